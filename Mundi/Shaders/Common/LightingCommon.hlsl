@@ -672,6 +672,12 @@ float3 CalculateSpotLight(
     Texture2D ShadowMap, SamplerComparisonState ShadowSampler,
     Texture2D<float2> VShadowMap, SamplerState VShadowSampler)
 {
+    // 해제된 슬롯(0으로 채워진 무효 라이트)은 건너뛴다. Direction이 0이라 normalize가 NaN이 된다
+    if (light.AttenuationRadius <= 0.0f)
+    {
+        return float3(0.0f, 0.0f, 0.0f);
+    }
+
     float3 lightVec = light.Position - worldPos;
     float distance = length(lightVec);
 
@@ -746,6 +752,12 @@ float3 CalculatePointLight(
     TextureCubeArray ShadowMapCube,
     SamplerComparisonState ShadowSampler)
 {
+    // 해제된 슬롯(0으로 채워진 무효 라이트)은 건너뛴다
+    if (light.AttenuationRadius <= 0.0f)
+    {
+        return float3(0.0f, 0.0f, 0.0f);
+    }
+
     float3 lightVec = light.Position - worldPos;
     float distance = length(lightVec);
 
@@ -6,6 +6,7 @@
 #include "ObjectIterator.h"
 #include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
+#include "AssetRegistry.h"
 #include "PathUtils.h"
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
 #include "Source/Runtime/Engine/Animation/AnimDataModel.h"
@@ -40,60 +41,47 @@ void UFbxLoader::PreLoad()
     }
 
     size_t LoadedCount = 0;
-    std::unordered_set<FWideString> ProcessedFiles;
 
-    for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
+    // 디렉토리를 직접 순회하지 않고 에셋 레지스트리 인덱스에서 조회 (경로는 이미 정규화/중복 제거됨)
+    TArray<const FAssetFileEntry*> FbxFiles;
+    FAssetRegistry::Get().FindFiles(FbxFiles, { ".fbx" });
+    for (const FAssetFileEntry* Entry : FbxFiles)
     {
-       if (!Entry.is_regular_file())
-          continue;
+       const FString& PathStr = Entry->Path;
 
-       const fs::path& Path = Entry.path();
+       // FBX Mesh 로드
+       USkeletalMesh* LoadedMesh = FbxLoader.LoadFbxMesh(PathStr);
+       ++LoadedCount;
 
-       FWideString Extension = Path.extension().wstring();
-       std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::towlower);
+       // 애니메이션 로드 (AnimStack이 있는 경우에만)
+       if (LoadedMesh && LoadedMesh->GetSkeleton())
+       {
+          const FSkeleton* TargetSkeleton = LoadedMesh->GetSkeleton();
 
-       if (Extension == L".fbx")
+          // LoadAllFbxAnimations가 내부에서 ResourceManager에 자동 등록
+          // 메시 추가는 나중에 일괄 처리 (95-115줄)
+          FbxLoader.LoadAllFbxAnimations(PathStr, *TargetSkeleton);
+       }
+       else
        {
-          // 변경 (wstring -> WideToUTF8 -> FString)
-          FWideString WPathStr = Path.wstring();
-          FString PathStr = NormalizePath(WideToUTF8(WPathStr));
+          // 메시가 없는 애니메이션 전용 FBX인 경우
+          // 표준 Canonical Mixamo 스켈레톤 사용
+          UE_LOG("FbxLoader: PreLoad: No mesh found in '%s', loading as animation-only FBX", PathStr.c_str());
 
-          if (ProcessedFiles.find(WPathStr) == ProcessedFiles.end())
+          FSkeleton* CanonicalSkeleton = FMixamoChainMapper::CreateCanonicalSkeleton();
+          if (CanonicalSkeleton)
           {
-             ProcessedFiles.insert(WPathStr);
-
-             // FBX Mesh 로드
-             USkeletalMesh* LoadedMesh = FbxLoader.LoadFbxMesh(PathStr);
-             ++LoadedCount;
-
-             // 애니메이션 로드 (AnimStack이 있는 경우에만)
-             if (LoadedMesh && LoadedMesh->GetSkeleton())
-             {
-                const FSkeleton* TargetSkeleton = LoadedMesh->GetSkeleton();
-
-                // LoadAllFbxAnimations가 내부에서 ResourceManager에 자동 등록
-                // 메시 추가는 나중에 일괄 처리 (95-115줄)
-                FbxLoader.LoadAllFbxAnimations(PathStr, *TargetSkeleton);
-             }
-             else
-             {
-                // 메시가 없는 애니메이션 전용 FBX인 경우
-                // 표준 Canonical Mixamo 스켈레톤 사용
-                UE_LOG("FbxLoader: PreLoad: No mesh found in '%s', loading as animation-only FBX", PathStr.c_str());
-
-                FSkeleton* CanonicalSkeleton = FMixamoChainMapper::CreateCanonicalSkeleton();
-                if (CanonicalSkeleton)
-                {
-                   FbxLoader.LoadAllFbxAnimations(PathStr, *CanonicalSkeleton);
-                   delete CanonicalSkeleton;
-                }
-             }
+             FbxLoader.LoadAllFbxAnimations(PathStr, *CanonicalSkeleton);
+             delete CanonicalSkeleton;
           }
        }
-       else if (Extension == L".dds" || Extension == L".jpg" || Extension == L".png")
-       {
-          UResourceManager::GetInstance().Load<UTexture>(WideToUTF8(Path.wstring()));
-       }
+    }
+
+    TArray<const FAssetFileEntry*> TextureFiles;
+    FAssetRegistry::Get().FindFiles(TextureFiles, { ".dds", ".jpg", ".png" });
+    for (const FAssetFileEntry* Entry : TextureFiles)
+    {
+       UResourceManager::GetInstance().Load<UTexture>(Entry->Path);
     }
     RESOURCE.SetSkeletalMeshes();
     RESOURCE.SetAnimSequences();
@@ -1577,6 +1565,7 @@ void UFbxLoader::EnsureSingleRootBone(FSkeletalMeshData& MeshData)
 
 TArray<UAnimSequence*> UFbxLoader::LoadAllFbxAnimations(const FString& FilePath, const FSkeleton& TargetSkeleton)
 {
+	MEM_SCOPE(Animation);
 	TArray<UAnimSequence*> Results;
 
 	// 1. 경로 정규화
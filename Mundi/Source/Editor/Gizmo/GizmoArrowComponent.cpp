@@ -153,13 +153,16 @@ void UGizmoArrowComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		// 머티리얼과 셰이더는 루프 밖에서 이미 결정되었습니다.
 		FMeshBatchElement BatchElement;
 
-		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(MaterialToUse->GetShaderMacros());
+		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(FShaderPermutation::WithMacroSet(0, MaterialToUse->GetShaderMacroSetId()));
 
 		// --- 정렬 키 ---
 		BatchElement.VertexShader = ShaderVariant->VertexShader;
 		BatchElement.PixelShader = ShaderVariant->PixelShader;
 		BatchElement.InputLayout = ShaderVariant->InputLayout;
 		BatchElement.Material = MaterialToUse;
+		BatchElement.MaterialSortId = MaterialToUse->GetSortId();
+		BatchElement.MeshSortId = StaticMesh->GetSortId();
+		BatchElement.ShaderSortId = ShaderVariant->SortId;
 		BatchElement.VertexBuffer = StaticMesh->GetVertexBuffer();
 		BatchElement.IndexBuffer = StaticMesh->GetIndexBuffer();
 		BatchElement.VertexStride = StaticMesh->GetVertexStride();
@@ -7,6 +7,7 @@
 #include "Enums.h"
 #include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
+#include "AssetRegistry.h"
 #include <filesystem>
 #include <unordered_set>
 
@@ -227,33 +228,21 @@ void FObjManager::Preload()
 	}
 
 	size_t LoadedCount = 0;
-	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
 
-	for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
+	// 디렉토리를 직접 순회하지 않고 에셋 레지스트리 인덱스에서 확장자로 조회 (경로는 이미 정규화/중복 제거됨)
+	TArray<const FAssetFileEntry*> MeshFiles;
+	FAssetRegistry::Get().FindFiles(MeshFiles, { ".obj", ".fbx" });
+	for (const FAssetFileEntry* Entry : MeshFiles)
 	{
-		if (!Entry.is_regular_file())
-			continue;
-
-		const fs::path& Path = Entry.path();
-		FString Extension = Path.extension().string();
-		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-
-		if (Extension == ".obj"|| Extension == ".fbx")
-		{
-			FString PathStr = NormalizePath(Path.string());
+		LoadObjStaticMesh(Entry->Path);
+		++LoadedCount;
+	}
 
-			// 이미 처리된 파일인지 확인
-			if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
-			{
-				ProcessedFiles.insert(PathStr);
-				LoadObjStaticMesh(PathStr);
-				++LoadedCount;
-			}
-		}
-		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
-		{
-			UResourceManager::GetInstance().Load<UTexture>(Path.string()); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
-		}
+	TArray<const FAssetFileEntry*> TextureFiles;
+	FAssetRegistry::Get().FindFiles(TextureFiles, { ".dds", ".jpg", ".png" });
+	for (const FAssetFileEntry* Entry : TextureFiles)
+	{
+		UResourceManager::GetInstance().Load<UTexture>(Entry->Path); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
 	}
 
 	// 4) 모든 StaticMeshs 가져오기
@@ -0,0 +1,100 @@
+﻿#include "pch.h"
+#include "StressSceneGenerator.h"
+#include "World.h"
+#include "Actor.h"
+#include "StaticMeshActor.h"
+#include "StaticMeshComponent.h"
+#include "PlatformTime.h"
+
+UWorld* FStressSceneGenerator::OwnerWorld = nullptr;
+TArray<AActor*> FStressSceneGenerator::SpawnedActors;
+
+int32 FStressSceneGenerator::SpawnActors(UWorld* World, int32 Count, bool bWithMesh, double& OutElapsedMs)
+{
+	OutElapsedMs = 0.0;
+	if (!World || Count <= 0)
+	{
+		return 0;
+	}
+
+	// 다른 월드에서 만든 목록은 이미 무효 (월드 소멸 시 함께 삭제됨)
+	if (OwnerWorld != World)
+	{
+		SpawnedActors.Empty();
+		OwnerWorld = World;
+	}
+
+	const int32 GridWidth = std::max(1, static_cast<int32>(std::ceil(std::sqrt(static_cast<float>(Count)))));
+	const float Spacing = 2.0f;
+	const FString MeshPath = GDataDir + "/Model/Cube.obj";
+
+	SpawnedActors.Reserve(SpawnedActors.Num() + Count);
+
+	int32 Spawned = 0;
+	const uint64 Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVector Location((i % GridWidth) * Spacing, (i / GridWidth) * Spacing, 0.0f);
+
+		AActor* NewActor = nullptr;
+		if (bWithMesh)
+		{
+			AStaticMeshActor* MeshActor = World->SpawnActor<AStaticMeshActor>();
+			if (MeshActor && MeshActor->GetStaticMeshComponent())
+			{
+				MeshActor->GetStaticMeshComponent()->SetStaticMesh(MeshPath);
+			}
+			NewActor = MeshActor;
+		}
+		else
+		{
+			NewActor = World->SpawnActor<AActor>();
+		}
+
+		if (!NewActor)
+		{
+			break;
+		}
+
+		NewActor->ObjectName = FName(World->GenerateUniqueActorName("Stress"));
+		NewActor->SetActorLocation(Location);
+		SpawnedActors.Add(NewActor);
+		++Spawned;
+	}
+	OutElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	UE_LOG("StressScene: Spawned %d %s actors in %.2f ms", Spawned, bWithMesh ? "mesh" : "empty", OutElapsedMs);
+	return Spawned;
+}
+
+int32 FStressSceneGenerator::Clear(UWorld* World)
+{
+	if (!World || OwnerWorld != World)
+	{
+		SpawnedActors.Empty();
+		OwnerWorld = nullptr;
+		return 0;
+	}
+
+	// 사용자가 이미 지운 액터는 건너뛰기 위해 현재 월드 액터 집합과 대조
+	TSet<AActor*> LiveActors;
+	LiveActors.reserve(World->GetActors().Num());
+	for (AActor* Actor : World->GetActors())
+	{
+		LiveActors.Add(Actor);
+	}
+
+	int32 Destroyed = 0;
+	for (AActor* Actor : SpawnedActors)
+	{
+		if (LiveActors.Contains(Actor) && !Actor->IsPendingDestroy())
+		{
+			Actor->Destroy();
+			++Destroyed;
+		}
+	}
+	SpawnedActors.Empty();
+
+	UE_LOG("StressScene: Destroy requested for %d actors", Destroyed);
+	return Destroyed;
+}
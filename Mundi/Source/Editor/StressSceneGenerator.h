@@ -0,0 +1,32 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class UWorld;
+class AActor;
+
+/**
+ * StressSceneGenerator
+ * - 아웃라이너/월드 관리 비용 측정을 위해 대량의 액터를 격자로 스폰하고 정리한다
+ * - 콘솔: STRESS ACTORS <N> [MESH], STRESS CLEAR
+ */
+class FStressSceneGenerator
+{
+public:
+	/**
+	 * @brief Count개의 액터를 격자 배치로 스폰
+	 * @param bWithMesh true면 큐브 스태틱 메시 액터, false면 컴포넌트 없는 빈 액터
+	 * @param OutElapsedMs 스폰에 걸린 시간
+	 * @return 실제로 스폰된 개수
+	 */
+	static int32 SpawnActors(UWorld* World, int32 Count, bool bWithMesh, double& OutElapsedMs);
+
+	/**
+	 * @brief 이 생성기로 만든 액터 중 아직 살아있는 것을 모두 Destroy (다음 프레임에 일괄 삭제됨)
+	 * @return Destroy 요청한 개수
+	 */
+	static int32 Clear(UWorld* World);
+
+private:
+	static UWorld* OwnerWorld;
+	static TArray<AActor*> SpawnedActors;
+};
@@ -0,0 +1,983 @@
+﻿#include "pch.h"
+#include "AssetRegistry.h"
+#include "WindowsBinReader.h"
+#include "WindowsBinWriter.h"
+#include "PlatformTime.h"
+#include <filesystem>
+
+namespace
+{
+	constexpr uint32 AssetRegistryCacheMagic = 0x47455241;	// 'AREG'
+	constexpr uint32 AssetRegistryCacheVersion = 2;
+
+	int64 GetLastWriteTime(const fs::path& InPath)
+	{
+		std::error_code Ec;
+		const auto Time = fs::last_write_time(InPath, Ec);
+		return Ec ? 0 : static_cast<int64>(Time.time_since_epoch().count());
+	}
+
+	// 디렉토리 열거 중 캐시된 시각 (파일별 stat 없음)
+	int64 GetLastWriteTime(const fs::directory_entry& InEntry)
+	{
+		std::error_code Ec;
+		const auto Time = InEntry.last_write_time(Ec);
+		return Ec ? 0 : static_cast<int64>(Time.time_since_epoch().count());
+	}
+
+	uint64 GetFileSize(const fs::path& InPath)
+	{
+		std::error_code Ec;
+		const uintmax_t Size = fs::file_size(InPath, Ec);
+		return Ec ? 0 : static_cast<uint64>(Size);
+	}
+
+	FString GetCacheFilePath()
+	{
+		return GCacheDir + "/AssetRegistry.bin";
+	}
+
+	FString GetLeafName(const FString& InPath)
+	{
+		const size_t Slash = InPath.find_last_of('/');
+		return Slash == FString::npos ? InPath : InPath.substr(Slash + 1);
+	}
+}
+
+FAssetRegistry& FAssetRegistry::Get()
+{
+	static FAssetRegistry Instance;
+	return Instance;
+}
+
+FAssetRegistry::~FAssetRegistry()
+{
+	StopWatching();
+}
+
+void FAssetRegistry::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+	bInitialized = true;
+	RootPath = GDataDir;
+
+	FScopeCycleCounter Timer;
+	auto NewState = std::make_shared<FAssetRegistryState>();
+	const bool bFromCache = LoadCache(*NewState);
+	bool bDirty = true;
+	if (bFromCache)
+	{
+		// 캐시 이후 바뀐 디렉토리만 다시 읽는다
+		bDirty = RefreshState(*NewState, false);
+	}
+	else
+	{
+		FullScan(*NewState);
+	}
+	NewState->Generation = 1;
+	SavedGeneration = bDirty ? 0 : NewState->Generation;
+
+	{
+		std::lock_guard<std::mutex> Lock(PublishMutex);
+		PublishedState = NewState;
+	}
+	AdoptPublishedState();
+
+	UE_LOG("AssetRegistry: %s %s (%d files, %d dirs) in %.2f ms", bFromCache ? "Loaded cache for" : "Scanned",
+		RootPath.c_str(), GetNumFiles(), GetNumDirectories(), Timer.Finish());
+
+	if (GetGeneration() != SavedGeneration)
+	{
+		SaveCache(*State);
+	}
+}
+
+void FAssetRegistry::Shutdown()
+{
+	StopWatching();
+	if (bInitialized)
+	{
+		AdoptPublishedState();
+		if (State && State->Generation != SavedGeneration)
+		{
+			SaveCache(*State);
+		}
+	}
+}
+
+FString FAssetRegistry::ToLower(const FString& InStr)
+{
+	FString Result = InStr;
+	std::transform(Result.begin(), Result.end(), Result.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	return Result;
+}
+
+FString FAssetRegistry::ToRegistryPath(const FString& InPath)
+{
+	FString Result = NormalizePath(InPath);
+
+	// 절대 경로면 작업 디렉토리 기준 상대 경로로
+	const fs::path AsPath(UTF8ToWide(Result));
+	if (AsPath.is_absolute())
+	{
+		std::error_code Ec;
+		const fs::path Relative = fs::relative(AsPath, fs::current_path(), Ec);
+		if (!Ec && !Relative.empty())
+		{
+			Result = NormalizePath(WideToUTF8(Relative.wstring()));
+		}
+	}
+
+	while (Result.rfind("./", 0) == 0)
+	{
+		Result.erase(0, 2);
+	}
+	while (Result.size() > 1 && Result.back() == '/')
+	{
+		Result.pop_back();
+	}
+	return Result;
+}
+
+EAssetFileType FAssetRegistry::GetFileType(const FString& InExtension)
+{
+	if (InExtension == ".obj" || InExtension == ".fbx")
+		return EAssetFileType::Mesh;
+	if (InExtension == ".png" || InExtension == ".jpg" || InExtension == ".jpeg" || InExtension == ".dds" || InExtension == ".tga")
+		return EAssetFileType::Texture;
+	if (InExtension == ".anim" || InExtension == ".blend2d" || InExtension == ".statemachine")
+		return EAssetFileType::Animation;
+	if (InExtension == ".prefab")
+		return EAssetFileType::Prefab;
+	if (InExtension == ".mat" || InExtension == ".mtl")
+		return EAssetFileType::Material;
+	if (InExtension == ".wav" || InExtension == ".mp3" || InExtension == ".ogg")
+		return EAssetFileType::Sound;
+	if (InExtension == ".hlsl" || InExtension == ".hlsli" || InExtension == ".fx")
+		return EAssetFileType::Shader;
+	if (InExtension == ".level" || InExtension == ".scene" || InExtension == ".json" || InExtension == ".lua")
+		return EAssetFileType::Data;
+	return EAssetFileType::Other;
+}
+
+void FAssetRegistry::FillFileEntry(FAssetFileEntry& OutEntry, const FString& InPath, const FString& InFileName, uint64 InFileSize, int64 InLastWriteTime)
+{
+	OutEntry.Path = InPath;
+	OutEntry.FileName = InFileName;
+	OutEntry.Extension = ToLower(WideToUTF8(fs::path(UTF8ToWide(InFileName)).extension().wstring()));
+	OutEntry.Type = GetFileType(OutEntry.Extension);
+	OutEntry.FileSize = InFileSize;
+	OutEntry.LastWriteTime = InLastWriteTime;
+
+	uint64 Key = std::hash<FString>{}(InPath);
+	Key ^= static_cast<uint64>(InFileSize) + 0x9e3779b97f4a7c15ull + (Key << 6) + (Key >> 2);
+	Key ^= static_cast<uint64>(InLastWriteTime) + 0x9e3779b97f4a7c15ull + (Key << 6) + (Key >> 2);
+	OutEntry.ThumbnailKey = Key;
+}
+
+// ──────────────────────────────────────────────
+// 상태 스냅샷
+// ──────────────────────────────────────────────
+
+const FAssetDirectoryBucket* FAssetRegistryState::FindBucket(const FString& InDirPath) const
+{
+	const std::shared_ptr<FAssetDirectoryBucket>* Bucket = Directories.Find(InDirPath);
+	return Bucket ? Bucket->get() : nullptr;
+}
+
+const FAssetFileEntry* FAssetRegistryState::FindFile(const FString& InPath) const
+{
+	const size_t Slash = InPath.find_last_of('/');
+	if (Slash == FString::npos)
+	{
+		return nullptr;
+	}
+	const FAssetDirectoryBucket* Bucket = FindBucket(InPath.substr(0, Slash));
+	return Bucket ? Bucket->Files.Find(InPath) : nullptr;
+}
+
+const TArray<FString>* FAssetRegistryState::FindPathsByName(const FString& InLowerName) const
+{
+	const std::shared_ptr<FNameShard>& Shard = FileNameShards[GetNameShardIndex(InLowerName)];
+	return Shard ? Shard->Find(InLowerName) : nullptr;
+}
+
+uint32 FAssetRegistryState::GetNameShardIndex(const FString& InLowerName)
+{
+	return static_cast<uint32>(std::hash<FString>{}(InLowerName) % NumNameShards);
+}
+
+FAssetDirectoryBucket* FAssetRegistry::EditBucket(FAssetRegistryState& InOutState, const FString& InDirPath)
+{
+	std::shared_ptr<FAssetDirectoryBucket>* Bucket = InOutState.Directories.Find(InDirPath);
+	if (!Bucket)
+	{
+		return nullptr;
+	}
+	// 이전 세대도 가리키고 있으면 복사본으로 교체. 게시 전 상태만 참조하는 버킷(use_count 1)은 이번 변경에서 이미 복사한 것
+	if (Bucket->use_count() > 1)
+	{
+		*Bucket = std::make_shared<FAssetDirectoryBucket>(**Bucket);
+	}
+	return Bucket->get();
+}
+
+FAssetRegistryState::FNameShard& FAssetRegistry::EditNameShard(FAssetRegistryState& InOutState, const FString& InLowerName)
+{
+	std::shared_ptr<FAssetRegistryState::FNameShard>& Shard = InOutState.FileNameShards[FAssetRegistryState::GetNameShardIndex(InLowerName)];
+	if (!Shard)
+	{
+		Shard = std::make_shared<FAssetRegistryState::FNameShard>();
+	}
+	else if (Shard.use_count() > 1)
+	{
+		Shard = std::make_shared<FAssetRegistryState::FNameShard>(*Shard);
+	}
+	return *Shard;
+}
+
+// ──────────────────────────────────────────────
+// 상태 게시/채택
+// ──────────────────────────────────────────────
+
+FAssetRegistry::FStatePtr FAssetRegistry::GetPublishedState() const
+{
+	std::lock_guard<std::mutex> Lock(PublishMutex);
+	return PublishedState;
+}
+
+void FAssetRegistry::AdoptPublishedState()
+{
+	FStatePtr Latest = GetPublishedState();
+	if (Latest == State)
+	{
+		return;
+	}
+	State = std::move(Latest);
+	MissingFileNames.Empty();
+}
+
+template<typename MutatorType>
+bool FAssetRegistry::MutateState(MutatorType&& Mutator, bool bAdoptOnMainThread)
+{
+	std::lock_guard<std::mutex> WriteLock(WriteMutex);
+
+	FStatePtr Base = GetPublishedState();
+	auto NewState = Base ? std::make_shared<FAssetRegistryState>(*Base) : std::make_shared<FAssetRegistryState>();
+	if (!Mutator(*NewState))
+	{
+		return false;
+	}
+
+	NewState->Generation = (Base ? Base->Generation : 0) + 1;
+	{
+		std::lock_guard<std::mutex> Lock(PublishMutex);
+		PublishedState = NewState;
+	}
+	if (bAdoptOnMainThread)
+	{
+		AdoptPublishedState();
+	}
+	return true;
+}
+
+bool FAssetRegistry::Tick()
+{
+	const uint32 PrevGeneration = GetGeneration();
+	AdoptPublishedState();
+	return GetGeneration() != PrevGeneration;
+}
+
+// ──────────────────────────────────────────────
+// 스캔
+// ──────────────────────────────────────────────
+
+void FAssetRegistry::FullScan(FAssetRegistryState& InOutState) const
+{
+	InOutState.Directories.Empty();
+	for (std::shared_ptr<FAssetRegistryState::FNameShard>& Shard : InOutState.FileNameShards)
+	{
+		Shard.reset();
+	}
+	InOutState.NumFiles = 0;
+
+	std::error_code Ec;
+	if (fs::is_directory(fs::path(UTF8ToWide(RootPath)), Ec))
+	{
+		ScanDirectoryRecursive(InOutState, RootPath);
+	}
+}
+
+void FAssetRegistry::ScanDirectoryRecursive(FAssetRegistryState& InOutState, const FString& InDirPath) const
+{
+	auto Bucket = std::make_shared<FAssetDirectoryBucket>();
+	Bucket->Directory.Path = InDirPath;
+	Bucket->Directory.Name = GetLeafName(InDirPath);
+	InOutState.Directories[InDirPath] = std::move(Bucket);
+	RescanDirectory(InOutState, InDirPath, true, false);
+}
+
+bool FAssetRegistry::RescanDirectory(FAssetRegistryState& InOutState, const FString& InDirPath, bool bForce, bool bCheckFiles) const
+{
+	// 바뀐 것이 없으면 버킷을 복사하지 않도록 먼저 읽기 전용으로 비교한다
+	const FAssetDirectoryBucket* Existing = InOutState.FindBucket(InDirPath);
+	if (!Existing)
+	{
+		return false;
+	}
+
+	const fs::path DirPath(UTF8ToWide(Existing->Directory.Path));
+	const int64 DirTime = GetLastWriteTime(DirPath);
+	if (!bForce && !bCheckFiles && DirTime != 0 && DirTime == Existing->Directory.LastWriteTime)
+	{
+		return false;
+	}
+
+	TArray<FString> NewFiles;
+	TArray<FString> NewSubDirs;
+	TArray<FAssetFileEntry> AddedFiles;
+
+	// 파일 크기/시각은 열거 결과에 캐시된 값을 쓴다 (디렉토리 시각이 같아도 내용 변경은 여기서 잡힌다)
+	std::error_code Ec;
+	for (fs::directory_iterator It(DirPath, Ec), End; !Ec && It != End; It.increment(Ec))
+	{
+		const fs::directory_entry& Entry = *It;
+		const FString Name = WideToUTF8(Entry.path().filename().wstring());
+		const FString ChildPath = Existing->Directory.Path + "/" + Name;
+
+		std::error_code EntryEc;
+		if (Entry.is_directory(EntryEc))
+		{
+			NewSubDirs.Add(ChildPath);
+		}
+		else if (Entry.is_regular_file(EntryEc))
+		{
+			NewFiles.Add(ChildPath);
+
+			const uint64 FileSize = static_cast<uint64>(Entry.file_size(EntryEc));
+			const int64 FileTime = GetLastWriteTime(Entry);
+			const FAssetFileEntry* Known = Existing->Files.Find(ChildPath);
+			if (!Known || Known->FileSize != FileSize || Known->LastWriteTime != FileTime)
+			{
+				FAssetFileEntry File;
+				FillFileEntry(File, ChildPath, Name, FileSize, FileTime);
+				AddedFiles.Add(File);
+			}
+		}
+	}
+	NewFiles.Sort();
+	NewSubDirs.Sort();
+
+	const bool bChanged = AddedFiles.Num() > 0 || NewFiles != Existing->Directory.Files || NewSubDirs != Existing->Directory.SubDirectories ||
+		DirTime != Existing->Directory.LastWriteTime;
+	if (!bChanged)
+	{
+		return false;
+	}
+
+	// 여기서부터 이 디렉토리 버킷만 복사해서 고친다 (Existing은 더 이상 쓰지 않음)
+	FAssetDirectoryBucket* Bucket = EditBucket(InOutState, InDirPath);
+	FAssetDirectoryEntry& Dir = Bucket->Directory;
+	Dir.LastWriteTime = DirTime;
+
+	// 사라진 파일/디렉토리 제거 (목록을 먼저 교체하고 이전 목록과 비교)
+	const TArray<FString> OldFiles = std::move(Dir.Files);
+	const TArray<FString> OldSubDirs = std::move(Dir.SubDirectories);
+	Dir.Files = NewFiles;
+	Dir.SubDirectories = NewSubDirs;
+
+	TSet<FString> NewFileSet(NewFiles.begin(), NewFiles.end());
+	for (const FString& OldFile : OldFiles)
+	{
+		if (!NewFileSet.Contains(OldFile))
+		{
+			RemoveFile(InOutState, *Bucket, OldFile);
+		}
+	}
+	for (const FAssetFileEntry& File : AddedFiles)
+	{
+		AddFile(InOutState, *Bucket, File);
+	}
+
+	// 하위 디렉토리 추가/삭제는 Directories 맵만 바꾸므로 Bucket 포인터는 그대로 유효
+	TSet<FString> NewDirSet(NewSubDirs.begin(), NewSubDirs.end());
+	for (const FString& OldDir : OldSubDirs)
+	{
+		if (!NewDirSet.Contains(OldDir))
+		{
+			RemoveDirectoryRecursive(InOutState, OldDir);
+		}
+	}
+	for (const FString& SubDir : NewSubDirs)
+	{
+		if (!InOutState.Directories.Contains(SubDir))
+		{
+			ScanDirectoryRecursive(InOutState, SubDir);
+		}
+	}
+
+	return true;
+}
+
+void FAssetRegistry::RemoveDirectoryRecursive(FAssetRegistryState& InOutState, const FString& InDirPath)
+{
+	const FAssetDirectoryBucket* Bucket = InOutState.FindBucket(InDirPath);
+	if (!Bucket)
+	{
+		return;
+	}
+
+	const TArray<FString> SubDirs = Bucket->Directory.SubDirectories;
+	for (const auto& Pair : Bucket->Files)
+	{
+		RemoveFromNameIndex(InOutState, Pair.second);
+	}
+	InOutState.NumFiles -= Bucket->Files.Num();
+	InOutState.Directories.Remove(InDirPath);
+
+	for (const FString& SubDir : SubDirs)
+	{
+		RemoveDirectoryRecursive(InOutState, SubDir);
+	}
+}
+
+void FAssetRegistry::AddFile(FAssetRegistryState& InOutState, FAssetDirectoryBucket& InOutBucket, const FAssetFileEntry& InEntry)
+{
+	const bool bIsNew = !InOutBucket.Files.Contains(InEntry.Path);
+	InOutBucket.Files[InEntry.Path] = InEntry;
+
+	if (bIsNew)
+	{
+		const FString LowerName = ToLower(InEntry.FileName);
+		EditNameShard(InOutState, LowerName)[LowerName].Add(InEntry.Path);
+		++InOutState.NumFiles;
+	}
+}
+
+void FAssetRegistry::RemoveFile(FAssetRegistryState& InOutState, FAssetDirectoryBucket& InOutBucket, const FString& InPath)
+{
+	const FAssetFileEntry* Entry = InOutBucket.Files.Find(InPath);
+	if (!Entry)
+	{
+		return;
+	}
+
+	RemoveFromNameIndex(InOutState, *Entry);
+	InOutBucket.Files.Remove(InPath);
+	--InOutState.NumFiles;
+}
+
+void FAssetRegistry::RemoveFromNameIndex(FAssetRegistryState& InOutState, const FAssetFileEntry& InEntry)
+{
+	const FString LowerName = ToLower(InEntry.FileName);
+	FAssetRegistryState::FNameShard& Shard = EditNameShard(InOutState, LowerName);
+	if (TArray<FString>* Paths = Shard.Find(LowerName))
+	{
+		Paths->Remove(InEntry.Path);
+		if (Paths->IsEmpty())
+		{
+			Shard.Remove(LowerName);
+		}
+	}
+}
+
+bool FAssetRegistry::RefreshState(FAssetRegistryState& InOutState, bool bCheckFiles) const
+{
+	// 루트가 없어졌거나 새로 생겼으면 전체 재구성
+	std::error_code Ec;
+	const bool bRootExists = fs::is_directory(fs::path(UTF8ToWide(RootPath)), Ec);
+	if (bRootExists != InOutState.Directories.Contains(RootPath))
+	{
+		FullScan(InOutState);
+		return true;
+	}
+
+	// 재스캔 중 하위 디렉토리가 추가/삭제되므로 경로 목록을 먼저 복사
+	TArray<FString> DirPaths;
+	DirPaths.Reserve(InOutState.Directories.Num());
+	for (const auto& Pair : InOutState.Directories)
+	{
+		DirPaths.Add(Pair.first);
+	}
+
+	bool bChanged = false;
+	for (const FString& DirPath : DirPaths)
+	{
+		bChanged |= RescanDirectory(InOutState, DirPath, false, bCheckFiles);
+	}
+	return bChanged;
+}
+
+bool FAssetRegistry::HasChangesOnDisk(const FAssetRegistryState& InState) const
+{
+	std::error_code Ec;
+	const bool bRootExists = fs::is_directory(fs::path(UTF8ToWide(RootPath)), Ec);
+	if (bRootExists != InState.Directories.Contains(RootPath))
+	{
+		return true;
+	}
+
+	for (const auto& Pair : InState.Directories)
+	{
+		const FAssetDirectoryBucket& Bucket = *Pair.second;
+		const fs::path DirPath(UTF8ToWide(Bucket.Directory.Path));
+		if (GetLastWriteTime(DirPath) != Bucket.Directory.LastWriteTime)
+		{
+			return true;
+		}
+
+		// 파일 내용 변경은 디렉토리 시각을 바꾸지 않으므로 열거 결과의 크기/시각과 비교 (디렉토리당 열거 1회)
+		int32 NumSeen = 0;
+		for (fs::directory_iterator It(DirPath, Ec), End; !Ec && It != End; It.increment(Ec))
+		{
+			std::error_code EntryEc;
+			if (!It->is_regular_file(EntryEc))
+			{
+				continue;
+			}
+			const FAssetFileEntry* File = Bucket.Files.Find(Bucket.Directory.Path + "/" + WideToUTF8(It->path().filename().wstring()));
+			if (!File || File->FileSize != static_cast<uint64>(It->file_size(EntryEc)) || File->LastWriteTime != GetLastWriteTime(*It))
+			{
+				return true;
+			}
+			++NumSeen;
+		}
+		if (NumSeen != Bucket.Files.Num())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// ──────────────────────────────────────────────
+// 동기 갱신
+// ──────────────────────────────────────────────
+
+bool FAssetRegistry::Refresh()
+{
+	if (!bInitialized)
+	{
+		Initialize();
+		return true;
+	}
+	return MutateState([this](FAssetRegistryState& S) { return RefreshState(S, false); }, true);
+}
+
+bool FAssetRegistry::RefreshDirectory(const FString& InPath)
+{
+	Initialize();
+
+	const FString DirPath = ToRegistryPath(InPath);
+	if (!State || !State->Directories.Contains(DirPath))
+	{
+		return Refresh();
+	}
+	return MutateState([&](FAssetRegistryState& S) { return RescanDirectory(S, DirPath, false, true); }, true);
+}
+
+void FAssetRegistry::NotifyFileAdded(const FString& InPath)
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	const FString Path = ToRegistryPath(InPath);
+	const size_t Slash = Path.find_last_of('/');
+	if (Slash == FString::npos)
+	{
+		return;
+	}
+
+	const FString DirPath = Path.substr(0, Slash);
+	if (!State || !State->Directories.Contains(DirPath))
+	{
+		// 인덱스 밖이거나 새 디렉토리: 디렉토리 시각 비교로 처리
+		Refresh();
+		return;
+	}
+
+	MutateState([&](FAssetRegistryState& S)
+	{
+		const fs::path FilePath(UTF8ToWide(Path));
+		std::error_code Ec;
+		if (!fs::is_regular_file(FilePath, Ec))
+		{
+			return false;
+		}
+
+		// 이 디렉토리 버킷만 복사된다
+		FAssetDirectoryBucket* Bucket = EditBucket(S, DirPath);
+		if (!Bucket)
+		{
+			return false;
+		}
+
+		FAssetDirectoryEntry& Dir = Bucket->Directory;
+		if (!Bucket->Files.Contains(Path))
+		{
+			Dir.Files.insert(std::lower_bound(Dir.Files.begin(), Dir.Files.end(), Path), Path);
+		}
+
+		FAssetFileEntry File;
+		FillFileEntry(File, Path, Path.substr(Slash + 1), GetFileSize(FilePath), GetLastWriteTime(FilePath));
+		AddFile(S, *Bucket, File);
+		Dir.LastWriteTime = GetLastWriteTime(FilePath.parent_path());
+		return true;
+	}, true);
+}
+
+void FAssetRegistry::NotifyFileRemoved(const FString& InPath)
+{
+	const FString Path = ToRegistryPath(InPath);
+	if (!State || !State->FindFile(Path))
+	{
+		return;
+	}
+
+	MutateState([&](FAssetRegistryState& S)
+	{
+		FAssetDirectoryBucket* Bucket = EditBucket(S, Path.substr(0, Path.find_last_of('/')));
+		if (!Bucket)
+		{
+			return false;
+		}
+		Bucket->Directory.Files.Remove(Path);
+		Bucket->Directory.LastWriteTime = GetLastWriteTime(fs::path(UTF8ToWide(Bucket->Directory.Path)));
+		RemoveFile(S, *Bucket, Path);
+		return true;
+	}, true);
+}
+
+// ──────────────────────────────────────────────
+// 백그라운드 폴링
+// ──────────────────────────────────────────────
+
+void FAssetRegistry::StartWatching(float InPollIntervalSeconds)
+{
+	Initialize();
+	if (WatchThread.joinable())
+	{
+		return;
+	}
+
+	PollIntervalSeconds = std::max(0.1f, InPollIntervalSeconds);
+	bStopWatching = false;
+	bRefreshRequested = false;
+	WatchThread = std::thread(&FAssetRegistry::WatchThreadMain, this);
+}
+
+void FAssetRegistry::StopWatching()
+{
+	if (!WatchThread.joinable())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(WatchMutex);
+		bStopWatching = true;
+	}
+	WatchCondition.notify_all();
+	WatchThread.join();
+}
+
+void FAssetRegistry::RequestRefresh()
+{
+	if (!WatchThread.joinable())
+	{
+		Refresh();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(WatchMutex);
+		bRefreshRequested = true;
+	}
+	WatchCondition.notify_all();
+}
+
+void FAssetRegistry::WatchThreadMain()
+{
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> Lock(WatchMutex);
+			WatchCondition.wait_for(Lock, std::chrono::duration<float>(PollIntervalSeconds),
+				[this]() { return bStopWatching || bRefreshRequested; });
+			if (bStopWatching)
+			{
+				return;
+			}
+			bRefreshRequested = false;
+		}
+
+		// 변경이 없으면 상태를 복사하지 않는다 (시각 비교만)
+		FStatePtr Current = GetPublishedState();
+		if (!Current || !HasChangesOnDisk(*Current))
+		{
+			continue;
+		}
+
+		MutateState([this](FAssetRegistryState& S) { return RefreshState(S, true); }, false);
+	}
+}
+
+// ──────────────────────────────────────────────
+// 조회 (메인 스레드 상태만 읽음)
+// ──────────────────────────────────────────────
+
+const FAssetFileEntry* FAssetRegistry::FindFileByName(const FString& InFileName)
+{
+	Initialize();
+
+	const FString LowerName = ToLower(InFileName);
+	if (MissingFileNames.Contains(LowerName))
+	{
+		return nullptr;
+	}
+
+	if (const TArray<FString>* Paths = State->FindPathsByName(LowerName))
+	{
+		if (!Paths->IsEmpty())
+		{
+			return State->FindFile((*Paths)[0]);
+		}
+	}
+
+	MissingFileNames.Add(LowerName);
+	return nullptr;
+}
+
+void FAssetRegistry::FindAllFilesByName(const FString& InFileName, TArray<const FAssetFileEntry*>& OutFiles)
+{
+	OutFiles.Empty();
+	if (!FindFileByName(InFileName))
+	{
+		return;
+	}
+
+	for (const FString& Path : *State->FindPathsByName(ToLower(InFileName)))
+	{
+		if (const FAssetFileEntry* Entry = State->FindFile(Path))
+		{
+			OutFiles.Add(Entry);
+		}
+	}
+}
+
+const FAssetFileEntry* FAssetRegistry::FindFile(const FString& InPath) const
+{
+	if (!State)
+	{
+		return nullptr;
+	}
+	// 이미 레지스트리 경로면 정규화 생략
+	if (const FAssetFileEntry* Found = State->FindFile(InPath))
+	{
+		return Found;
+	}
+	return State->FindFile(ToRegistryPath(InPath));
+}
+
+const FAssetDirectoryEntry* FAssetRegistry::FindDirectory(const FString& InPath) const
+{
+	if (!State)
+	{
+		return nullptr;
+	}
+	const FAssetDirectoryBucket* Bucket = State->FindBucket(InPath);
+	if (!Bucket)
+	{
+		Bucket = State->FindBucket(ToRegistryPath(InPath));
+	}
+	return Bucket ? &Bucket->Directory : nullptr;
+}
+
+void FAssetRegistry::FindFiles(TArray<const FAssetFileEntry*>& OutFiles, const TArray<FString>& InExtensions, const FString& InDirectory) const
+{
+	OutFiles.Empty();
+	if (!State)
+	{
+		return;
+	}
+
+	FString Prefix = InDirectory.empty() ? FString() : ToRegistryPath(InDirectory) + "/";
+	for (const auto& DirPair : State->Directories)
+	{
+		// 디렉토리 단위로 걸러낸다 (InDirectory 자신 또는 그 하위)
+		const FAssetDirectoryBucket& Bucket = *DirPair.second;
+		if (!Prefix.empty() && (Bucket.Directory.Path + "/").compare(0, Prefix.size(), Prefix) != 0)
+		{
+			continue;
+		}
+
+		for (const auto& Pair : Bucket.Files)
+		{
+			const FAssetFileEntry& Entry = Pair.second;
+			if (!InExtensions.IsEmpty() && std::find(InExtensions.begin(), InExtensions.end(), Entry.Extension) == InExtensions.end())
+			{
+				continue;
+			}
+			OutFiles.Add(&Entry);
+		}
+	}
+
+	// 해시 순서 대신 경로 순으로 (로딩 순서를 결정적으로)
+	std::sort(OutFiles.begin(), OutFiles.end(), [](const FAssetFileEntry* A, const FAssetFileEntry* B) { return A->Path < B->Path; });
+}
+
+// ──────────────────────────────────────────────
+// 캐시 파일
+// ──────────────────────────────────────────────
+
+bool FAssetRegistry::LoadCache(FAssetRegistryState& OutState) const
+{
+	const FString CachePath = GetCacheFilePath();
+	std::error_code Ec;
+	if (!fs::exists(fs::path(UTF8ToWide(CachePath)), Ec))
+	{
+		return false;
+	}
+
+	try
+	{
+		FWindowsBinReader Reader(CachePath);
+		if (!Reader.IsOpen())
+		{
+			return false;
+		}
+
+		uint32 Magic = 0, Version = 0;
+		Reader << Magic << Version;
+		if (Magic != AssetRegistryCacheMagic || Version != AssetRegistryCacheVersion)
+		{
+			return false;
+		}
+
+		FString CachedRoot;
+		Serialization::ReadString(Reader, CachedRoot);
+		if (CachedRoot != RootPath)
+		{
+			return false;
+		}
+
+		uint32 NumDirs = 0;
+		Reader << NumDirs;
+		if (NumDirs > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			return false;
+		}
+
+		for (uint32 i = 0; i < NumDirs; ++i)
+		{
+			auto Bucket = std::make_shared<FAssetDirectoryBucket>();
+			FAssetDirectoryEntry& Dir = Bucket->Directory;
+			Serialization::ReadString(Reader, Dir.Path);
+			Dir.Name = GetLeafName(Dir.Path);
+			Reader << Dir.LastWriteTime;
+
+			uint32 NumSubDirs = 0;
+			Reader << NumSubDirs;
+			if (NumSubDirs > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+			{
+				throw std::runtime_error("Cache corrupt: subdirectory count is unreasonable.");
+			}
+			Dir.SubDirectories.SetNum(NumSubDirs);
+			for (FString& SubDir : Dir.SubDirectories)
+			{
+				Serialization::ReadString(Reader, SubDir);
+			}
+
+			uint32 NumFiles = 0;
+			Reader << NumFiles;
+			if (NumFiles > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+			{
+				throw std::runtime_error("Cache corrupt: file count is unreasonable.");
+			}
+			for (uint32 f = 0; f < NumFiles; ++f)
+			{
+				FString FileName;
+				uint64 FileSize = 0;
+				int64 FileTime = 0;
+				Serialization::ReadString(Reader, FileName);
+				Reader << FileSize << FileTime;
+
+				FAssetFileEntry File;
+				FillFileEntry(File, Dir.Path + "/" + FileName, FileName, FileSize, FileTime);
+				Dir.Files.Add(File.Path);
+				AddFile(OutState, *Bucket, File);
+			}
+
+			const FString DirKey = Dir.Path;
+			OutState.Directories[DirKey] = std::move(Bucket);
+		}
+
+		uint32 EndMagic = 0;
+		Reader << EndMagic;
+		if (EndMagic != AssetRegistryCacheMagic)
+		{
+			throw std::runtime_error("Cache corrupt: missing end marker.");
+		}
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG("AssetRegistry: Cache load failed (%s), rescanning", e.what());
+		OutState = FAssetRegistryState();
+		return false;
+	}
+
+	return true;
+}
+
+bool FAssetRegistry::SaveCache(const FAssetRegistryState& InState)
+{
+	std::error_code Ec;
+	fs::create_directories(fs::path(UTF8ToWide(GCacheDir)), Ec);
+
+	FWindowsBinWriter Writer(GetCacheFilePath());
+
+	uint32 Magic = AssetRegistryCacheMagic;
+	uint32 Version = AssetRegistryCacheVersion;
+	Writer << Magic << Version;
+	Serialization::WriteString(Writer, RootPath);
+
+	uint32 NumDirs = static_cast<uint32>(InState.Directories.Num());
+	Writer << NumDirs;
+	for (const auto& Pair : InState.Directories)
+	{
+		const FAssetDirectoryBucket& Bucket = *Pair.second;
+		const FAssetDirectoryEntry& Dir = Bucket.Directory;
+		Serialization::WriteString(Writer, Dir.Path);
+		int64 DirTime = Dir.LastWriteTime;
+		Writer << DirTime;
+
+		uint32 NumSubDirs = static_cast<uint32>(Dir.SubDirectories.Num());
+		Writer << NumSubDirs;
+		for (const FString& SubDir : Dir.SubDirectories)
+		{
+			Serialization::WriteString(Writer, SubDir);
+		}
+
+		uint32 NumFiles = static_cast<uint32>(Dir.Files.Num());
+		Writer << NumFiles;
+		for (const FString& FilePath : Dir.Files)
+		{
+			const FAssetFileEntry* File = Bucket.Files.Find(FilePath);
+			FString FileName = File ? File->FileName : GetLeafName(FilePath);
+			uint64 FileSize = File ? File->FileSize : 0;
+			int64 FileTime = File ? File->LastWriteTime : 0;
+			Serialization::WriteString(Writer, FileName);
+			Writer << FileSize << FileTime;
+		}
+	}
+	Writer << Magic;
+	Writer.Close();
+
+	SavedGeneration = InState.Generation;
+	return true;
+}
@@ -0,0 +1,188 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// 확장자로 분류한 에셋 종류 (컨텐츠 브라우저 아이콘/썸네일 분기용)
+enum class EAssetFileType : uint8
+{
+	Other,
+	Mesh,
+	Texture,
+	Animation,
+	Prefab,
+	Material,
+	Sound,
+	Shader,
+	Data,
+};
+
+// 레지스트리에 등록된 파일 하나 (경로는 작업 디렉토리 기준 상대 경로, '/' 구분자, UTF-8)
+struct FAssetFileEntry
+{
+	FString Path;				// 예: "Data/Textures/Brick.png"
+	FString FileName;			// 예: "Brick.png"
+	FString Extension;			// 소문자, 점 포함 (예: ".png")
+	EAssetFileType Type = EAssetFileType::Other;
+	uint64 FileSize = 0;
+	int64 LastWriteTime = 0;
+	uint64 ThumbnailKey = 0;	// 경로 + 크기 + 수정 시각 해시. 파일이 바뀌면 달라진다
+};
+
+// 디렉토리 하나의 직계 자식 목록. LastWriteTime은 자식 추가/삭제/이름 변경 시 갱신되므로 변경 감지에 사용
+struct FAssetDirectoryEntry
+{
+	FString Path;
+	FString Name;
+	int64 LastWriteTime = 0;
+	TArray<FString> Files;			// 파일 전체 경로 (이름 순)
+	TArray<FString> SubDirectories;	// 하위 디렉토리 전체 경로 (이름 순)
+};
+
+// 디렉토리 하나와 그 직계 파일 항목. 세대 간에 공유하고, 바뀐 디렉토리만 복사해서 고친다 (copy-on-write)
+struct FAssetDirectoryBucket
+{
+	FAssetDirectoryEntry Directory;
+	TMap<FString, FAssetFileEntry> Files;	// 파일 전체 경로 -> 항목 (Directory.Files와 같은 집합)
+};
+
+// 레지스트리 상태 스냅샷. 한 번 게시되면 수정하지 않는다 (변경은 복사본에서 만들어 교체)
+// 복사본은 버킷/샤드 포인터만 복사하므로 파일 하나가 바뀌어도 비용은 디렉토리 수에 비례한다.
+struct FAssetRegistryState
+{
+	static constexpr uint32 NumNameShards = 64;
+	using FNameShard = TMap<FString, TArray<FString>>;	// 소문자 파일 이름 -> 경로 목록
+
+	TMap<FString, std::shared_ptr<FAssetDirectoryBucket>> Directories;
+	std::shared_ptr<FNameShard> FileNameShards[NumNameShards];	// 이름 해시로 나눈 파일 이름 인덱스
+	int32 NumFiles = 0;
+	uint32 Generation = 0;
+
+	const FAssetDirectoryBucket* FindBucket(const FString& InDirPath) const;
+	const FAssetFileEntry* FindFile(const FString& InPath) const;
+	const TArray<FString>* FindPathsByName(const FString& InLowerName) const;
+	static uint32 GetNameShardIndex(const FString& InLowerName);
+};
+
+/**
+ * @brief Data 디렉토리 가상 파일 시스템 인덱스
+ * @details
+ * - 최초 1회 전체 스캔하거나 캐시 파일(GCacheDir/AssetRegistry.bin)에서 읽어온 뒤,
+ *   디렉토리 수정 시각만 비교해 바뀐 디렉토리만 다시 읽는다 (Refresh).
+ * - 파일 이름(대소문자 무시) -> 경로 인덱스와 "없는 이름" 캐시를 유지해,
+ *   깨진 텍스처 참조가 있어도 Data 전체를 다시 뒤지지 않는다.
+ * - StartWatching 이후에는 워커 스레드가 주기적으로 디렉토리/파일 시각을 폴링해 바뀐 부분만 반영한
+ *   새 스냅샷을 게시하고, 메인 스레드는 Tick에서 그것을 채택한다. 조회 함수는 메모리만 읽는다.
+ * - 조회 함수가 돌려준 포인터는 다음 Tick/Refresh/Notify* 호출 전까지만 유효하다 (메인 스레드 전용).
+ * - UResourceManager, FObjManager::Preload, 컨텐츠 브라우저가 같은 인덱스를 공유한다.
+ */
+class FAssetRegistry
+{
+public:
+	static FAssetRegistry& Get();
+
+	// 캐시 로드(+검증) 또는 전체 스캔. 이미 초기화되었으면 아무것도 하지 않음
+	void Initialize();
+	// 워커 중지 후 변경 사항이 있으면 캐시 파일 저장
+	void Shutdown();
+
+	// 백그라운드 폴링 시작/중지
+	void StartWatching(float InPollIntervalSeconds = 2.0f);
+	void StopWatching();
+	bool IsWatching() const { return WatchThread.joinable(); }
+	// 워커에게 즉시 폴링 요청 (워커가 없으면 동기 Refresh)
+	void RequestRefresh();
+
+	// 메인 스레드에서 프레임마다 호출: 워커가 게시한 새 스냅샷이 있으면 채택. 바뀌었으면 true
+	bool Tick();
+
+	// 디렉토리 수정 시각이 바뀐 곳만 다시 읽어 인덱스를 갱신 (동기). 변경이 있었으면 true
+	bool Refresh();
+	// 디렉토리 하나만 검사 (동기). 인덱스에 없는 디렉토리면 전체 Refresh
+	bool RefreshDirectory(const FString& InPath);
+
+	// 엔진이 직접 파일을 만들거나 지웠을 때 즉시 반영 (Refresh 없이)
+	void NotifyFileAdded(const FString& InPath);
+	void NotifyFileRemoved(const FString& InPath);
+
+	// 파일 이름(대소문자 무시)으로 검색. 없으면 negative 캐시에 기록하고 nullptr
+	const FAssetFileEntry* FindFileByName(const FString& InFileName);
+	void FindAllFilesByName(const FString& InFileName, TArray<const FAssetFileEntry*>& OutFiles);
+
+	const FAssetFileEntry* FindFile(const FString& InPath) const;
+	const FAssetDirectoryEntry* FindDirectory(const FString& InPath) const;
+
+	// InDirectory 이하(재귀)에서 확장자가 일치하는 파일을 경로 순으로 수집. Extensions가 비면 전체
+	void FindFiles(TArray<const FAssetFileEntry*>& OutFiles, const TArray<FString>& InExtensions, const FString& InDirectory = FString()) const;
+
+	// 인덱스가 바뀔 때마다 증가 (외부 캐시 무효화용)
+	uint32 GetGeneration() const { return State ? State->Generation : 0; }
+	int32 GetNumFiles() const { return State ? State->NumFiles : 0; }
+	int32 GetNumDirectories() const { return State ? State->Directories.Num() : 0; }
+	const FString& GetRootPath() const { return RootPath; }
+
+	static FString ToRegistryPath(const FString& InPath);
+	static EAssetFileType GetFileType(const FString& InExtension);
+
+private:
+	using FStatePtr = std::shared_ptr<const FAssetRegistryState>;
+
+	FAssetRegistry() = default;
+	~FAssetRegistry();
+
+	// 게시된 상태를 (버킷 공유로) 복사해 Mutator로 수정하고, 변경이 있으면 새 세대로 게시. 메인 스레드 상태도 즉시 채택
+	template<typename MutatorType>
+	bool MutateState(MutatorType&& Mutator, bool bAdoptOnMainThread);
+	FStatePtr GetPublishedState() const;
+	void AdoptPublishedState();
+
+	void WatchThreadMain();
+	// 상태 복사 없이 디렉토리/파일 시각만 비교 (워커 폴링용). 파일 시각은 디렉토리 열거 결과로 비교해 파일별 stat을 피한다
+	bool HasChangesOnDisk(const FAssetRegistryState& InState) const;
+
+	void FullScan(FAssetRegistryState& InOutState) const;
+	void ScanDirectoryRecursive(FAssetRegistryState& InOutState, const FString& InDirPath) const;
+	// 디렉토리 하나를 비재귀로 다시 읽고 기존 항목과 비교. 변경이 있었으면 true
+	// bCheckFiles면 디렉토리 시각이 같아도 파일별 크기/시각을 비교해 내용 변경까지 반영
+	bool RescanDirectory(FAssetRegistryState& InOutState, const FString& InDirPath, bool bForce, bool bCheckFiles) const;
+	bool RefreshState(FAssetRegistryState& InOutState, bool bCheckFiles) const;
+	static void RemoveDirectoryRecursive(FAssetRegistryState& InOutState, const FString& InDirPath);
+	// 이 상태만 참조하는 버킷/샤드를 돌려준다 (다른 세대와 공유 중이면 먼저 복사)
+	static FAssetDirectoryBucket* EditBucket(FAssetRegistryState& InOutState, const FString& InDirPath);
+	static FAssetRegistryState::FNameShard& EditNameShard(FAssetRegistryState& InOutState, const FString& InLowerName);
+	static void AddFile(FAssetRegistryState& InOutState, FAssetDirectoryBucket& InOutBucket, const FAssetFileEntry& InEntry);
+	static void RemoveFile(FAssetRegistryState& InOutState, FAssetDirectoryBucket& InOutBucket, const FString& InPath);
+	static void RemoveFromNameIndex(FAssetRegistryState& InOutState, const FAssetFileEntry& InEntry);
+	static void FillFileEntry(FAssetFileEntry& OutEntry, const FString& InPath, const FString& InFileName, uint64 InFileSize, int64 InLastWriteTime);
+
+	bool LoadCache(FAssetRegistryState& OutState) const;
+	bool SaveCache(const FAssetRegistryState& InState);
+
+	static FString ToLower(const FString& InStr);
+
+private:
+	FString RootPath;
+
+	// 메인 스레드가 보는 상태 (Tick/동기 갱신 때만 교체)
+	FStatePtr State;
+	TSet<FString> MissingFileNames;	// negative lookup 캐시 (소문자), 세대가 바뀌면 비움
+
+	// 워커/메인이 공유하는 최신 게시 상태
+	mutable std::mutex PublishMutex;
+	FStatePtr PublishedState;
+	// 상태 변경(복사-수정-게시)은 한 번에 하나만
+	std::mutex WriteMutex;
+
+	std::thread WatchThread;
+	std::mutex WatchMutex;
+	std::condition_variable WatchCondition;
+	bool bStopWatching = false;
+	bool bRefreshRequested = false;
+	float PollIntervalSeconds = 2.0f;
+
+	bool bInitialized = false;
+	uint32 SavedGeneration = 0;
+};
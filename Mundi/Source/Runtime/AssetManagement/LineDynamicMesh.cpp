@@ -66,12 +66,20 @@ bool ULineDynamicMesh::Initialize(uint32 InMaxVertices, uint32 InMaxIndices, ID3
 }
 
 bool ULineDynamicMesh::UpdateData(FMeshData* InData, ID3D11DeviceContext* InContext)
+{
+    if (!InData)
+        return false;
+
+    return UpdateDataRange(InData, 0, static_cast<uint32>(InData->Vertices.size()), 0, static_cast<uint32>(InData->Indices.size()), InContext);
+}
+
+bool ULineDynamicMesh::UpdateDataRange(const FMeshData* InData, uint32 FirstVertex, uint32 vertexCount, uint32 FirstIndex, uint32 indexCount, ID3D11DeviceContext* InContext)
 {
     if (!bIsInitialized || !InData || !InContext)
         return false;
 
-    uint32 vertexCount = static_cast<uint32>(InData->Vertices.size());
-    uint32 indexCount = static_cast<uint32>(InData->Indices.size());
+    if (FirstVertex + vertexCount > InData->Vertices.size() || FirstIndex + indexCount > InData->Indices.size())
+        return false;
 
     if (vertexCount > MaxVertices || indexCount > MaxIndices)
         return false;
@@ -90,8 +98,9 @@ bool ULineDynamicMesh::UpdateData(FMeshData* InData, ID3D11DeviceContext* InCont
     FVertexSimple* dstVertices = static_cast<FVertexSimple*>(mappedVertex.pData);
     for (uint32 i = 0; i < vertexCount; ++i)
     {
-        dstVertices[i].Position = InData->Vertices[i];
-        dstVertices[i].Color = (i < InData->Color.size()) ? InData->Color[i] : FVector4(1, 1, 1, 1);
+        const uint32 src = FirstVertex + i;
+        dstVertices[i].Position = InData->Vertices[src];
+        dstVertices[i].Color = (src < InData->Color.size()) ? InData->Color[src] : FVector4(1, 1, 1, 1);
     }
     InContext->Unmap(VertexBuffer, 0);
 
@@ -101,7 +110,17 @@ bool ULineDynamicMesh::UpdateData(FMeshData* InData, ID3D11DeviceContext* InCont
         return false;
 
     uint32* indices = static_cast<uint32*>(mappedIndex.pData);
-    memcpy(indices, InData->Indices.data(), indexCount * sizeof(uint32));
+    if (FirstVertex == 0)
+    {
+        memcpy(indices, InData->Indices.data() + FirstIndex, indexCount * sizeof(uint32));
+    }
+    else
+    {
+        for (uint32 i = 0; i < indexCount; ++i)
+        {
+            indices[i] = InData->Indices[FirstIndex + i] - FirstVertex;
+        }
+    }
     InContext->Unmap(IndexBuffer, 0);
 
     return true;
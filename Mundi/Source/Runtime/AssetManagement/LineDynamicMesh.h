@@ -16,6 +16,8 @@ public:
     bool Initialize(uint32 MaxVertices, uint32 MaxIndices, ID3D11Device* InDevice);
 
     bool UpdateData(FMeshData* InData, ID3D11DeviceContext* InContext);
+    // InData의 [FirstVertex, +VertexCount) 정점과 [FirstIndex, +IndexCount) 인덱스만 업로드 (인덱스는 FirstVertex 기준으로 재배치)
+    bool UpdateDataRange(const FMeshData* InData, uint32 FirstVertex, uint32 VertexCount, uint32 FirstIndex, uint32 IndexCount, ID3D11DeviceContext* InContext);
 
     ID3D11Buffer* GetVertexBuffer() const { return VertexBuffer; }
     ID3D11Buffer* GetIndexBuffer() const { return IndexBuffer; }
@@ -2,3 +2,15 @@
 #include "ResourceBase.h"
 
 IMPLEMENT_CLASS(UResourceBase)
+
+uint32 UResourceBase::AllocateSortId()
+{
+	static uint32 NextSortId = 1;
+	const uint32 NewSortId = NextSortId++;
+	if (NewSortId == 0x10000)
+	{
+		// 정렬 키의 Material/Mesh 필드는 16비트 (MeshBatchSort.h)
+		UE_LOG("[warning] Resource sort IDs exceed 16 bits; draw sorting may interleave materials/meshes");
+	}
+	return NewSortId;
+}
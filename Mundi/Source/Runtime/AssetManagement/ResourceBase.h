@@ -18,7 +18,23 @@ public:
 	std::filesystem::file_time_type GetLastModifiedTime() const { return LastModifiedTime; }
 	void SetLastModifiedTime(std::filesystem::file_time_type InTime) { LastModifiedTime = InTime; }
 
+	// 드로우 정렬 키용 작은 ID (머티리얼/메시). 처음 요청될 때 1부터 순서대로 발급한다.
+	// UUID는 모든 UObject가 나눠 쓰므로 큰 씬에서는 정렬 키의 16비트 필드를 금방 넘어 서로 다른 에셋이 섞인다.
+	uint32 GetSortId() const
+	{
+		if (SortId == 0)
+		{
+			SortId = AllocateSortId();
+		}
+		return SortId;
+	}
+
 protected:
 	FString FilePath;	// 원본 파일의 경로이자, UResourceManager에 등록된 Key 
 	std::filesystem::file_time_type LastModifiedTime;
+
+private:
+	static uint32 AllocateSortId();
+
+	mutable uint32 SortId = 0;
 };
\ No newline at end of file
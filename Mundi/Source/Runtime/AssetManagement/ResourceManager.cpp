@@ -6,6 +6,9 @@
 #include "ObjManager.h"
 #include "Quad.h"
 #include "MeshBVH.h"
+#include "WindowsBinReader.h"
+#include "WindowsBinWriter.h"
+#include "AssetRegistry.h"
 #include "Enums.h"
 
 #include <filesystem>
@@ -139,8 +142,57 @@ FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FString& ObjPath, const FSta
     if (!StaticMeshAsset)
         return nullptr;
 
+    // .obj.bin 캐시 옆에 .bvh로 저장 (캐시에서 로드되지 않은 메시는 DerivedDataCache 경로 규칙을 따름)
+    const FString BinPathFileName = StaticMeshAsset->CacheFilePath.empty()
+        ? ConvertDataPathToCachePath(NormalizePath(ObjPath)) + ".bin"
+        : StaticMeshAsset->CacheFilePath;
+    const FString BVHPathFileName = BinPathFileName + ".bvh";
+    const uint64 SourceHash = FMeshBVH::ComputeSourceHash(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
+
     FMeshBVH* NewBVH = new FMeshBVH();
-    NewBVH->Build(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
+    bool bLoadedFromCache = false;
+    if (fs::exists(UTF8ToWide(BVHPathFileName)))
+    {
+        try
+        {
+            FWindowsBinReader Reader(BVHPathFileName);
+            if (!Reader.IsOpen())
+            {
+                throw std::runtime_error("Failed to open bvh file for reading.");
+            }
+            Reader << *NewBVH;
+            Reader.Close();
+
+            // 메시가 바뀌었으면 재빌드
+            bLoadedFromCache = NewBVH->GetSourceHash() == SourceHash;
+        }
+        catch (const std::exception& e)
+        {
+            UE_LOG("Error loading mesh BVH cache: %s. Rebuilding '%s'.", e.what(), ObjPath.c_str());
+            fs::remove(UTF8ToWide(BVHPathFileName));
+        }
+    }
+
+    if (!bLoadedFromCache)
+    {
+        NewBVH->Build(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
+        try
+        {
+            fs::path CacheFileDirPath(UTF8ToWide(BVHPathFileName));
+            if (CacheFileDirPath.has_parent_path())
+            {
+                fs::create_directories(CacheFileDirPath.parent_path());
+            }
+            FWindowsBinWriter Writer(BVHPathFileName);
+            Writer << *NewBVH;
+            Writer.Close();
+        }
+        catch (const std::exception& e)
+        {
+            UE_LOG("Failed to save mesh BVH cache '%s': %s", BVHPathFileName.c_str(), e.what());
+        }
+    }
+
     MeshBVHCache.Add(ObjPath, NewBVH);
     return NewBVH;
 }
@@ -165,6 +217,31 @@ void UResourceManager::SetAudioFiles()
     Sounds = GetAll<USound>();
 }
 
+EMemoryTag UResourceManager::GetMemoryTag(EResourceType InType)
+{
+    switch (InType)
+    {
+    case EResourceType::StaticMesh:
+    case EResourceType::SkeletalMesh:
+    case EResourceType::Quad:
+    case EResourceType::DynamicMesh:
+        return EMemoryTag::Mesh;
+    case EResourceType::Shader:
+        return EMemoryTag::Shader;
+    case EResourceType::Texture:
+        return EMemoryTag::Texture;
+    case EResourceType::Material:
+        return EMemoryTag::Material;
+    case EResourceType::Sound:
+        return EMemoryTag::Audio;
+    case EResourceType::Animation:
+    case EResourceType::AnimationStateMachine:
+        return EMemoryTag::Animation;
+    default:
+        return EMemoryTag::Untagged;
+    }
+}
+
 
 void UResourceManager::CreateAxisMesh(float Length, const FString& FilePath)
 {
@@ -207,6 +284,7 @@ void UResourceManager::CreateAxisMesh(float Length, const FString& FilePath)
     MeshData->Color = axisColors;
     MeshData->Indices = axisIndices;
 
+    MEM_SCOPE(Mesh);
     UStaticMesh* Mesh = NewObject<UStaticMesh>();
     Mesh->Load(MeshData, Device);
     Add<UStaticMesh>("Axis", Mesh);
@@ -367,6 +445,7 @@ void UResourceManager::CreateGridMesh(int N, const FString& FilePath)
     MeshData->Color = gridColors;
     MeshData->Indices = gridIndices;
 
+    MEM_SCOPE(Mesh);
     UStaticMesh* Mesh = NewObject<UStaticMesh>();
     Mesh->Load(MeshData, Device);
     Add<UStaticMesh>("Grid", Mesh);
@@ -426,6 +505,7 @@ void UResourceManager::CreateBoxWireframeMesh(const FVector& Min, const FVector&
     MeshData->Color = colors;
     MeshData->Indices = indices;
 
+    MEM_SCOPE(Mesh);
     UStaticMesh* Mesh = NewObject<UStaticMesh>();
     Mesh->Load(MeshData, Device);
     //Mesh->SetTopology(EPrimitiveTopology::LineList); // ✅ 꼭 LineList로 설정
@@ -690,6 +770,18 @@ FTextureData* UResourceManager::CreateOrGetTextureData(const FWideString& FilePa
         return it->second;
     }
 
+    // 이전에 실패한 경로는 레지스트리가 바뀌기 전까지 다시 시도하지 않음
+    FAssetRegistry& Registry = FAssetRegistry::Get();
+    if (FailedTextureGeneration != Registry.GetGeneration())
+    {
+        FailedTexturePaths.Empty();
+        FailedTextureGeneration = Registry.GetGeneration();
+    }
+    if (FailedTexturePaths.Contains(FilePath))
+    {
+        return nullptr;
+    }
+
     FTextureData* Data = new FTextureData();
 
     // 확장자 판별 (안전)
@@ -697,43 +789,35 @@ FTextureData* UResourceManager::CreateOrGetTextureData(const FWideString& FilePa
     std::wstring ext = realPath.has_extension() ? realPath.extension().wstring() : L"";
 for (auto& ch : ext) ch = static_cast<wchar_t>(::towlower(ch));
 
-    HRESULT hr = E_FAIL;
-    if (ext == L".dds")
-    {
-        hr = DirectX::CreateDDSTextureFromFile(Device, FilePath.c_str(), &Data->Texture, &Data->TextureSRV, 0, nullptr);
-    }
-    else
+    auto LoadFromFile = [&](const wchar_t* InPath) -> HRESULT
     {
-        hr = DirectX::CreateWICTextureFromFile(Device, Context, FilePath.c_str(), &Data->Texture, &Data->TextureSRV);
-    }
+        if (ext == L".dds")
+            return DirectX::CreateDDSTextureFromFile(Device, InPath, &Data->Texture, &Data->TextureSRV, 0, nullptr);
+        return DirectX::CreateWICTextureFromFile(Device, Context, InPath, &Data->Texture, &Data->TextureSRV);
+    };
+
+    HRESULT hr = LoadFromFile(FilePath.c_str());
 
     if (FAILED(hr) || Data->TextureSRV == nullptr)
     {
-        // Fallback: Data 디렉토리 아래에서 파일명 일치 검색
-        std::filesystem::path fname = std::filesystem::path(FilePath).filename();
-        std::filesystem::path dataRoot = std::filesystem::absolute(GDataDir);
-        bool retried = false;
-        try {
-            for (auto& entry : std::filesystem::recursive_directory_iterator(dataRoot))
-            {
-                if (!entry.is_regular_file()) continue;
-                if (entry.path().filename() == fname)
-                {
-                    retried = true;
-                    if (ext == L".dds")
-                        hr = DirectX::CreateDDSTextureFromFile(Device, entry.path().c_str(), &Data->Texture, &Data->TextureSRV, 0, nullptr);
-                    else
-                        hr = DirectX::CreateWICTextureFromFile(Device, Context, entry.path().c_str(), &Data->Texture, &Data->TextureSRV);
-                    if (SUCCEEDED(hr) && Data->TextureSRV) break;
-                }
-            }
-        } catch(...) {}
+        // Fallback: Data 디렉토리 아래에서 파일명 일치 검색 (디스크 순회 대신 에셋 레지스트리 인덱스 사용)
+        const FString FileName = WideToUTF8(realPath.filename().wstring());
+        TArray<const FAssetFileEntry*> Candidates;
+        Registry.FindAllFilesByName(FileName, Candidates);
+
+        for (const FAssetFileEntry* Candidate : Candidates)
+        {
+            if (Data->Texture) { Data->Texture->Release(); Data->Texture = nullptr; }
+            hr = LoadFromFile(UTF8ToWide(Candidate->Path).c_str());
+            if (SUCCEEDED(hr) && Data->TextureSRV) break;
+        }
 
-        if (!retried || FAILED(hr) || Data->TextureSRV == nullptr)
+        if (Candidates.IsEmpty() || FAILED(hr) || Data->TextureSRV == nullptr)
         {
             if (Data->Texture) { Data->Texture->Release(); Data->Texture = nullptr; }
             if (Data->BlendState) { Data->BlendState->Release(); Data->BlendState = nullptr; }
             delete Data;
+            FailedTexturePaths.Add(FilePath);
             UE_LOG("CreateOrGetTextureData failed: %ls\r\n", FilePath.c_str());
             return nullptr; // 실패 시 맵에 넣지 않음
         }
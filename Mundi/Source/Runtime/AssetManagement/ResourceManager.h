@@ -74,6 +74,9 @@ public:
 	template<typename T>
 	EResourceType GetResourceType();
 
+	// 리소스 타입별 메모리 태그 (Load 중 생성되는 UObject를 해당 태그로 집계)
+	static EMemoryTag GetMemoryTag(EResourceType InType);
+
 	// --- 헬퍼 및 유틸리티 ---
 	ID3D11Device* GetDevice() { return Device; }
 	ID3D11DeviceContext* GetDeviceContext() { return Context; }
@@ -149,6 +152,10 @@ private:
 	// Cache for per-mesh BVHs to avoid rebuilding for identical OBJ assets
 	TMap<FString, FMeshBVH*> MeshBVHCache;
 
+	// 로드에 실패한 텍스처 경로 (negative 캐시). 에셋 레지스트리가 바뀌면 비운다
+	TSet<FWideString> FailedTexturePaths;
+	uint32 FailedTextureGeneration = 0;
+
 	UMaterial* DefaultMaterialInstance;
 
 	// Shader Hot Reload
@@ -218,6 +225,7 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 	}
 	else//없으면 해당 리소스의 Load실행
 	{
+		FMemTagScope MemTag(GetMemoryTag(GetResourceType<T>()));
 		T* Resource = NewObject<T>();
 		Resource->Load(NormalizedPath, Device, std::forward<Args>(InArgs)...);
 		Resource->SetFilePath(NormalizedPath);
@@ -303,6 +311,7 @@ inline UShader* UResourceManager::Load(const FString& InFilePath, TArray<FShader
 	else
 	{
 		// 3. 캐시에 없으면 새로 생성하여 로드
+		MEM_SCOPE(Shader);
 		UShader* Resource = NewObject<UShader>();
 		// UShader::Load는 이제 매크로 인자를 받도록 수정되어야 함
 		Resource->Load(NormalizedPath, Device, InMacros);
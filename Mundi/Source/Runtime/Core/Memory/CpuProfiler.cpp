@@ -0,0 +1,400 @@
+﻿#include "pch.h"
+#include "CpuProfiler.h"
+#include "PlatformTime.h"
+#include <mutex>
+
+std::atomic<bool> FCpuProfiler::bEnabled{ true };
+std::atomic<bool> FCpuProfiler::bCapturing{ false };
+TArray<FProfileScopeStats> FCpuProfiler::FrameStats;
+
+namespace
+{
+	// 소유 스레드만 더하고, 메인 스레드는 지난 프레임 쪽만 읽고 0으로 되돌린다
+	struct FScopeAccum
+	{
+		std::atomic<uint64> InclusiveCycles{ 0 };
+		std::atomic<uint64> ExclusiveCycles{ 0 };
+		std::atomic<uint32> CallCount{ 0 };
+		std::atomic<uint16> ParentId{ INVALID_PROFILE_SCOPE };
+		std::atomic<uint16> Depth{ 0 };
+	};
+
+	struct FTraceEvent
+	{
+		uint64 StartCycles;
+		uint64 DurationCycles;
+		FProfileScopeId Id;
+		uint16 Depth;
+	};
+
+	struct FScopeStackEntry
+	{
+		FProfileScopeId Id;
+		uint64 ChildCycles;
+	};
+
+	struct FThreadProfileBuffer
+	{
+		uint32 ThreadId = 0;
+
+		FScopeStackEntry Stack[FCpuProfiler::MaxDepth];
+		int32 Depth = 0;
+
+		FScopeAccum Accum[2][FCpuProfiler::MaxScopes];	// [프레임 parity][스코프 ID]
+
+		std::unique_ptr<FTraceEvent[]> Events;
+		std::atomic<uint32> EventCount{ 0 };
+		std::atomic<uint32> DroppedEventCount{ 0 };
+	};
+
+	std::mutex GScopeMutex;
+	const char* GScopeNames[FCpuProfiler::MaxScopes] = {};
+	std::atomic<int32> GScopeCount{ 0 };
+
+	// 스레드 버퍼는 스레드가 끝나도 해제하지 않는다 (EndFrame에서 언제든 안전하게 읽기 위해)
+	std::mutex GThreadMutex;
+	TArray<FThreadProfileBuffer*> GThreadBuffers;
+
+	std::atomic<uint32> GFrameIndex{ 0 };
+
+	thread_local FThreadProfileBuffer* GThreadBuffer = nullptr;
+
+	// 캡처 상태 (메인 스레드 전용)
+	int32 GPendingCaptureFrames = 0;
+	int32 GCaptureFramesRemaining = 0;
+	FString GCapturePath;
+	uint64 GCaptureStartCycles = 0;
+	TArray<uint64> GCaptureFrameCycles;
+
+	FThreadProfileBuffer& GetThreadBuffer()
+	{
+		if (!GThreadBuffer)
+		{
+			// 스레드당 최초 1회만 할당
+			FThreadProfileBuffer* Buffer = new FThreadProfileBuffer();
+			Buffer->ThreadId = static_cast<uint32>(GetCurrentThreadId());
+			Buffer->Events = std::make_unique<FTraceEvent[]>(FCpuProfiler::MaxEventsPerThread);
+
+			std::lock_guard<std::mutex> Lock(GThreadMutex);
+			GThreadBuffers.Add(Buffer);
+			GThreadBuffer = Buffer;
+		}
+		return *GThreadBuffer;
+	}
+
+	// 쓰는 스레드가 하나뿐이므로 lock 접두사가 붙는 fetch_add 대신 load/store로 충분하다
+	template<typename T>
+	void AddRelaxed(std::atomic<T>& Counter, T Value)
+	{
+		Counter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+	}
+}
+
+FProfileScopeId FCpuProfiler::RegisterScope(const char* Name)
+{
+	std::lock_guard<std::mutex> Lock(GScopeMutex);
+
+	const int32 Count = GScopeCount.load(std::memory_order_relaxed);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		if (std::strcmp(GScopeNames[i], Name) == 0)
+		{
+			return static_cast<FProfileScopeId>(i);
+		}
+	}
+
+	if (Count >= MaxScopes)
+	{
+		return INVALID_PROFILE_SCOPE;
+	}
+
+	// Name은 TIME_PROFILE의 문자열 리터럴이라 수명이 프로그램 전체와 같다
+	GScopeNames[Count] = Name;
+	GScopeCount.store(Count + 1, std::memory_order_release);
+	return static_cast<FProfileScopeId>(Count);
+}
+
+FProfileScopeId FCpuProfiler::FindScope(const char* Name)
+{
+	const int32 Count = GScopeCount.load(std::memory_order_acquire);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		if (std::strcmp(GScopeNames[i], Name) == 0)
+		{
+			return static_cast<FProfileScopeId>(i);
+		}
+	}
+	return INVALID_PROFILE_SCOPE;
+}
+
+const char* FCpuProfiler::GetScopeName(FProfileScopeId Id)
+{
+	return Id < GScopeCount.load(std::memory_order_acquire) ? GScopeNames[Id] : "";
+}
+
+bool FCpuProfiler::BeginScope(FProfileScopeId Id)
+{
+	if (Id >= MaxScopes)
+	{
+		return false;
+	}
+
+	FThreadProfileBuffer& Buffer = GetThreadBuffer();
+	if (Buffer.Depth >= MaxDepth)
+	{
+		return false;
+	}
+
+	Buffer.Stack[Buffer.Depth++] = FScopeStackEntry{ Id, 0 };
+	return true;
+}
+
+void FCpuProfiler::EndScope(FProfileScopeId Id, uint64 StartCycles, uint64 EndCycles)
+{
+	FThreadProfileBuffer& Buffer = *GThreadBuffer;	// BeginScope에서 이미 생성됨
+
+	const int32 Depth = --Buffer.Depth;
+	const uint64 Duration = EndCycles - StartCycles;
+	const uint64 ChildCycles = Buffer.Stack[Depth].ChildCycles;
+
+	FProfileScopeId ParentId = INVALID_PROFILE_SCOPE;
+	if (Depth > 0)
+	{
+		FScopeStackEntry& Parent = Buffer.Stack[Depth - 1];
+		Parent.ChildCycles += Duration;
+		ParentId = Parent.Id;
+	}
+
+	const uint32 Parity = GFrameIndex.load(std::memory_order_relaxed) & 1;
+	FScopeAccum& Accum = Buffer.Accum[Parity][Id];
+	AddRelaxed<uint64>(Accum.InclusiveCycles, Duration);
+	AddRelaxed<uint64>(Accum.ExclusiveCycles, Duration > ChildCycles ? Duration - ChildCycles : 0);
+	AddRelaxed<uint32>(Accum.CallCount, 1);
+	Accum.ParentId.store(ParentId, std::memory_order_relaxed);
+	Accum.Depth.store(static_cast<uint16>(Depth), std::memory_order_relaxed);
+
+	if (bCapturing.load(std::memory_order_relaxed))
+	{
+		const uint32 Index = Buffer.EventCount.load(std::memory_order_relaxed);
+		if (Index < static_cast<uint32>(MaxEventsPerThread))
+		{
+			Buffer.Events[Index] = FTraceEvent{ StartCycles, Duration, Id, static_cast<uint16>(Depth) };
+			Buffer.EventCount.store(Index + 1, std::memory_order_release);
+		}
+		else
+		{
+			AddRelaxed<uint32>(Buffer.DroppedEventCount, 1);
+		}
+	}
+}
+
+void FCpuProfiler::EndFrame()
+{
+	// 프레임 parity를 뒤집은 뒤, 방금 끝난 쪽 집계만 읽는다 (측정 중인 스레드는 새 parity에 기록)
+	const uint32 FinishedParity = GFrameIndex.fetch_add(1, std::memory_order_acq_rel) & 1;
+	const int32 ScopeCount = GScopeCount.load(std::memory_order_acquire);
+	const double MsPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000.0;
+
+	FrameStats.SetNum(ScopeCount);
+	for (int32 Id = 0; Id < ScopeCount; ++Id)
+	{
+		FrameStats[Id] = FProfileScopeStats{};
+		FrameStats[Id].Name = GScopeNames[Id];
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(GThreadMutex);
+		for (FThreadProfileBuffer* Buffer : GThreadBuffers)
+		{
+			for (int32 Id = 0; Id < ScopeCount; ++Id)
+			{
+				FScopeAccum& Accum = Buffer->Accum[FinishedParity][Id];
+				const uint32 CallCount = Accum.CallCount.load(std::memory_order_relaxed);
+				if (CallCount == 0)
+				{
+					continue;
+				}
+
+				FProfileScopeStats& Stats = FrameStats[Id];
+				Stats.InclusiveMs += Accum.InclusiveCycles.load(std::memory_order_relaxed) * MsPerCycle;
+				Stats.ExclusiveMs += Accum.ExclusiveCycles.load(std::memory_order_relaxed) * MsPerCycle;
+				Stats.CallCount += CallCount;
+				Stats.ParentId = Accum.ParentId.load(std::memory_order_relaxed);
+				Stats.Depth = Accum.Depth.load(std::memory_order_relaxed);
+
+				Accum.InclusiveCycles.store(0, std::memory_order_relaxed);
+				Accum.ExclusiveCycles.store(0, std::memory_order_relaxed);
+				Accum.CallCount.store(0, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// 캡처 진행
+	if (GCaptureFramesRemaining > 0)
+	{
+		GCaptureFrameCycles.Add(FPlatformTime::Cycles64());
+		if (--GCaptureFramesRemaining == 0)
+		{
+			bCapturing.store(false, std::memory_order_relaxed);
+			WriteChromeTrace(GCapturePath);
+		}
+	}
+	else if (GPendingCaptureFrames > 0)
+	{
+		{
+			std::lock_guard<std::mutex> Lock(GThreadMutex);
+			for (FThreadProfileBuffer* Buffer : GThreadBuffers)
+			{
+				Buffer->EventCount.store(0, std::memory_order_relaxed);
+				Buffer->DroppedEventCount.store(0, std::memory_order_relaxed);
+			}
+		}
+
+		GCaptureStartCycles = FPlatformTime::Cycles64();
+		GCaptureFrameCycles.Empty();
+		GCaptureFrameCycles.Add(GCaptureStartCycles);
+		GCaptureFramesRemaining = GPendingCaptureFrames;
+		GPendingCaptureFrames = 0;
+		bCapturing.store(true, std::memory_order_relaxed);
+	}
+}
+
+const FProfileScopeStats& FCpuProfiler::GetFrameStats(const char* Name)
+{
+	static const FProfileScopeStats EmptyStats;
+
+	const FProfileScopeId Id = FindScope(Name);
+	if (Id == INVALID_PROFILE_SCOPE || Id >= FrameStats.Num())
+	{
+		return EmptyStats;
+	}
+	return FrameStats[Id];
+}
+
+void FCpuProfiler::GetFrameStatsHierarchy(TArray<const FProfileScopeStats*>& OutStats)
+{
+	OutStats.Empty();
+
+	const int32 Count = FrameStats.Num();
+	TArray<bool> Visited;
+	Visited.SetNum(Count);
+
+	// 부모가 없거나 이번 프레임에 호출되지 않았으면(재귀 포함) 루트로 취급
+	auto IsRoot = [Count](int32 Id)
+	{
+		const FProfileScopeId ParentId = FrameStats[Id].ParentId;
+		return ParentId >= Count || ParentId == Id || FrameStats[ParentId].CallCount == 0;
+	};
+
+	std::function<void(int32)> Visit = [&](int32 Id)
+	{
+		Visited[Id] = true;
+		OutStats.Add(&FrameStats[Id]);
+		for (int32 Child = 0; Child < Count; ++Child)
+		{
+			if (!Visited[Child] && FrameStats[Child].CallCount > 0 && FrameStats[Child].ParentId == Id)
+			{
+				Visit(Child);
+			}
+		}
+	};
+
+	for (int32 Id = 0; Id < Count; ++Id)
+	{
+		if (!Visited[Id] && FrameStats[Id].CallCount > 0 && IsRoot(Id))
+		{
+			Visit(Id);
+		}
+	}
+}
+
+void FCpuProfiler::RequestCapture(int32 NumFrames, const FString& OutputPath)
+{
+	if (IsCapturing() || GPendingCaptureFrames > 0)
+	{
+		UE_LOG("[Profiler] Capture already in progress");
+		return;
+	}
+
+	// 다음 EndFrame부터 기록 시작
+	GPendingCaptureFrames = std::max(1, NumFrames);
+	GCapturePath = OutputPath;
+}
+
+bool FCpuProfiler::WriteChromeTrace(const FString& OutputPath)
+{
+	const FWideString WidePath = UTF8ToWide(OutputPath);
+	const std::filesystem::path Path(WidePath);
+	if (Path.has_parent_path())
+	{
+		std::error_code Ec;
+		std::filesystem::create_directories(Path.parent_path(), Ec);
+	}
+
+	std::ofstream File(Path, std::ios::out | std::ios::trunc);
+	if (!File.is_open())
+	{
+		UE_LOG("[Profiler] Failed to open trace file: %s", OutputPath.c_str());
+		return false;
+	}
+
+	// Chrome trace 타임스탬프 단위는 마이크로초
+	const double UsPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000000.0;
+	auto ToUs = [&](uint64 Cycles) { return static_cast<double>(Cycles - GCaptureStartCycles) * UsPerCycle; };
+
+	char Line[256];
+	bool bFirst = true;
+	auto WriteLine = [&](int32 Length)
+	{
+		if (!bFirst)
+		{
+			File.write(",\n", 2);
+		}
+		bFirst = false;
+		File.write(Line, Length);
+	};
+
+	File << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+	uint32 TotalEvents = 0;
+	uint32 TotalDropped = 0;
+	{
+		std::lock_guard<std::mutex> Lock(GThreadMutex);
+		for (FThreadProfileBuffer* Buffer : GThreadBuffers)
+		{
+			const uint32 Count = std::min<uint32>(Buffer->EventCount.load(std::memory_order_acquire), MaxEventsPerThread);
+			if (Count == 0)
+			{
+				continue;
+			}
+
+			WriteLine(snprintf(Line, sizeof(Line),
+				"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}",
+				Buffer->ThreadId, Buffer->ThreadId));
+
+			for (uint32 i = 0; i < Count; ++i)
+			{
+				const FTraceEvent& Event = Buffer->Events[i];
+				WriteLine(snprintf(Line, sizeof(Line),
+					"{\"name\":\"%s\",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+					GetScopeName(Event.Id), ToUs(Event.StartCycles), Event.DurationCycles * UsPerCycle, Buffer->ThreadId));
+			}
+
+			TotalEvents += Count;
+			TotalDropped += Buffer->DroppedEventCount.load(std::memory_order_relaxed);
+		}
+	}
+
+	// 프레임 경계
+	for (int32 i = 0; i < GCaptureFrameCycles.Num(); ++i)
+	{
+		WriteLine(snprintf(Line, sizeof(Line),
+			"{\"name\":\"Frame %d\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":1,\"tid\":0}",
+			i, ToUs(GCaptureFrameCycles[i])));
+	}
+
+	File << "\n]}\n";
+
+	UE_LOG("[Profiler] Chrome trace saved: %s (%u events, %u dropped)", OutputPath.c_str(), TotalEvents, TotalDropped);
+	return true;
+}
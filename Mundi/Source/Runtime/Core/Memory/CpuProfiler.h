@@ -0,0 +1,65 @@
+﻿#pragma once
+#include <atomic>
+
+// 프로파일 스코프 ID. TIME_PROFILE(Key)마다 함수 static으로 한 번만 발급된다
+using FProfileScopeId = uint16;
+constexpr FProfileScopeId INVALID_PROFILE_SCOPE = 0xFFFF;
+
+// 마지막으로 완료된 프레임의 스코프별 집계 (모든 스레드 합산)
+struct FProfileScopeStats
+{
+	const char* Name = nullptr;
+	FProfileScopeId ParentId = INVALID_PROFILE_SCOPE;	// 마지막으로 관측된 부모 스코프
+	uint32 Depth = 0;
+	double InclusiveMs = 0.0;	// 자식 포함
+	double ExclusiveMs = 0.0;	// 자식 제외 (자기 자신)
+	uint32 CallCount = 0;
+};
+
+/**
+ * @brief 계층형 CPU 프로파일러
+ * @details
+ * - 스코프 이름은 RegisterScope에서 한 번만 인터닝되고, 이후 측정은 ID로만 이루어진다 (문자열/해시 없음).
+ * - 스레드마다 고정 크기 버퍼(스코프 스택, 프레임 집계, 트레이스 이벤트)를 가지며 측정 중에는 락도 할당도 없다.
+ * - 프레임 집계는 짝/홀 프레임 이중 버퍼라, 메인 스레드가 EndFrame에서 지난 프레임 쪽만 읽고 비운다.
+ * - 비활성화 시 스코프 비용은 원자 변수 한 번 읽기뿐이며, pch.h의 USE_CPU_PROFILER를 끄면 매크로 자체가 사라진다.
+ */
+class FCpuProfiler
+{
+public:
+	static constexpr int32 MaxScopes = 512;
+	static constexpr int32 MaxDepth = 64;
+	static constexpr int32 MaxEventsPerThread = 1 << 15;
+
+	// 이름 인터닝 (최초 1회만 뮤텍스). 같은 이름은 같은 ID를 반환
+	static FProfileScopeId RegisterScope(const char* Name);
+	static FProfileScopeId FindScope(const char* Name);
+	static const char* GetScopeName(FProfileScopeId Id);
+
+	static void SetEnabled(bool bInEnabled) { bEnabled.store(bInEnabled, std::memory_order_relaxed); }
+	static bool IsEnabled() { return bEnabled.load(std::memory_order_relaxed); }
+
+	// FScopeCycleCounter에서 호출. 스택이 넘치면 false (해당 스코프는 기록하지 않음)
+	static bool BeginScope(FProfileScopeId Id);
+	static void EndScope(FProfileScopeId Id, uint64 StartCycles, uint64 EndCycles);
+
+	// 메인 스레드에서 프레임 끝에 한 번 호출: 스레드별 집계를 합산해 프레임 통계를 갱신하고 캡처를 진행
+	static void EndFrame();
+
+	// 마지막으로 완료된 프레임 통계 (인덱스 = 스코프 ID)
+	static const TArray<FProfileScopeStats>& GetFrameStats() { return FrameStats; }
+	static const FProfileScopeStats& GetFrameStats(const char* Name);
+	// 부모-자식 순서(DFS)로 정렬된, 이번 프레임에 호출된 스코프 목록
+	static void GetFrameStatsHierarchy(TArray<const FProfileScopeStats*>& OutStats);
+
+	// NumFrames 프레임 동안 이벤트를 기록해 Chrome trace JSON(chrome://tracing, Perfetto)으로 저장
+	static void RequestCapture(int32 NumFrames, const FString& OutputPath);
+	static bool IsCapturing() { return bCapturing.load(std::memory_order_relaxed); }
+
+private:
+	static bool WriteChromeTrace(const FString& OutputPath);
+
+	static std::atomic<bool> bEnabled;
+	static std::atomic<bool> bCapturing;
+	static TArray<FProfileScopeStats> FrameStats;
+};
@@ -4,13 +4,54 @@
 #include <malloc.h>
 #include <algorithm>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+namespace
+{
+	// 사용자 포인터 바로 앞에 놓이는 할당 헤더
+	struct FAllocHeader
+	{
+		uint64 Size;
+		uint32 Offset;		// Raw -> 사용자 포인터 거리
+		uint8 Tag;
+		uint8 Padding[3];
+	};
+	static_assert(sizeof(FAllocHeader) == 16, "FAllocHeader must stay 16 bytes");
+
+	constexpr SIZE_T MinAlignment = 16;
+
+	const char* const MemoryTagNames[] =
+	{
+		"Untagged",
+		"Object",
+		"Mesh",
+		"Texture",
+		"Material",
+		"Shader",
+		"Animation",
+		"Particle",
+		"Audio",
+		"Lua",
+		"World",
+		"UI",
+	};
+	static_assert(std::size(MemoryTagNames) == static_cast<size_t>(EMemoryTag::Count), "MemoryTagNames mismatch");
+}
+
+FMemoryManager::FTagCounters FMemoryManager::TagCounters[static_cast<int32>(EMemoryTag::Count)];
+FMemoryManager::FTagCounters FMemoryManager::Total;
+thread_local EMemoryTag FMemoryManager::CurrentTag = EMemoryTag::Untagged;
+
+const char* GetMemoryTagName(EMemoryTag Tag)
+{
+	const uint8 Index = static_cast<uint8>(Tag);
+	return Index < static_cast<uint8>(EMemoryTag::Count) ? MemoryTagNames[Index] : "Invalid";
+}
 
 void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	// 헤더 공간을 정렬 단위로 올려 사용자 포인터가 요청 정렬을 유지하도록 한다
+	const SIZE_T FinalAlignment = std::max(Alignment, MinAlignment);
+	const SIZE_T HeaderSpace = (sizeof(FAllocHeader) + FinalAlignment - 1) & ~(FinalAlignment - 1);
+	const SIZE_T TotalSize = Size + HeaderSpace;
 
 #if defined(_MSC_VER) && defined(_DEBUG)
 	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
@@ -20,11 +61,16 @@ void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
 	if (!Raw)
 		return nullptr;
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+	unsigned char* UserPtr = static_cast<unsigned char*>(Raw) + HeaderSpace;
+	FAllocHeader* Header = reinterpret_cast<FAllocHeader*>(UserPtr) - 1;
+	Header->Size = Size;
+	Header->Offset = static_cast<uint32>(HeaderSpace);
+	Header->Tag = static_cast<uint8>(CurrentTag);
+
+	AddAlloc(TagCounters[Header->Tag], Size);
+	AddAlloc(Total, Size);
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+	return UserPtr;
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -33,15 +79,112 @@ void FMemoryManager::Deallocate(void* Ptr)
 		return;
 
 	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+	const FAllocHeader* Header = reinterpret_cast<const FAllocHeader*>(UserPtr) - 1;
+	unsigned char* Raw = UserPtr - Header->Offset;
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+	AddFree(TagCounters[Header->Tag], static_cast<SIZE_T>(Header->Size));
+	AddFree(Total, static_cast<SIZE_T>(Header->Size));
 
 #if defined(_MSC_VER) && defined(_DEBUG)
 	_aligned_free_dbg(Raw);
 #else
 	_aligned_free(Raw);
 #endif
-}
\ No newline at end of file
+}
+
+void FMemoryManager::RecordAlloc(EMemoryTag Tag, SIZE_T Size)
+{
+	AddAlloc(TagCounters[static_cast<uint8>(Tag)], Size);
+	AddAlloc(Total, Size);
+}
+
+void FMemoryManager::RecordFree(EMemoryTag Tag, SIZE_T Size)
+{
+	AddFree(TagCounters[static_cast<uint8>(Tag)], Size);
+	AddFree(Total, Size);
+}
+
+void FMemoryManager::AddAlloc(FTagCounters& Counters, SIZE_T Size)
+{
+	const uint64 NewLive = Counters.LiveBytes.fetch_add(Size, std::memory_order_relaxed) + Size;
+	Counters.LiveCount.fetch_add(1, std::memory_order_relaxed);
+	Counters.FrameAllocCount.fetch_add(1, std::memory_order_relaxed);
+	Counters.FrameAllocBytes.fetch_add(Size, std::memory_order_relaxed);
+
+	// high-water 갱신 (다른 스레드가 더 큰 값을 먼저 썼으면 중단)
+	uint64 Peak = Counters.PeakBytes.load(std::memory_order_relaxed);
+	while (NewLive > Peak && !Counters.PeakBytes.compare_exchange_weak(Peak, NewLive, std::memory_order_relaxed))
+	{
+	}
+}
+
+void FMemoryManager::AddFree(FTagCounters& Counters, SIZE_T Size)
+{
+	Counters.LiveBytes.fetch_sub(Size, std::memory_order_relaxed);
+	Counters.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+FMemoryTagStats FMemoryManager::ToStats(const FTagCounters& Counters)
+{
+	FMemoryTagStats Stats;
+	Stats.LiveBytes = Counters.LiveBytes.load(std::memory_order_relaxed);
+	Stats.PeakBytes = Counters.PeakBytes.load(std::memory_order_relaxed);
+	Stats.LiveCount = Counters.LiveCount.load(std::memory_order_relaxed);
+	Stats.FrameAllocCount = Counters.LastFrameAllocCount;
+	Stats.FrameAllocBytes = Counters.LastFrameAllocBytes;
+	return Stats;
+}
+
+void FMemoryManager::EndFrame()
+{
+	for (FTagCounters& Counters : TagCounters)
+	{
+		Counters.LastFrameAllocCount = Counters.FrameAllocCount.exchange(0, std::memory_order_relaxed);
+		Counters.LastFrameAllocBytes = Counters.FrameAllocBytes.exchange(0, std::memory_order_relaxed);
+	}
+	Total.LastFrameAllocCount = Total.FrameAllocCount.exchange(0, std::memory_order_relaxed);
+	Total.LastFrameAllocBytes = Total.FrameAllocBytes.exchange(0, std::memory_order_relaxed);
+}
+
+FMemoryTagStats FMemoryManager::GetTagStats(EMemoryTag Tag)
+{
+	return ToStats(TagCounters[static_cast<uint8>(Tag)]);
+}
+
+FMemoryTagStats FMemoryManager::GetTotalStats()
+{
+	return ToStats(Total);
+}
+
+void FMemoryManager::ResetPeaks()
+{
+	for (FTagCounters& Counters : TagCounters)
+	{
+		Counters.PeakBytes.store(Counters.LiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+	Total.PeakBytes.store(Total.LiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void FMemoryManager::DumpTagStats()
+{
+	auto ToKB = [](uint64 Bytes) { return static_cast<double>(Bytes) / 1024.0; };
+
+	UE_LOG("[Memory] %-10s %12s %12s %10s %12s %12s", "Tag", "Live(KB)", "Peak(KB)", "Count", "FrameAllocs", "Frame(KB)");
+	for (int32 i = 0; i < static_cast<int32>(EMemoryTag::Count); ++i)
+	{
+		const FMemoryTagStats Stats = GetTagStats(static_cast<EMemoryTag>(i));
+		if (Stats.PeakBytes == 0 && Stats.LiveCount == 0)
+		{
+			continue;
+		}
+		UE_LOG("[Memory] %-10s %12.1f %12.1f %10llu %12llu %12.1f",
+			GetMemoryTagName(static_cast<EMemoryTag>(i)),
+			ToKB(Stats.LiveBytes), ToKB(Stats.PeakBytes), Stats.LiveCount,
+			Stats.FrameAllocCount, ToKB(Stats.FrameAllocBytes));
+	}
+
+	const FMemoryTagStats TotalStats = GetTotalStats();
+	UE_LOG("[Memory] %-10s %12.1f %12.1f %10llu %12llu %12.1f", "Total",
+		ToKB(TotalStats.LiveBytes), ToKB(TotalStats.PeakBytes), TotalStats.LiveCount,
+		TotalStats.FrameAllocCount, ToKB(TotalStats.FrameAllocBytes));
+}
@@ -1,15 +1,110 @@
 ﻿#pragma once
 #include <cstddef>
+#include <atomic>
 #include "UEContainer.h"
 
+// 메모리 사용처 분류. MEM_SCOPE(Tag)로 현재 스레드의 태그를 지정한다
+enum class EMemoryTag : uint8
+{
+	Untagged,
+	Object,
+	Mesh,
+	Texture,
+	Material,
+	Shader,
+	Animation,
+	Particle,
+	Audio,
+	Lua,
+	World,
+	UI,
+
+	Count
+};
+
+const char* GetMemoryTagName(EMemoryTag Tag);
+
+// 태그별 통계 스냅샷. Frame* 값은 마지막으로 완료된 프레임 기준
+struct FMemoryTagStats
+{
+	uint64 LiveBytes = 0;
+	uint64 PeakBytes = 0;
+	uint64 LiveCount = 0;
+	uint64 FrameAllocCount = 0;
+	uint64 FrameAllocBytes = 0;
+};
+
 class FMemoryManager
 {
 public:
 	// 인자 변수를 PascalCase로 변경
+	// 현재 스레드의 태그(MEM_SCOPE)로 기록된다. 태그는 헤더에 저장되어 Deallocate 시 같은 태그에서 차감
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
 	static void  Deallocate(void* Ptr);
 
+	// FMemoryManager를 거치지 않는 할당자(Lua 등)가 직접 사용량을 보고할 때 사용
+	static void RecordAlloc(EMemoryTag Tag, SIZE_T Size);
+	static void RecordFree(EMemoryTag Tag, SIZE_T Size);
+
+	static EMemoryTag GetCurrentTag() { return CurrentTag; }
+	static EMemoryTag SetCurrentTag(EMemoryTag Tag)
+	{
+		EMemoryTag Prev = CurrentTag;
+		CurrentTag = Tag;
+		return Prev;
+	}
+
+	// 메인 스레드에서 프레임 끝에 한 번 호출: 프레임 할당 카운터를 스냅샷하고 0으로 리셋
+	static void EndFrame();
+
+	static FMemoryTagStats GetTagStats(EMemoryTag Tag);
+	static FMemoryTagStats GetTotalStats();
+	static uint64 GetTotalAllocationBytes() { return Total.LiveBytes.load(std::memory_order_relaxed); }
+	static uint64 GetTotalAllocationCount() { return Total.LiveCount.load(std::memory_order_relaxed); }
+
+	// 피크 값을 현재 사용량으로 되돌린다 (구간별 high-water 측정용)
+	static void ResetPeaks();
+
+	// 태그별 사용량 표를 로그로 출력
+	static void DumpTagStats();
+
+private:
+	struct FTagCounters
+	{
+		std::atomic<uint64> LiveBytes{ 0 };
+		std::atomic<uint64> PeakBytes{ 0 };
+		std::atomic<uint64> LiveCount{ 0 };
+		std::atomic<uint64> FrameAllocCount{ 0 };
+		std::atomic<uint64> FrameAllocBytes{ 0 };
+		// EndFrame에서 메인 스레드만 쓰는 지난 프레임 값
+		uint64 LastFrameAllocCount = 0;
+		uint64 LastFrameAllocBytes = 0;
+	};
+
+	static void AddAlloc(FTagCounters& Counters, SIZE_T Size);
+	static void AddFree(FTagCounters& Counters, SIZE_T Size);
+	static FMemoryTagStats ToStats(const FTagCounters& Counters);
+
+	static FTagCounters TagCounters[static_cast<int32>(EMemoryTag::Count)];
+	static FTagCounters Total;
+	static thread_local EMemoryTag CurrentTag;
+};
+
+// 스코프 동안 현재 스레드의 메모리 태그를 바꾼다 (중첩 가능)
+class FMemTagScope
+{
 public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	explicit FMemTagScope(EMemoryTag Tag) : PrevTag(FMemoryManager::SetCurrentTag(Tag)) {}
+	~FMemTagScope() { FMemoryManager::SetCurrentTag(PrevTag); }
+
+	FMemTagScope(const FMemTagScope&) = delete;
+	FMemTagScope& operator=(const FMemTagScope&) = delete;
+
+private:
+	EMemoryTag PrevTag;
+};
+
+#define MEM_SCOPE_CONCAT_INNER(A, B) A##B
+#define MEM_SCOPE_CONCAT(A, B) MEM_SCOPE_CONCAT_INNER(A, B)
+// 예: MEM_SCOPE(Animation);
+#define MEM_SCOPE(Tag) FMemTagScope MEM_SCOPE_CONCAT(MemTagScope_, __LINE__)(EMemoryTag::Tag)
@@ -1,12 +1,20 @@
 ﻿#pragma once
+#include "CpuProfiler.h"
 
-
+// 스코프 이름은 함수 static으로 한 번만 인터닝되고, 이후에는 ID만 사용한다
+// pch.h의 USE_CPU_PROFILER를 끄면 측정 코드가 완전히 제거된다
+#ifdef USE_CPU_PROFILER
 #define TIME_PROFILE(Key)\
-FScopeCycleCounter Key##Counter(#Key); //현재 스코프 단위로 측정
+static const FProfileScopeId Key##ScopeId = FCpuProfiler::RegisterScope(#Key);\
+FScopeCycleCounter Key##Counter(Key##ScopeId); //현재 스코프 단위로 측정
 
 
 #define TIME_PROFILE_END(Key)\
 Key##Counter.Finish();
+#else
+#define TIME_PROFILE(Key)
+#define TIME_PROFILE_END(Key)
+#endif
 
 
 
@@ -63,63 +71,27 @@ public:
 	}
 };
 
-struct TStatId
-{
-	FString Key;
-	TStatId() = default;
-	TStatId(const FString& InKey) : Key(InKey) {}
-};
-struct FTimeProfile
-{
-	double Milliseconds;
-	uint32 CallCount;
-
-	const char* GetConstChar() const
-	{
-		static char buffer[64]; // static으로 해야 반환 가능
-		sprintf_s(buffer, sizeof(buffer), " : %.3fms, Call : %d", Milliseconds, CallCount);
-		return buffer;
-	}
-
-	const wchar_t* GetConstWChar_t() const
-	{
-		static wchar_t buffer[64];
-		swprintf_s(buffer, _countof(buffer), L" : %.3fms, Call : %d", Milliseconds, CallCount);
-		return buffer;
-	}
-
-	const char* GetConstCharWithKey(const FString& Key) const
-	{
-		static char buffer[64]; // static으로 해야 반환 가능
-		sprintf_s(buffer, sizeof(buffer), "%s : %.3fms, Call : %d", Key.c_str(), Milliseconds, CallCount);
-		return buffer;
-	}
-
-	const wchar_t* GetConstWChar_tWithKey(const FString& Key) const
-	{
-		static wchar_t buffer[64];
-
-		swprintf_s(buffer, _countof(buffer), L"%s : %.3fms, Call : %d", std::wstring(Key.begin(), Key.end()).c_str(), Milliseconds, CallCount);
-		return buffer;
-	}
-};
-
 typedef FWindowsPlatformTime FPlatformTime;
 
 class FScopeCycleCounter
 {
 public:
-	FScopeCycleCounter(TStatId StatId)
+	// 이름 없는 카운터: 프로파일러에 기록하지 않고 Finish()로 경과 시간(ms)만 측정
+	FScopeCycleCounter()
 		: StartCycles(FPlatformTime::Cycles64()) //생성 시 사이클 저장
-		, UsedStatId(StatId) //키값 저장
-	{
-	}
-	FScopeCycleCounter() : StartCycles(FPlatformTime::Cycles64()), UsedStatId()
+		, bTiming(true)
 	{
 	}
 
-	FScopeCycleCounter(const FString& Key) : StartCycles(FPlatformTime::Cycles64()), UsedStatId(TStatId(Key))
+	// 프로파일러 스코프. 프로파일러가 꺼져 있으면 원자 변수 하나만 읽고 아무것도 하지 않는다
+	explicit FScopeCycleCounter(FProfileScopeId InScopeId)
 	{
+		if (FCpuProfiler::IsEnabled() && FCpuProfiler::BeginScope(InScopeId))
+		{
+			ScopeId = InScopeId;
+			bTiming = true;
+			StartCycles = FPlatformTime::Cycles64();
+		}
 	}
 
 	~FScopeCycleCounter()
@@ -129,35 +101,23 @@ public:
 
 	double Finish()
 	{
-		if (bIsFinish == true)
+		if (bIsFinish == true || bTiming == false)
 		{
 			return 0;
 		}
 		bIsFinish = true;
 		const uint64 EndCycles = FPlatformTime::Cycles64();
-		const uint64 CycleDiff = EndCycles - StartCycles;
 
-		double Milliseconds = FWindowsPlatformTime::ToMilliseconds(CycleDiff);
-		if (UsedStatId.Key.empty() == false)
+		if (ScopeId != INVALID_PROFILE_SCOPE)
 		{
-			AddTimeProfile(UsedStatId, Milliseconds); //키 값이 있을경우 Map에 저장
+			FCpuProfiler::EndScope(ScopeId, StartCycles, EndCycles); //스코프 ID가 있을 경우 프로파일러에 기록
 		}
-		return Milliseconds;
+		return FWindowsPlatformTime::ToMilliseconds(EndCycles - StartCycles);
 	}
 
-	static void AddTimeProfile(const TStatId& Key, double InMilliseconds);
-	static void TimeProfileInit();
-
-	//이거 왜 안됨?
-	//static const TMap<FString, FTimeProfile>& GetTimeProfiles();
-
-	static const TArray<FString> GetTimeProfileKeys();
-	static const TArray<FTimeProfile> GetTimeProfileValues();
-	static const FTimeProfile& GetTimeProfile(const FString& Key);
 private:
 	bool bIsFinish = false;
-	uint64 StartCycles;
-	TStatId UsedStatId;
-
+	bool bTiming = false;
+	FProfileScopeId ScopeId = INVALID_PROFILE_SCOPE;
+	uint64 StartCycles = 0;
 };
-
@@ -0,0 +1,1051 @@
+﻿#include "pch.h"
+#include "JsonDocument.h"
+#include "PlatformTime.h"
+#include <bit>
+#include <charconv>
+#include <emmintrin.h>
+
+namespace
+{
+	// SIMD 로드가 버퍼 끝을 넘지 않도록 문서 버퍼 뒤에 붙이는 0 패딩
+	constexpr size_t ParsePadding = 16;
+	constexpr int32 MaxParseDepth = 512;
+
+	inline bool IsJsonSpace(char C)
+	{
+		return C == ' ' || C == '\n' || C == '\r' || C == '\t';
+	}
+
+	inline bool NeedsEscape(char C)
+	{
+		return C == '\"' || C == '\\' || C == '\b' || C == '\f' || C == '\n' || C == '\r' || C == '\t';
+	}
+
+	bool NeedsEscape(std::string_view Str)
+	{
+		for (char C : Str)
+		{
+			if (NeedsEscape(C))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// json::json_escape와 같은 규칙 (제어 문자 중 \b \f \n \r \t만 이스케이프)
+	void AppendEscaped(std::string_view Str, FString& Out)
+	{
+		size_t RunStart = 0;
+		for (size_t i = 0; i < Str.size(); ++i)
+		{
+			const char* Escape = nullptr;
+			switch (Str[i])
+			{
+			case '\"': Escape = "\\\""; break;
+			case '\\': Escape = "\\\\"; break;
+			case '\b': Escape = "\\b"; break;
+			case '\f': Escape = "\\f"; break;
+			case '\n': Escape = "\\n"; break;
+			case '\r': Escape = "\\r"; break;
+			case '\t': Escape = "\\t"; break;
+			default: continue;
+			}
+			Out.append(Str.data() + RunStart, i - RunStart);
+			Out += Escape;
+			RunStart = i + 1;
+		}
+		Out.append(Str.data() + RunStart, Str.size() - RunStart);
+	}
+
+	FString EscapeString(std::string_view Str)
+	{
+		FString Out;
+		Out.reserve(Str.size());
+		AppendEscaped(Str, Out);
+		return Out;
+	}
+
+	// std::to_string(double)과 같은 "%f" 표기
+	void AppendFloat(double Value, FString& Out)
+	{
+		char Buffer[384];
+		const std::to_chars_result Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), Value, std::chars_format::fixed, 6);
+		Out.append(Buffer, Result.ptr);
+	}
+
+	void AppendInt(int64 Value, FString& Out)
+	{
+		char Buffer[24];
+		const std::to_chars_result Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), Value);
+		Out.append(Buffer, Result.ptr);
+	}
+
+	// dump()의 pad: depth 하나당 공백 2칸
+	inline void AppendPad(int32 Depth, FString& Out)
+	{
+		if (Depth > 0)
+		{
+			Out.append(static_cast<size_t>(Depth) * 2, ' ');
+		}
+	}
+
+	void WriteLegacy(const JSON& Json, int32 Depth, FString& Out)
+	{
+		switch (Json.JSONType())
+		{
+		case JSON::Class::Null:
+			Out += "null";
+			break;
+		case JSON::Class::Object:
+		{
+			Out += "{\n";
+			bool bFirst = true;
+			for (const auto& Pair : Json.ObjectRange())
+			{
+				if (!bFirst)
+				{
+					Out += ",\n";
+				}
+				AppendPad(Depth, Out);
+				Out += '\"';
+				Out += Pair.first;	// 기존 JSON은 이스케이프된 키를 그대로 보관한다
+				Out += "\" : ";
+				WriteLegacy(Pair.second, Depth + 1, Out);
+				bFirst = false;
+			}
+			Out += '\n';
+			AppendPad(Depth - 1, Out);
+			Out += '}';
+			break;
+		}
+		case JSON::Class::Array:
+		{
+			Out += '[';
+			bool bFirst = true;
+			for (const JSON& Item : Json.ArrayRange())
+			{
+				if (!bFirst)
+				{
+					Out += ", ";
+				}
+				WriteLegacy(Item, Depth + 1, Out);
+				bFirst = false;
+			}
+			Out += ']';
+			break;
+		}
+		case JSON::Class::String:
+			Out += '\"';
+			Out += Json.ToString();
+			Out += '\"';
+			break;
+		case JSON::Class::Floating:
+			AppendFloat(Json.ToFloat(), Out);
+			break;
+		case JSON::Class::Integral:
+			AppendInt(Json.ToInt(), Out);
+			break;
+		case JSON::Class::Boolean:
+			Out += Json.ToBool() ? "true" : "false";
+			break;
+		}
+	}
+
+	// std::map<string, JSON>의 순서(이스케이프된 키의 바이트 순)
+	bool LessMemberKey(const FJsonMember* A, const FJsonMember* B)
+	{
+		if (!NeedsEscape(A->Key) && !NeedsEscape(B->Key))
+		{
+			return A->Key < B->Key;
+		}
+		return EscapeString(A->Key) < EscapeString(B->Key);
+	}
+
+	void WriteValue(const FJsonValue& Value, int32 Depth, FString& Out, TArray<const FJsonMember*>& SortScratch)
+	{
+		switch (Value.Type)
+		{
+		case JSON::Class::Null:
+			Out += "null";
+			break;
+		case JSON::Class::Object:
+		{
+			// 기존 JSON과 같은 출력을 위해 키 정렬 + 중복 키는 마지막 값만 남긴다
+			const int32 Base = SortScratch.Num();
+			for (const FJsonMember* Member = Value.MemberBegin(); Member != Value.MemberEnd(); ++Member)
+			{
+				SortScratch.Add(Member);
+			}
+			std::stable_sort(SortScratch.begin() + Base, SortScratch.end(), LessMemberKey);
+
+			Out += "{\n";
+			bool bFirst = true;
+			for (int32 i = Base; i < SortScratch.Num(); ++i)
+			{
+				const FJsonMember* Member = SortScratch[i];
+				if (i + 1 < SortScratch.Num() && SortScratch[i + 1]->Key == Member->Key)
+				{
+					continue;
+				}
+				if (!bFirst)
+				{
+					Out += ",\n";
+				}
+				AppendPad(Depth, Out);
+				Out += '\"';
+				AppendEscaped(Member->Key, Out);
+				Out += "\" : ";
+				WriteValue(Member->Value, Depth + 1, Out, SortScratch);
+				bFirst = false;
+			}
+			SortScratch.resize(Base);
+			Out += '\n';
+			AppendPad(Depth - 1, Out);
+			Out += '}';
+			break;
+		}
+		case JSON::Class::Array:
+			Out += '[';
+			for (uint32 i = 0; i < Value.Count; ++i)
+			{
+				if (i > 0)
+				{
+					Out += ", ";
+				}
+				WriteValue(Value.Items[i], Depth + 1, Out, SortScratch);
+			}
+			Out += ']';
+			break;
+		case JSON::Class::String:
+			Out += '\"';
+			AppendEscaped(Value.AsString(), Out);
+			Out += '\"';
+			break;
+		case JSON::Class::Floating:
+			AppendFloat(Value.Float, Out);
+			break;
+		case JSON::Class::Integral:
+			AppendInt(Value.Int, Out);
+			break;
+		case JSON::Class::Boolean:
+			Out += Value.Bool ? "true" : "false";
+			break;
+		}
+	}
+
+	inline int32 HexDigit(char C)
+	{
+		if (C >= '0' && C <= '9') return C - '0';
+		if (C >= 'a' && C <= 'f') return C - 'a' + 10;
+		if (C >= 'A' && C <= 'F') return C - 'A' + 10;
+		return -1;
+	}
+
+	inline int32 ParseHex4(const char* Str)
+	{
+		int32 Value = 0;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			const int32 Digit = HexDigit(Str[i]);
+			if (Digit < 0)
+			{
+				return -1;
+			}
+			Value = (Value << 4) | Digit;
+		}
+		return Value;
+	}
+
+	// 코드 포인트를 UTF-8로 기록 (입력 이스케이프보다 항상 짧으므로 제자리 기록 가능)
+	char* WriteUTF8(uint32 CodePoint, char* Out)
+	{
+		if (CodePoint < 0x80)
+		{
+			*Out++ = static_cast<char>(CodePoint);
+		}
+		else if (CodePoint < 0x800)
+		{
+			*Out++ = static_cast<char>(0xC0 | (CodePoint >> 6));
+			*Out++ = static_cast<char>(0x80 | (CodePoint & 0x3F));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			*Out++ = static_cast<char>(0xE0 | (CodePoint >> 12));
+			*Out++ = static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+			*Out++ = static_cast<char>(0x80 | (CodePoint & 0x3F));
+		}
+		else
+		{
+			*Out++ = static_cast<char>(0xF0 | (CodePoint >> 18));
+			*Out++ = static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3F));
+			*Out++ = static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+			*Out++ = static_cast<char>(0x80 | (CodePoint & 0x3F));
+		}
+		return Out;
+	}
+}
+
+// ============================================================================
+// FJsonArena
+// ============================================================================
+
+void* FJsonArena::Allocate(size_t Size, size_t Alignment)
+{
+	// 블록 절반을 넘는 요청(문서 원문 복사 등)은 전용 블록으로 받아 현재 블록의 남은 공간을 버리지 않는다
+	if (Size > BlockSize / 2)
+	{
+		uint8* Block = static_cast<uint8*>(::operator new(Size));
+		Blocks.Add(Block);
+		ReservedBytes += Size;
+		UsedBytes += Size;
+		return Block;
+	}
+
+	uintptr_t Aligned = (reinterpret_cast<uintptr_t>(Cursor) + Alignment - 1) & ~static_cast<uintptr_t>(Alignment - 1);
+	if (Cursor == nullptr || Aligned + Size > reinterpret_cast<uintptr_t>(End))
+	{
+		uint8* Block = static_cast<uint8*>(::operator new(BlockSize));
+		Blocks.Add(Block);
+		ReservedBytes += BlockSize;
+		Cursor = Block;
+		End = Block + BlockSize;
+		Aligned = (reinterpret_cast<uintptr_t>(Cursor) + Alignment - 1) & ~static_cast<uintptr_t>(Alignment - 1);
+	}
+
+	Cursor = reinterpret_cast<uint8*>(Aligned + Size);
+	UsedBytes += Size;
+	return reinterpret_cast<void*>(Aligned);
+}
+
+void FJsonArena::Reset()
+{
+	for (uint8* Block : Blocks)
+	{
+		::operator delete(Block);
+	}
+	Blocks.Empty();
+	Cursor = nullptr;
+	End = nullptr;
+	UsedBytes = 0;
+	ReservedBytes = 0;
+}
+
+// ============================================================================
+// FJsonParser
+// ============================================================================
+
+/**
+ * @brief FJsonDocument 전용 제자리 파서
+ * @details 문자열은 문서 버퍼 안에서 바로 디코딩하고 닫는 따옴표 자리에 '\0'을 써서 C 문자열로도 쓸 수 있게 한다.
+ *          배열/오브젝트의 자식은 스크래치 스택에 쌓았다가 닫힐 때 개수만큼 아레나로 한 번에 옮긴다.
+ */
+class FJsonParser
+{
+public:
+	FJsonParser(FJsonDocument& InDocument, char* InBegin, char* InEnd)
+		: Document(InDocument), Begin(InBegin), Cur(InBegin), End(InEnd)
+	{
+	}
+
+	bool Run()
+	{
+		// UTF-8 BOM
+		if (End - Cur >= 3 && static_cast<uint8>(Cur[0]) == 0xEF && static_cast<uint8>(Cur[1]) == 0xBB && static_cast<uint8>(Cur[2]) == 0xBF)
+		{
+			Cur += 3;
+		}
+
+		if (!ParseValue(Document.Root, 0))
+		{
+			return false;
+		}
+		SkipWhitespace();
+		if (Cur != End)
+		{
+			return Fail("Unexpected trailing characters");
+		}
+		return true;
+	}
+
+private:
+	void SkipWhitespace()
+	{
+		// 토큰 사이에 공백이 없거나 한 칸뿐인 경우가 대부분이라 스칼라로 먼저 확인
+		if (!IsJsonSpace(*Cur))
+		{
+			return;
+		}
+		++Cur;
+		if (!IsJsonSpace(*Cur))
+		{
+			return;
+		}
+
+		// 들여쓰기 구간은 16바이트씩 건너뛴다. 버퍼 끝의 0 패딩은 공백이 아니므로 End를 넘지 않는다.
+		const __m128i Space = _mm_set1_epi8(' ');
+		const __m128i NewLine = _mm_set1_epi8('\n');
+		const __m128i Return = _mm_set1_epi8('\r');
+		const __m128i Tab = _mm_set1_epi8('\t');
+		for (;;)
+		{
+			const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Cur));
+			const __m128i IsSpace = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(Chunk, Space), _mm_cmpeq_epi8(Chunk, NewLine)),
+				_mm_or_si128(_mm_cmpeq_epi8(Chunk, Return), _mm_cmpeq_epi8(Chunk, Tab)));
+			const uint32 NonSpaceMask = ~static_cast<uint32>(_mm_movemask_epi8(IsSpace)) & 0xFFFFu;
+			if (NonSpaceMask != 0)
+			{
+				Cur += std::countr_zero(NonSpaceMask);
+				return;
+			}
+			Cur += 16;
+		}
+	}
+
+	bool ParseValue(FJsonValue& Out, int32 Depth)
+	{
+		SkipWhitespace();
+		++Document.Stats.NumValues;
+
+		switch (*Cur)
+		{
+		case '{':
+			return ParseObject(Out, Depth);
+		case '[':
+			return ParseArray(Out, Depth);
+		case '\"':
+		{
+			std::string_view Str;
+			if (!ParseString(Str))
+			{
+				return false;
+			}
+			Out.Type = JSON::Class::String;
+			Out.String = Str.data();
+			Out.Count = static_cast<uint32>(Str.size());
+			++Document.Stats.NumStrings;
+			return true;
+		}
+		case 't':
+			Out.Type = JSON::Class::Boolean;
+			Out.Bool = true;
+			return ParseLiteral("true", 4);
+		case 'f':
+			Out.Type = JSON::Class::Boolean;
+			Out.Bool = false;
+			return ParseLiteral("false", 5);
+		case 'n':
+			Out.Type = JSON::Class::Null;
+			return ParseLiteral("null", 4);
+		default:
+			if ((*Cur >= '0' && *Cur <= '9') || *Cur == '-')
+			{
+				return ParseNumber(Out);
+			}
+			return Fail(Cur == End ? "Unexpected end of input" : "Unexpected character");
+		}
+	}
+
+	bool ParseObject(FJsonValue& Out, int32 Depth)
+	{
+		if (Depth >= MaxParseDepth)
+		{
+			return Fail("Nesting too deep");
+		}
+
+		++Cur;
+		const int32 Base = MemberStack.Num();
+		SkipWhitespace();
+		if (*Cur != '}')
+		{
+			for (;;)
+			{
+				SkipWhitespace();
+				if (*Cur != '\"')
+				{
+					return Fail("Expected object key");
+				}
+
+				FJsonMember Member;
+				std::string_view Key;
+				if (!ParseString(Key))
+				{
+					return false;
+				}
+
+				// 같은 문서 안의 같은 키는 첫 등장 위치의 문자열과 해시를 공유한다
+				auto It = Document.InternedKeys.find(Key);
+				if (It == Document.InternedKeys.end())
+				{
+					It = Document.InternedKeys.emplace(Key, FJsonDocument::HashKey(Key)).first;
+				}
+				Member.Key = It->first;
+				Member.KeyHash = It->second;
+
+				SkipWhitespace();
+				if (*Cur != ':')
+				{
+					return Fail("Expected ':' after object key");
+				}
+				++Cur;
+
+				if (!ParseValue(Member.Value, Depth + 1))
+				{
+					return false;
+				}
+				MemberStack.Add(Member);
+
+				SkipWhitespace();
+				if (*Cur == ',')
+				{
+					++Cur;
+					continue;
+				}
+				if (*Cur == '}')
+				{
+					break;
+				}
+				return Fail("Expected ',' or '}' in object");
+			}
+		}
+		++Cur;
+
+		const int32 Count = MemberStack.Num() - Base;
+		Out.Type = JSON::Class::Object;
+		Out.Count = static_cast<uint32>(Count);
+		Out.Members = nullptr;
+		if (Count > 0)
+		{
+			FJsonMember* Members = Document.Arena.AllocateArray<FJsonMember>(Count);
+			std::copy(MemberStack.begin() + Base, MemberStack.end(), Members);
+			Out.Members = Members;
+		}
+		MemberStack.resize(Base);
+		Document.Stats.NumMembers += Count;
+		return true;
+	}
+
+	bool ParseArray(FJsonValue& Out, int32 Depth)
+	{
+		if (Depth >= MaxParseDepth)
+		{
+			return Fail("Nesting too deep");
+		}
+
+		++Cur;
+		const int32 Base = ValueStack.Num();
+		SkipWhitespace();
+		if (*Cur != ']')
+		{
+			for (;;)
+			{
+				FJsonValue Item;
+				if (!ParseValue(Item, Depth + 1))
+				{
+					return false;
+				}
+				ValueStack.Add(Item);
+
+				SkipWhitespace();
+				if (*Cur == ',')
+				{
+					++Cur;
+					continue;
+				}
+				if (*Cur == ']')
+				{
+					break;
+				}
+				return Fail("Expected ',' or ']' in array");
+			}
+		}
+		++Cur;
+
+		const int32 Count = ValueStack.Num() - Base;
+		Out.Type = JSON::Class::Array;
+		Out.Count = static_cast<uint32>(Count);
+		Out.Items = nullptr;
+		if (Count > 0)
+		{
+			FJsonValue* Items = Document.Arena.AllocateArray<FJsonValue>(Count);
+			std::copy(ValueStack.begin() + Base, ValueStack.end(), Items);
+			Out.Items = Items;
+		}
+		ValueStack.resize(Base);
+		return true;
+	}
+
+	// Cur는 여는 따옴표를 가리킨다
+	bool ParseString(std::string_view& Out)
+	{
+		++Cur;
+		char* const Start = Cur;
+		char* Write = nullptr;	// 첫 이스케이프를 만난 뒤부터 디코딩 결과를 앞쪽으로 당겨 쓴다
+
+		const __m128i Quote = _mm_set1_epi8('\"');
+		const __m128i Backslash = _mm_set1_epi8('\\');
+		const __m128i Zero = _mm_setzero_si128();
+		for (;;)
+		{
+			const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Cur));
+			const uint32 Mask = static_cast<uint32>(_mm_movemask_epi8(_mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(Chunk, Quote), _mm_cmpeq_epi8(Chunk, Backslash)),
+				_mm_cmpeq_epi8(Chunk, Zero))));
+			if (Mask == 0)
+			{
+				if (Write)
+				{
+					std::memmove(Write, Cur, 16);
+					Write += 16;
+				}
+				Cur += 16;
+				continue;
+			}
+
+			const int32 Offset = std::countr_zero(Mask);
+			if (Write)
+			{
+				std::memmove(Write, Cur, Offset);
+				Write += Offset;
+			}
+			Cur += Offset;
+
+			if (*Cur == '\"')
+			{
+				char* const StrEnd = Write ? Write : Cur;
+				*StrEnd = '\0';
+				Out = std::string_view(Start, StrEnd - Start);
+				++Cur;
+				return true;
+			}
+			if (*Cur == '\0')
+			{
+				if (Cur >= End)
+				{
+					return Fail("Unterminated string");
+				}
+				if (Write)
+				{
+					*Write++ = '\0';
+				}
+				++Cur;
+				continue;
+			}
+
+			if (!Write)
+			{
+				Write = Cur;
+			}
+			if (!DecodeEscape(Write))
+			{
+				return false;
+			}
+		}
+	}
+
+	// Cur는 '\\'를 가리킨다. 디코딩 결과를 Write에 기록하고 둘 다 전진시킨다.
+	bool DecodeEscape(char*& Write)
+	{
+		switch (Cur[1])
+		{
+		case '\"': *Write++ = '\"'; break;
+		case '\\': *Write++ = '\\'; break;
+		case '/': *Write++ = '/'; break;
+		case 'b': *Write++ = '\b'; break;
+		case 'f': *Write++ = '\f'; break;
+		case 'n': *Write++ = '\n'; break;
+		case 'r': *Write++ = '\r'; break;
+		case 't': *Write++ = '\t'; break;
+		case 'u':
+		{
+			int32 CodePoint = ParseHex4(Cur + 2);
+			if (CodePoint < 0)
+			{
+				return Fail("Expected 4 hex digits in unicode escape");
+			}
+			Cur += 6;
+
+			// 서로게이트 쌍
+			if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Cur[0] == '\\' && Cur[1] == 'u')
+			{
+				const int32 Low = ParseHex4(Cur + 2);
+				if (Low >= 0xDC00 && Low <= 0xDFFF)
+				{
+					CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+					Cur += 6;
+				}
+			}
+			Write = WriteUTF8(static_cast<uint32>(CodePoint), Write);
+			return true;
+		}
+		default:
+			return Fail("Invalid escape sequence");
+		}
+		Cur += 2;
+		return true;
+	}
+
+	bool ParseNumber(FJsonValue& Out)
+	{
+		char* const Start = Cur;
+		bool bFloating = false;
+		if (*Cur == '-')
+		{
+			++Cur;
+		}
+		for (;;)
+		{
+			const char C = *Cur;
+			if (C >= '0' && C <= '9')
+			{
+				++Cur;
+			}
+			else if (C == '.' || C == 'e' || C == 'E' || C == '+' || C == '-')
+			{
+				bFloating = true;
+				++Cur;
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		// 기존 파서와 같이 소수점/지수가 없으면 정수, 있으면 실수
+		if (!bFloating)
+		{
+			int64 IntValue = 0;
+			const std::from_chars_result Result = std::from_chars(Start, Cur, IntValue);
+			if (Result.ec == std::errc() && Result.ptr == Cur)
+			{
+				Out.Type = JSON::Class::Integral;
+				Out.Int = IntValue;
+				return true;
+			}
+			if (Result.ec != std::errc::result_out_of_range)
+			{
+				return Fail("Invalid number");
+			}
+			// int64 범위를 벗어나면 실수로 보관
+		}
+
+		double FloatValue = 0.0;
+		const std::from_chars_result Result = std::from_chars(Start, Cur, FloatValue);
+		if (Result.ec != std::errc() || Result.ptr != Cur)
+		{
+			return Fail("Invalid number");
+		}
+		Out.Type = JSON::Class::Floating;
+		Out.Float = FloatValue;
+		return true;
+	}
+
+	bool ParseLiteral(const char* Literal, size_t Length)
+	{
+		// 패딩 덕분에 End 근처에서도 Length 바이트 비교가 안전하다
+		if (std::memcmp(Cur, Literal, Length) != 0)
+		{
+			return Fail("Invalid literal");
+		}
+		Cur += Length;
+		return true;
+	}
+
+	bool Fail(const char* Message)
+	{
+		int32 Line = 1;
+		int32 Column = 1;
+		for (const char* It = Begin; It < Cur && It < End; ++It)
+		{
+			if (*It == '\n')
+			{
+				++Line;
+				Column = 1;
+			}
+			else
+			{
+				++Column;
+			}
+		}
+
+		char Buffer[256];
+		snprintf(Buffer, sizeof(Buffer), "%s (line %d, column %d)", Message, Line, Column);
+		Document.Error = Buffer;
+		return false;
+	}
+
+	FJsonDocument& Document;
+	char* Begin;
+	char* Cur;
+	char* End;
+	TArray<FJsonValue> ValueStack;
+	TArray<FJsonMember> MemberStack;
+};
+
+// ============================================================================
+// FJsonValue / FJsonDocument
+// ============================================================================
+
+const FJsonValue* FJsonValue::Find(std::string_view Key) const
+{
+	if (!IsObject())
+	{
+		return nullptr;
+	}
+
+	const uint32 Hash = FJsonDocument::HashKey(Key);
+	for (int32 i = static_cast<int32>(Count) - 1; i >= 0; --i)
+	{
+		if (Members[i].KeyHash == Hash && Members[i].Key == Key)
+		{
+			return &Members[i].Value;
+		}
+	}
+	return nullptr;
+}
+
+uint32 FJsonDocument::HashKey(std::string_view Key)
+{
+	// FNV-1a
+	uint32 Hash = 2166136261u;
+	for (char C : Key)
+	{
+		Hash ^= static_cast<uint8>(C);
+		Hash *= 16777619u;
+	}
+	return Hash;
+}
+
+void FJsonDocument::Reset()
+{
+	Arena.Reset();
+	Root = FJsonValue();
+	Error.clear();
+	Stats = FJsonDocumentStats();
+	InternedKeys.clear();
+}
+
+bool FJsonDocument::Parse(std::string_view Text)
+{
+	Reset();
+
+	// 원문을 아레나로 복사해 제자리 디코딩한다. 뒤쪽 0 패딩은 SIMD 로드와 리터럴 비교의 경계 검사를 대신한다.
+	char* Buffer = Arena.AllocateArray<char>(Text.size() + ParsePadding);
+	std::memcpy(Buffer, Text.data(), Text.size());
+	std::memset(Buffer + Text.size(), 0, ParsePadding);
+
+	FJsonParser Parser(*this, Buffer, Buffer + Text.size());
+	const bool bSuccess = Parser.Run();
+	if (!bSuccess)
+	{
+		Root = FJsonValue();
+	}
+
+	Stats.NumUniqueKeys = static_cast<int32>(InternedKeys.size());
+	Stats.ArenaBytes = Arena.GetReservedBytes();
+	return bSuccess;
+}
+
+JSON FJsonDocument::ToJSON() const
+{
+	return ToJSON(Root);
+}
+
+JSON FJsonDocument::ToJSON(const FJsonValue& Value)
+{
+	switch (Value.Type)
+	{
+	case JSON::Class::Object:
+	{
+		JSON Object = JSON::Make(JSON::Class::Object);
+		for (const FJsonMember* Member = Value.MemberBegin(); Member != Value.MemberEnd(); ++Member)
+		{
+			// 기존 파서는 키를 이스케이프된 형태로 보관한다 (Key.ToString())
+			Object[NeedsEscape(Member->Key) ? EscapeString(Member->Key) : FString(Member->Key)] = ToJSON(Member->Value);
+		}
+		return Object;
+	}
+	case JSON::Class::Array:
+	{
+		JSON Array = JSON::Make(JSON::Class::Array);
+		for (uint32 i = Value.Count; i > 0; --i)
+		{
+			// 뒤에서부터 채워 deque resize를 한 번만 하게 한다
+			Array[i - 1] = ToJSON(Value.Items[i - 1]);
+		}
+		return Array;
+	}
+	case JSON::Class::String:
+		return JSON(FString(Value.AsString()));
+	case JSON::Class::Floating:
+		return JSON(Value.Float);
+	case JSON::Class::Integral:
+		return JSON(static_cast<long>(Value.Int));
+	case JSON::Class::Boolean:
+		return JSON(Value.Bool);
+	default:
+		return JSON();
+	}
+}
+
+// ============================================================================
+// FJsonWriter
+// ============================================================================
+
+void FJsonWriter::Write(const JSON& Json, FString& Out)
+{
+	WriteLegacy(Json, 1, Out);
+}
+
+void FJsonWriter::Write(const FJsonValue& Value, FString& Out)
+{
+	TArray<const FJsonMember*> SortScratch;
+	WriteValue(Value, 1, Out, SortScratch);
+}
+
+void FJsonWriter::AppendEscaped(std::string_view Str, FString& Out)
+{
+	::AppendEscaped(Str, Out);
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+FJsonBenchmarkResult RunJsonBenchmark(const TArray<FWideString>& Directories, int32 Iterations)
+{
+	FJsonBenchmarkResult Result;
+	Result.Iterations = std::max(1, Iterations);
+
+	TArray<FString> Texts;
+	for (const FWideString& Directory : Directories)
+	{
+		std::error_code ErrorCode;
+		for (const fs::directory_entry& Entry : fs::recursive_directory_iterator(Directory, ErrorCode))
+		{
+			if (!Entry.is_regular_file())
+			{
+				continue;
+			}
+			FWideString Extension = Entry.path().extension().wstring();
+			std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::towlower);
+			if (Extension != L".scene" && Extension != L".prefab")
+			{
+				continue;
+			}
+
+			std::ifstream File(Entry.path(), std::ios::binary);
+			if (File.is_open())
+			{
+				Texts.Add(FString((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>()));
+				Result.TotalBytes += Texts.Last().size();
+			}
+		}
+	}
+	Result.NumFiles = Texts.Num();
+	if (Texts.IsEmpty())
+	{
+		return Result;
+	}
+
+	// 측정 대상이 최적화로 사라지지 않도록 결과 크기를 누적
+	size_t Sink = 0;
+
+	// 1. 기존 파서
+	uint64 Start = FPlatformTime::Cycles64();
+	for (int32 Iter = 0; Iter < Result.Iterations; ++Iter)
+	{
+		for (const FString& Text : Texts)
+		{
+			JSON Json = JSON::Load(Text);
+			Sink += Json.size();
+		}
+	}
+	Result.LegacyParseMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 2. 아레나 DOM
+	FJsonDocument Document;
+	Start = FPlatformTime::Cycles64();
+	for (int32 Iter = 0; Iter < Result.Iterations; ++Iter)
+	{
+		for (const FString& Text : Texts)
+		{
+			Document.Parse(Text);
+			Sink += Document.GetRoot().Num();
+		}
+	}
+	Result.DocumentParseMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 3. 아레나 DOM + 기존 JSON 변환 (FJsonSerializer::LoadJsonFromFile 경로)
+	Start = FPlatformTime::Cycles64();
+	for (int32 Iter = 0; Iter < Result.Iterations; ++Iter)
+	{
+		for (const FString& Text : Texts)
+		{
+			Document.Parse(Text);
+			JSON Json = Document.ToJSON();
+			Sink += Json.size();
+		}
+	}
+	Result.DocumentToJSONMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 4. 출력: dump() vs FJsonWriter
+	TArray<JSON> LegacyJsons;
+	LegacyJsons.Reserve(Texts.Num());
+	for (const FString& Text : Texts)
+	{
+		LegacyJsons.Add(JSON::Load(Text));
+	}
+
+	Start = FPlatformTime::Cycles64();
+	for (int32 Iter = 0; Iter < Result.Iterations; ++Iter)
+	{
+		for (const JSON& Json : LegacyJsons)
+		{
+			Sink += Json.dump().size();
+		}
+	}
+	Result.LegacyDumpMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	FString Output;
+	Start = FPlatformTime::Cycles64();
+	for (int32 Iter = 0; Iter < Result.Iterations; ++Iter)
+	{
+		for (const JSON& Json : LegacyJsons)
+		{
+			Output.clear();
+			FJsonWriter::Write(Json, Output);
+			Sink += Output.size();
+		}
+	}
+	Result.WriterMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 5. 검증: 두 파서 결과를 같은 형식으로 출력해 비교
+	for (int32 i = 0; i < Texts.Num(); ++i)
+	{
+		if (!Document.Parse(Texts[i]))
+		{
+			UE_LOG("[JsonBenchmark] Parse failed: %s", Document.GetError().c_str());
+			++Result.NumParseFailures;
+			continue;
+		}
+		Result.NumValues += Document.GetStats().NumValues;
+
+		const FString Expected = LegacyJsons[i].dump();
+		FString FromDocument;
+		FJsonWriter::Write(Document.GetRoot(), FromDocument);
+		FString FromWriter;
+		FJsonWriter::Write(LegacyJsons[i], FromWriter);
+		if (FromDocument != Expected || FromWriter != Expected || Document.ToJSON().dump() != Expected)
+		{
+			++Result.NumOutputMismatches;
+		}
+	}
+
+	if (Sink == 0)
+	{
+		UE_LOG("[JsonBenchmark] No values parsed");
+	}
+	return Result;
+}
@@ -0,0 +1,182 @@
+﻿#pragma once
+#include <cstddef>
+#include <string_view>
+#include "UEContainer.h"
+#include "nlohmann/json.hpp"
+
+/**
+ * @brief JSON DOM 전용 bump 할당기
+ * @details 값/멤버/문자열을 큰 블록 단위로 이어 붙여 할당하고, 문서가 사라질 때 블록째 해제한다.
+ *          개별 해제는 지원하지 않는다.
+ */
+class FJsonArena
+{
+public:
+	explicit FJsonArena(size_t InBlockSize = 64 * 1024) : BlockSize(InBlockSize) {}
+	~FJsonArena() { Reset(); }
+
+	FJsonArena(const FJsonArena&) = delete;
+	FJsonArena& operator=(const FJsonArena&) = delete;
+
+	void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t));
+
+	template<typename T>
+	T* AllocateArray(size_t Count)
+	{
+		return static_cast<T*>(Allocate(sizeof(T) * Count, alignof(T)));
+	}
+
+	// 모든 블록 해제
+	void Reset();
+
+	size_t GetUsedBytes() const { return UsedBytes; }
+	size_t GetReservedBytes() const { return ReservedBytes; }
+
+private:
+	TArray<uint8*> Blocks;
+	uint8* Cursor = nullptr;
+	uint8* End = nullptr;
+	size_t BlockSize;
+	size_t UsedBytes = 0;
+	size_t ReservedBytes = 0;
+};
+
+struct FJsonMember;
+
+/**
+ * @brief 아레나에 놓이는 읽기 전용 JSON 값
+ * @details 타입 분류는 기존 JSON::Class와 같다. 문자열은 문서 버퍼를 제자리에서 디코딩한 것을 가리키므로
+ *          복사가 없고, 배열/오브젝트는 아레나 위의 연속 배열이다. 문서(FJsonDocument)보다 오래 살 수 없다.
+ */
+struct FJsonValue
+{
+	JSON::Class Type = JSON::Class::Null;
+	uint32 Count = 0;	// 문자열 길이 / 배열 원소 수 / 오브젝트 멤버 수
+	union
+	{
+		bool Bool;
+		int64 Int = 0;
+		double Float;
+		const char* String;
+		const FJsonValue* Items;
+		const FJsonMember* Members;
+	};
+
+	bool IsNull() const { return Type == JSON::Class::Null; }
+	bool IsObject() const { return Type == JSON::Class::Object; }
+	bool IsArray() const { return Type == JSON::Class::Array; }
+	bool IsString() const { return Type == JSON::Class::String; }
+	bool IsNumber() const { return Type == JSON::Class::Integral || Type == JSON::Class::Floating; }
+
+	// 기존 JSON::ToXXX와 마찬가지로 타입이 다르면 기본값을 돌려준다
+	std::string_view AsString() const { return IsString() ? std::string_view(String, Count) : std::string_view(); }
+	int64 AsInt(int64 Default = 0) const { return Type == JSON::Class::Integral ? Int : Default; }
+	double AsFloat(double Default = 0.0) const
+	{
+		return Type == JSON::Class::Floating ? Float : (Type == JSON::Class::Integral ? static_cast<double>(Int) : Default);
+	}
+	bool AsBool(bool Default = false) const { return Type == JSON::Class::Boolean ? Bool : Default; }
+
+	// 배열 원소 / 오브젝트 멤버 수 (그 외 타입은 0)
+	int32 Num() const { return (IsArray() || IsObject()) ? static_cast<int32>(Count) : 0; }
+
+	const FJsonValue& operator[](int32 Index) const { return Items[Index]; }
+	const FJsonValue* begin() const { return IsArray() ? Items : nullptr; }
+	const FJsonValue* end() const { return IsArray() ? Items + Count : nullptr; }
+
+	const FJsonMember* MemberBegin() const;
+	const FJsonMember* MemberEnd() const;
+
+	// 키로 멤버 검색. 키가 중복되면 기존 파서처럼 마지막 값이 이긴다.
+	const FJsonValue* Find(std::string_view Key) const;
+};
+
+// 오브젝트 멤버. 같은 문서 안에서 같은 키는 하나의 인턴 문자열을 공유한다.
+struct FJsonMember
+{
+	std::string_view Key;
+	uint32 KeyHash = 0;
+	FJsonValue Value;
+};
+
+inline const FJsonMember* FJsonValue::MemberBegin() const { return IsObject() ? Members : nullptr; }
+inline const FJsonMember* FJsonValue::MemberEnd() const { return IsObject() ? Members + Count : nullptr; }
+
+struct FJsonDocumentStats
+{
+	int32 NumValues = 0;
+	int32 NumStrings = 0;
+	int32 NumMembers = 0;
+	int32 NumUniqueKeys = 0;
+	size_t ArenaBytes = 0;
+};
+
+/**
+ * @brief 아레나 기반 JSON 문서
+ * @details 입력을 아레나로 한 번 복사한 뒤 그 위에서 제자리 파싱한다.
+ *          공백/문자열 스캔은 SSE2로 16바이트씩 처리하고, 키는 문서 단위로 인턴된다.
+ *          \u 이스케이프는 UTF-8로 디코딩하며, 실패 시 예외 대신 false와 오류 위치(줄/열)를 남긴다.
+ */
+class FJsonDocument
+{
+public:
+	FJsonDocument() = default;
+	FJsonDocument(const FJsonDocument&) = delete;
+	FJsonDocument& operator=(const FJsonDocument&) = delete;
+
+	bool Parse(std::string_view Text);
+
+	const FJsonValue& GetRoot() const { return Root; }
+	const FString& GetError() const { return Error; }
+	const FJsonDocumentStats& GetStats() const { return Stats; }
+
+	// 기존 json::JSON 트리로 변환 (저장/편집 코드와의 호환용)
+	JSON ToJSON() const;
+	static JSON ToJSON(const FJsonValue& Value);
+
+	static uint32 HashKey(std::string_view Key);
+
+private:
+	void Reset();
+
+	FJsonArena Arena;
+	FJsonValue Root;
+	FString Error;
+	FJsonDocumentStats Stats;
+	TMap<std::string_view, uint32> InternedKeys;	// 키 -> 해시 (문서 버퍼 안의 첫 등장 위치를 가리킨다)
+
+	friend class FJsonParser;
+};
+
+/**
+ * @brief JSON 텍스트 출력
+ * @details 출력 형식은 json::JSON::dump()와 바이트 단위로 같다 (키 정렬, 들여쓰기, 실수 "%f" 표기 포함).
+ *          문자열 하나에 이어 쓰므로 노드마다 임시 문자열을 만드는 dump()보다 훨씬 적게 할당한다.
+ */
+class FJsonWriter
+{
+public:
+	static void Write(const JSON& Json, FString& Out);
+	static void Write(const FJsonValue& Value, FString& Out);
+
+	// 기존 JSON::ToString()/맵 키와 같은 규칙으로 이스케이프해 Out 뒤에 붙인다
+	static void AppendEscaped(std::string_view Str, FString& Out);
+};
+
+// Data/Scenes, Data/Prefabs 전체를 대상으로 기존 파서와 아레나 DOM을 비교한다
+struct FJsonBenchmarkResult
+{
+	int32 NumFiles = 0;
+	size_t TotalBytes = 0;
+	int32 NumValues = 0;
+	int32 Iterations = 0;
+	double LegacyParseMs = 0.0;		// JSON::Load
+	double DocumentParseMs = 0.0;	// FJsonDocument::Parse
+	double DocumentToJSONMs = 0.0;	// Parse + ToJSON (FJsonSerializer::LoadJsonFromFile 경로)
+	double LegacyDumpMs = 0.0;		// JSON::dump
+	double WriterMs = 0.0;			// FJsonWriter
+	int32 NumParseFailures = 0;
+	int32 NumOutputMismatches = 0;	// 두 경로의 출력이 다른 파일 수
+};
+
+FJsonBenchmarkResult RunJsonBenchmark(const TArray<FWideString>& Directories, int32 Iterations);
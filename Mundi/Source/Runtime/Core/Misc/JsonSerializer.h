@@ -16,6 +16,8 @@
 #include "GlobalConsole.h"
 #include "Vector.h"
 #include "Enums.h"
+#include "PathUtils.h"
+#include "JsonDocument.h"
 
 /**
  * @brief Level 직렬화에 관여하는 클래스
@@ -348,7 +350,11 @@ public:
 			{
 				return false;
 			}
-			File << std::setw(2) << InJsonData << "\n";
+			// dump()와 같은 형식이지만 노드마다 임시 문자열을 만들지 않는다
+			FString Text;
+			FJsonWriter::Write(InJsonData, Text);
+			Text += "\n";
+			File.write(Text.data(), Text.size());
 			File.close();
 			return true;
 		}
@@ -358,21 +364,42 @@ public:
 		}
 	}
 
+	/**
+	 * @brief 파일을 아레나 DOM으로 읽습니다. 읽기 전용으로 순회만 하는 경우 JSON 트리 변환 비용이 없습니다.
+	 * @return 파일을 열 수 없거나 문법 오류가 있으면 false (오류 위치는 로그로 남김)
+	 */
+	static bool LoadJsonDocumentFromFile(FJsonDocument& OutDocument, const FWideString& InFilePath)
+	{
+		std::ifstream File(InFilePath, std::ios::binary | std::ios::ate);
+		if (!File.is_open())
+		{
+			return false;
+		}
+
+		const std::streamoff FileSize = File.tellg();
+		File.seekg(0, std::ios::beg);
+		FString FileContent(static_cast<size_t>(std::max<std::streamoff>(FileSize, 0)), '\0');
+		File.read(FileContent.data(), FileContent.size());
+		File.close();
+
+		if (!OutDocument.Parse(FileContent))
+		{
+			UE_LOG("[JsonSerializer] %s 파싱에 실패했습니다: %s", WideToUTF8(InFilePath).c_str(), OutDocument.GetError().c_str());
+			return false;
+		}
+		return true;
+	}
+
 	static bool LoadJsonFromFile(JSON& OutJson, const FWideString& InFilePath)
 	{
 		try
 		{
-			std::ifstream File(InFilePath);
-			if (!File.is_open())
+			FJsonDocument Document;
+			if (!LoadJsonDocumentFromFile(Document, InFilePath))
 			{
 				return false;
 			}
-
-			FString FileContent((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
-			File.close();
-
-			std::cout << "[JsonSerializer] File Content Length: " << FileContent.length() << "\n";
-			OutJson = JSON::Load(FileContent);
+			OutJson = Document.ToJSON();
 			return true;
 		}
 		catch (const std::exception&)
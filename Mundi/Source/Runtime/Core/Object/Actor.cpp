@@ -11,6 +11,8 @@
 #include "World.h"
 #include "PrimitiveComponent.h"
 #include "GameObject.h"
+#include "CookedLevel.h"
+#include "WorldDuplication.h"
 #include "Source/Runtime/Engine/Animation/AnimationTypes.h"
 
 /*BEGIN_PROPERTIES(AActor)
@@ -102,7 +104,11 @@ void AActor::Destroy()
 
 	MarkPendingDestroy();
 
-	World->AddPendingKillActor(this);
+	// 풀에서 대기 중인 액터는 월드가 없다 (Acquire 시 ClearPendingDestroy로 되돌림)
+	if (World)
+	{
+		World->AddPendingKillActor(this);
+	}
 }
 
 void AActor::SetRootComponent(USceneComponent* InRoot)
@@ -282,6 +288,45 @@ void AActor::RegisterAllComponents(UWorld* InWorld)
 	}
 }
 
+void AActor::UnregisterAllComponents()
+{
+	for (UActorComponent* Component : OwnedComponents)
+	{
+		Component->UnregisterComponent();
+	}
+}
+
+void AActor::ResetForPool()
+{
+	CustomTimeDillation = 1.0f;
+	Tag = ArchetypeTag;
+	bActorHiddenInGame = bArchetypeHiddenInGame;
+	bActorIsActive = bArchetypeIsActive;
+
+	for (UActorComponent* Component : OwnedComponents)
+	{
+		if (Component)
+		{
+			Component->ResetForPool();
+		}
+	}
+}
+
+void AActor::CapturePoolArchetype()
+{
+	ArchetypeTag = Tag;
+	bArchetypeHiddenInGame = bActorHiddenInGame;
+	bArchetypeIsActive = bActorIsActive;
+
+	for (UActorComponent* Component : OwnedComponents)
+	{
+		if (Component)
+		{
+			Component->CapturePoolArchetype();
+		}
+	}
+}
+
 // 소유 중인 Component 전체 삭제
 void AActor::DestroyAllComponents()
 {
@@ -606,6 +651,55 @@ void AActor::DuplicateSubObjects()
 		return; // 복제할 컴포넌트가 없으면 종료
 	}
 
+	// 월드 일괄 복제 중: 전역 매핑 테이블에 기록하고 부모 재연결은 모든 액터 복제 후 한 번에 처리
+	if (FWorldDuplicationContext* BulkContext = FWorldDuplicationContext::GetActive())
+	{
+		USceneComponent* const OriginalRoot = RootComponent;
+		TSet<UActorComponent*> OriginalComponents = std::move(OwnedComponents);
+		OwnedComponents.Empty();
+		OwnedComponents.reserve(OriginalComponents.size());
+		SceneComponents.Empty();
+		RootComponent = nullptr;
+
+		for (UActorComponent* OriginalComp : OriginalComponents)
+		{
+			// 에디터 전용 컴포넌트는 PIE World로 복사하지 않음 (아래 기존 경로와 동일)
+			if (!OriginalComp || !OriginalComp->IsEditable())
+			{
+				continue;
+			}
+
+			UActorComponent* NewComp = OriginalComp->Duplicate();
+			NewComp->SetOwner(this);
+			OwnedComponents.insert(NewComp);
+			BulkContext->AddComponent(OriginalComp, NewComp);
+
+			if (USceneComponent* NewSceneComp = Cast<USceneComponent>(NewComp))
+			{
+				if (OriginalComp == OriginalRoot)
+				{
+					RootComponent = NewSceneComp;
+				}
+				else
+				{
+					SceneComponents.push_back(NewSceneComp);
+				}
+
+				// 루트도 다른 액터에 붙어 있을 수 있으므로 부모가 있으면 모두 예약
+				if (USceneComponent* OriginalParent = static_cast<USceneComponent*>(OriginalComp)->GetAttachParent())
+				{
+					BulkContext->AddPendingAttachment(NewSceneComp, OriginalParent);
+				}
+			}
+		}
+
+		if (RootComponent)
+		{
+			SceneComponents.insert(SceneComponents.begin(), RootComponent);
+		}
+		return;
+	}
+
 	// ========================================================================
 	// 1단계: 모든 컴포넌트 복제 및 '원본 -> 사본' 매핑 테이블 생성
 	// ========================================================================
@@ -707,10 +801,16 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		uint32 RootUUID;
 		FJsonSerializer::ReadUint32(InOutHandle, "RootComponentId", RootUUID);
 
-		JSON ComponentsJson;
-		if (FJsonSerializer::ReadArray(InOutHandle, "OwnedComponents", ComponentsJson))
+		// 쿠킹된 레벨에서 로드 중이면 컴포넌트가 이미 바이너리 레코드로 만들어져 있다
+		TArray<UActorComponent*> NewComponents;
+		if (!FCookedLevel::CreatePendingComponents(this, NewComponents))
 		{
-			// 1) OwnedComponents와 SceneComponents에 Component들 추가
+			JSON ComponentsJson;
+			if (!FJsonSerializer::ReadArray(InOutHandle, "OwnedComponents", ComponentsJson))
+			{
+				return;
+			}
+
 			for (uint32 i = 0; i < static_cast<uint32>(ComponentsJson.size()); ++i)
 			{
 				JSON ComponentJson = ComponentsJson.at(i);
@@ -723,37 +823,42 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 				UActorComponent* NewComponent = Cast<UActorComponent>(ObjectFactory::NewObject(NewClass));
 
 				NewComponent->Serialize(bInIsLoading, ComponentJson);
+				NewComponents.Add(NewComponent);
+			}
+		}
 
-				// RootComponent 설정
-				if (USceneComponent* NewSceneComponent = Cast<USceneComponent>(NewComponent))
+		// 1) OwnedComponents와 SceneComponents에 Component들 추가
+		for (UActorComponent* NewComponent : NewComponents)
+		{
+			// RootComponent 설정
+			if (USceneComponent* NewSceneComponent = Cast<USceneComponent>(NewComponent))
+			{
+				if (RootUUID == NewSceneComponent->GetSceneId())
 				{
-					if (RootUUID == NewSceneComponent->GetSceneId())
-					{
-						assert(NewSceneComponent);
-						SetRootComponent(NewSceneComponent);
-					}
+					assert(NewSceneComponent);
+					SetRootComponent(NewSceneComponent);
 				}
-
-				// OwnedComponents와 SceneComponents에 Component 추가
-				AddOwnedComponent(NewComponent);
 			}
 
-			// 2) 컴포넌트 간 부모 자식 관계 설정
-			for (auto& Component : OwnedComponents)
+			// OwnedComponents와 SceneComponents에 Component 추가
+			AddOwnedComponent(NewComponent);
+		}
+
+		// 2) 컴포넌트 간 부모 자식 관계 설정
+		for (auto& Component : OwnedComponents)
+		{
+			USceneComponent* SceneComp = Cast<USceneComponent>(Component);
+			if (!SceneComp)
 			{
-				USceneComponent* SceneComp = Cast<USceneComponent>(Component);
-				if (!SceneComp)
-				{
-					continue;
-				}
-				uint32 ParentId = SceneComp->GetParentId();
-				if (ParentId != 0) // RootComponent가 아니면 부모 설정
-				{
-					USceneComponent** ParentP = SceneComp->GetSceneIdMap().Find(ParentId);
-					USceneComponent* Parent = *ParentP;
+				continue;
+			}
+			uint32 ParentId = SceneComp->GetParentId();
+			if (ParentId != 0) // RootComponent가 아니면 부모 설정
+			{
+				USceneComponent** ParentP = SceneComp->GetSceneIdMap().Find(ParentId);
+				USceneComponent* Parent = *ParentP;
 
-					SceneComp->SetupAttachment(Parent, EAttachmentRule::KeepRelative);
-				}
+				SceneComp->SetupAttachment(Parent, EAttachmentRule::KeepRelative);
 			}
 		}
 	}
@@ -78,6 +78,7 @@ public:
     void RegisterAllComponents(UWorld* InWorld);
     void RegisterComponentTree(USceneComponent* SceneComp, UWorld* InWorld);
     void UnregisterComponentTree(USceneComponent* SceneComp);
+    void UnregisterAllComponents();   // 파괴 없이 등록만 해제 (액터 풀 반납용)
 
     // ===== 월드가 파괴 경로에서 호출할 "좁은 공개 API" =====
     void DestroyAllComponents();   // Unregister 이후 최종 파괴
@@ -85,6 +86,12 @@ public:
     // ===== 파괴 재진입 가드 =====
     bool IsPendingDestroy() const { return bPendingDestroy; }
     void MarkPendingDestroy() { bPendingDestroy = true; }
+    void ClearPendingDestroy() { bPendingDestroy = false; }   // 액터 풀이 삭제 대신 회수할 때만 사용
+
+    // 풀 반납 시 런타임 상태를 CapturePoolArchetype 시점으로 되돌림 (모든 컴포넌트의 ResetForPool 호출)
+    virtual void ResetForPool();
+    // 풀이 액터를 처음 만들 때 1회 호출: 스폰 직후 상태 저장 (모든 컴포넌트의 CapturePoolArchetype 호출)
+    virtual void CapturePoolArchetype();
 
     // ───────────────
     // Transform API
@@ -214,6 +221,11 @@ protected:
 
     float CustomTimeDillation;
 
+    // 액터 풀 재사용 시 되돌릴 스폰 직후 상태
+    FString ArchetypeTag;
+    bool bArchetypeHiddenInGame = false;
+    bool bArchetypeIsActive = true;
+
 private:
     FGameObject* LuaGameObject = nullptr;
 };
@@ -108,6 +108,24 @@ void UActorComponent::EndPlay()
     // 필요하다면 Override
 }
 
+// Override시 Super::ResetForPool() 권장
+void UActorComponent::ResetForPool()
+{
+    // 풀에 반납된 액터가 다시 꺼내질 때를 대비해 실행 중에 바뀐 상태를 스폰 직후 값으로 되돌림
+    // 액터 트랜스폼은 꺼낼 때 새로 지정됨
+    bIsActive = bArchetypeActive;
+    bHiddenInGame = bArchetypeHiddenInGame;
+    bTickEnabled = bArchetypeTickEnabled;
+}
+
+// Override시 Super::CapturePoolArchetype() 권장
+void UActorComponent::CapturePoolArchetype()
+{
+    bArchetypeActive = bIsActive;
+    bArchetypeHiddenInGame = bHiddenInGame;
+    bArchetypeTickEnabled = bTickEnabled;
+}
+
 void UActorComponent::DuplicateSubObjects()
 {
     Super::DuplicateSubObjects();
@@ -30,6 +30,10 @@ public:
     virtual void OnUnregister();                       // 내부 훅 (오버라이드 지점)
     void DestroyComponent();                           // 소멸
 
+    // ─────────────── 액터 풀
+    virtual void ResetForPool();                       // 풀 반납 시 런타임 상태를 스폰 직후로 되돌림 (등록 해제 후 호출)
+    virtual void CapturePoolArchetype();               // 풀이 액터를 처음 만들 때 호출: ResetForPool이 되돌아갈 스폰 직후 상태 저장
+
     // ─────────────── 활성화/틱
     void SetActive(bool bNewActive) { bIsActive = bNewActive; }
     bool IsActive() const { return bIsActive; }
@@ -87,6 +91,11 @@ protected:
     // 저장되지 않는 실시간 상태 변수
     bool bRegistered = false;       // RegisterComponent가 호출됐는가
     bool bPendingDestroy = false;   // DestroyComponent 의도 플래그, NOTE: 현재 작동 안함
+
+    // 액터 풀 재사용 시 되돌릴 스폰 직후 상태 (CapturePoolArchetype에서 저장)
+    bool bArchetypeActive = true;
+    bool bArchetypeHiddenInGame = false;
+    bool bArchetypeTickEnabled = true;
 public:
 	// 설정 가능한 데이터
 	UPROPERTY(EditAnywhere, Category = "렌더링")
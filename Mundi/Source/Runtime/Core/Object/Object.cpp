@@ -1,4 +1,5 @@
 ﻿#include "pch.h"
+#include "CookedLevel.h"
 
 void UObject::DeleteObjectDirty()
 {
@@ -18,6 +19,12 @@ FString UObject::GetComparisonName()
 // 리플렉션 기반 자동 직렬화 (현재 클래스의 프로퍼티만 처리)
 void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
+	// 쿠킹된 레벨에서 로드 중이면 리플렉션 프로퍼티는 이미 레코드로 채워져 있다
+	if (bInIsLoading && FCookedLevel::HasPreloadedProperties(this))
+	{
+		return;
+	}
+
 	const TArray<FProperty>& Properties = this->GetClass()->GetAllProperties();
 
 	for (const FProperty& Prop : Properties)
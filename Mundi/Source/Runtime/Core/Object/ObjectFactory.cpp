@@ -3,6 +3,29 @@
 // 전역 오브젝트 배열 정의 (한 번만!)
 TArray<UObject*> GUObjectArray;
 
+namespace
+{
+    // GUObjectArray에서 Obj의 슬롯을 Hint 위치부터 양방향으로 찾는다 (없으면 -1).
+    // 월드 파괴처럼 생성 순서대로 연달아 삭제하는 경우 직전 삭제 위치 근처에 있으므로 거의 바로 찾는다.
+    int32 FindObjectSlot(const UObject* Obj, int32 Hint)
+    {
+        const int32 Num = GUObjectArray.Num();
+        Hint = std::clamp(Hint, 0, Num);
+        for (int32 Low = Hint - 1, High = Hint; Low >= 0 || High < Num; --Low, ++High)
+        {
+            if (High < Num && GUObjectArray[High] == Obj)
+            {
+                return High;
+            }
+            if (Low >= 0 && GUObjectArray[Low] == Obj)
+            {
+                return Low;
+            }
+        }
+        return -1;
+    }
+}
+
 namespace ObjectFactory
 {
     TMap<UClass*, ConstructFunc>& GetRegistry()
@@ -82,21 +105,16 @@ namespace ObjectFactory
         if (!Obj) return;
 
         // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 foundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
-        {
-            if (GUObjectArray[i] == Obj)
-            {
-                foundIndex = i;
-                break;
-            }
-        }
+        // (그래서 InternalIndex 대신 직전 삭제 위치를 탐색 시작점으로 쓴다)
+        static int32 LastDeletedIndex = 0;
+        const int32 foundIndex = FindObjectSlot(Obj, LastDeletedIndex);
         if (foundIndex < 0)
         {
             // Not managed or already deleted.
             return;
         }
 
+        LastDeletedIndex = foundIndex;
         GUObjectArray[foundIndex] = nullptr;
         // Safe to delete now; Obj still valid since we found it in GUObjectArray
         Obj->DestroyInternal();
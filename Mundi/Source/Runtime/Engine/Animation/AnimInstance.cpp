@@ -227,13 +227,13 @@ void UAnimInstance::TriggerAnimNotifies(float DeltaSeconds)
 	for (int32 i = 0; i < ActiveAnimNotifyState.Num(); ++i)
 	{
 		const FAnimNotifyEvent& AnimNotifyEvent = ActiveAnimNotifyState[i];
-		LuaMgr->ExecuteNotifyStateEnd(AnimNotifyEvent.NotifyName.ToString(), AnimNotifyEvent.PropertyData, OwnerComponent, ActiveCurrentTime);
+		LuaMgr->ExecuteNotifyStateEnd(AnimNotifyEvent, OwnerComponent, ActiveCurrentTime);
 	}
 
 	// 4. 새로 시작하는 NotifyState → NotifyBegin 호출
 	for (const FAnimNotifyEvent* NotifyEvent : NotifyStateBeginEvents)
 	{
-		LuaMgr->ExecuteNotifyStateBegin(NotifyEvent->NotifyName.ToString(), NotifyEvent->PropertyData, OwnerComponent, ActiveCurrentTime);
+		LuaMgr->ExecuteNotifyStateBegin(*NotifyEvent, OwnerComponent, ActiveCurrentTime);
 	}
 
 	// 5. ActiveAnimNotifyState 교체
@@ -243,7 +243,7 @@ void UAnimInstance::TriggerAnimNotifies(float DeltaSeconds)
 	for (int32 i = 0; i < ActiveAnimNotifyState.Num(); ++i)
 	{
 		const FAnimNotifyEvent& AnimNotifyEvent = ActiveAnimNotifyState[i];
-		LuaMgr->ExecuteNotifyStateTick(AnimNotifyEvent.NotifyName.ToString(), AnimNotifyEvent.PropertyData, OwnerComponent, ActiveCurrentTime, DeltaSeconds);
+		LuaMgr->ExecuteNotifyStateTick(AnimNotifyEvent, OwnerComponent, ActiveCurrentTime, DeltaSeconds);
 	}
 }
 
@@ -327,8 +327,7 @@ void UAnimInstance::HandleNotify(const FAnimNotifyEvent& NotifyEvent)
 		return;
 	}
 
-	FString NotifyClassName = NotifyEvent.NotifyName.ToString();
-	LuaMgr->ExecuteNotify(NotifyClassName, NotifyEvent.PropertyData, OwnerComponent, NotifyEvent.TriggerTime, NotifyEvent.Duration);
+	LuaMgr->ExecuteNotify(NotifyEvent, OwnerComponent);
 }
 
 /**
@@ -361,8 +360,7 @@ void UAnimInstance::TriggerNotify(const FAnimNotifyEvent& NotifyEvent, USkeletal
 		return;
 	}
 
-	FString NotifyClassName = NotifyEvent.NotifyName.ToString();
-	LuaMgr->ExecuteNotify(NotifyClassName, NotifyEvent.PropertyData, MeshComp, NotifyEvent.TriggerTime, NotifyEvent.Duration);
+	LuaMgr->ExecuteNotify(NotifyEvent, MeshComp);
 }
 
 /**
@@ -182,13 +182,13 @@ void FAnimNode_StateMachine::Update(float DeltaSeconds)
 					for (int32 i = 0; i < ActiveAnimNotifyState.Num(); ++i)
 					{
 						const FAnimNotifyEvent& AnimNotifyEvent = ActiveAnimNotifyState[i];
-						LuaMgr->ExecuteNotifyStateEnd(AnimNotifyEvent.NotifyName.ToString(), AnimNotifyEvent.PropertyData, MeshComp, CurrentAnimTime);
+						LuaMgr->ExecuteNotifyStateEnd(AnimNotifyEvent, MeshComp, CurrentAnimTime);
 					}
 
 					// 4. 새로 시작하는 NotifyState → NotifyBegin 호출
 					for (const FAnimNotifyEvent* NotifyEvent : NotifyStateBeginEvents)
 					{
-						LuaMgr->ExecuteNotifyStateBegin(NotifyEvent->NotifyName.ToString(), NotifyEvent->PropertyData, MeshComp, CurrentAnimTime);
+						LuaMgr->ExecuteNotifyStateBegin(*NotifyEvent, MeshComp, CurrentAnimTime);
 					}
 
 					// 5. ActiveAnimNotifyState 교체
@@ -198,7 +198,7 @@ void FAnimNode_StateMachine::Update(float DeltaSeconds)
 					for (int32 i = 0; i < ActiveAnimNotifyState.Num(); ++i)
 					{
 						const FAnimNotifyEvent& AnimNotifyEvent = ActiveAnimNotifyState[i];
-						LuaMgr->ExecuteNotifyStateTick(AnimNotifyEvent.NotifyName.ToString(), AnimNotifyEvent.PropertyData, MeshComp, CurrentAnimTime, DeltaSeconds);
+						LuaMgr->ExecuteNotifyStateTick(AnimNotifyEvent, MeshComp, CurrentAnimTime, DeltaSeconds);
 					}
 				}
 			}
@@ -397,7 +397,7 @@ void FAnimNode_StateMachine::TransitionTo(FName NewStateName, float BlendTime)
 			{
 				for (const FAnimNotifyEvent& AnimNotifyEvent : ActiveAnimNotifyState)
 				{
-					LuaMgr->ExecuteNotifyStateEnd(AnimNotifyEvent.NotifyName.ToString(), AnimNotifyEvent.PropertyData, MeshComp, CurrentAnimTime);
+					LuaMgr->ExecuteNotifyStateEnd(AnimNotifyEvent, MeshComp, CurrentAnimTime);
 				}
 			}
 		}
@@ -0,0 +1,82 @@
+﻿#include "pch.h"
+#include "AnimNotifyPayload.h"
+#include "JsonDocument.h"
+#include <atomic>
+
+namespace
+{
+	std::atomic<uint32> GNextPayloadId{ 1 };
+}
+
+std::shared_ptr<const FAnimNotifyPayload> FAnimNotifyPayload::GetEmpty()
+{
+	static const std::shared_ptr<const FAnimNotifyPayload> EmptyPayload = std::make_shared<FAnimNotifyPayload>();
+	return EmptyPayload;
+}
+
+std::shared_ptr<const FAnimNotifyPayload> FAnimNotifyPayload::Parse(const FString& PropertyData)
+{
+	if (PropertyData.empty() || PropertyData == "{}")
+	{
+		return GetEmpty();
+	}
+
+	std::shared_ptr<FAnimNotifyPayload> Payload = std::make_shared<FAnimNotifyPayload>();
+
+	// JSON 트리를 만들지 않고 아레나 DOM에서 바로 읽는다
+	FJsonDocument Document;
+	if (!Document.Parse(PropertyData))
+	{
+		UE_LOG("[AnimNotify] Failed to parse PropertyData '%s': %s", PropertyData.c_str(), Document.GetError().c_str());
+	}
+	else
+	{
+		const FJsonValue& Props = Document.GetRoot();
+		for (const FJsonMember* Pair = Props.MemberBegin(); Pair != Props.MemberEnd(); ++Pair)
+		{
+			// 중복 키는 기존처럼 마지막 값만 사용
+			if (Props.Find(Pair->Key) != &Pair->Value)
+			{
+				continue;
+			}
+
+			const FJsonValue& Value = Pair->Value;
+
+			FAnimNotifyProperty Property;
+			Property.Key = FString(Pair->Key);
+
+			switch (Value.Type)
+			{
+			case JSON::Class::String:
+				Property.Type = EAnimNotifyPropertyType::String;
+				Property.StringValue = FString(Value.AsString());
+				break;
+			case JSON::Class::Floating:
+				Property.Type = EAnimNotifyPropertyType::Float;
+				Property.FloatValue = Value.AsFloat();
+				break;
+			case JSON::Class::Integral:
+				Property.Type = EAnimNotifyPropertyType::Int;
+				Property.IntValue = Value.AsInt();
+				break;
+			case JSON::Class::Boolean:
+				Property.Type = EAnimNotifyPropertyType::Bool;
+				Property.bBoolValue = Value.AsBool();
+				break;
+			default:
+				// 배열/오브젝트/null은 기존과 동일하게 무시
+				continue;
+			}
+
+			Payload->Properties.Add(std::move(Property));
+		}
+	}
+
+	if (Payload->IsEmpty())
+	{
+		return GetEmpty();
+	}
+
+	Payload->PayloadId = GNextPayloadId.fetch_add(1);
+	return Payload;
+}
@@ -0,0 +1,39 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <memory>
+
+enum class EAnimNotifyPropertyType : uint8
+{
+	String,
+	Float,
+	Int,
+	Bool,
+};
+
+// Notify PropertyData(JSON 오브젝트)의 키/값 하나
+struct FAnimNotifyProperty
+{
+	FString Key;
+	EAnimNotifyPropertyType Type = EAnimNotifyPropertyType::String;
+	FString StringValue;
+	double FloatValue = 0.0;
+	int64 IntValue = 0;
+	bool bBoolValue = false;
+};
+
+/**
+ * @brief 미리 파싱된 Notify PropertyData
+ * @details 시퀀스 로드/Notify 편집 시점에 한 번만 파싱하고, 이후에는 불변으로 공유한다.
+ *          PayloadId는 Lua 쪽에서 페이로드별 테이블을 캐시할 때 키로 사용한다 (0 = 빈 페이로드).
+ */
+struct FAnimNotifyPayload
+{
+	uint32 PayloadId = 0;
+	TArray<FAnimNotifyProperty> Properties;
+
+	bool IsEmpty() const { return Properties.Num() == 0; }
+
+	// PropertyData 문자열을 파싱한다. 비어 있거나 "{}"면 공유된 빈 페이로드를 반환
+	static std::shared_ptr<const FAnimNotifyPayload> Parse(const FString& PropertyData);
+	static std::shared_ptr<const FAnimNotifyPayload> GetEmpty();
+};
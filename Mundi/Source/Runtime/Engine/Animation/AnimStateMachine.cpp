@@ -451,6 +451,7 @@ void UAnimStateMachine::Load(const FString& InFilePath, ID3D11Device* InDevice)
                         FJsonSerializer::ReadFloat(NotifyJson, "Duration", NotifyEvent.Duration);
                         FJsonSerializer::ReadInt32(NotifyJson, "TrackIndex", NotifyEvent.TrackIndex);
                         FJsonSerializer::ReadString(NotifyJson, "PropertyData", NotifyEvent.PropertyData);
+                        NotifyEvent.SetPropertyData(NotifyEvent.PropertyData);
                         NotifyEvent.NotifyName = FName(NotifyName);
                         LoadedNode->StateEntryNotifies.Add(NotifyEvent);
                     }
@@ -470,6 +471,7 @@ void UAnimStateMachine::Load(const FString& InFilePath, ID3D11Device* InDevice)
                         FJsonSerializer::ReadFloat(NotifyJson, "Duration", NotifyEvent.Duration);
                         FJsonSerializer::ReadInt32(NotifyJson, "TrackIndex", NotifyEvent.TrackIndex);
                         FJsonSerializer::ReadString(NotifyJson, "PropertyData", NotifyEvent.PropertyData);
+                        NotifyEvent.SetPropertyData(NotifyEvent.PropertyData);
                         NotifyEvent.NotifyName = FName(NotifyName);
                         LoadedNode->StateExitNotifies.Add(NotifyEvent);
                     }
@@ -489,6 +491,7 @@ void UAnimStateMachine::Load(const FString& InFilePath, ID3D11Device* InDevice)
                         FJsonSerializer::ReadFloat(NotifyJson, "Duration", NotifyEvent.Duration);
                         FJsonSerializer::ReadInt32(NotifyJson, "TrackIndex", NotifyEvent.TrackIndex);
                         FJsonSerializer::ReadString(NotifyJson, "PropertyData", NotifyEvent.PropertyData);
+                        NotifyEvent.SetPropertyData(NotifyEvent.PropertyData);
                         NotifyEvent.NotifyName = FName(NotifyName);
                         LoadedNode->StateFullyBlendedNotifies.Add(NotifyEvent);
                     }
@@ -553,6 +556,7 @@ void UAnimStateMachine::Load(const FString& InFilePath, ID3D11Device* InDevice)
                         FJsonSerializer::ReadFloat(NotifyJson, "Duration", NotifyEvent.Duration);
                         FJsonSerializer::ReadInt32(NotifyJson, "TrackIndex", NotifyEvent.TrackIndex);
                         FJsonSerializer::ReadString(NotifyJson, "PropertyData", NotifyEvent.PropertyData);
+                        NotifyEvent.SetPropertyData(NotifyEvent.PropertyData);
                         NotifyEvent.NotifyName = FName(NotifyName);
                         NewTrans->TransitionNotifies.Add(NotifyEvent);
                     }
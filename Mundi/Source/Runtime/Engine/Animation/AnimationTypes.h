@@ -3,6 +3,7 @@
 #include "UEContainer.h"
 #include "Archive.h"
 #include "Name.h"
+#include "AnimNotifyPayload.h"
 
 /**
  * @brief Animation Notify 이벤트
@@ -22,6 +23,9 @@ struct FAnimNotifyEvent
 	int32 TrackIndex;
 	FString PropertyData;
 
+	// PropertyData 파싱 결과 (복사본끼리 공유, 디스패치 때마다 다시 파싱하지 않음)
+	mutable std::shared_ptr<const FAnimNotifyPayload> CachedPayload;
+
 	FAnimNotifyEvent()
 		: TriggerTime(0.0f)
 		, Duration(0.0f)
@@ -41,6 +45,23 @@ struct FAnimNotifyEvent
 	{
 	}
 
+	// PropertyData 편집 시 반드시 이 함수로 변경해야 캐시가 갱신된다
+	void SetPropertyData(const FString& InPropertyData)
+	{
+		PropertyData = InPropertyData;
+		CachedPayload = FAnimNotifyPayload::Parse(PropertyData);
+	}
+
+	// 로드 경로에서 파싱되지 않았다면 최초 접근 시 한 번만 파싱
+	const FAnimNotifyPayload& GetPayload() const
+	{
+		if (!CachedPayload)
+		{
+			CachedPayload = FAnimNotifyPayload::Parse(PropertyData);
+		}
+		return *CachedPayload;
+	}
+
 	bool operator<(const FAnimNotifyEvent& Other) const
 	{
 		return TriggerTime < Other.TriggerTime;
@@ -70,6 +91,7 @@ struct FAnimNotifyEvent
 			Ar << Event.TriggerWeightThreshold;
 			Ar << Event.TrackIndex;
 			Serialization::ReadString(Ar, Event.PropertyData);
+			Event.CachedPayload = FAnimNotifyPayload::Parse(Event.PropertyData);
 		}
 		return Ar;
 	}
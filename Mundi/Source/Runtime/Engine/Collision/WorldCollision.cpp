@@ -0,0 +1,521 @@
+﻿#include "pch.h"
+#include "WorldCollision.h"
+#include "BVHierarchy.h"
+#include "Collision.h"
+#include "OBB.h"
+#include "Picking.h"
+#include "MeshBVH.h"
+#include "ResourceManager.h"
+#include "StaticMesh.h"
+#include "StaticMeshComponent.h"
+#include "SkinnedMeshComponent.h"
+#include "ShapeComponent.h"
+#include "WorldPartitionManager.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	enum class ESweepShape : uint8
+	{
+		Line,
+		Sphere,
+		Box
+	};
+
+	struct FSweep
+	{
+		FVector Start;
+		FVector Direction;      // 정규화된 방향
+		FVector InvDirection;
+		float Length = 0.0f;
+		ESweepShape Shape = ESweepShape::Line;
+		float Radius = 0.0f;
+		FVector Extent;         // 브로드 페이즈에서 노드 AABB를 부풀릴 크기
+	};
+
+	float SafeInverse(float Value)
+	{
+		if (std::fabs(Value) < 1e-20f)
+		{
+			Value = (Value < 0.0f) ? -1e-20f : 1e-20f;
+		}
+		return 1.0f / Value;
+	}
+
+	FSweep MakeSweep(const FVector& Start, const FVector& End, ESweepShape Shape, float Radius, const FVector& Extent)
+	{
+		FSweep Sweep;
+		Sweep.Start = Start;
+		const FVector Delta = End - Start;
+		Sweep.Length = Delta.Size();
+		// 길이 0인 트레이스는 시작 지점 겹침만 검사한다 (방향은 임의)
+		Sweep.Direction = (Sweep.Length > KINDA_SMALL_NUMBER) ? Delta / Sweep.Length : FVector(0.0f, 0.0f, 1.0f);
+		Sweep.InvDirection = FVector(SafeInverse(Sweep.Direction.X), SafeInverse(Sweep.Direction.Y), SafeInverse(Sweep.Direction.Z));
+		Sweep.Shape = Shape;
+		Sweep.Radius = Radius;
+		Sweep.Extent = Extent;
+		return Sweep;
+	}
+
+	ECollisionObjectType GetObjectType(UPrimitiveComponent* Component)
+	{
+		if (Cast<UStaticMeshComponent>(Component))
+		{
+			return ECollisionObjectType::StaticMesh;
+		}
+		if (Cast<USkinnedMeshComponent>(Component))
+		{
+			return ECollisionObjectType::SkeletalMesh;
+		}
+		if (Cast<UShapeComponent>(Component))
+		{
+			return ECollisionObjectType::Shape;
+		}
+		return ECollisionObjectType::Other;
+	}
+
+	bool PassesFilter(UPrimitiveComponent* Component, ECollisionObjectType Type, const FCollisionQueryParams& Params)
+	{
+		if (!HasObjectType(Params.ObjectTypes, Type) || Component->IsPendingDestroy())
+		{
+			return false;
+		}
+		AActor* Owner = Component->GetOwner();
+		return Owner && Owner != Params.IgnoreActor && !Owner->IsPendingDestroy() && Owner->IsActorActive();
+	}
+
+	// 시작점이 이미 안쪽이면 t = 0, 노멀은 진행 반대 방향
+	bool IntersectBox(const FVector& Min, const FVector& Max, const FSweep& Sweep, float MaxDistance, float& OutT, FVector& OutNormal)
+	{
+		float Enter = 0.0f;
+		float Exit = MaxDistance;
+		int32 EnterAxis = -1;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			float T0 = (Min[Axis] - Sweep.Start[Axis]) * Sweep.InvDirection[Axis];
+			float T1 = (Max[Axis] - Sweep.Start[Axis]) * Sweep.InvDirection[Axis];
+			if (T0 > T1) std::swap(T0, T1);
+			if (T0 > Enter)
+			{
+				Enter = T0;
+				EnterAxis = Axis;
+			}
+			Exit = std::min(Exit, T1);
+			if (Enter > Exit)
+			{
+				return false;
+			}
+		}
+
+		OutT = Enter;
+		OutNormal = -Sweep.Direction;
+		if (EnterAxis >= 0)
+		{
+			OutNormal = FVector(0.0f, 0.0f, 0.0f);
+			OutNormal[EnterAxis] = (Sweep.Direction[EnterAxis] > 0.0f) ? -1.0f : 1.0f;
+		}
+		return true;
+	}
+
+	bool IntersectSphere(const FVector& Center, float Radius, const FSweep& Sweep, float MaxDistance, float& OutT, FVector& OutNormal)
+	{
+		const FVector M = Sweep.Start - Center;
+		const float C = FVector::Dot(M, M) - Radius * Radius;
+		if (C <= 0.0f)
+		{
+			OutT = 0.0f;
+			OutNormal = -Sweep.Direction;
+			return true;
+		}
+
+		const float B = FVector::Dot(M, Sweep.Direction);
+		if (B > 0.0f)
+		{
+			return false;
+		}
+		const float Discriminant = B * B - C;
+		if (Discriminant < 0.0f)
+		{
+			return false;
+		}
+
+		const float T = -B - std::sqrt(Discriminant);
+		if (T > MaxDistance)
+		{
+			return false;
+		}
+		OutT = std::max(T, 0.0f);
+		OutNormal = (Sweep.Start + Sweep.Direction * OutT - Center) / Radius;
+		return true;
+	}
+
+	// 캡슐 = 원기둥 옆면 + 양 끝 구. 세 후보 중 가장 가까운 진입점이 캡슐 표면이다
+	bool IntersectCapsule(const FVector& P0, const FVector& P1, float Radius, const FSweep& Sweep, float MaxDistance, float& OutT, FVector& OutNormal)
+	{
+		bool bHit = false;
+		float BestT = MaxDistance;
+
+		const FVector Axis = P1 - P0;
+		const FVector M = Sweep.Start - P0;
+		const float AxisLengthSq = FVector::Dot(Axis, Axis);
+		if (AxisLengthSq > KINDA_SMALL_NUMBER)
+		{
+			// 시작점이 캡슐 안쪽인지 먼저 확인
+			const float S0 = std::clamp(FVector::Dot(M, Axis) / AxisLengthSq, 0.0f, 1.0f);
+			const FVector Closest0 = P0 + Axis * S0;
+			if ((Sweep.Start - Closest0).SizeSquared() <= Radius * Radius)
+			{
+				OutT = 0.0f;
+				OutNormal = -Sweep.Direction;
+				return true;
+			}
+
+			const float MD = FVector::Dot(M, Axis);
+			const float ND = FVector::Dot(Sweep.Direction, Axis);
+			const float MN = FVector::Dot(M, Sweep.Direction);
+			const float A = AxisLengthSq - ND * ND;
+			const float K = FVector::Dot(M, M) - Radius * Radius;
+			const float C = AxisLengthSq * K - MD * MD;
+			const float B = AxisLengthSq * MN - ND * MD;
+			const float Discriminant = B * B - A * C;
+			if (std::fabs(A) > KINDA_SMALL_NUMBER && Discriminant >= 0.0f)
+			{
+				const float T = (-B - std::sqrt(Discriminant)) / A;
+				const float S = MD + T * ND;
+				if (T >= 0.0f && T <= BestT && S >= 0.0f && S <= AxisLengthSq)
+				{
+					const FVector HitPoint = Sweep.Start + Sweep.Direction * T;
+					BestT = T;
+					OutNormal = (HitPoint - (P0 + Axis * (S / AxisLengthSq))) / Radius;
+					bHit = true;
+				}
+			}
+		}
+
+		float CapT;
+		FVector CapNormal;
+		if (IntersectSphere(P0, Radius, Sweep, BestT, CapT, CapNormal) && (!bHit || CapT < BestT))
+		{
+			BestT = CapT;
+			OutNormal = CapNormal;
+			bHit = true;
+		}
+		if (IntersectSphere(P1, Radius, Sweep, BestT, CapT, CapNormal) && (!bHit || CapT < BestT))
+		{
+			BestT = CapT;
+			OutNormal = CapNormal;
+			bHit = true;
+		}
+
+		if (bHit)
+		{
+			OutT = BestT;
+		}
+		return bHit;
+	}
+
+	// OBB 로컬 축으로 옮겨 슬랩 테스트 (Inflate만큼 모든 면을 밀어낸다)
+	bool IntersectOBB(const FOBB& Box, float Inflate, const FSweep& Sweep, float MaxDistance, float& OutT, FVector& OutNormal)
+	{
+		const FVector Offset = Sweep.Start - Box.Center;
+		float Enter = 0.0f;
+		float Exit = MaxDistance;
+		int32 EnterAxis = -1;
+		float EnterSign = 1.0f;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float LocalOrigin = FVector::Dot(Offset, Box.Axes[Axis]);
+			const float LocalDirection = FVector::Dot(Sweep.Direction, Box.Axes[Axis]);
+			const float HalfExtent = Box.HalfExtent[Axis] + Inflate;
+			const float InvDirection = SafeInverse(LocalDirection);
+
+			float T0 = (-HalfExtent - LocalOrigin) * InvDirection;
+			float T1 = (HalfExtent - LocalOrigin) * InvDirection;
+			if (T0 > T1) std::swap(T0, T1);
+			if (T0 > Enter)
+			{
+				Enter = T0;
+				EnterAxis = Axis;
+				EnterSign = (LocalDirection > 0.0f) ? -1.0f : 1.0f;
+			}
+			Exit = std::min(Exit, T1);
+			if (Enter > Exit)
+			{
+				return false;
+			}
+		}
+
+		OutT = Enter;
+		OutNormal = (EnterAxis >= 0) ? Box.Axes[EnterAxis] * EnterSign : -Sweep.Direction;
+		return true;
+	}
+
+	// 스태틱 메시 로컬 공간으로 광선을 옮겨 FMeshBVH로 삼각형 단위 판정.
+	// 방향은 월드 단위 벡터를 그대로 변환하므로 로컬 t가 곧 월드 거리다.
+	bool IntersectStaticMesh(UStaticMeshComponent* Component, const FSweep& Sweep, float MaxDistance, float& OutT, FVector& OutNormal)
+	{
+		UStaticMesh* Mesh = Component->GetStaticMesh();
+		FStaticMesh* MeshAsset = Mesh ? Mesh->GetStaticMeshAsset() : nullptr;
+		if (!MeshAsset)
+		{
+			return false;
+		}
+		FMeshBVH* MeshBVH = UResourceManager::GetInstance().GetOrBuildMeshBVH(Mesh->GetAssetPathFileName(), MeshAsset);
+		if (!MeshBVH)
+		{
+			return false;
+		}
+
+		const FMatrix WorldMatrix = Component->GetWorldMatrix();
+		const FMatrix InvWorld = WorldMatrix.InverseAffine();
+		const FRay LocalRay{ InvWorld.TransformPosition(Sweep.Start), InvWorld.TransformVector(Sweep.Direction) };
+
+		float HitT;
+		uint32 TriangleId;
+		if (!MeshBVH->IntersectRay(LocalRay, HitT, &TriangleId) || HitT > MaxDistance)
+		{
+			return false;
+		}
+
+		// 비균등 스케일에서도 맞도록 월드로 옮긴 두 변의 외적으로 노멀 계산
+		const FVector& A = MeshAsset->Vertices[MeshAsset->Indices[3 * TriangleId + 0]].pos;
+		const FVector& B = MeshAsset->Vertices[MeshAsset->Indices[3 * TriangleId + 1]].pos;
+		const FVector& C = MeshAsset->Vertices[MeshAsset->Indices[3 * TriangleId + 2]].pos;
+		FVector Normal = FVector::Cross(WorldMatrix.TransformVector(B - A), WorldMatrix.TransformVector(C - A)).GetSafeNormal();
+		if (Normal.SizeSquared() == 0.0f)
+		{
+			Normal = -Sweep.Direction;
+		}
+		else if (FVector::Dot(Normal, Sweep.Direction) > 0.0f)
+		{
+			Normal = -Normal;
+		}
+
+		OutT = HitT;
+		OutNormal = Normal;
+		return true;
+	}
+
+	bool IntersectComponent(UPrimitiveComponent* Component, ECollisionObjectType Type, const FAABB& WorldBox, const FSweep& Sweep, float MaxDistance, const FCollisionQueryParams& Params, float& OutT, FVector& OutNormal)
+	{
+		if (Type == ECollisionObjectType::Shape && Sweep.Shape != ESweepShape::Box)
+		{
+			UShapeComponent* ShapeComponent = static_cast<UShapeComponent*>(Component);
+			FShape Shape;
+			ShapeComponent->GetShape(Shape);
+			const FTransform Transform = ShapeComponent->GetWorldTransform();
+			const float Inflate = (Sweep.Shape == ESweepShape::Sphere) ? Sweep.Radius : 0.0f;
+
+			switch (Shape.Kind)
+			{
+			case EShapeKind::Sphere:
+			{
+				const float Radius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(Transform.Scale3D);
+				return IntersectSphere(Transform.Translation, Radius + Inflate, Sweep, MaxDistance, OutT, OutNormal);
+			}
+			case EShapeKind::Capsule:
+			{
+				FVector P0, P1;
+				float Radius;
+				Collision::BuildCapsule(Shape, Transform, P0, P1, Radius);
+				return IntersectCapsule(P0, P1, Radius + Inflate, Sweep, MaxDistance, OutT, OutNormal);
+			}
+			case EShapeKind::Box:
+			{
+				FOBB Box;
+				Collision::BuildOBB(Shape, Transform, Box);
+				return IntersectOBB(Box, Inflate, Sweep, MaxDistance, OutT, OutNormal);
+			}
+			default:
+				break;
+			}
+		}
+
+		if (Type == ECollisionObjectType::StaticMesh && Sweep.Shape == ESweepShape::Line && Params.bTraceComplex)
+		{
+			return IntersectStaticMesh(static_cast<UStaticMeshComponent*>(Component), Sweep, MaxDistance, OutT, OutNormal);
+		}
+
+		// 나머지는 스윕 형상만큼 부풀린 월드 AABB
+		return IntersectBox(WorldBox.Min - Sweep.Extent, WorldBox.Max + Sweep.Extent, Sweep, MaxDistance, OutT, OutNormal);
+	}
+
+	void FillHit(FHitResult& OutHit, UPrimitiveComponent* Component, const FSweep& Sweep, float T, const FVector& Normal)
+	{
+		OutHit.bBlockingHit = true;
+		OutHit.Component = Component;
+		OutHit.Actor = Component->GetOwner();
+		OutHit.Location = Sweep.Start + Sweep.Direction * T;
+		OutHit.Normal = Normal;
+		OutHit.Distance = T;
+		OutHit.Time = (Sweep.Length > 0.0f) ? T / Sweep.Length : 0.0f;
+	}
+
+	bool SweepSingle(const FBVHierarchy* BVH, FHitResult& OutHit, const FSweep& Sweep, const FCollisionQueryParams& Params)
+	{
+		OutHit = FHitResult();
+		if (!BVH)
+		{
+			return false;
+		}
+
+		BVH->TraverseRay(Sweep.Start, Sweep.InvDirection, Sweep.Extent, Sweep.Length,
+			[&](UPrimitiveComponent* Component, const FAABB& WorldBox, float MaxDistance) -> float
+			{
+				const ECollisionObjectType Type = GetObjectType(Component);
+				if (!PassesFilter(Component, Type, Params))
+				{
+					return MaxDistance;
+				}
+
+				float HitT;
+				FVector HitNormal;
+				if (!IntersectComponent(Component, Type, WorldBox, Sweep, MaxDistance, Params, HitT, HitNormal))
+				{
+					return MaxDistance;
+				}
+				if (OutHit.bBlockingHit && HitT >= OutHit.Distance)
+				{
+					return MaxDistance;
+				}
+				FillHit(OutHit, Component, Sweep, HitT, HitNormal);
+				return HitT;
+			});
+
+		return OutHit.bBlockingHit;
+	}
+}
+
+namespace WorldCollision
+{
+	bool LineTraceSingle(const FBVHierarchy* BVH, FHitResult& OutHit, const FVector& Start, const FVector& End, const FCollisionQueryParams& Params)
+	{
+		const FSweep Sweep = MakeSweep(Start, End, ESweepShape::Line, 0.0f, FVector(0.0f, 0.0f, 0.0f));
+		return SweepSingle(BVH, OutHit, Sweep, Params);
+	}
+
+	int32 LineTraceMulti(const FBVHierarchy* BVH, TArray<FHitResult>& OutHits, const FVector& Start, const FVector& End, const FCollisionQueryParams& Params)
+	{
+		OutHits.clear();
+		if (!BVH)
+		{
+			return 0;
+		}
+
+		const FSweep Sweep = MakeSweep(Start, End, ESweepShape::Line, 0.0f, FVector(0.0f, 0.0f, 0.0f));
+		BVH->TraverseRay(Sweep.Start, Sweep.InvDirection, Sweep.Extent, Sweep.Length,
+			[&](UPrimitiveComponent* Component, const FAABB& WorldBox, float MaxDistance) -> float
+			{
+				const ECollisionObjectType Type = GetObjectType(Component);
+				float HitT;
+				FVector HitNormal;
+				if (PassesFilter(Component, Type, Params) &&
+					IntersectComponent(Component, Type, WorldBox, Sweep, MaxDistance, Params, HitT, HitNormal))
+				{
+					FHitResult& Hit = OutHits.emplace_back();
+					FillHit(Hit, Component, Sweep, HitT, HitNormal);
+				}
+				// 모든 히트를 모으므로 최대 거리는 줄이지 않는다
+				return MaxDistance;
+			});
+
+		std::sort(OutHits.begin(), OutHits.end(),
+			[](const FHitResult& A, const FHitResult& B) { return A.Distance < B.Distance; });
+		return OutHits.Num();
+	}
+
+	void LineTraceBatch(const FBVHierarchy* BVH, const TArray<FLineTraceRequest>& Requests, TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params)
+	{
+		OutHits.SetNum(Requests.Num());
+		for (int32 i = 0; i < Requests.Num(); ++i)
+		{
+			const FSweep Sweep = MakeSweep(Requests[i].Start, Requests[i].End, ESweepShape::Line, 0.0f, FVector(0.0f, 0.0f, 0.0f));
+			SweepSingle(BVH, OutHits[i], Sweep, Params);
+		}
+	}
+
+	bool SweepSphereSingle(const FBVHierarchy* BVH, FHitResult& OutHit, const FVector& Start, const FVector& End, float Radius, const FCollisionQueryParams& Params)
+	{
+		Radius = std::max(Radius, 0.0f);
+		const FSweep Sweep = MakeSweep(Start, End, ESweepShape::Sphere, Radius, FVector(Radius, Radius, Radius));
+		return SweepSingle(BVH, OutHit, Sweep, Params);
+	}
+
+	bool SweepBoxSingle(const FBVHierarchy* BVH, FHitResult& OutHit, const FVector& Start, const FVector& End, const FVector& HalfExtent, const FCollisionQueryParams& Params)
+	{
+		const FVector Extent(std::fabs(HalfExtent.X), std::fabs(HalfExtent.Y), std::fabs(HalfExtent.Z));
+		const FSweep Sweep = MakeSweep(Start, End, ESweepShape::Box, 0.0f, Extent);
+		return SweepSingle(BVH, OutHit, Sweep, Params);
+	}
+}
+
+FWorldTraceBenchmarkResult RunWorldTraceBenchmark(UWorld* World, int32 NumRays)
+{
+	FWorldTraceBenchmarkResult Result;
+	UWorldPartitionManager* Partition = World ? World->GetPartitionManager() : nullptr;
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH || NumRays <= 0)
+	{
+		return Result;
+	}
+
+	BVH->FlushRebuild();
+	Result.NumComponents = BVH->TotalActorCount();
+	Result.NumRays = NumRays;
+
+	// 씬 바운드 위쪽에서 아래쪽 임의 지점으로 내리꽂는 광선 (시야 검사/낙하 지점 검사 형태)
+	const FAABB& Bounds = BVH->GetBounds();
+	TArray<FLineTraceRequest> Requests;
+	Requests.SetNum(NumRays);
+	uint32 Seed = 1;
+	auto Random = [&Seed]()
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return (Seed >> 8) * (1.0f / 16777216.0f);
+	};
+	auto RandomPoint = [&](float Z)
+	{
+		return FVector(
+			Bounds.Min.X + (Bounds.Max.X - Bounds.Min.X) * Random(),
+			Bounds.Min.Y + (Bounds.Max.Y - Bounds.Min.Y) * Random(),
+			Z);
+	};
+	for (FLineTraceRequest& Request : Requests)
+	{
+		Request.Start = RandomPoint(Bounds.Max.Z + 5.0f);
+		Request.End = RandomPoint(Bounds.Min.Z - 5.0f);
+	}
+
+	// 1. 기존 경로: 광선마다 RayQueryClosest (priority_queue + 액터 단위 피킹)
+	uint64 Start = FPlatformTime::Cycles64();
+	for (const FLineTraceRequest& Request : Requests)
+	{
+		const FVector Delta = Request.End - Request.Start;
+		const FRay Ray{ Request.Start, Delta.GetNormalized() };
+		AActor* HitActor = nullptr;
+		float BestT = Delta.Size();
+		Partition->RayQueryClosest(Ray, HitActor, BestT);
+		if (HitActor)
+		{
+			++Result.LegacyHits;
+		}
+	}
+	Result.LegacyMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 2. 배치 트레이스
+	FCollisionQueryParams Params;
+	Params.ObjectTypes = ECollisionObjectType::All;
+	TArray<FHitResult> Hits;
+	Start = FPlatformTime::Cycles64();
+	WorldCollision::LineTraceBatch(BVH, Requests, Hits, Params);
+	Result.BatchMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	for (const FHitResult& Hit : Hits)
+	{
+		if (Hit.bBlockingHit)
+		{
+			++Result.BatchHits;
+		}
+	}
+
+	return Result;
+}
@@ -0,0 +1,95 @@
+﻿#pragma once
+#include "Vector.h"
+#include "UEContainer.h"
+
+class AActor;
+class UPrimitiveComponent;
+class UWorld;
+class FBVHierarchy;
+
+// 트레이스가 검사할 프리미티브 종류 (비트 마스크로 조합)
+enum class ECollisionObjectType : uint32
+{
+	None         = 0,
+	StaticMesh   = 1 << 0,  // UStaticMeshComponent (bTraceComplex면 삼각형 단위)
+	SkeletalMesh = 1 << 1,  // USkinnedMeshComponent 계열 (월드 AABB)
+	Shape        = 1 << 2,  // Box/Sphere/Capsule 컴포넌트
+	Other        = 1 << 3,  // 빌보드, 텍스트 등 나머지 프리미티브 (월드 AABB)
+
+	Default      = StaticMesh | SkeletalMesh | Shape,
+	All          = 0xFFFFFFFFu
+};
+
+inline ECollisionObjectType operator|(ECollisionObjectType a, ECollisionObjectType b)
+{
+	return static_cast<ECollisionObjectType>(static_cast<uint32>(a) | static_cast<uint32>(b));
+}
+
+inline ECollisionObjectType operator&(ECollisionObjectType a, ECollisionObjectType b)
+{
+	return static_cast<ECollisionObjectType>(static_cast<uint32>(a) & static_cast<uint32>(b));
+}
+
+inline bool HasObjectType(ECollisionObjectType Mask, ECollisionObjectType Type)
+{
+	return (Mask & Type) != ECollisionObjectType::None;
+}
+
+struct FCollisionQueryParams
+{
+	ECollisionObjectType ObjectTypes = ECollisionObjectType::Default;
+	const AActor* IgnoreActor = nullptr;   // 보통 트레이스를 쏘는 자기 자신
+	bool bTraceComplex = true;             // 스태틱 메시를 FMeshBVH로 정밀 판정 (false면 월드 AABB)
+};
+
+struct FHitResult
+{
+	bool bBlockingHit = false;
+	UPrimitiveComponent* Component = nullptr;
+	AActor* Actor = nullptr;
+	FVector Location;       // 라인 트레이스는 충돌 지점, 스윕은 충돌 순간의 형상 중심
+	FVector Normal;         // 충돌 면 노멀 (트레이스 방향을 향하도록 뒤집힘)
+	float Distance = 0.0f;  // Start로부터의 월드 거리
+	float Time = 0.0f;      // Start -> End 구간 비율 [0, 1]
+};
+
+struct FLineTraceRequest
+{
+	FVector Start;
+	FVector End;
+};
+
+/**
+ * 월드 파티션 BVH 위에서 동작하는 트레이스/스윕 쿼리.
+ * - 노드 순회는 고정 크기 스택을 사용하고 결과 배열은 호출자가 재사용하므로 쿼리당 힙 할당이 없다.
+ *   (처음 맞은 스태틱 메시의 FMeshBVH 빌드/로드만 예외)
+ * - 스윕은 구/캡슐 셰이프에 대해서만 정확하고, 나머지는 (Minkowski 합으로) 부풀린 바운드로 판정한다.
+ */
+namespace WorldCollision
+{
+	bool LineTraceSingle(const FBVHierarchy* BVH, FHitResult& OutHit, const FVector& Start, const FVector& End, const FCollisionQueryParams& Params);
+
+	// Start에서 가까운 순으로 정렬된 모든 히트. OutHits는 비운 뒤 채운다 (capacity 유지)
+	int32 LineTraceMulti(const FBVHierarchy* BVH, TArray<FHitResult>& OutHits, const FVector& Start, const FVector& End, const FCollisionQueryParams& Params);
+
+	// 요청마다 가장 가까운 히트 하나. OutHits[i].bBlockingHit으로 히트 여부 확인
+	void LineTraceBatch(const FBVHierarchy* BVH, const TArray<FLineTraceRequest>& Requests, TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params);
+
+	bool SweepSphereSingle(const FBVHierarchy* BVH, FHitResult& OutHit, const FVector& Start, const FVector& End, float Radius, const FCollisionQueryParams& Params);
+
+	// 축 정렬 박스 스윕 (회전 없음)
+	bool SweepBoxSingle(const FBVHierarchy* BVH, FHitResult& OutHit, const FVector& Start, const FVector& End, const FVector& HalfExtent, const FCollisionQueryParams& Params);
+}
+
+// 월드에 등록된 프리미티브에 대해 광선 NumRays개를 쏴서 기존 RayQueryClosest와 배치 트레이스를 비교한다
+struct FWorldTraceBenchmarkResult
+{
+	int32 NumComponents = 0;
+	int32 NumRays = 0;
+	double LegacyMs = 0.0;
+	double BatchMs = 0.0;
+	int32 LegacyHits = 0;
+	int32 BatchHits = 0;
+};
+
+FWorldTraceBenchmarkResult RunWorldTraceBenchmark(UWorld* World, int32 NumRays);
@@ -119,13 +119,16 @@ void UBillboardComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshB
 	// UQuad는 GroupInfo가 없는 단일 메시로 처리합니다.
 	FMeshBatchElement BatchElement;
 
-	FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(MaterialToUse->GetShaderMacros());
+	FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(FShaderPermutation::WithMacroSet(0, MaterialToUse->GetShaderMacroSetId()));
 
 	// --- 정렬 키 ---
 	BatchElement.VertexShader = ShaderVariant->VertexShader;
 	BatchElement.PixelShader = ShaderVariant->PixelShader;
 	BatchElement.InputLayout = ShaderVariant->InputLayout;
 	BatchElement.Material = MaterialToUse;
+	BatchElement.MaterialSortId = MaterialToUse->GetSortId();
+	BatchElement.MeshSortId = Quad->GetSortId();
+	BatchElement.ShaderSortId = ShaderVariant->SortId;
 	BatchElement.VertexBuffer = Quad->GetVertexBuffer();
 	BatchElement.IndexBuffer = Quad->GetIndexBuffer();
 
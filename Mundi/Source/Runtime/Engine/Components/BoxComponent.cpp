@@ -69,10 +69,11 @@ void UBoxComponent::RenderDebugVolume(URenderer* Renderer) const
 
 	const FVector Extent = BoxExtent;
 	const FTransform WorldTransform = GetWorldTransform();
-
-	TArray<FVector> StartPoints;
-	TArray<FVector> EndPoints;
-	TArray<FVector4> Colors;
+	if (!ShouldRebuildDebugVolume(WorldTransform.ToMatrix(), FVector4(Extent.X, Extent.Y, Extent.Z, 0.0f)))
+	{
+		Renderer->AddLines(DebugVolumeLines);
+		return;
+	}
 
 	FVector local[8] = {
 		{-Extent.X, -Extent.Y, -Extent.Z}, {+Extent.X, -Extent.Y, -Extent.Z},
@@ -95,11 +96,9 @@ void UBoxComponent::RenderDebugVolume(URenderer* Renderer) const
 	};
 	for (int i = 0; i < 12; ++i)
 	{
-		StartPoints.Add(WorldSpace[Edge[i][0]]);
-		EndPoints.Add(WorldSpace[Edge[i][1]]);
-		Colors.Add(ShapeColor); // 동일 색으로 라인 렌더
+		DebugVolumeLines.AddLine(WorldSpace[Edge[i][0]], WorldSpace[Edge[i][1]], ShapeColor); // 동일 색으로 라인 렌더
 	}
 
-	Renderer->AddLines(StartPoints, EndPoints, Colors);
+	Renderer->AddLines(DebugVolumeLines);
 }
 
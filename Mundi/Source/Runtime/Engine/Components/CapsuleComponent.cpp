@@ -87,9 +87,11 @@ void UCapsuleComponent::RenderDebugVolume(URenderer* Renderer) const
     const int NumOfSphereSlice = 4;
     const int NumHemisphereSegments = 8; 
 
-    TArray<FVector> StartPoints;
-    TArray<FVector> EndPoints;
-    TArray<FVector4> Colors;
+    if (!ShouldRebuildDebugVolume(WorldNoScale, FVector4(Radius, HalfHeightAABB, 0.0f, 0.0f)))
+    {
+        Renderer->AddLines(DebugVolumeLines);
+        return;
+    }
 
     TArray<FVector> TopRingLocal;
     TArray<FVector> BottomRingLocal;
@@ -112,22 +114,16 @@ void UCapsuleComponent::RenderDebugVolume(URenderer* Renderer) const
         const int j = (i + 1) % NumOfSphereSlice;
 
         //윗면
-        StartPoints.Add(TopRingLocal[i] * WorldNoScale);
-        EndPoints.Add(TopRingLocal[j] * WorldNoScale);
-        Colors.Add(ShapeColor);
+        DebugVolumeLines.AddLine(TopRingLocal[i] * WorldNoScale, TopRingLocal[j] * WorldNoScale, ShapeColor);
 
         // 아랫면
-        StartPoints.Add(BottomRingLocal[i] * WorldNoScale);
-        EndPoints.Add(BottomRingLocal[j] * WorldNoScale);
-        Colors.Add(ShapeColor);
+        DebugVolumeLines.AddLine(BottomRingLocal[i] * WorldNoScale, BottomRingLocal[j] * WorldNoScale, ShapeColor);
     }
      
     //윗면 아랫면 잇는 선분
     for (int i = 0; i < NumOfSphereSlice; ++i)
     {
-        StartPoints.Add(TopRingLocal[i] * WorldNoScale);
-        EndPoints.Add(BottomRingLocal[i] * WorldNoScale);
-        Colors.Add(ShapeColor);
+        DebugVolumeLines.AddLine(TopRingLocal[i] * WorldNoScale, BottomRingLocal[i] * WorldNoScale, ShapeColor);
     }
     
     // 반구 위아래 
@@ -143,21 +139,17 @@ void UCapsuleComponent::RenderDebugVolume(URenderer* Renderer) const
             FVector PlaneXZ0(Radius * std::cos(t0), 0.0f, CenterZ + CenterZSign* Radius * std::sin(t0));
             FVector PlaneXZ1(Radius * std::cos(t1), 0.0f, CenterZ + CenterZSign* Radius * std::sin(t1));
             
-            StartPoints.Add(PlaneXZ0 * WorldNoScale);
-            EndPoints.Add(PlaneXZ1 * WorldNoScale);
-            Colors.Add(ShapeColor);
+            DebugVolumeLines.AddLine(PlaneXZ0 * WorldNoScale, PlaneXZ1 * WorldNoScale, ShapeColor);
             
             FVector PlaneYZ0(0.0f, Radius * std::cos(t0), CenterZ + CenterZSign * Radius * std::sin(t0));
             FVector PlaneYZ1(0.0f, Radius * std::cos(t1), CenterZ + CenterZSign * Radius * std::sin(t1));
 
-            StartPoints.Add(PlaneYZ0 * WorldNoScale);
-            EndPoints.Add(PlaneYZ1 * WorldNoScale);
-            Colors.Add(ShapeColor);
+            DebugVolumeLines.AddLine(PlaneYZ0 * WorldNoScale, PlaneYZ1 * WorldNoScale, ShapeColor);
         }
     };
      
     AddHemisphereArcs(+1.0f);
     AddHemisphereArcs(-1.0f);
 
-    Renderer->AddLines(StartPoints, EndPoints, Colors);
+    Renderer->AddLines(DebugVolumeLines);
 }
@@ -33,6 +33,7 @@ void UDecalComponent::DuplicateSubObjects()
 	Super::DuplicateSubObjects();
 	DirectionGizmo = nullptr;
 	SpriteComponent = nullptr;
+	ReceiverCache.Invalidate();   // 원본 월드의 리시버를 가리키므로 복제본에서는 새로 쿼리
 }
 
 void UDecalComponent::TickComponent(float DeltaTime)
@@ -9,6 +9,28 @@
 struct FOBB;
 class UTexture;
 struct FDecalProjectionData;
+class FBVHierarchy;
+
+/**
+ * 데칼이 덮는 리시버 목록 캐시 (RenderDecalPass 전용)
+ * 데칼 트랜스폼이 그대로이고, 저장한 리비전 이후 BVH 변경 영역이 데칼 AABB와 겹치지 않으면 재사용한다.
+ */
+struct FDecalReceiverCache
+{
+	const FBVHierarchy* BVH = nullptr;
+	uint64 Revision = 0;
+	FMatrix DecalWorldMatrix;
+	FAABB DecalBounds;
+	TArray<UPrimitiveComponent*> Receivers;
+	bool bValid = false;
+
+	void Invalidate()
+	{
+		bValid = false;
+		BVH = nullptr;
+		Receivers.Empty();
+	}
+};
 
 /**
  * UDecalComponent - Projection Decal implementation
@@ -69,6 +91,8 @@ public:
 	// Tick
 	virtual void TickComponent(float DeltaTime) override;
 
+	FDecalReceiverCache& GetReceiverCache() { return ReceiverCache; }
+
 	void OnRegister(UWorld* InWorld) override;
 
 private:
@@ -79,6 +103,7 @@ private:
 
 	bool bIsVisible = true;
 
+	FDecalReceiverCache ReceiverCache;
 
 	// for PIE Tick
 
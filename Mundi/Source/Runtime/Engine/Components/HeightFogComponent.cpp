@@ -49,13 +49,8 @@ void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	Super::Serialize(bInIsLoading, InOutHandle);
 	if (bInIsLoading)
 	{
-		// Load FogInscatteringColor
-		if (InOutHandle.hasKey("FogInscatteringColor"))
-		{
-			FVector4 ColorVec;
-			FJsonSerializer::ReadVector4(InOutHandle, "FogInscatteringColor", ColorVec);
-			FogInscatteringColor = FLinearColor(ColorVec);
-		}
+		// FogInscatteringColor와 Fog 수치들은 UPROPERTY라 Super::Serialize에서 이미 읽었다
+		// (쿠킹된 레벨은 이 키들을 레코드로 옮기므로 여기서 다시 읽으면 기본값으로 덮어쓴다)
 
 		// Load HeightFogShader
 		if (InOutHandle.hasKey("HeightFogShader"))
@@ -66,13 +61,6 @@ void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 				HeightFogShader = UResourceManager::GetInstance().Load<UShader>(shaderPath.c_str());
 			}
 		}
-
-		// FogDensity, FogHeightFalloff, StartDistance, FogCutoffDistance, FogMaxOpacity도 로드
-		FJsonSerializer::ReadFloat(InOutHandle, "FogDensity", FogDensity, 0.2f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FogHeightFalloff", FogHeightFalloff, 0.2f);
-		FJsonSerializer::ReadFloat(InOutHandle, "StartDistance", StartDistance, 0.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FogCutoffDistance", FogCutoffDistance, 6000.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FogMaxOpacity", FogMaxOpacity, 1.0f);
 	}
 	else
 	{
@@ -13,23 +13,11 @@ void ULineComponent::GetWorldLineData(TArray<FVector>& OutStartPoints, TArray<FV
         OutColors.clear();
         return;
     }
-    
-    FMatrix worldMatrix = GetWorldMatrix();
-    size_t lineCount = Lines.size();
-    
-    for (const ULine* Line : Lines)
-    {
-        if (Line)
-        {
-            FVector worldStart, worldEnd;
-            Line->GetWorldPoints(worldMatrix, worldStart, worldEnd);
-            
-            OutStartPoints.push_back(worldStart);
-            OutEndPoints.push_back(worldEnd);
-            OutColors.push_back(Line->GetColor());
-        }
-    }
-    return;
+
+    UpdateWorldLineCache();
+    OutStartPoints.insert(OutStartPoints.end(), WorldStartPoints.begin(), WorldStartPoints.end());
+    OutEndPoints.insert(OutEndPoints.end(), WorldEndPoints.begin(), WorldEndPoints.end());
+    OutColors.insert(OutColors.end(), WorldColors.begin(), WorldColors.end());
 }
 
 void ULineComponent::DuplicateSubObjects()
@@ -38,14 +26,8 @@ void ULineComponent::DuplicateSubObjects()
 
     bLinesVisible = true;
 
-    const uint64 NumLines = Lines.size();
-    for (uint64 idx = 0; idx < NumLines; ++idx)
-    {
-        if (Lines[idx])
-        {
-            Lines[idx] = Lines[idx]->Duplicate();
-        }
-    }
+    // 선분은 값으로 복사되었으므로 월드 캐시만 새 트랜스폼 기준으로 다시 만든다
+    bWorldCacheDirty = true;
 }
 
 ULineComponent::ULineComponent()
@@ -58,62 +40,159 @@ ULineComponent::~ULineComponent()
     ClearLines();
 }
 
-ULine* ULineComponent::AddLine(const FVector& StartPoint, const FVector& EndPoint, const FVector4& Color)
+FLineHandle ULineComponent::AddLine(const FVector& StartPoint, const FVector& EndPoint, const FVector4& Color)
 {
-    ULine* NewLine = NewObject<ULine>();
-    NewLine->SetLine(StartPoint, EndPoint);
-    NewLine->SetColor(Color);
-    
-    Lines.push_back(NewLine);
-    
-    return NewLine;
+    int32 Slot;
+    if (FreeSlots.Num() > 0)
+    {
+        Slot = FreeSlots.Pop();
+    }
+    else
+    {
+        Slot = Slots.Num();
+        Slots.Add(FLineSlot{});
+    }
+
+    Slots[Slot].LineIndex = Lines.Num();
+    Lines.Add(FLineSegment{ StartPoint, EndPoint, Color });
+    LineSlots.Add(Slot);
+    bWorldCacheDirty = true;
+
+    return FLineHandle{ Slot, Slots[Slot].Generation };
 }
 
-void ULineComponent::RemoveLine(ULine* Line)
+bool ULineComponent::RemoveLine(FLineHandle Handle)
 {
-    if (!Line) return;
-    
-    auto it = std::find(Lines.begin(), Lines.end(), Line);
-    if (it != Lines.end())
+    const int32 LineIndex = ResolveHandle(Handle);
+    if (LineIndex < 0)
+    {
+        return false;
+    }
+
+    // 마지막 선을 빈 자리로 옮겨 배열을 조밀하게 유지
+    const int32 LastIndex = Lines.Num() - 1;
+    if (LineIndex != LastIndex)
     {
-        DeleteObject(*it);
-        Lines.erase(it);
+        Lines[LineIndex] = Lines[LastIndex];
+        LineSlots[LineIndex] = LineSlots[LastIndex];
+        Slots[LineSlots[LineIndex]].LineIndex = LineIndex;
     }
+    Lines.Pop();
+    LineSlots.Pop();
+
+    FLineSlot& Slot = Slots[Handle.Slot];
+    Slot.LineIndex = -1;
+    ++Slot.Generation;
+    FreeSlots.Add(Handle.Slot);
+    bWorldCacheDirty = true;
+    return true;
 }
 
 void ULineComponent::ClearLines()
 {
-    for (ULine* Line : Lines)
+    // 이전 핸들이 새 선을 가리키지 않도록 세대만 올려 슬롯을 재사용
+    FreeSlots.Empty();
+    for (int32 i = Slots.Num() - 1; i >= 0; --i)
     {
-        if (Line)
+        if (Slots[i].LineIndex >= 0)
         {
-            DeleteObject(Line);
+            Slots[i].LineIndex = -1;
+            ++Slots[i].Generation;
         }
+        FreeSlots.Add(i);
     }
     Lines.Empty();
+    LineSlots.Empty();
+    bWorldCacheDirty = true;
 }
 
-void ULineComponent::CollectLineBatches(URenderer* Renderer)
+void ULineComponent::ReserveLines(int32 Count)
 {
-    if (!HasVisibleLines() || !Renderer)
+    Lines.reserve(Count);
+    LineSlots.reserve(Count);
+    Slots.reserve(Count);
+}
+
+bool ULineComponent::SetLine(FLineHandle Handle, const FVector& StartPoint, const FVector& EndPoint)
+{
+    const int32 LineIndex = ResolveHandle(Handle);
+    if (LineIndex < 0)
+    {
+        return false;
+    }
+    Lines[LineIndex].StartPoint = StartPoint;
+    Lines[LineIndex].EndPoint = EndPoint;
+    bWorldCacheDirty = true;
+    return true;
+}
+
+bool ULineComponent::SetLineColor(FLineHandle Handle, const FVector4& Color)
+{
+    const int32 LineIndex = ResolveHandle(Handle);
+    if (LineIndex < 0)
+    {
+        return false;
+    }
+    Lines[LineIndex].Color = Color;
+    // 색만 바뀐 경우 월드 좌표 재계산 없이 캐시에 바로 반영
+    if (!bWorldCacheDirty && LineIndex < WorldColors.Num())
+    {
+        WorldColors[LineIndex] = Color;
+    }
+    return true;
+}
+
+bool ULineComponent::IsValidLine(FLineHandle Handle) const
+{
+    return ResolveHandle(Handle) >= 0;
+}
+
+const FLineSegment* ULineComponent::GetLine(FLineHandle Handle) const
+{
+    const int32 LineIndex = ResolveHandle(Handle);
+    return LineIndex >= 0 ? &Lines[LineIndex] : nullptr;
+}
+
+int32 ULineComponent::ResolveHandle(FLineHandle Handle) const
+{
+    if (Handle.Slot < 0 || Handle.Slot >= Slots.Num())
+    {
+        return -1;
+    }
+    const FLineSlot& Slot = Slots[Handle.Slot];
+    return Slot.Generation == Handle.Generation ? Slot.LineIndex : -1;
+}
+
+void ULineComponent::UpdateWorldLineCache() const
+{
+    const FMatrix WorldMatrix = GetWorldMatrix();
+    if (!bWorldCacheDirty && std::memcmp(&WorldMatrix, &CachedWorldMatrix, sizeof(FMatrix)) == 0)
+    {
         return;
+    }
 
-    TArray<FVector> startPoints, endPoints;
-    TArray<FVector4> colors;
-    
-    // Extract world coordinate line data efficiently
-    GetWorldLineData(startPoints, endPoints, colors);
-    
-    // Add all lines to renderer batch at once
-    if (!startPoints.empty())
+    const int32 LineCount = Lines.Num();
+    WorldStartPoints.SetNum(LineCount);
+    WorldEndPoints.SetNum(LineCount);
+    WorldColors.SetNum(LineCount);
+    for (int32 i = 0; i < LineCount; ++i)
     {
-        Renderer->AddLines(startPoints, endPoints, colors);
+        const FLineSegment& Line = Lines[i];
+        WorldStartPoints[i] = WorldMatrix.TransformPosition(Line.StartPoint);
+        WorldEndPoints[i] = WorldMatrix.TransformPosition(Line.EndPoint);
+        WorldColors[i] = Line.Color;
     }
-    startPoints.clear();
-    startPoints.Shrink();
-    endPoints.clear();
-    endPoints.Shrink();
-    colors.clear();
-    colors.Shrink();
+
+    CachedWorldMatrix = WorldMatrix;
+    bWorldCacheDirty = false;
 }
 
+void ULineComponent::CollectLineBatches(URenderer* Renderer)
+{
+    if (!HasVisibleLines() || !Renderer)
+        return;
+
+    // 캐시된 월드 데이터를 그대로 넘긴다 (프레임마다 임시 배열을 만들지 않음)
+    UpdateWorldLineCache();
+    Renderer->AddLines(WorldStartPoints, WorldEndPoints, WorldColors);
+}
@@ -1,10 +1,26 @@
 ﻿#pragma once
 #include "PrimitiveComponent.h"
-#include "Line.h"
 #include "UEContainer.h"
 
 class URenderer;
 
+// 로컬 공간 선분 (UObject 없이 값으로 보관)
+struct FLineSegment
+{
+    FVector StartPoint;
+    FVector EndPoint;
+    FVector4 Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+};
+
+// AddLine이 돌려주는 핸들. 다른 선이 지워져도 유효하며, 지워진 선의 핸들은 Generation으로 걸러진다
+struct FLineHandle
+{
+    int32 Slot = -1;
+    uint32 Generation = 0;
+
+    bool IsSet() const { return Slot >= 0; }
+};
+
 class ULineComponent : public UPrimitiveComponent
 {
 public:
@@ -15,9 +31,16 @@ public:
 
 public:
     // Line management
-    ULine* AddLine(const FVector& StartPoint, const FVector& EndPoint, const FVector4& Color = FVector4(1,1,1,1));
-    void RemoveLine(ULine* Line);
+    FLineHandle AddLine(const FVector& StartPoint, const FVector& EndPoint, const FVector4& Color = FVector4(1,1,1,1));
+    bool RemoveLine(FLineHandle Handle);
     void ClearLines();
+    void ReserveLines(int32 Count);
+
+    // 제자리 갱신 (핸들이 유효하지 않으면 false)
+    bool SetLine(FLineHandle Handle, const FVector& StartPoint, const FVector& EndPoint);
+    bool SetLineColor(FLineHandle Handle, const FVector4& Color);
+    bool IsValidLine(FLineHandle Handle) const;
+    const FLineSegment* GetLine(FLineHandle Handle) const;
 
     void CollectLineBatches(URenderer* Renderer);
 
@@ -25,7 +48,8 @@ public:
     void SetLineVisible(bool bVisible) { bLinesVisible = bVisible; }
     bool IsLineVisible() const { return bLinesVisible; }
     
-    const TArray<ULine*>& GetLines() const { return Lines; }
+    // 조밀하게 채워진 선분 배열 (제거 시 순서가 바뀔 수 있음)
+    const TArray<FLineSegment>& GetLines() const { return Lines; }
     int64 GetLineCount() const { return static_cast<int64>(Lines.size()); }
     
     // Efficient world coordinate line data extraction
@@ -41,7 +65,29 @@ public:
     DECLARE_DUPLICATE(ULineComponent)
 
 private:
-    TArray<ULine*> Lines;
+    int32 ResolveHandle(FLineHandle Handle) const;
+
+    // 컴포넌트 트랜스폼이나 선 목록이 바뀌었을 때만 월드 좌표를 다시 계산
+    void UpdateWorldLineCache() const;
+
+    struct FLineSlot
+    {
+        int32 LineIndex = -1;   // Lines 내 위치 (-1 = 빈 슬롯)
+        uint32 Generation = 0;
+    };
+
+    TArray<FLineSegment> Lines;      // 조밀 배열 (스왑 제거)
+    TArray<int32> LineSlots;         // Lines[i]를 가리키는 슬롯 번호
+    TArray<FLineSlot> Slots;         // 핸들 -> Lines 인덱스
+    TArray<int32> FreeSlots;
+
+    // 월드 공간 캐시 (URenderer::AddLines 입력 형태 그대로)
+    mutable TArray<FVector> WorldStartPoints;
+    mutable TArray<FVector> WorldEndPoints;
+    mutable TArray<FVector4> WorldColors;
+    mutable FMatrix CachedWorldMatrix;
+    mutable bool bWorldCacheDirty = true;
+
     bool bLinesVisible = true;
     bool bAlwaysOnTop = false;
  };
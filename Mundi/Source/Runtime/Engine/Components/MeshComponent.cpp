@@ -113,6 +113,9 @@ void UMeshComponent::DuplicateSubObjects()
 	// 원본 MID -> 복사본 MID 매핑 테이블
 	TMap<UMaterialInstanceDynamic*, UMaterialInstanceDynamic*> OldToNewMIDMap;
 
+	// 원본의 드로우 커맨드(ObjectID, 머티리얼 포인터)가 얕은 복사되었으므로 폐기
+	DrawCommandCache.Invalidate();
+
 	// 1. 복사본의 MID 소유권 리스트를 비웁니다. (메모리 해제 아님)
 	//    이 리스트는 새로운 '복사본 MID'들로 다시 채워질 것입니다.
 	DynamicMaterialInstances.Empty();
@@ -162,6 +165,12 @@ void UMeshComponent::DuplicateSubObjects()
 	}
 }
 
+void UMeshComponent::OnTransformUpdated()
+{
+	Super::OnTransformUpdated();
+	DrawCommandCache.MarkTransformDirty();
+}
+
 void UMeshComponent::MarkWorldPartitionDirty()
 {
 	if (UWorld* World = GetWorld())
@@ -237,7 +246,9 @@ void UMeshComponent::SetMaterial(uint32 InElementIndex, UMaterialInterface* InNe
 	}
 
 	// 6. 새 머티리얼을 슬롯에 할당합니다.
+	// (삭제된 MID와 같은 주소에 새 MID가 할당될 수 있어 슬롯 비교만으로는 부족하므로 명시적으로 폐기)
 	MaterialSlots[InElementIndex] = InNewMaterial;
+	DrawCommandCache.Invalidate();
 }
 
 UMaterialInstanceDynamic* UMeshComponent::CreateAndSetMaterialInstanceDynamic(uint32 ElementIndex)
@@ -309,6 +320,7 @@ void UMeshComponent::ClearDynamicMaterials()
 		delete MID;
 	}	
 	DynamicMaterialInstances.Empty();
+	DrawCommandCache.Invalidate();
 
 	// 2. 머티리얼 슬롯 배열도 비웁니다.
 	// (이 배열이 MID 포인터를 가리키고 있었을 수 있으므로
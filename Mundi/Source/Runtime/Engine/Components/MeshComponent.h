@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "PrimitiveComponent.h"
+#include "MeshDrawCommandCache.h"
 #include "UMeshComponent.generated.h"
 
 class UShader;
@@ -29,6 +30,10 @@ public:
 
 protected:
     void MarkWorldPartitionDirty();
+    void OnTransformUpdated() override;
+
+    // 메시/머티리얼/뷰 매크로가 바뀔 때만 다시 만드는 드로우 커맨드 (CollectMeshBatches에서 사용)
+    FMeshDrawCommandCache DrawCommandCache;
 
 // Material Section
 public:
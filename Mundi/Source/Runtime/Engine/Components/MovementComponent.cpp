@@ -55,6 +55,23 @@ void UMovementComponent::StopMovement()
     Acceleration = FVector(0.0f, 0.0f, 0.0f);
 }
 
+void UMovementComponent::ResetForPool()
+{
+    Super::ResetForPool();
+
+    // StopMovement로 0을 넣으면 재사용한 발사체가 프리팹의 초기 속도를 잃는다
+    Velocity = ArchetypeVelocity;
+    Acceleration = ArchetypeAcceleration;
+}
+
+void UMovementComponent::CapturePoolArchetype()
+{
+    Super::CapturePoolArchetype();
+
+    ArchetypeVelocity = Velocity;
+    ArchetypeAcceleration = Acceleration;
+}
+
 void UMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdatedComponent)
 {
     UpdatedComponent = NewUpdatedComponent;
@@ -34,6 +34,10 @@ public:
     // 속도와 가속도를 0으로 설정하여 이동 중지
     virtual void StopMovement();
 
+    // 풀 반납 시 속도/가속도를 스폰 직후 값으로 되돌림
+    void ResetForPool() override;
+    void CapturePoolArchetype() override;
+
     // 업데이트 대상 컴포넌트
     void SetUpdatedComponent(USceneComponent* NewUpdatedComponent);
     USceneComponent* GetUpdatedComponent() const { return UpdatedComponent; }
@@ -52,4 +56,8 @@ protected:
     FVector Velocity;
     FVector Acceleration;
     bool bUpdateOnlyIfRendered = false;
+
+    // 액터 풀 재사용 시 되돌릴 스폰 직후 값 (프리팹에 저장된 초기 속도 등)
+    FVector ArchetypeVelocity;
+    FVector ArchetypeAcceleration;
 };
@@ -167,9 +167,8 @@ void UPerspectiveDecalComponent::Serialize(const bool bInIsLoading, JSON& InOutH
 	Super::Serialize(bInIsLoading, InOutHandle);
 	if (bInIsLoading)
 	{
-		float FovYTemp;
-		FJsonSerializer::ReadFloat(InOutHandle, "FovY", FovYTemp);
-		SetFovY(FovYTemp);
+		// FovY는 UPROPERTY라 Super::Serialize(또는 쿠킹 레코드)에서 이미 채워졌다. 스케일만 맞춰준다
+		SetFovY(FovY);
 	}
 	else
 	{
@@ -52,7 +52,7 @@ void UPointLightComponent::GetShadowRenderRequests(FSceneView* View, TArray<FSha
 
 FPointLightInfo UPointLightComponent::GetLightInfo() const
 {
-	FPointLightInfo Info;
+	FPointLightInfo Info{}; // 패딩까지 0으로 (슬롯 바이트 비교용)
 	// Use GetLightColorWithIntensity() to include Temperature + Intensity
 	Info.Color = GetLightColorWithIntensity();
 	Info.Position = GetWorldLocation();
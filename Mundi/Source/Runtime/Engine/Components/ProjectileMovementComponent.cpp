@@ -3,6 +3,7 @@
 #include "SceneComponent.h"
 #include "Actor.h"
 #include "ObjectFactory.h"
+#include "ProjectileSimulation.h"
 // IMPLEMENT_CLASS is now auto-generated in .generated.cpp
 UProjectileMovementComponent::UProjectileMovementComponent()
     : Gravity(-9.80f)  // Z-Up 좌표계에서 중력은 Z방향으로 -980 cm/s^2
@@ -16,71 +17,66 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     , ProjectileLifespan(0.0f)  // 0 = 무제한
     , CurrentLifetime(0.0f)
     , bAutoDestroyWhenLifespanExceeded(false)
+    , bSweepCollision(true)
+    , CollisionRadius(0.0f)  // 0 = 라인 트레이스
+    , bShouldBounce(false)
+    , Bounciness(0.6f)
+    , Friction(0.2f)
+    , BounceVelocityStopThreshold(0.5f)
     , bIsActive(true)
 {
-    bCanEverTick = true;
+    // 컴포넌트 단위 틱 대신 FProjectileSimulation이 일괄 처리
+    bCanEverTick = false;
 }
 
 UProjectileMovementComponent::~UProjectileMovementComponent()
 {
+    if (Simulation)
+    {
+        Simulation->Unregister(this);
+    }
 }
 
-void UProjectileMovementComponent::TickComponent(float DeltaSeconds)
+void UProjectileMovementComponent::OnRegister(UWorld* InWorld)
 {
-    if (!UpdatedComponent)
-    {
-        return;
-    }
+    Super::OnRegister(InWorld);
 
-    // 1. 생명주기 체크
-    if (ProjectileLifespan > 0.0f)
+    // 이동/충돌은 월드가 모든 발사체를 모아 한 번에 처리 (UWorld::Tick -> FProjectileSimulation::Tick)
+    if (InWorld && InWorld->GetProjectileSimulation())
     {
-        CurrentLifetime += DeltaSeconds;
-        if (CurrentLifetime >= ProjectileLifespan)
-        {
-            if (bAutoDestroyWhenLifespanExceeded)
-            {
-                // Owner Actor 파괴 (현재 지연 삭제 처리가 없어서 안보이게만 처리.)
-                AActor* Owner = UpdatedComponent->GetOwner();
-                if (Owner)
-                {
-                    //Owner->Destroy();
-                    Owner->SetActorHiddenInGame(true);
-                    return;
-                }
-            }
-            bIsActive = false;
-            return;
-        }
+        InWorld->GetProjectileSimulation()->Register(this);
     }
+}
 
-    // 2. 호밍 가속도 계산
-    if (bIsHomingProjectile)
+void UProjectileMovementComponent::OnUnregister()
+{
+    if (Simulation)
     {
-        ComputeHomingAcceleration(DeltaSeconds);
+        Simulation->Unregister(this);
     }
 
-    // 3. 중력 적용
-    Velocity.Z += Gravity * DeltaSeconds;
+    Super::OnUnregister();
+}
 
-    // 4. 가속도 적용
-    Velocity += Acceleration * DeltaSeconds;
+void UProjectileMovementComponent::DuplicateSubObjects()
+{
+    Super::DuplicateSubObjects();
 
-    // 5. 속도 제한
-    LimitVelocity();
+    // 복제본은 자기 월드에 등록될 때 새 슬롯을 받는다
+    Simulation = nullptr;
+    SimulationSlot = -1;
+    OnProjectileBounce.Clear();
+    OnProjectileStop.Clear();
+}
 
-    // 6. 위치 업데이트
-    FVector Delta = Velocity * DeltaSeconds;
-    if (!Delta.IsZero())
-    {
-        UpdatedComponent->AddWorldOffset(Delta);
-    }
+void UProjectileMovementComponent::ResetForPool()
+{
+    Super::ResetForPool();
 
-    // 7. 회전 업데이트 (속도 방향 추적)
-    if (bRotationFollowsVelocity)
-    {
-        UpdateRotationFromVelocity();
-    }
+    // 정지/수명 만료로 꺼진 상태는 Super에서 스폰 직후 값으로 되돌아가고, 여기서는 수명과 이전 타겟을 지운다
+    CurrentLifetime = 0.0f;
+    HomingTargetActor = nullptr;
+    HomingTargetComponent = nullptr;
 }
 
 void UProjectileMovementComponent::FireInDirection(const FVector& ShootDirection)
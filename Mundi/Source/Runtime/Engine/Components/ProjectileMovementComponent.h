@@ -2,15 +2,19 @@
 
 #include "MovementComponent.h"
 #include "Vector.h"
+#include "Delegates.h"
 #include "UProjectileMovementComponent.generated.h"
 
 class AActor;
 class USceneComponent;
+class FProjectileSimulation;
+struct FHitResult;
 
 /**
  * UProjectileMovementComponent
  * 발사체(Projectile)의 움직임을 시뮬레이션하는 컴포넌트
  * 중력, 바운스, 호밍 등의 기능을 지원
+ * 이동과 충돌은 컴포넌트 틱이 아니라 월드의 FProjectileSimulation이 모든 발사체를 모아 한 번에 처리한다
  */
 UCLASS(DisplayName="발사체 이동 컴포넌트", Description="발사체 물리 이동 컴포넌트입니다")
 class UProjectileMovementComponent : public UMovementComponent
@@ -19,6 +23,11 @@ public:
 
     GENERATED_REFLECTION_BODY()
 
+    // 튕길 때 (충돌 정보, 충돌 직전 속도)
+    DECLARE_DELEGATE(OnProjectileBounce, const FHitResult&, const FVector&);
+    // 충돌로 멈췄을 때 (튕기지 않거나, 튕긴 뒤 속력이 BounceVelocityStopThreshold 미만)
+    DECLARE_DELEGATE(OnProjectileStop, const FHitResult&);
+
     UProjectileMovementComponent();
 
 protected:
@@ -51,8 +60,30 @@ public:
 
     UPROPERTY(EditAnywhere, Category="발사체", Tooltip="생명 시간 초과시 발사체를 파괴합니다")
     bool bAutoDestroyWhenLifespanExceeded;
+
+    UPROPERTY(EditAnywhere, Category="충돌", Tooltip="이동 경로를 월드에 스윕해서 충돌을 검사합니다")
+    bool bSweepCollision;
+
+    UPROPERTY(EditAnywhere, Category="충돌", Tooltip="스윕에 쓰는 구 반지름입니다 (0이면 라인 트레이스)")
+    float CollisionRadius;
+
+    UPROPERTY(EditAnywhere, Category="충돌", Tooltip="충돌 시 멈추지 않고 튕깁니다")
+    bool bShouldBounce;
+
+    UPROPERTY(EditAnywhere, Category="충돌", Range="0.0, 1.0", Tooltip="튕길 때 법선 방향 속도 보존 비율입니다")
+    float Bounciness;
+
+    UPROPERTY(EditAnywhere, Category="충돌", Range="0.0, 1.0", Tooltip="튕길 때 접선 방향 속도 감쇠 비율입니다")
+    float Friction;
+
+    UPROPERTY(EditAnywhere, Category="충돌", Tooltip="튕긴 뒤 속력이 이보다 작으면 멈춥니다")
+    float BounceVelocityStopThreshold;
+
     // Life Cycle
-    virtual void TickComponent(float DeltaSeconds) override;
+    void OnRegister(UWorld* InWorld) override;
+    void OnUnregister() override;
+    void DuplicateSubObjects() override;
+    void ResetForPool() override;
 
     // 발사 API
     void FireInDirection(const FVector& ShootDirection);
@@ -100,6 +131,8 @@ public:
     float GetCurrentLifetime() const { return CurrentLifetime; }
 
 protected:
+    friend class FProjectileSimulation;
+
     // 내부 헬퍼 함수
     void LimitVelocity();
     void ComputeHomingAcceleration(float DeltaTime);
@@ -142,4 +175,8 @@ protected:
     // === 상태 ===
     // 활성화 상태
     bool bIsActive;
+
+    // 월드 시뮬레이션 등록 정보 (OnRegister/OnUnregister에서 관리)
+    FProjectileSimulation* Simulation = nullptr;
+    int32 SimulationSlot = -1;
 };
@@ -407,6 +407,32 @@ void USceneComponent::OnRegister(UWorld* InWorld)
     OnTransformUpdated();
 }
 
+void USceneComponent::ResetForPool()
+{
+    Super::ResetForPool();
+
+    // 런타임에 옮긴 자식 컴포넌트가 다음 사용에 남지 않도록 되돌린다
+    // 등록 해제 상태라 파티션 갱신 없이 값만 바꾸고, 월드 행렬은 꺼낼 때 SetActorTransform에서 다시 계산된다
+    bIsVisible = bArchetypeVisible;
+    RelativeLocation = ArchetypeRelativeLocation;
+    RelativeRotation = ArchetypeRelativeRotation;
+    RelativeRotationEuler = ArchetypeRelativeRotationEuler;
+    RelativeScale = ArchetypeRelativeScale;
+    UpdateRelativeTransform();
+    bIsTransformDirty = true;
+}
+
+void USceneComponent::CapturePoolArchetype()
+{
+    Super::CapturePoolArchetype();
+
+    bArchetypeVisible = bIsVisible;
+    ArchetypeRelativeLocation = RelativeLocation;
+    ArchetypeRelativeRotation = RelativeRotation;
+    ArchetypeRelativeRotationEuler = RelativeRotationEuler;
+    ArchetypeRelativeScale = RelativeScale;
+}
+
 void USceneComponent::OnTransformUpdated()
 {
     bIsTransformDirty = true;
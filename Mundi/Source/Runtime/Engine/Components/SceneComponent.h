@@ -114,6 +114,10 @@ public:
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
     void OnRegister(UWorld* InWorld) override;
 
+    // 액터 풀: 상대 트랜스폼과 가시성을 스폰 직후 값으로 되돌림
+    void ResetForPool() override;
+    void CapturePoolArchetype() override;
+
     virtual void OnTransformUpdated();
 
     // SceneId
@@ -171,6 +175,13 @@ protected:
     // 로컬(부모 기준) 트랜스폼
     FTransform RelativeTransform;
 
+    // 액터 풀 재사용 시 되돌릴 스폰 직후 상대 트랜스폼/가시성
+    FVector ArchetypeRelativeLocation{ 0,0,0 };
+    FQuat   ArchetypeRelativeRotation;
+    FVector ArchetypeRelativeRotationEuler{ 0,0,0 };
+    FVector ArchetypeRelativeScale{ 1,1,1 };
+    bool bArchetypeVisible = true;
+
     void UpdateRelativeTransform();
     
     uint32 SceneId; // Scene파일에서 불러온 Id. 컴포넌트끼리 자식부모관계 연결하기 위해 저장. Scene에 저장할 때는 UUID를 저장
@@ -183,6 +183,33 @@ FAABB UShapeComponent::GetWorldAABB() const
 void UShapeComponent::DuplicateSubObjects()
 {
     Super::DuplicateSubObjects();
+    bDebugVolumeValid = false;
+}
+
+void UShapeComponent::ResetForPool()
+{
+    Super::ResetForPool();
+    OverlapNow.clear();
+    OverlapPrev.clear();
+    OverlapInfos.clear();
+}
+
+bool UShapeComponent::ShouldRebuildDebugVolume(const FMatrix& WorldMatrix, const FVector4& ShapeParams) const
+{
+    if (bDebugVolumeValid
+        && std::memcmp(&WorldMatrix, &DebugVolumeMatrix, sizeof(FMatrix)) == 0
+        && std::memcmp(&ShapeParams, &DebugVolumeParams, sizeof(FVector4)) == 0
+        && std::memcmp(&ShapeColor, &DebugVolumeColor, sizeof(FVector4)) == 0)
+    {
+        return false;
+    }
+
+    DebugVolumeMatrix = WorldMatrix;
+    DebugVolumeParams = ShapeParams;
+    DebugVolumeColor = ShapeColor;
+    bDebugVolumeValid = true;
+    DebugVolumeLines.Reset();
+    return true;
 }
 
 
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "PrimitiveComponent.h"
+#include "DebugDrawManager.h"
 #include "UShapeComponent.generated.h"
 
 enum class EShapeKind : uint8
@@ -60,6 +61,9 @@ public:
 	// Duplication
 	virtual void DuplicateSubObjects() override;
 
+	// 풀 반납 시 이전 겹침 상태 제거 (다시 꺼냈을 때 EndOverlap이 잘못 나가지 않도록)
+	virtual void ResetForPool() override;
+
 	// ㅡㅡㅡㅡㅡㅡㅡㅡㅡ디버깅용ㅡㅡㅡㅡㅡㅡㅡㅡㅡㅡ
  
 protected: 
@@ -75,4 +79,14 @@ protected:
 	TArray<FOverlapInfo> OverlapInfos; 
 	//TODO: float LineThickness;
 
+	// 디버그 볼륨 선분 캐시: 월드 행렬/모양 파라미터/색이 그대로면 매 프레임 재생성하지 않는다.
+	// true를 반환하면 캐시가 비워진 상태이므로 호출 측이 DebugVolumeLines를 다시 채운다.
+	bool ShouldRebuildDebugVolume(const FMatrix& WorldMatrix, const FVector4& ShapeParams) const;
+
+	mutable FDebugLineBuffer DebugVolumeLines;
+	mutable FMatrix DebugVolumeMatrix;
+	mutable FVector4 DebugVolumeParams;
+	mutable FVector4 DebugVolumeColor;
+	mutable bool bDebugVolumeValid = false;
+
 };
@@ -59,6 +59,26 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
 		bSkinningMatricesDirty = false;
 	}
 
+    if (DrawCommandCache.IsTransformDirty())
+    {
+       DrawCommandCache.UpdateWorldMatrix(GetWorldMatrix());
+    }
+
+    // 스키닝 모드에 따라 정점 버퍼(에셋 공용 vs 컴포넌트 전용)가 달라지므로 키에 모드가 자연스럽게 반영된다
+    ID3D11Buffer* VertexBufferToUse = bIsGPUSkinning ? SkeletalMesh->GetVertexBuffer() : VertexBuffer;
+    const FMeshDrawCommandCacheKey CacheKey{ SkeletalMesh, VertexBufferToUse, SkeletalMesh->GetIndexBuffer(), View->ViewPermutationId };
+    TArray<FMeshBatchElement>* CachedCommands = DrawCommandCache.Find(CacheKey, MaterialSlots);
+    if (!CachedCommands)
+    {
+       CachedCommands = &DrawCommandCache.Add(CacheKey, MaterialSlots);
+       BuildMeshBatches(*CachedCommands, View, bIsGPUSkinning);
+    }
+
+    OutMeshBatchElements.Append(*CachedCommands);
+}
+
+void USkinnedMeshComponent::BuildMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View, bool bIsGPUSkinning)
+{
     const TArray<FGroupInfo>& MeshGroupInfos = SkeletalMesh->GetMeshGroupInfo();
     auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
     {
@@ -118,19 +138,15 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
        }
 
        FMeshBatchElement BatchElement;
-       TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
-       if (0 < MaterialToUse->GetShaderMacros().Num())
-       {
-          ShaderMacros.Append(MaterialToUse->GetShaderMacros());
-       }
+       FShaderPermutationId PermutationId = FShaderPermutation::WithMacroSet(View->ViewPermutationId, MaterialToUse->GetShaderMacroSetId());
 
     	if (bIsGPUSkinning)
     	{
-    		ShaderMacros.Append({{"GPU_SKINNING", "1"}});
+    		PermutationId = FShaderPermutation::WithGPUSkinning(PermutationId, true);
     		BatchElement.SkinningMatrices = &FinalSkinningMatrices;
     	}
 
-       FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
+       FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(PermutationId);
 
        if (ShaderVariant)
        {
@@ -140,6 +156,9 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
        }
 
        BatchElement.Material = MaterialToUse;
+       BatchElement.MaterialSortId = MaterialToUse->GetSortId();
+       BatchElement.MeshSortId = SkeletalMesh->GetSortId();
+       BatchElement.ShaderSortId = ShaderVariant ? ShaderVariant->SortId : 0;
 
        BatchElement.VertexBuffer = bIsGPUSkinning ? SkeletalMesh->GetVertexBuffer() : VertexBuffer;
        BatchElement.IndexBuffer = SkeletalMesh->GetIndexBuffer();
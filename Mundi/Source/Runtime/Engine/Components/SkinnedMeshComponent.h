@@ -60,6 +60,8 @@ protected:
     TArray<FNormalVertex> NormalSkinnedVertices;
 
 private:
+    // 섹션별 머티리얼/셰이더를 결정해 드로우 커맨드를 새로 만든다 (캐시 재구성 시에만 호출)
+    void BuildMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View, bool bIsGPUSkinning);
     void PerformSkinning();
     FVector SkinVertexPosition(const FSkinnedVertex& InVertex) const;
     FVector SkinVertexNormal(const FSkinnedVertex& InVertex) const;
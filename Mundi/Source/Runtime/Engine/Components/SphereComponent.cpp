@@ -67,9 +67,12 @@ void USphereComponent::RenderDebugVolume(URenderer* Renderer) const
     const float Radius = SphereRadius;
     const int NumSegments = 16;
 
-    TArray<FVector> StartPoints;
-    TArray<FVector> EndPoints;
-    TArray<FVector4> Colors;
+    // 축 정렬 원이라 회전/스케일과 무관하므로 위치와 반지름만 캐시 키로 쓴다
+    if (!ShouldRebuildDebugVolume(FMatrix::MakeTranslation(Center), FVector4(Radius, 0.0f, 0.0f, 0.0f)))
+    {
+        Renderer->AddLines(DebugVolumeLines);
+        return;
+    }
 
     // XY circle (Z fixed)
     for (int i = 0; i < NumSegments; ++i)
@@ -80,9 +83,7 @@ void USphereComponent::RenderDebugVolume(URenderer* Renderer) const
         const FVector p0 = Center + FVector(Radius * std::cos(a0), Radius * std::sin(a0), 0.0f);
         const FVector p1 = Center + FVector(Radius * std::cos(a1), Radius * std::sin(a1), 0.0f);
 
-        StartPoints.Add(p0);
-        EndPoints.Add(p1);
-        Colors.Add(ShapeColor);
+        DebugVolumeLines.AddLine(p0, p1, ShapeColor);
     }
 
     // XZ circle (Y fixed)
@@ -94,9 +95,7 @@ void USphereComponent::RenderDebugVolume(URenderer* Renderer) const
         const FVector p0 = Center + FVector(Radius * std::cos(a0), 0.0f, Radius * std::sin(a0));
         const FVector p1 = Center + FVector(Radius * std::cos(a1), 0.0f, Radius * std::sin(a1));
 
-        StartPoints.Add(p0);
-        EndPoints.Add(p1);
-        Colors.Add(ShapeColor);
+        DebugVolumeLines.AddLine(p0, p1, ShapeColor);
     }
 
     // YZ circle (X fixed)
@@ -108,10 +107,8 @@ void USphereComponent::RenderDebugVolume(URenderer* Renderer) const
         const FVector p0 = Center + FVector(0.0f, Radius * std::cos(a0), Radius * std::sin(a0));
         const FVector p1 = Center + FVector(0.0f, Radius * std::cos(a1), Radius * std::sin(a1));
 
-        StartPoints.Add(p0);
-        EndPoints.Add(p1);
-        Colors.Add(ShapeColor);
+        DebugVolumeLines.AddLine(p0, p1, ShapeColor);
     }
 
-    Renderer->AddLines(StartPoints, EndPoints, Colors);
+    Renderer->AddLines(DebugVolumeLines);
 }
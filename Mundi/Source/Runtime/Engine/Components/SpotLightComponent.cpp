@@ -102,7 +102,7 @@ float USpotLightComponent::GetConeAttenuation(const FVector& WorldPosition) cons
 
 FSpotLightInfo USpotLightComponent::GetLightInfo() const
 {
-	FSpotLightInfo Info;
+	FSpotLightInfo Info{}; // 패딩까지 0으로 (슬롯 바이트 비교용)
 	// Use GetLightColorWithIntensity() to include Temperature + Intensity
 	Info.Color = GetLightColorWithIntensity();
 	Info.Position = GetWorldLocation();
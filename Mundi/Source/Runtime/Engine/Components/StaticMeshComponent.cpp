@@ -36,6 +36,24 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		return;
 	}
 
+	if (DrawCommandCache.IsTransformDirty())
+	{
+		DrawCommandCache.UpdateWorldMatrix(GetWorldMatrix());
+	}
+
+	const FMeshDrawCommandCacheKey CacheKey{ StaticMesh, StaticMesh->GetVertexBuffer(), StaticMesh->GetIndexBuffer(), View->ViewPermutationId };
+	TArray<FMeshBatchElement>* CachedCommands = DrawCommandCache.Find(CacheKey, MaterialSlots);
+	if (!CachedCommands)
+	{
+		CachedCommands = &DrawCommandCache.Add(CacheKey, MaterialSlots);
+		BuildMeshBatches(*CachedCommands, View);
+	}
+
+	OutMeshBatchElements.Append(*CachedCommands);
+}
+
+void UStaticMeshComponent::BuildMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+{
 	const TArray<FGroupInfo>& MeshGroupInfos = StaticMesh->GetMeshGroupInfo();
 
 	auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
@@ -96,13 +114,9 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		}
 
 		FMeshBatchElement BatchElement;
-		// View 모드 전용 매크로와 머티리얼 개인 매크로를 결합한다
-		TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
-		if (0 < MaterialToUse->GetShaderMacros().Num())
-		{
-			ShaderMacros.Append(MaterialToUse->GetShaderMacros());
-		}
-		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
+		// View 모드 퍼뮤테이션에 머티리얼 매크로 세트를 얹은 정수 ID로 Variant를 찾는다
+		const FShaderPermutationId PermutationId = FShaderPermutation::WithMacroSet(View->ViewPermutationId, MaterialToUse->GetShaderMacroSetId());
+		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(PermutationId);
 
 		if (ShaderVariant)
 		{
@@ -114,6 +128,9 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		// UMaterialInterface를 UMaterial로 캐스팅해야 할 수 있음. 렌더러가 UMaterial을 기대한다면.
 		// 지금은 Material.h 구조상 UMaterialInterface에 필요한 정보가 다 있음.
 		BatchElement.Material = MaterialToUse;
+		BatchElement.MaterialSortId = MaterialToUse->GetSortId();
+		BatchElement.MeshSortId = StaticMesh->GetSortId();
+		BatchElement.ShaderSortId = ShaderVariant ? ShaderVariant->SortId : 0;
 		BatchElement.VertexBuffer = StaticMesh->GetVertexBuffer();
 		BatchElement.IndexBuffer = StaticMesh->GetIndexBuffer();
 		BatchElement.VertexStride = StaticMesh->GetVertexStride();
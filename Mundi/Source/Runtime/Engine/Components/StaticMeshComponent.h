@@ -46,5 +46,8 @@ public:
 protected:
 	void OnTransformUpdated() override;
 
+	// 섹션별 머티리얼/셰이더를 결정해 드로우 커맨드를 새로 만든다 (캐시 재구성 시에만 호출)
+	void BuildMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
+
 protected:
 };
@@ -0,0 +1,589 @@
+﻿#include "pch.h"
+#include "ActorPool.h"
+#include "Actor.h"
+#include "World.h"
+#include "Level.h"
+#include "SelectionManager.h"
+#include "PrefabRegistry.h"
+#include "PlatformTime.h"
+#include "SceneComponent.h"
+#include "MovementComponent.h"
+
+FActorPoolManager::~FActorPoolManager()
+{
+	Clear();
+}
+
+int32 FActorPoolManager::Prewarm(UClass* Class, int32 Count)
+{
+	if (!Class || !Class->IsChildOf(AActor::StaticClass()))
+	{
+		UE_LOG("[error] ActorPool: Prewarm에 유효하지 않은 클래스가 전달되었습니다.");
+		return 0;
+	}
+	return PrewarmPool(FindOrAddPool(Class), Count);
+}
+
+int32 FActorPoolManager::Prewarm(const FWideString& PrefabPath, int32 Count)
+{
+	if (PrefabPath.empty())
+	{
+		return 0;
+	}
+	return PrewarmPool(FindOrAddPool(PrefabPath), Count);
+}
+
+AActor* FActorPoolManager::Acquire(UClass* Class, const FTransform& Transform)
+{
+	if (!Class || !Class->IsChildOf(AActor::StaticClass()))
+	{
+		UE_LOG("[error] ActorPool: Acquire에 유효하지 않은 클래스가 전달되었습니다.");
+		return nullptr;
+	}
+	return AcquireFrom(FindOrAddPool(Class), Transform);
+}
+
+AActor* FActorPoolManager::Acquire(const FWideString& PrefabPath, const FTransform& Transform)
+{
+	if (PrefabPath.empty())
+	{
+		return nullptr;
+	}
+	return AcquireFrom(FindOrAddPool(PrefabPath), Transform);
+}
+
+bool FActorPoolManager::Release(AActor* Actor)
+{
+	FPooledActor* Entry = Actor ? PooledActors.Find(Actor) : nullptr;
+	if (!Entry || !Entry->bActive)
+	{
+		return false;
+	}
+
+	// 틱 도중 레벨 배열을 건드리지 않도록 지연 삭제 목록을 그대로 이용한다
+	Actor->Destroy();
+	return true;
+}
+
+void FActorPoolManager::ReclaimPendingKillActors(TArray<AActor*>& InOutActors)
+{
+	if (PooledActors.IsEmpty())
+	{
+		return;
+	}
+
+	// 1. 풀 액터를 골라내고 나머지는 앞으로 당겨 삭제 목록으로 남긴다
+	TArray<AActor*> Reclaimed;
+	TSet<AActor*> ReclaimSet;
+	int32 NumKept = 0;
+	for (AActor* Actor : InOutActors)
+	{
+		FPooledActor* Entry = PooledActors.Find(Actor);
+		if (!Entry)
+		{
+			InOutActors[NumKept++] = Actor;
+			continue;
+		}
+
+		// 대기 중인 액터에 대한 Destroy(오래된 UUID로 찾은 경우 등)나 중복 요청은 무시
+		Actor->ClearPendingDestroy();
+		if (Entry->bActive && !ReclaimSet.Contains(Actor))
+		{
+			ReclaimSet.Add(Actor);
+			Reclaimed.Add(Actor);
+		}
+	}
+	InOutActors.SetNum(NumKept);
+
+	if (Reclaimed.IsEmpty())
+	{
+		return;
+	}
+
+	// 2. 게임 수명 종료 -> 등록 해제(파티션, 발사체 시뮬레이션에서 빠짐) -> 런타임 상태 초기화
+	USelectionManager* SelectionMgr = World->GetSelectionManager();
+	for (AActor* Actor : Reclaimed)
+	{
+		if (World->bPie)
+		{
+			Actor->EndPlay();
+		}
+		if (SelectionMgr)
+		{
+			SelectionMgr->DeselectActor(Actor);
+		}
+		Actor->UnregisterAllComponents();
+		Actor->ResetForPool();
+	}
+
+	// 3. 레벨 배열은 한 번만 훑어 제거
+	if (ULevel* Level = World->GetLevel())
+	{
+		TArray<AActor*> Removed;
+		Removed.Reserve(Reclaimed.Num());
+		Level->RemoveActors(ReclaimSet, Removed);
+		for (AActor* Actor : Removed)
+		{
+			UWorld::OnActorRemoved.Broadcast(World, Actor);
+		}
+	}
+
+	// 4. 대기 목록으로 반납 (가득 찼으면 삭제)
+	for (AActor* Actor : Reclaimed)
+	{
+		FPooledActor& Entry = PooledActors[Actor];
+		FActorPool& Pool = *Entry.Pool;
+		Entry.bActive = false;
+		Actor->SetWorld(nullptr);
+
+		--Pool.Stats.NumActive;
+		++Pool.Stats.NumReleased;
+
+		if (Pool.FreeActors.Num() >= Pool.MaxFree)
+		{
+			++Pool.Stats.NumDiscarded;
+			DeleteFreeActor(Actor);
+			continue;
+		}
+		Pool.FreeActors.Add(Actor);
+		Pool.Stats.NumFree = Pool.FreeActors.Num();
+	}
+}
+
+void FActorPoolManager::SetMaxFree(UClass* Class, int32 MaxFree)
+{
+	if (!Class)
+	{
+		return;
+	}
+	FActorPool& Pool = FindOrAddPool(Class);
+	Pool.MaxFree = std::max(MaxFree, 0);
+	TrimFree(Pool);
+}
+
+void FActorPoolManager::SetMaxFree(const FWideString& PrefabPath, int32 MaxFree)
+{
+	if (PrefabPath.empty())
+	{
+		return;
+	}
+	FActorPool& Pool = FindOrAddPool(PrefabPath);
+	Pool.MaxFree = std::max(MaxFree, 0);
+	TrimFree(Pool);
+}
+
+void FActorPoolManager::RemovePool(UClass* Class)
+{
+	if (FActorPool* Pool = ClassPools.Find(Class))
+	{
+		DestroyPool(*Pool);
+		ClassPools.Remove(Class);
+	}
+}
+
+void FActorPoolManager::RemovePool(const FWideString& PrefabPath)
+{
+	if (FActorPool* Pool = PrefabPools.Find(PrefabPath))
+	{
+		DestroyPool(*Pool);
+		PrefabPools.Remove(PrefabPath);
+	}
+}
+
+void FActorPoolManager::Clear()
+{
+	for (auto& Pair : ClassPools)
+	{
+		DestroyPool(Pair.second);
+	}
+	for (auto& Pair : PrefabPools)
+	{
+		DestroyPool(Pair.second);
+	}
+	ClassPools.Empty();
+	PrefabPools.Empty();
+	PooledActors.Empty();
+}
+
+void FActorPoolManager::GetStats(TArray<FActorPoolStats>& OutStats) const
+{
+	OutStats.Empty();
+	OutStats.Reserve(ClassPools.Num() + PrefabPools.Num());
+	for (const auto& Pair : ClassPools)
+	{
+		OutStats.Add(Pair.second.Stats);
+	}
+	for (const auto& Pair : PrefabPools)
+	{
+		OutStats.Add(Pair.second.Stats);
+	}
+	std::sort(OutStats.begin(), OutStats.end(), [](const FActorPoolStats& A, const FActorPoolStats& B) { return A.Name < B.Name; });
+}
+
+FActorPoolStats FActorPoolManager::GetTotalStats() const
+{
+	TArray<FActorPoolStats> AllStats;
+	GetStats(AllStats);
+
+	FActorPoolStats Total;
+	Total.Name = "Total";
+	for (const FActorPoolStats& Stats : AllStats)
+	{
+		Total.NumActive += Stats.NumActive;
+		Total.NumFree += Stats.NumFree;
+		Total.PeakActive += Stats.PeakActive;
+		Total.MaxFree += Stats.MaxFree;
+		Total.NumCreated += Stats.NumCreated;
+		Total.NumPrewarmed += Stats.NumPrewarmed;
+		Total.NumAcquired += Stats.NumAcquired;
+		Total.NumReused += Stats.NumReused;
+		Total.NumReleased += Stats.NumReleased;
+		Total.NumDiscarded += Stats.NumDiscarded;
+	}
+	return Total;
+}
+
+FActorPoolManager::FActorPool& FActorPoolManager::FindOrAddPool(UClass* Class)
+{
+	FActorPool* Pool = ClassPools.Find(Class);
+	if (!Pool)
+	{
+		Pool = &ClassPools[Class];
+		Pool->Class = Class;
+		Pool->Stats.Name = Class->Name;
+		Pool->Stats.MaxFree = Pool->MaxFree;
+	}
+	return *Pool;
+}
+
+FActorPoolManager::FActorPool& FActorPoolManager::FindOrAddPool(const FWideString& PrefabPath)
+{
+	FActorPool* Pool = PrefabPools.Find(PrefabPath);
+	if (!Pool)
+	{
+		Pool = &PrefabPools[PrefabPath];
+		Pool->PrefabPath = PrefabPath;
+		Pool->Stats.Name = WideToUTF8(PrefabPath);
+		Pool->Stats.MaxFree = Pool->MaxFree;
+	}
+	return *Pool;
+}
+
+AActor* FActorPoolManager::CreateActor(FActorPool& Pool)
+{
+	AActor* NewActor = nullptr;
+	if (Pool.PrefabPath.empty())
+	{
+		MEM_SCOPE(World);
+		NewActor = Cast<AActor>(ObjectFactory::NewObject(Pool.Class));
+	}
+	else
+	{
+		// 프리팹은 레지스트리 템플릿을 복제한다 (파일 로드/파싱은 최초 1회)
+		FPrefabRegistry& Registry = FPrefabRegistry::GetInstance();
+		if (const FPrefabTemplate* Template = Registry.FindOrLoad(Pool.PrefabPath))
+		{
+			NewActor = Registry.Instantiate(*Template);
+		}
+	}
+
+	if (!NewActor)
+	{
+		UE_LOG("[error] ActorPool: %s 액터를 생성하지 못했습니다.", Pool.Stats.Name.c_str());
+		return nullptr;
+	}
+
+	// 아직 어디에도 쓰이지 않은 지금이 스폰 직후 상태: 반납될 때마다 여기로 되돌린다
+	NewActor->CapturePoolArchetype();
+
+	PooledActors.Add(NewActor, FPooledActor{ &Pool, false });
+	++Pool.Stats.NumCreated;
+	return NewActor;
+}
+
+AActor* FActorPoolManager::AcquireFrom(FActorPool& Pool, const FTransform& Transform)
+{
+	if (World->IsTearingDown())
+	{
+		UE_LOG("[warning] 월드 삭제 시 새로운 액터를 추가할 수 없습니다.");
+		return nullptr;
+	}
+
+	AActor* Actor = nullptr;
+	if (Pool.FreeActors.Num() > 0)
+	{
+		Actor = Pool.FreeActors.Pop();
+		Pool.Stats.NumFree = Pool.FreeActors.Num();
+		++Pool.Stats.NumReused;
+	}
+	else
+	{
+		Actor = CreateActor(Pool);
+		if (!Actor)
+		{
+			return nullptr;
+		}
+	}
+
+	PooledActors[Actor].bActive = true;
+	++Pool.Stats.NumAcquired;
+	++Pool.Stats.NumActive;
+	Pool.Stats.PeakActive = std::max(Pool.Stats.PeakActive, Pool.Stats.NumActive);
+
+	// 등록 전에 위치를 잡아 두면 파티션에는 새 위치로 한 번만 들어간다
+	Actor->ClearPendingDestroy();
+	Actor->SetActorTransform(Transform);
+
+	// 컴포넌트 재등록 (파티션 재삽입, 발사체 시뮬레이션 슬롯 재할당)
+	World->AddActorToLevel(Actor);
+
+	if (World->bPie)
+	{
+		Actor->BeginPlay();
+	}
+
+	return Actor;
+}
+
+int32 FActorPoolManager::PrewarmPool(FActorPool& Pool, int32 Count)
+{
+	if (Count > Pool.MaxFree)
+	{
+		Pool.MaxFree = Count;
+		Pool.Stats.MaxFree = Count;
+	}
+
+	int32 NumCreated = 0;
+	while (Pool.FreeActors.Num() < Count)
+	{
+		AActor* Actor = CreateActor(Pool);
+		if (!Actor)
+		{
+			break;
+		}
+		Pool.FreeActors.Add(Actor);
+		++NumCreated;
+	}
+
+	Pool.Stats.NumPrewarmed += NumCreated;
+	Pool.Stats.NumFree = Pool.FreeActors.Num();
+	return NumCreated;
+}
+
+void FActorPoolManager::TrimFree(FActorPool& Pool)
+{
+	while (Pool.FreeActors.Num() > Pool.MaxFree)
+	{
+		DeleteFreeActor(Pool.FreeActors.Pop());
+		++Pool.Stats.NumDiscarded;
+	}
+	Pool.Stats.NumFree = Pool.FreeActors.Num();
+	Pool.Stats.MaxFree = Pool.MaxFree;
+}
+
+void FActorPoolManager::DestroyPool(FActorPool& Pool)
+{
+	for (AActor* Actor : Pool.FreeActors)
+	{
+		DeleteFreeActor(Actor);
+	}
+	Pool.FreeActors.Empty();
+
+	// 나가 있는 액터는 레벨 소유로 남고, 이후 Destroy()되면 일반 액터처럼 삭제된다
+	for (auto It = PooledActors.begin(); It != PooledActors.end();)
+	{
+		if (It->second.Pool == &Pool)
+		{
+			It = PooledActors.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
+}
+
+void FActorPoolManager::DeleteFreeActor(AActor* Actor)
+{
+	// 대기 액터는 등록이 모두 해제된 상태라 레벨/파티션 정리 없이 바로 삭제할 수 있다
+	PooledActors.Remove(Actor);
+	ObjectFactory::DeleteObject(Actor);
+}
+
+namespace
+{
+	// 재사용 검증용: 풀 반납 시 되돌려야 하는 상태를 문자열로 덤프 (컴포넌트는 TSet 순서와 무관하게 정렬)
+	FString DumpPoolState(AActor* Actor)
+	{
+		char Buffer[512];
+		auto AppendVector = [&Buffer](FString& Out, const char* Label, const FVector& V)
+		{
+			snprintf(Buffer, sizeof(Buffer), " %s(%.4f,%.4f,%.4f)", Label, V.X, V.Y, V.Z);
+			Out += Buffer;
+		};
+
+		TArray<FString> ComponentStates;
+		for (UActorComponent* Component : Actor->GetOwnedComponents())
+		{
+			FString State = Component->GetClass()->Name;
+			snprintf(Buffer, sizeof(Buffer), " Active=%d Hidden=%d Tick=%d",
+				Component->IsActive(), Component->GetHiddenInGame(), Component->IsTickEnabled());
+			State += Buffer;
+
+			if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+			{
+				State += SceneComponent->bIsVisible ? " Visible" : " Invisible";
+				AppendVector(State, "L", SceneComponent->GetRelativeLocation());
+				AppendVector(State, "R", SceneComponent->GetRelativeRotationEuler());
+				AppendVector(State, "S", SceneComponent->GetRelativeScale());
+			}
+			if (UMovementComponent* MovementComponent = Cast<UMovementComponent>(Component))
+			{
+				AppendVector(State, "V", MovementComponent->GetVelocity());
+				AppendVector(State, "A", MovementComponent->GetAcceleration());
+			}
+			ComponentStates.Add(State);
+		}
+		std::sort(ComponentStates.begin(), ComponentStates.end());
+
+		FString Dump = Actor->GetClass()->Name;
+		snprintf(Buffer, sizeof(Buffer), " Tag=%s Hidden=%d Active=%d", Actor->Tag.c_str(), Actor->bActorHiddenInGame, Actor->bActorIsActive);
+		Dump += Buffer;
+		for (const FString& State : ComponentStates)
+		{
+			Dump += "\n";
+			Dump += State;
+		}
+		return Dump;
+	}
+}
+
+FActorPoolBenchmarkResult RunActorPoolBenchmark(UWorld* World, const FWideString& PrefabPath, int32 NumPerFrame, int32 NumFrames)
+{
+	FActorPoolBenchmarkResult Result;
+	FActorPoolManager* ActorPool = World ? World->GetActorPool() : nullptr;
+	if (!ActorPool || NumPerFrame <= 0 || NumFrames <= 0)
+	{
+		return Result;
+	}
+
+	// 템플릿 컴파일은 두 경로 모두에서 제외
+	if (!FPrefabRegistry::GetInstance().FindOrLoad(PrefabPath))
+	{
+		return Result;
+	}
+
+	Result.NumPerFrame = NumPerFrame;
+	Result.NumFrames = NumFrames;
+
+	auto MakeTransform = [](int32 Index)
+	{
+		return FTransform(FVector((float)(Index % 32) * 2.0f, (float)(Index / 32) * 2.0f, 50.0f), FQuat(0, 0, 0, 1), FVector(1, 1, 1));
+	};
+
+	// 한 프레임: NumPerFrame개 생성 -> 전부 Destroy -> 프레임 끝 지연 삭제 처리
+	TArray<AActor*> Spawned;
+	Spawned.Reserve(NumPerFrame);
+	auto RunFrames = [&](auto SpawnOne, double& OutTotalMs, double& OutMaxFrameMs)
+	{
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < NumPerFrame; ++i)
+			{
+				if (AActor* Actor = SpawnOne(i))
+				{
+					Spawned.Add(Actor);
+				}
+			}
+			for (AActor* Actor : Spawned)
+			{
+				Actor->Destroy();
+			}
+			World->ProcessPendingKillActors();
+			Spawned.Empty();
+
+			const double FrameMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+			OutTotalMs += FrameMs;
+			OutMaxFrameMs = std::max(OutMaxFrameMs, FrameMs);
+		}
+	};
+
+	// 1. 기존 경로: 매번 템플릿 복제 + 컴포넌트 생성/파괴
+	RunFrames([&](int32 Index)
+	{
+		AActor* Actor = World->SpawnPrefabActor(PrefabPath);
+		if (Actor)
+		{
+			Actor->SetActorTransform(MakeTransform(Index));
+		}
+		return Actor;
+	}, Result.SpawnDestroyMs, Result.SpawnDestroyMaxFrameMs);
+
+	// 2. 풀 경로: 로딩 시점에 미리 채워 두고 꺼내기/반납만 반복
+	ActorPool->RemovePool(PrefabPath);
+	ActorPool->Prewarm(PrefabPath, NumPerFrame);
+	RunFrames([&](int32 Index)
+	{
+		return ActorPool->Acquire(PrefabPath, MakeTransform(Index));
+	}, Result.PoolMs, Result.PoolMaxFrameMs);
+
+	// 3. 재사용 검증: 실행 중 바꾼 상태를 들고 반납된 액터가 새로 스폰한 액터와 같아야 한다
+	const FTransform CheckTransform = MakeTransform(0);
+	if (AActor* Dirty = ActorPool->Acquire(PrefabPath, CheckTransform))
+	{
+		Dirty->Tag = "PoolDirty";
+		Dirty->SetActorHiddenInGame(true);
+		for (UActorComponent* Component : Dirty->GetOwnedComponents())
+		{
+			Component->SetHiddenInGame(true);
+			Component->SetTickEnabled(false);
+			if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+			{
+				SceneComponent->SetVisibility(false);
+				if (SceneComponent != Dirty->GetRootComponent())
+				{
+					SceneComponent->AddRelativeLocation(FVector(1.0f, 2.0f, 3.0f));
+				}
+			}
+			if (UMovementComponent* MovementComponent = Cast<UMovementComponent>(Component))
+			{
+				MovementComponent->StopMovement();
+				MovementComponent->SetAcceleration(FVector(0.0f, 0.0f, -9.8f));
+			}
+		}
+		ActorPool->Release(Dirty);
+		World->ProcessPendingKillActors();
+
+		AActor* Reused = ActorPool->Acquire(PrefabPath, CheckTransform);
+		AActor* Fresh = World->SpawnPrefabActor(PrefabPath);
+		if (Fresh)
+		{
+			Fresh->SetActorTransform(CheckTransform);
+		}
+		Result.bReuseMatchesFresh = Reused == Dirty && Fresh && DumpPoolState(Reused) == DumpPoolState(Fresh);
+
+		for (AActor* Actor : { Reused, Fresh })
+		{
+			if (Actor)
+			{
+				Actor->Destroy();
+			}
+		}
+		World->ProcessPendingKillActors();
+	}
+
+	TArray<FActorPoolStats> AllStats;
+	ActorPool->GetStats(AllStats);
+	const FString PoolName = WideToUTF8(PrefabPath);
+	for (const FActorPoolStats& Stats : AllStats)
+	{
+		if (Stats.Name == PoolName)
+		{
+			Result.NumReused = Stats.NumReused;
+		}
+	}
+
+	ActorPool->RemovePool(PrefabPath);
+	return Result;
+}
@@ -0,0 +1,121 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class AActor;
+class UClass;
+class UWorld;
+struct FTransform;
+
+struct FActorPoolStats
+{
+	FString Name;					// 클래스 이름 또는 프리팹 경로
+	int32 NumActive = 0;			// 레벨에 나가 있는 액터
+	int32 NumFree = 0;				// 대기 중인 액터
+	int32 PeakActive = 0;
+	int32 MaxFree = 0;
+	uint64 NumCreated = 0;			// 풀이 새로 만든 액터 (프리웜 포함)
+	uint64 NumPrewarmed = 0;
+	uint64 NumAcquired = 0;
+	uint64 NumReused = 0;			// 대기 액터를 꺼내 쓴 횟수 (NumAcquired - NumReused = 미스)
+	uint64 NumReleased = 0;
+	uint64 NumDiscarded = 0;		// MaxFree 초과로 반납 대신 삭제된 액터
+};
+
+/**
+ * @brief 월드별 액터 풀
+ * - 클래스 또는 프리팹 경로마다 대기 액터 목록을 두고, 스폰/파괴 대신 꺼내기/반납으로 재사용한다.
+ * - 대기 액터는 레벨, 파티션, 발사체 시뮬레이션 어디에도 등록되지 않은 상태(World == nullptr)로 보관된다.
+ * - 처음 만들 때 CapturePoolArchetype으로 스폰 직후 상태(태그, 숨김, 컴포넌트 상대 트랜스폼, 초기 속도 등)를 저장해 둔다.
+ * - 꺼내기: 트랜스폼 적용 -> AddActorToLevel(컴포넌트 재등록, 파티션 재삽입) -> PIE면 BeginPlay
+ * - 반납: Destroy()와 같은 지연 경로를 타고 ProcessPendingKillActors에서
+ *   EndPlay -> 컴포넌트 등록 해제 -> ResetForPool -> 레벨에서 제거 순으로 회수된다.
+ *   따라서 풀 액터에 Destroy()를 호출해도(Lua DeleteObject 포함) 삭제되지 않고 풀로 돌아간다.
+ * - 메인 스레드 전용.
+ */
+class FActorPoolManager
+{
+public:
+	explicit FActorPoolManager(UWorld* InWorld) : World(InWorld) {}
+	~FActorPoolManager();
+
+	FActorPoolManager(const FActorPoolManager&) = delete;
+	FActorPoolManager& operator=(const FActorPoolManager&) = delete;
+
+	// 대기 액터가 Count개가 될 때까지 미리 만든다. 새로 만든 개수 반환
+	int32 Prewarm(UClass* Class, int32 Count);
+	int32 Prewarm(const FWideString& PrefabPath, int32 Count);
+
+	// 대기 액터를 꺼내 월드에 등록한다. 비어 있으면 새로 만든다. 실패 시 nullptr
+	AActor* Acquire(UClass* Class, const FTransform& Transform);
+	AActor* Acquire(const FWideString& PrefabPath, const FTransform& Transform);
+
+	// 풀 액터 반납 요청 (이번 프레임 끝에 회수). 풀 액터가 아니면 false
+	bool Release(AActor* Actor);
+
+	// UWorld::ProcessPendingKillActors에서 호출: 풀 액터를 회수하고 목록에서 빼서 나머지만 삭제되게 한다
+	void ReclaimPendingKillActors(TArray<AActor*>& InOutActors);
+
+	bool IsPooled(const AActor* Actor) const { return PooledActors.Find(const_cast<AActor*>(Actor)) != nullptr; }
+
+	// 대기 액터 최대 보관 수. 줄이면 넘치는 대기 액터는 바로 삭제
+	void SetMaxFree(UClass* Class, int32 MaxFree);
+	void SetMaxFree(const FWideString& PrefabPath, int32 MaxFree);
+
+	// 풀 제거: 대기 액터는 삭제하고 나가 있는 액터는 일반 액터로 남긴다
+	void RemovePool(UClass* Class);
+	void RemovePool(const FWideString& PrefabPath);
+
+	// 모든 풀 제거 (레벨 교체, 월드 소멸 시)
+	void Clear();
+
+	void GetStats(TArray<FActorPoolStats>& OutStats) const;
+	FActorPoolStats GetTotalStats() const;
+
+private:
+	struct FActorPool
+	{
+		UClass* Class = nullptr;			// 클래스 풀
+		FWideString PrefabPath;				// 프리팹 풀 (비어 있으면 클래스 풀)
+		TArray<AActor*> FreeActors;
+		int32 MaxFree = DefaultMaxFree;
+		FActorPoolStats Stats;
+	};
+
+	struct FPooledActor
+	{
+		FActorPool* Pool = nullptr;
+		bool bActive = false;
+	};
+
+	FActorPool& FindOrAddPool(UClass* Class);
+	FActorPool& FindOrAddPool(const FWideString& PrefabPath);
+
+	AActor* CreateActor(FActorPool& Pool);
+	AActor* AcquireFrom(FActorPool& Pool, const FTransform& Transform);
+	int32 PrewarmPool(FActorPool& Pool, int32 Count);
+	void TrimFree(FActorPool& Pool);
+	void DestroyPool(FActorPool& Pool);
+	void DeleteFreeActor(AActor* Actor);
+
+	static constexpr int32 DefaultMaxFree = 256;
+
+	UWorld* World = nullptr;
+	TMap<UClass*, FActorPool> ClassPools;				// unordered_map이라 값 주소가 rehash에도 유지됨
+	TMap<FWideString, FActorPool> PrefabPools;
+	TMap<AActor*, FPooledActor> PooledActors;			// 풀이 만든 모든 액터 (나가 있는 것 + 대기 중인 것)
+};
+
+// 매 프레임 NumPerFrame개를 만들고 지우는 부하: SpawnPrefabActor/Destroy vs Acquire/Release
+struct FActorPoolBenchmarkResult
+{
+	int32 NumPerFrame = 0;
+	int32 NumFrames = 0;
+	double SpawnDestroyMs = 0.0;
+	double SpawnDestroyMaxFrameMs = 0.0;
+	double PoolMs = 0.0;
+	double PoolMaxFrameMs = 0.0;
+	uint64 NumReused = 0;
+	bool bReuseMatchesFresh = false;	// 런타임에 상태를 바꾼 뒤 반납된 액터가 새로 스폰한 액터와 같은지
+};
+
+FActorPoolBenchmarkResult RunActorPoolBenchmark(UWorld* World, const FWideString& PrefabPath, int32 NumPerFrame, int32 NumFrames);
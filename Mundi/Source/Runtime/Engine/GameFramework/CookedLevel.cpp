@@ -0,0 +1,1377 @@
+﻿#include "pch.h"
+#include "CookedLevel.h"
+#include "Level.h"
+#include "Actor.h"
+#include "ActorComponent.h"
+#include "JsonDocument.h"
+#include "JsonSerializer.h"
+#include "PlatformTime.h"
+#include "PerspectiveDecalComponent.h"
+#include "FakeSpotLightActor.h"
+#include <filesystem>
+
+bool FCookedLevel::bEnabled = true;
+
+namespace
+{
+	constexpr uint32 CookedLevelMagic = 0x4C564C43;	// 'CLVL'
+	constexpr uint32 CookedLevelVersion = 1;
+	constexpr uint32 InvalidAssetIndex = 0xFFFFFFFFu;
+	constexpr int32 MaxTreeDepth = 512;
+
+	// 메모리 버퍼에 이어 쓰는 아카이브
+	class FCookedMemoryWriter : public FArchive
+	{
+	public:
+		FCookedMemoryWriter() : FArchive(false, true) {}
+
+		void Serialize(void* Data, int64 Length) override
+		{
+			const uint8* Bytes = static_cast<const uint8*>(Data);
+			Buffer.insert(Buffer.end(), Bytes, Bytes + Length);
+		}
+		bool Close() override { return true; }
+
+		TArray<uint8> Buffer;
+	};
+
+	// 파일 전체를 한 번에 읽어 둔 버퍼에서 읽는 아카이브. 범위를 벗어나면 손상으로 보고 예외를 던진다
+	class FCookedMemoryReader : public FArchive
+	{
+	public:
+		FCookedMemoryReader(const uint8* InData, size_t InSize) : FArchive(true, false), Data(InData), Size(InSize) {}
+
+		void Serialize(void* Dest, int64 Length) override
+		{
+			if (Length < 0 || Position + static_cast<size_t>(Length) > Size)
+			{
+				throw std::runtime_error("Cooked level corrupt: read past end of file.");
+			}
+			std::memcpy(Dest, Data + Position, static_cast<size_t>(Length));
+			Position += static_cast<size_t>(Length);
+		}
+		bool Close() override { return true; }
+
+		size_t Tell() const { return Position; }
+		void Seek(size_t InPosition)
+		{
+			if (InPosition > Size)
+			{
+				throw std::runtime_error("Cooked level corrupt: seek past end of file.");
+			}
+			Position = InPosition;
+		}
+
+	private:
+		const uint8* Data;
+		size_t Size;
+		size_t Position = 0;
+	};
+
+	uint64 HashBytes(uint64 Hash, const void* Data, size_t Size)
+	{
+		// FNV-1a 64
+		const uint8* Bytes = static_cast<const uint8*>(Data);
+		for (size_t i = 0; i < Size; ++i)
+		{
+			Hash ^= Bytes[i];
+			Hash *= 1099511628211ull;
+		}
+		return Hash;
+	}
+
+	bool IsAssetProperty(EPropertyType Type)
+	{
+		return Type == EPropertyType::Texture || Type == EPropertyType::StaticMesh
+			|| Type == EPropertyType::SkeletalMesh || Type == EPropertyType::Material;
+	}
+
+	// UObject::Serialize가 실제로 읽고 쓰는 프로퍼티만 쿠킹 대상
+	bool IsCookableProperty(const FProperty& Prop)
+	{
+		switch (Prop.Type)
+		{
+		case EPropertyType::Bool:
+		case EPropertyType::Int32:
+		case EPropertyType::Float:
+		case EPropertyType::FVector:
+		case EPropertyType::FLinearColor:
+		case EPropertyType::FString:
+		case EPropertyType::ScriptFile:
+		case EPropertyType::FName:
+		case EPropertyType::Texture:
+		case EPropertyType::StaticMesh:
+		case EPropertyType::SkeletalMesh:
+		case EPropertyType::Material:
+		case EPropertyType::Curve:
+			return true;
+		case EPropertyType::Array:
+			return Prop.InnerType == EPropertyType::Int32 || Prop.InnerType == EPropertyType::Float
+				|| Prop.InnerType == EPropertyType::Bool || Prop.InnerType == EPropertyType::FString
+				|| Prop.InnerType == EPropertyType::Sound;
+		default:
+			return false;
+		}
+	}
+
+	// 클래스 하나의 쿠킹 스키마: 직렬화 대상 프로퍼티 목록과 (이름, 타입, 오프셋) 해시
+	struct FCookedClassSchema
+	{
+		UClass* Class = nullptr;
+		TArray<const FProperty*> Properties;
+		TSet<std::string_view> PropertyNames;
+		uint64 Hash = 0;
+	};
+
+	FCookedClassSchema BuildSchema(UClass* Class)
+	{
+		FCookedClassSchema Schema;
+		Schema.Class = Class;
+		Schema.Hash = HashBytes(14695981039346656037ull, Class->Name, std::strlen(Class->Name));
+		Schema.Hash = HashBytes(Schema.Hash, &CookedLevelVersion, sizeof(CookedLevelVersion));
+
+		for (const FProperty& Prop : Class->GetAllProperties())
+		{
+			if (!IsCookableProperty(Prop))
+			{
+				continue;
+			}
+			Schema.Properties.Add(&Prop);
+			Schema.PropertyNames.insert(std::string_view(Prop.Name));
+
+			const uint32 Offset = static_cast<uint32>(Prop.Offset);
+			Schema.Hash = HashBytes(Schema.Hash, Prop.Name, std::strlen(Prop.Name) + 1);
+			Schema.Hash = HashBytes(Schema.Hash, &Prop.Type, sizeof(Prop.Type));
+			Schema.Hash = HashBytes(Schema.Hash, &Prop.InnerType, sizeof(Prop.InnerType));
+			Schema.Hash = HashBytes(Schema.Hash, &Offset, sizeof(Offset));
+		}
+		return Schema;
+	}
+
+	// ------------------------------------------------------------------
+	// 기존 JSON 읽기 규칙 (FJsonSerializer::ReadXXX / JSON::ToXXX)을 DOM 위에서 재현
+	// ------------------------------------------------------------------
+
+	// JSON::ToFloat(): Floating이 아니면 0
+	float LegacyFloat(const FJsonValue& Value)
+	{
+		return Value.Type == JSON::Class::Floating ? static_cast<float>(Value.Float) : 0.0f;
+	}
+
+	// JSON::ToString(): 이스케이프된 문자열을 돌려준다
+	FString LegacyString(const FJsonValue& Value)
+	{
+		FString Out;
+		if (Value.IsString())
+		{
+			FJsonWriter::AppendEscaped(Value.AsString(), Out);
+		}
+		return Out;
+	}
+
+	FString LegacyKey(std::string_view Key)
+	{
+		FString Out;
+		FJsonWriter::AppendEscaped(Key, Out);
+		return Out;
+	}
+
+	// 중복 키는 기존 파서처럼 마지막 값만 유효
+	bool IsEffectiveMember(const FJsonValue& Object, const FJsonMember& Member)
+	{
+		return Object.Find(Member.Key) == &Member.Value;
+	}
+
+	// 바이너리 JSON 트리: [타입 1바이트][값]. 오브젝트 키는 기존 JSON처럼 이스케이프된 형태로 저장
+	void WriteTree(const FJsonValue& Value, FArchive& Ar);
+
+	template<typename FilterFunc>
+	void WriteObjectMembers(const FJsonValue& Object, FArchive& Ar, FilterFunc ShouldKeep)
+	{
+		TArray<const FJsonMember*> Kept;
+		for (const FJsonMember* Member = Object.MemberBegin(); Member != Object.MemberEnd(); ++Member)
+		{
+			if (IsEffectiveMember(Object, *Member) && ShouldKeep(Member->Key))
+			{
+				Kept.Add(Member);
+			}
+		}
+
+		uint8 Tag = static_cast<uint8>(JSON::Class::Object);
+		uint32 Count = static_cast<uint32>(Kept.Num());
+		Ar << Tag << Count;
+		for (const FJsonMember* Member : Kept)
+		{
+			Serialization::WriteString(Ar, LegacyKey(Member->Key));
+			WriteTree(Member->Value, Ar);
+		}
+	}
+
+	void WriteTree(const FJsonValue& Value, FArchive& Ar)
+	{
+		if (Value.IsObject())
+		{
+			WriteObjectMembers(Value, Ar, [](std::string_view) { return true; });
+			return;
+		}
+
+		uint8 Tag = static_cast<uint8>(Value.Type);
+		Ar << Tag;
+		switch (Value.Type)
+		{
+		case JSON::Class::Array:
+		{
+			uint32 Count = Value.Count;
+			Ar << Count;
+			for (const FJsonValue& Item : Value)
+			{
+				WriteTree(Item, Ar);
+			}
+			break;
+		}
+		case JSON::Class::String:
+			Serialization::WriteString(Ar, FString(Value.AsString()));
+			break;
+		case JSON::Class::Floating:
+		{
+			double Float = Value.Float;
+			Ar << Float;
+			break;
+		}
+		case JSON::Class::Integral:
+		{
+			int64 Int = Value.Int;
+			Ar << Int;
+			break;
+		}
+		case JSON::Class::Boolean:
+		{
+			uint8 Bool = Value.Bool ? 1 : 0;
+			Ar << Bool;
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	JSON ReadTree(FArchive& Ar, int32 Depth = 0)
+	{
+		if (Depth > MaxTreeDepth)
+		{
+			throw std::runtime_error("Cooked level corrupt: JSON tree too deep.");
+		}
+
+		uint8 Tag = 0;
+		Ar << Tag;
+		switch (static_cast<JSON::Class>(Tag))
+		{
+		case JSON::Class::Null:
+			return JSON();
+		case JSON::Class::Object:
+		{
+			uint32 Count = 0;
+			Ar << Count;
+			if (Count > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+			{
+				throw std::runtime_error("Cooked level corrupt: object size is unreasonable.");
+			}
+			JSON Object = JSON::Make(JSON::Class::Object);
+			for (uint32 i = 0; i < Count; ++i)
+			{
+				FString Key;
+				Serialization::ReadString(Ar, Key);
+				Object[Key] = ReadTree(Ar, Depth + 1);
+			}
+			return Object;
+		}
+		case JSON::Class::Array:
+		{
+			uint32 Count = 0;
+			Ar << Count;
+			if (Count > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+			{
+				throw std::runtime_error("Cooked level corrupt: array size is unreasonable.");
+			}
+			JSON Array = JSON::Make(JSON::Class::Array);
+			for (uint32 i = 0; i < Count; ++i)
+			{
+				Array[i] = ReadTree(Ar, Depth + 1);
+			}
+			return Array;
+		}
+		case JSON::Class::String:
+		{
+			FString String;
+			Serialization::ReadString(Ar, String);
+			return JSON(String);
+		}
+		case JSON::Class::Floating:
+		{
+			double Float = 0.0;
+			Ar << Float;
+			return JSON(Float);
+		}
+		case JSON::Class::Integral:
+		{
+			int64 Int = 0;
+			Ar << Int;
+			return JSON(static_cast<long>(Int));
+		}
+		case JSON::Class::Boolean:
+		{
+			uint8 Bool = 0;
+			Ar << Bool;
+			return JSON(Bool != 0);
+		}
+		default:
+			throw std::runtime_error("Cooked level corrupt: unknown JSON tag.");
+		}
+	}
+
+	// ------------------------------------------------------------------
+	// 쿠킹
+	// ------------------------------------------------------------------
+
+	struct FCookContext
+	{
+		TMap<UClass*, uint32> ClassIndices;
+		TArray<FCookedClassSchema> Schemas;
+		TMap<FString, uint32> AssetIndices;
+		TArray<std::pair<EPropertyType, FString>> Assets;
+
+		// 알 수 없는 클래스면 nullptr
+		const FCookedClassSchema* FindOrAddClass(const FString& ClassName, const UClass* RequiredBase, uint32& OutIndex)
+		{
+			UClass* Class = UClass::FindClass(ClassName);
+			if (!Class || !Class->IsChildOf(RequiredBase))
+			{
+				UE_LOG("[CookedLevel] Cannot cook unknown class '%s'", ClassName.c_str());
+				return nullptr;
+			}
+			if (const uint32* Found = ClassIndices.Find(Class))
+			{
+				OutIndex = *Found;
+				return &Schemas[*Found];
+			}
+			OutIndex = static_cast<uint32>(Schemas.Num());
+			ClassIndices.Add(Class, OutIndex);
+			Schemas.Add(BuildSchema(Class));
+			return &Schemas[OutIndex];
+		}
+
+		uint32 FindOrAddAsset(EPropertyType Type, const FString& Path)
+		{
+			if (Path.empty())
+			{
+				return InvalidAssetIndex;
+			}
+			const FString Key = std::to_string(static_cast<int32>(Type)) + ":" + Path;
+			if (const uint32* Found = AssetIndices.Find(Key))
+			{
+				return *Found;
+			}
+			const uint32 Index = static_cast<uint32>(Assets.Num());
+			AssetIndices.Add(Key, Index);
+			Assets.Add({ Type, Path });
+			return Index;
+		}
+	};
+
+	// 객체 하나의 프로퍼티 레코드: [존재 비트마스크][스키마 순서로 압축한 값]
+	// 각 타입의 존재 조건은 UObject::Serialize의 로드 분기와 같다 (에셋은 키가 없어도 nullptr로 덮어쓰므로 항상 존재)
+	void WriteRecord(FCookContext& Context, const FCookedClassSchema& Schema, const FJsonValue& ObjectJson, FArchive& Ar)
+	{
+		TArray<uint8> Mask;
+		Mask.SetNum((Schema.Properties.Num() + 7) / 8);
+		std::fill(Mask.begin(), Mask.end(), 0);
+		FCookedMemoryWriter Values;
+
+		for (int32 i = 0; i < Schema.Properties.Num(); ++i)
+		{
+			const FProperty& Prop = *Schema.Properties[i];
+			const FJsonValue* Value = ObjectJson.Find(Prop.Name);
+			bool bPresent = false;
+
+			switch (Prop.Type)
+			{
+			case EPropertyType::Bool:
+				if (Value && Value->Type == JSON::Class::Boolean)
+				{
+					uint8 Bool = Value->Bool ? 1 : 0;
+					Values << Bool;
+					bPresent = true;
+				}
+				break;
+			case EPropertyType::Int32:
+				if (Value && Value->Type == JSON::Class::Integral && Value->Int >= INT32_MIN && Value->Int <= INT32_MAX)
+				{
+					int32 Int = static_cast<int32>(Value->Int);
+					Values << Int;
+					bPresent = true;
+				}
+				break;
+			case EPropertyType::Float:
+				if (Value && Value->Type == JSON::Class::Floating)
+				{
+					float Float = static_cast<float>(Value->Float);
+					Values << Float;
+					bPresent = true;
+				}
+				break;
+			case EPropertyType::FVector:
+				if (Value && Value->IsArray() && Value->Num() == 3)
+				{
+					for (int32 c = 0; c < 3; ++c)
+					{
+						float Component = LegacyFloat((*Value)[c]);
+						Values << Component;
+					}
+					bPresent = true;
+				}
+				break;
+			case EPropertyType::FLinearColor:
+			case EPropertyType::Curve:
+				if (Value && Value->IsArray() && Value->Num() == 4)
+				{
+					for (int32 c = 0; c < 4; ++c)
+					{
+						float Component = LegacyFloat((*Value)[c]);
+						Values << Component;
+					}
+					bPresent = true;
+				}
+				break;
+			case EPropertyType::FString:
+			case EPropertyType::ScriptFile:
+			case EPropertyType::FName:
+				if (Value && Value->IsString())
+				{
+					Serialization::WriteString(Values, LegacyString(*Value));
+					bPresent = true;
+				}
+				break;
+			case EPropertyType::Texture:
+			case EPropertyType::StaticMesh:
+			case EPropertyType::SkeletalMesh:
+			case EPropertyType::Material:
+			{
+				uint32 AssetIndex = Context.FindOrAddAsset(Prop.Type, Value ? LegacyString(*Value) : FString());
+				Values << AssetIndex;
+				bPresent = true;
+				break;
+			}
+			case EPropertyType::Array:
+			{
+				if (!Value || !Value->IsArray())
+				{
+					break;
+				}
+				bPresent = true;
+
+				if (Prop.InnerType == EPropertyType::Sound)
+				{
+					// 문자열이 아닌 원소는 기존 로더도 건너뛴다
+					TArray<uint32> SoundIndices;
+					for (const FJsonValue& Item : *Value)
+					{
+						if (Item.IsString())
+						{
+							SoundIndices.Add(Context.FindOrAddAsset(EPropertyType::Sound, LegacyString(Item)));
+						}
+					}
+					Serialization::WriteArray(Values, SoundIndices);
+					break;
+				}
+
+				uint32 Count = Value->Count;
+				Values << Count;
+				for (const FJsonValue& Item : *Value)
+				{
+					switch (Prop.InnerType)
+					{
+					case EPropertyType::Int32:
+					{
+						int32 Int = Item.Type == JSON::Class::Integral ? static_cast<int32>(Item.Int) : 0;
+						Values << Int;
+						break;
+					}
+					case EPropertyType::Float:
+					{
+						float Float = LegacyFloat(Item);
+						Values << Float;
+						break;
+					}
+					case EPropertyType::Bool:
+					{
+						uint8 Bool = (Item.Type == JSON::Class::Boolean && Item.Bool) ? 1 : 0;
+						Values << Bool;
+						break;
+					}
+					case EPropertyType::FString:
+						Serialization::WriteString(Values, LegacyString(Item));
+						break;
+					default:
+						break;
+					}
+				}
+				break;
+			}
+			default:
+				break;
+			}
+
+			if (bPresent)
+			{
+				Mask[i >> 3] |= static_cast<uint8>(1u << (i & 7));
+			}
+		}
+
+		if (!Mask.IsEmpty())
+		{
+			Ar.Serialize(Mask.GetData(), Mask.Num());
+		}
+		uint32 ValueBytes = static_cast<uint32>(Values.Buffer.Num());
+		Ar << ValueBytes;
+		if (ValueBytes > 0)
+		{
+			Ar.Serialize(Values.Buffer.GetData(), ValueBytes);
+		}
+	}
+
+	// 스키마 프로퍼티와 별도로 처리하는 키(ExtraKeys)를 뺀 나머지를 트리로 기록
+	void WriteResidual(const FCookedClassSchema& Schema, const FJsonValue& ObjectJson, std::initializer_list<std::string_view> ExtraKeys, FArchive& Ar)
+	{
+		WriteObjectMembers(ObjectJson, Ar, [&](std::string_view Key)
+		{
+			if (Schema.PropertyNames.count(Key) > 0)
+			{
+				return false;
+			}
+			return std::find(ExtraKeys.begin(), ExtraKeys.end(), Key) == ExtraKeys.end();
+		});
+	}
+
+	// 오브젝트 멤버를 기존 std::map<string, JSON> 순서(이스케이프된 키의 바이트 순)로 정렬
+	TArray<const FJsonMember*> GetLegacyOrderedMembers(const FJsonValue& Object)
+	{
+		TArray<std::pair<FString, const FJsonMember*>> Sorted;
+		for (const FJsonMember* Member = Object.MemberBegin(); Member != Object.MemberEnd(); ++Member)
+		{
+			if (IsEffectiveMember(Object, *Member))
+			{
+				Sorted.Add({ LegacyKey(Member->Key), Member });
+			}
+		}
+		std::sort(Sorted.begin(), Sorted.end(), [](const auto& A, const auto& B) { return A.first < B.first; });
+
+		TArray<const FJsonMember*> Result;
+		for (const auto& Pair : Sorted)
+		{
+			Result.Add(Pair.second);
+		}
+		return Result;
+	}
+
+	FString ReadTypeName(const FJsonValue& ObjectJson)
+	{
+		const FJsonValue* Type = ObjectJson.Find("Type");
+		return Type ? LegacyString(*Type) : FString();
+	}
+
+	bool GetSourceFileInfo(const FWideString& SourcePath, int64& OutWriteTime, uint64& OutSize)
+	{
+		std::error_code Ec;
+		const fs::path Path(SourcePath);
+		const auto WriteTime = fs::last_write_time(Path, Ec);
+		if (Ec)
+		{
+			return false;
+		}
+		const uintmax_t Size = fs::file_size(Path, Ec);
+		if (Ec)
+		{
+			return false;
+		}
+		OutWriteTime = static_cast<int64>(WriteTime.time_since_epoch().count());
+		OutSize = static_cast<uint64>(Size);
+		return true;
+	}
+
+	// ------------------------------------------------------------------
+	// 로드
+	// ------------------------------------------------------------------
+
+	struct FCookedLoadContext
+	{
+		FCookedMemoryReader* Reader = nullptr;
+		TArray<FCookedClassSchema> Schemas;
+		TArray<UObject*> Assets;
+		TArray<uint8> MaskScratch;
+
+		const FCookedClassSchema& GetSchema(uint32 Index) const
+		{
+			if (Index >= static_cast<uint32>(Schemas.Num()))
+			{
+				throw std::runtime_error("Cooked level corrupt: class index out of range.");
+			}
+			return Schemas[Index];
+		}
+
+		template<typename T>
+		T* GetAsset(uint32 Index) const
+		{
+			if (Index == InvalidAssetIndex)
+			{
+				return nullptr;
+			}
+			if (Index >= static_cast<uint32>(Assets.Num()))
+			{
+				throw std::runtime_error("Cooked level corrupt: asset index out of range.");
+			}
+			return static_cast<T*>(Assets[Index]);
+		}
+	};
+
+	// 컴포넌트 레코드를 AActor::Serialize 안에서 소비하기 위한 대기 정보
+	struct FPendingActorComponents
+	{
+		AActor* Owner = nullptr;
+		FCookedLoadContext* Context = nullptr;
+		bool bConsumed = false;
+	};
+
+	const UObject* GPreloadedObject = nullptr;
+	FPendingActorComponents* GPendingActor = nullptr;
+
+	struct FPreloadedObjectScope
+	{
+		explicit FPreloadedObjectScope(const UObject* Object) : Previous(GPreloadedObject) { GPreloadedObject = Object; }
+		~FPreloadedObjectScope() { GPreloadedObject = Previous; }
+		const UObject* Previous;
+	};
+
+	template<typename T>
+	void ReadPrimitiveArray(FArchive& Ar, TArray<T>& OutArray)
+	{
+		uint32 Count = 0;
+		Ar << Count;
+		if (Count > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			throw std::runtime_error("Cooked level corrupt: array size is unreasonable.");
+		}
+		OutArray.clear();
+		OutArray.reserve(Count);
+		for (uint32 i = 0; i < Count; ++i)
+		{
+			if constexpr (std::is_same_v<T, bool>)
+			{
+				uint8 Bool = 0;
+				Ar << Bool;
+				OutArray.Add(Bool != 0);
+			}
+			else if constexpr (std::is_same_v<T, FString>)
+			{
+				FString String;
+				Serialization::ReadString(Ar, String);
+				OutArray.Add(String);
+			}
+			else
+			{
+				T Value{};
+				Ar << Value;
+				OutArray.Add(Value);
+			}
+		}
+	}
+
+	// 레코드를 객체 메모리에 바로 적용 (키 검색 없음)
+	void ApplyRecord(FCookedLoadContext& Context, const FCookedClassSchema& Schema, UObject* Object)
+	{
+		FCookedMemoryReader& Ar = *Context.Reader;
+
+		const int32 MaskBytes = (Schema.Properties.Num() + 7) / 8;
+		Context.MaskScratch.SetNum(MaskBytes);
+		if (MaskBytes > 0)
+		{
+			Ar.Serialize(Context.MaskScratch.GetData(), MaskBytes);
+		}
+		uint32 ValueBytes = 0;
+		Ar << ValueBytes;
+		const size_t ValuesEnd = Ar.Tell() + ValueBytes;
+
+		for (int32 i = 0; i < Schema.Properties.Num(); ++i)
+		{
+			if ((Context.MaskScratch[i >> 3] & (1u << (i & 7))) == 0)
+			{
+				continue;
+			}
+
+			const FProperty& Prop = *Schema.Properties[i];
+			switch (Prop.Type)
+			{
+			case EPropertyType::Bool:
+			{
+				uint8 Bool = 0;
+				Ar << Bool;
+				*Prop.GetValuePtr<bool>(Object) = Bool != 0;
+				break;
+			}
+			case EPropertyType::Int32:
+				Ar << *Prop.GetValuePtr<int32>(Object);
+				break;
+			case EPropertyType::Float:
+				Ar << *Prop.GetValuePtr<float>(Object);
+				break;
+			case EPropertyType::FVector:
+			{
+				float X, Y, Z;
+				Ar << X << Y << Z;
+				*Prop.GetValuePtr<FVector>(Object) = FVector(X, Y, Z);
+				break;
+			}
+			case EPropertyType::FLinearColor:
+			{
+				float X, Y, Z, W;
+				Ar << X << Y << Z << W;
+				*Prop.GetValuePtr<FLinearColor>(Object) = FLinearColor(FVector4(X, Y, Z, W));
+				break;
+			}
+			case EPropertyType::Curve:
+				Ar.Serialize(Prop.GetValuePtr<float>(Object), sizeof(float) * 4);
+				break;
+			case EPropertyType::FString:
+			case EPropertyType::ScriptFile:
+				Serialization::ReadString(Ar, *Prop.GetValuePtr<FString>(Object));
+				break;
+			case EPropertyType::FName:
+			{
+				FString Name;
+				Serialization::ReadString(Ar, Name);
+				*Prop.GetValuePtr<FName>(Object) = FName(Name);
+				break;
+			}
+			case EPropertyType::Texture:
+			{
+				uint32 Index = 0;
+				Ar << Index;
+				*Prop.GetValuePtr<UTexture*>(Object) = Context.GetAsset<UTexture>(Index);
+				break;
+			}
+			case EPropertyType::StaticMesh:
+			{
+				uint32 Index = 0;
+				Ar << Index;
+				*Prop.GetValuePtr<UStaticMesh*>(Object) = Context.GetAsset<UStaticMesh>(Index);
+				break;
+			}
+			case EPropertyType::SkeletalMesh:
+			{
+				uint32 Index = 0;
+				Ar << Index;
+				*Prop.GetValuePtr<USkeletalMesh*>(Object) = Context.GetAsset<USkeletalMesh>(Index);
+				break;
+			}
+			case EPropertyType::Material:
+			{
+				uint32 Index = 0;
+				Ar << Index;
+				*Prop.GetValuePtr<UMaterial*>(Object) = Context.GetAsset<UMaterial>(Index);
+				break;
+			}
+			case EPropertyType::Array:
+				switch (Prop.InnerType)
+				{
+				case EPropertyType::Int32:
+					ReadPrimitiveArray(Ar, *Prop.GetValuePtr<TArray<int32>>(Object));
+					break;
+				case EPropertyType::Float:
+					ReadPrimitiveArray(Ar, *Prop.GetValuePtr<TArray<float>>(Object));
+					break;
+				case EPropertyType::Bool:
+					ReadPrimitiveArray(Ar, *Prop.GetValuePtr<TArray<bool>>(Object));
+					break;
+				case EPropertyType::FString:
+					ReadPrimitiveArray(Ar, *Prop.GetValuePtr<TArray<FString>>(Object));
+					break;
+				case EPropertyType::Sound:
+				{
+					TArray<uint32> SoundIndices;
+					Serialization::ReadArray(Ar, SoundIndices);
+					TArray<USound*>& Sounds = *Prop.GetValuePtr<TArray<USound*>>(Object);
+					Sounds.Empty();
+					for (uint32 Index : SoundIndices)
+					{
+						Sounds.Add(Context.GetAsset<USound>(Index));
+					}
+					break;
+				}
+				default:
+					break;
+				}
+				break;
+			default:
+				break;
+			}
+		}
+
+		if (Ar.Tell() != ValuesEnd)
+		{
+			throw std::runtime_error("Cooked level corrupt: property record size mismatch.");
+		}
+	}
+
+	UObject* ResolveAsset(EPropertyType Type, const FString& Path)
+	{
+		UResourceManager& ResourceManager = UResourceManager::GetInstance();
+		switch (Type)
+		{
+		case EPropertyType::Texture: return ResourceManager.Load<UTexture>(Path);
+		case EPropertyType::StaticMesh: return ResourceManager.Load<UStaticMesh>(Path);
+		case EPropertyType::SkeletalMesh: return ResourceManager.Load<USkeletalMesh>(Path);
+		case EPropertyType::Material: return ResourceManager.Load<UMaterial>(Path);
+		case EPropertyType::Sound: return ResourceManager.Load<USound>(Path);
+		default: return nullptr;
+		}
+	}
+
+	// UUID는 로드할 때마다 새로 발급되므로 컴포넌트 순서 기준 번호로 바꿔 비교한다
+	FString DumpActorNormalized(AActor* Actor)
+	{
+		JSON ActorJson = json::Object();
+		ActorJson["Type"] = Actor->GetClass()->Name;
+		Actor->Serialize(false, ActorJson);
+
+		TMap<long, long> IdRemap;
+		auto Remap = [&IdRemap](JSON& Value)
+		{
+			if (Value.JSONType() == JSON::Class::Integral)
+			{
+				const long* Found = IdRemap.Find(Value.ToInt());
+				Value = Found ? *Found : 0L;
+			}
+		};
+
+		if (ActorJson.hasKey("OwnedComponents"))
+		{
+			for (JSON& Component : ActorJson["OwnedComponents"].ArrayRange())
+			{
+				if (Component.hasKey("Id"))
+				{
+					IdRemap.Add(Component["Id"].ToInt(), static_cast<long>(IdRemap.size()) + 1);
+				}
+			}
+			for (JSON& Component : ActorJson["OwnedComponents"].ArrayRange())
+			{
+				if (Component.hasKey("Id")) Remap(Component["Id"]);
+				if (Component.hasKey("ParentId")) Remap(Component["ParentId"]);
+			}
+		}
+		if (ActorJson.hasKey("RootComponentId"))
+		{
+			Remap(ActorJson["RootComponentId"]);
+		}
+		return ActorJson.dump();
+	}
+}
+
+// ============================================================================
+// FCookedLevel
+// ============================================================================
+
+FString FCookedLevel::GetCookedPath(const FWideString& SourcePath)
+{
+	const fs::path Source = fs::path(SourcePath).lexically_normal();
+	const FString Generic = WideToUTF8(Source.generic_wstring());
+	const uint32 PathHash = static_cast<uint32>(HashBytes(14695981039346656037ull, Generic.data(), Generic.size()));
+
+	char HashText[16];
+	snprintf(HashText, sizeof(HashText), "%08x", PathHash);
+	return GCacheDir + "/CookedLevels/" + WideToUTF8(Source.stem().wstring()) + "_" + HashText + ".clevel";
+}
+
+bool FCookedLevel::Cook(const FWideString& SourcePath, const FJsonDocument& Document)
+{
+	const FJsonValue& Root = Document.GetRoot();
+	if (!Root.IsObject())
+	{
+		return false;
+	}
+
+	int64 SourceWriteTime = 0;
+	uint64 SourceSize = 0;
+	if (!GetSourceFileInfo(SourcePath, SourceWriteTime, SourceSize))
+	{
+		return false;
+	}
+
+	FCookContext Context;
+	FCookedMemoryWriter Body;
+
+	// 1. 레벨 자체의 나머지 키 (카메라 등). 액터 목록은 아래에서 레코드로 기록
+	WriteObjectMembers(Root, Body, [](std::string_view Key) { return Key != "Actors"; });
+
+	// 2. 액터: ULevel::Serialize와 같은 순서(키 정렬)로 기록
+	TArray<const FJsonMember*> ActorMembers;
+	if (const FJsonValue* Actors = Root.Find("Actors"))
+	{
+		if (Actors->IsObject())
+		{
+			ActorMembers = GetLegacyOrderedMembers(*Actors);
+		}
+	}
+
+	uint32 NumActors = static_cast<uint32>(ActorMembers.Num());
+	Body << NumActors;
+	for (const FJsonMember* ActorMember : ActorMembers)
+	{
+		const FJsonValue& ActorJson = ActorMember->Value;
+		uint32 ClassIndex = 0;
+		const FCookedClassSchema* ActorSchema = Context.FindOrAddClass(ReadTypeName(ActorJson), AActor::StaticClass(), ClassIndex);
+		if (!ActorSchema)
+		{
+			return false;
+		}
+
+		Body << ClassIndex;
+		WriteRecord(Context, *ActorSchema, ActorJson, Body);
+		WriteResidual(*ActorSchema, ActorJson, { "Type", "OwnedComponents" }, Body);
+
+		// 컴포넌트 블록은 크기를 앞에 둬서 AActor::Serialize가 소비하지 않았을 때 건너뛸 수 있게 한다
+		FCookedMemoryWriter Components;
+		TArray<const FJsonValue*> ComponentJsons;
+		if (const FJsonValue* Owned = ActorJson.Find("OwnedComponents"))
+		{
+			for (const FJsonValue& ComponentJson : *Owned)
+			{
+				ComponentJsons.Add(&ComponentJson);
+			}
+		}
+		uint32 NumComponents = static_cast<uint32>(ComponentJsons.Num());
+		Components << NumComponents;
+		for (const FJsonValue* ComponentJson : ComponentJsons)
+		{
+			uint32 ComponentClassIndex = 0;
+			const FCookedClassSchema* ComponentSchema = Context.FindOrAddClass(ReadTypeName(*ComponentJson), UActorComponent::StaticClass(), ComponentClassIndex);
+			if (!ComponentSchema)
+			{
+				return false;
+			}
+			Components << ComponentClassIndex;
+			WriteRecord(Context, *ComponentSchema, *ComponentJson, Components);
+			WriteResidual(*ComponentSchema, *ComponentJson, { "Type" }, Components);
+		}
+
+		uint32 ComponentBytes = static_cast<uint32>(Components.Buffer.Num());
+		Body << ComponentBytes;
+		Body.Serialize(Components.Buffer.GetData(), ComponentBytes);
+	}
+
+	// 3. 헤더 + 스키마 + 에셋 테이블 + 본문
+	FCookedMemoryWriter Writer;
+	uint32 Magic = CookedLevelMagic;
+	uint32 Version = CookedLevelVersion;
+	Writer << Magic << Version << SourceWriteTime << SourceSize;
+
+	uint32 NumClasses = static_cast<uint32>(Context.Schemas.Num());
+	Writer << NumClasses;
+	for (const FCookedClassSchema& Schema : Context.Schemas)
+	{
+		Serialization::WriteString(Writer, Schema.Class->Name);
+		uint64 SchemaHash = Schema.Hash;
+		uint32 NumProperties = static_cast<uint32>(Schema.Properties.Num());
+		Writer << SchemaHash << NumProperties;
+		for (const FProperty* Prop : Schema.Properties)
+		{
+			Serialization::WriteString(Writer, Prop->Name);
+			uint8 Type = static_cast<uint8>(Prop->Type);
+			uint8 InnerType = static_cast<uint8>(Prop->InnerType);
+			uint32 Offset = static_cast<uint32>(Prop->Offset);
+			Writer << Type << InnerType << Offset;
+		}
+	}
+
+	uint32 NumAssets = static_cast<uint32>(Context.Assets.Num());
+	Writer << NumAssets;
+	for (const auto& Asset : Context.Assets)
+	{
+		uint8 Type = static_cast<uint8>(Asset.first);
+		Writer << Type;
+		Serialization::WriteString(Writer, Asset.second);
+	}
+
+	Writer.Serialize(Body.Buffer.GetData(), Body.Buffer.Num());
+	Writer << Magic;
+
+	const FString CookedPath = GetCookedPath(SourcePath);
+	std::error_code Ec;
+	fs::create_directories(fs::path(UTF8ToWide(CookedPath)).parent_path(), Ec);
+	std::ofstream File(fs::path(UTF8ToWide(CookedPath)), std::ios::binary | std::ios::trunc);
+	if (!File.is_open())
+	{
+		return false;
+	}
+	File.write(reinterpret_cast<const char*>(Writer.Buffer.GetData()), Writer.Buffer.Num());
+	return File.good();
+}
+
+bool FCookedLevel::Load(const FWideString& SourcePath, ULevel* OutLevel)
+{
+	if (!bEnabled || !OutLevel)
+	{
+		return false;
+	}
+
+	int64 SourceWriteTime = 0;
+	uint64 SourceSize = 0;
+	if (!GetSourceFileInfo(SourcePath, SourceWriteTime, SourceSize))
+	{
+		return false;
+	}
+
+	TArray<uint8> Bytes;
+	{
+		std::ifstream File(fs::path(UTF8ToWide(GetCookedPath(SourcePath))), std::ios::binary | std::ios::ate);
+		if (!File.is_open())
+		{
+			return false;
+		}
+		const std::streamoff FileSize = File.tellg();
+		if (FileSize <= 0)
+		{
+			return false;
+		}
+		Bytes.SetNum(static_cast<int32>(FileSize));
+		File.seekg(0, std::ios::beg);
+		File.read(reinterpret_cast<char*>(Bytes.GetData()), FileSize);
+	}
+
+	FCookedMemoryReader Reader(Bytes.GetData(), Bytes.Num());
+	FCookedLoadContext Context;
+	Context.Reader = &Reader;
+
+	try
+	{
+		// 1. 헤더: 포맷 버전과 원본 파일이 같은지
+		uint32 Magic = 0, Version = 0;
+		int64 CookedWriteTime = 0;
+		uint64 CookedSize = 0;
+		Reader << Magic << Version << CookedWriteTime << CookedSize;
+		if (Magic != CookedLevelMagic || Version != CookedLevelVersion
+			|| CookedWriteTime != SourceWriteTime || CookedSize != SourceSize)
+		{
+			return false;
+		}
+
+		// 2. 스키마: 현재 빌드의 클래스 레이아웃과 해시가 같아야 레코드를 그대로 쓸 수 있다
+		uint32 NumClasses = 0;
+		Reader << NumClasses;
+		if (NumClasses > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			throw std::runtime_error("Cooked level corrupt: class count is unreasonable.");
+		}
+		for (uint32 i = 0; i < NumClasses; ++i)
+		{
+			FString ClassName;
+			uint64 SchemaHash = 0;
+			uint32 NumProperties = 0;
+			Serialization::ReadString(Reader, ClassName);
+			Reader << SchemaHash << NumProperties;
+			for (uint32 p = 0; p < NumProperties; ++p)
+			{
+				FString PropName;
+				uint8 Type = 0, InnerType = 0;
+				uint32 Offset = 0;
+				Serialization::ReadString(Reader, PropName);
+				Reader << Type << InnerType << Offset;
+			}
+
+			UClass* Class = UClass::FindClass(ClassName);
+			if (!Class)
+			{
+				return false;
+			}
+			Context.Schemas.Add(BuildSchema(Class));
+			if (Context.Schemas.Last().Hash != SchemaHash)
+			{
+				UE_LOG("[CookedLevel] Schema of '%s' changed, falling back to JSON", ClassName.c_str());
+				return false;
+			}
+		}
+
+		// 3. 에셋 테이블을 한 번에 해석
+		uint32 NumAssets = 0;
+		Reader << NumAssets;
+		if (NumAssets > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			throw std::runtime_error("Cooked level corrupt: asset count is unreasonable.");
+		}
+		Context.Assets.Reserve(NumAssets);
+		for (uint32 i = 0; i < NumAssets; ++i)
+		{
+			uint8 Type = 0;
+			FString Path;
+			Reader << Type;
+			Serialization::ReadString(Reader, Path);
+			Context.Assets.Add(ResolveAsset(static_cast<EPropertyType>(Type), Path));
+		}
+
+		// 4. 레벨 나머지 키 (액터 목록은 비워 두고 아래에서 직접 생성)
+		JSON LevelJson = ReadTree(Reader);
+		LevelJson["Actors"] = json::Object();
+		OutLevel->Serialize(true, LevelJson);
+
+		// 5. 액터
+		uint32 NumActors = 0;
+		Reader << NumActors;
+		if (NumActors > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			throw std::runtime_error("Cooked level corrupt: actor count is unreasonable.");
+		}
+		for (uint32 i = 0; i < NumActors; ++i)
+		{
+			uint32 ClassIndex = 0;
+			Reader << ClassIndex;
+			const FCookedClassSchema& Schema = Context.GetSchema(ClassIndex);
+
+			AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(Schema.Class));
+			if (!NewActor)
+			{
+				throw std::runtime_error("Cooked level corrupt: actor class cannot be instantiated.");
+			}
+			OutLevel->AddActor(NewActor);
+
+			ApplyRecord(Context, Schema, NewActor);
+			JSON ActorJson = ReadTree(Reader);
+
+			uint32 ComponentBytes = 0;
+			Reader << ComponentBytes;
+			const size_t ComponentsEnd = Reader.Tell() + ComponentBytes;
+
+			FPendingActorComponents Pending;
+			Pending.Owner = NewActor;
+			Pending.Context = &Context;
+			GPendingActor = &Pending;
+			{
+				FPreloadedObjectScope Scope(NewActor);
+				NewActor->Serialize(true, ActorJson);
+			}
+			GPendingActor = nullptr;
+
+			// AActor::Serialize까지 내려가지 않은 클래스면 컴포넌트 블록을 건너뛴다
+			Reader.Seek(ComponentsEnd);
+		}
+
+		uint32 EndMagic = 0;
+		Reader << EndMagic;
+		if (EndMagic != CookedLevelMagic)
+		{
+			throw std::runtime_error("Cooked level corrupt: missing end marker.");
+		}
+	}
+	catch (const std::exception& e)
+	{
+		GPendingActor = nullptr;
+		UE_LOG("[CookedLevel] Load failed (%s), falling back to JSON", e.what());
+		DestroyLevelActors(OutLevel);
+		return false;
+	}
+
+	return true;
+}
+
+void FCookedLevel::DestroyLevelActors(ULevel* Level)
+{
+	if (!Level)
+	{
+		return;
+	}
+	for (AActor* Actor : Level->GetActors())
+	{
+		ObjectFactory::DeleteObject(Actor);
+	}
+	Level->Clear();
+}
+
+bool FCookedLevel::HasPreloadedProperties(const UObject* Object)
+{
+	return Object && Object == GPreloadedObject;
+}
+
+bool FCookedLevel::CreatePendingComponents(AActor* Owner, TArray<UActorComponent*>& OutComponents)
+{
+	if (!GPendingActor || GPendingActor->Owner != Owner || GPendingActor->bConsumed)
+	{
+		return false;
+	}
+	GPendingActor->bConsumed = true;
+
+	FCookedLoadContext& Context = *GPendingActor->Context;
+	FCookedMemoryReader& Reader = *Context.Reader;
+
+	uint32 NumComponents = 0;
+	Reader << NumComponents;
+	if (NumComponents > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+	{
+		throw std::runtime_error("Cooked level corrupt: component count is unreasonable.");
+	}
+
+	for (uint32 i = 0; i < NumComponents; ++i)
+	{
+		uint32 ClassIndex = 0;
+		Reader << ClassIndex;
+		const FCookedClassSchema& Schema = Context.GetSchema(ClassIndex);
+
+		UActorComponent* NewComponent = Cast<UActorComponent>(ObjectFactory::NewObject(Schema.Class));
+		if (!NewComponent)
+		{
+			throw std::runtime_error("Cooked level corrupt: component class cannot be instantiated.");
+		}
+
+		ApplyRecord(Context, Schema, NewComponent);
+		JSON ComponentJson = ReadTree(Reader);
+		{
+			FPreloadedObjectScope Scope(NewComponent);
+			NewComponent->Serialize(true, ComponentJson);
+		}
+		OutComponents.Add(NewComponent);
+	}
+	return true;
+}
+
+// ============================================================================
+// 라운드트립 검증
+// ============================================================================
+
+FCookedLevelVerifyResult VerifyCookedLevel(const FWideString& SourcePath)
+{
+	FCookedLevelVerifyResult Result;
+
+	FJsonDocument Document;
+	if (!FJsonSerializer::LoadJsonDocumentFromFile(Document, SourcePath))
+	{
+		return Result;
+	}
+
+	std::error_code Ec;
+	Result.JsonBytes = static_cast<size_t>(fs::file_size(fs::path(SourcePath), Ec));
+
+	uint64 Start = FPlatformTime::Cycles64();
+	Result.bCooked = FCookedLevel::Cook(SourcePath, Document);
+	Result.CookMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	if (!Result.bCooked)
+	{
+		return Result;
+	}
+	Result.CookedBytes = static_cast<size_t>(fs::file_size(fs::path(UTF8ToWide(FCookedLevel::GetCookedPath(SourcePath))), Ec));
+
+	auto LoadJsonLevel = [&SourcePath](ULevel* Level)
+	{
+		FJsonDocument LevelDocument;
+		if (FJsonSerializer::LoadJsonDocumentFromFile(LevelDocument, SourcePath))
+		{
+			JSON LevelJson = LevelDocument.ToJSON();
+			Level->Serialize(true, LevelJson);
+		}
+	};
+
+	// 에셋 로드 비용이 한쪽에만 잡히지 않도록 한 번 읽고 버린다
+	{
+		std::unique_ptr<ULevel> WarmUp = ULevelService::CreateDefaultLevel();
+		LoadJsonLevel(WarmUp.get());
+		FCookedLevel::DestroyLevelActors(WarmUp.get());
+	}
+
+	std::unique_ptr<ULevel> JsonLevel = ULevelService::CreateDefaultLevel();
+	Start = FPlatformTime::Cycles64();
+	LoadJsonLevel(JsonLevel.get());
+	Result.JsonLoadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	std::unique_ptr<ULevel> CookedLevel = ULevelService::CreateDefaultLevel();
+	Start = FPlatformTime::Cycles64();
+	Result.bLoaded = FCookedLevel::Load(SourcePath, CookedLevel.get());
+	Result.CookedLoadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	const TArray<AActor*>& JsonActors = JsonLevel->GetActors();
+	const TArray<AActor*>& CookedActors = CookedLevel->GetActors();
+	Result.NumActors = JsonActors.Num();
+	if (!Result.bLoaded || JsonActors.Num() != CookedActors.Num())
+	{
+		Result.NumMismatchedActors = -1;
+	}
+	else
+	{
+		for (int32 i = 0; i < JsonActors.Num(); ++i)
+		{
+			if (DumpActorNormalized(JsonActors[i]) != DumpActorNormalized(CookedActors[i]))
+			{
+				UE_LOG("[CookedLevel] Actor %d (%s) differs between JSON and cooked load", i, JsonActors[i]->GetClass()->Name);
+				++Result.NumMismatchedActors;
+			}
+
+			// 원근 데칼은 FovY로 투영이 결정되므로 값 자체도 비교한다
+			for (UActorComponent* Component : JsonActors[i]->GetOwnedComponents())
+			{
+				UPerspectiveDecalComponent* JsonDecal = Cast<UPerspectiveDecalComponent>(Component);
+				if (!JsonDecal)
+				{
+					continue;
+				}
+				++Result.NumPerspectiveDecals;
+
+				UPerspectiveDecalComponent* CookedDecal = nullptr;
+				for (UActorComponent* CookedComponent : CookedActors[i]->GetOwnedComponents())
+				{
+					if ((CookedDecal = Cast<UPerspectiveDecalComponent>(CookedComponent)))
+					{
+						break;
+					}
+				}
+				if (!CookedDecal || CookedDecal->GetFovY() != JsonDecal->GetFovY())
+				{
+					UE_LOG("[CookedLevel] Actor %d: perspective decal FovY %.3f (JSON) vs %.3f (cooked)", i,
+						JsonDecal->GetFovY(), CookedDecal ? CookedDecal->GetFovY() : 0.0f);
+					++Result.NumFovYMismatches;
+				}
+			}
+		}
+	}
+
+	FCookedLevel::DestroyLevelActors(JsonLevel.get());
+	FCookedLevel::DestroyLevelActors(CookedLevel.get());
+	return Result;
+}
+
+FCookedLevelVerifyResult VerifyCookedPerspectiveDecal()
+{
+	// 원근 데칼이 들어간 씬이 없어도 검증되도록 임시 .scene을 만든다
+	const FWideString ScenePath = UTF8ToWide(GCacheDir) + L"/CookedLevels/PerspectiveDecalCheck.scene";
+	std::error_code Ec;
+	fs::create_directories(fs::path(ScenePath).parent_path(), Ec);
+
+	{
+		std::unique_ptr<ULevel> Level = ULevelService::CreateDefaultLevel();
+		AFakeSpotLightActor* SpotLight = NewObject<AFakeSpotLightActor>();
+		for (UActorComponent* Component : SpotLight->GetOwnedComponents())
+		{
+			if (UPerspectiveDecalComponent* Decal = Cast<UPerspectiveDecalComponent>(Component))
+			{
+				Decal->SetFovY(37.5f);
+			}
+		}
+		Level->AddActor(SpotLight);
+
+		JSON LevelJson = json::Object();
+		Level->Serialize(false, LevelJson);
+		FCookedLevel::DestroyLevelActors(Level.get());
+		if (!FJsonSerializer::SaveJsonToFile(LevelJson, ScenePath))
+		{
+			return FCookedLevelVerifyResult();
+		}
+	}
+
+	FCookedLevelVerifyResult Result = VerifyCookedLevel(ScenePath);
+	fs::remove(fs::path(ScenePath), Ec);
+	fs::remove(fs::path(UTF8ToWide(FCookedLevel::GetCookedPath(ScenePath))), Ec);
+	return Result;
+}
@@ -0,0 +1,63 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class AActor;
+class UActorComponent;
+class UObject;
+class ULevel;
+class FJsonDocument;
+
+/**
+ * @brief 쿠킹된 바이너리 레벨 (.clevel)
+ * - 원본은 여전히 JSON(.scene)이고, 이 파일은 GCacheDir/CookedLevels 아래의 캐시다.
+ *   원본 크기/수정 시각, 포맷 버전, 클래스 스키마 해시 중 하나라도 다르면 무효로 보고 JSON 경로로 돌아간다.
+ * - 클래스마다 UClass::GetAllProperties()에서 직렬화 대상 프로퍼티(이름/타입/오프셋)만 뽑아 스키마를 만들고,
+ *   객체마다 "존재 비트마스크 + 스키마 순서로 압축한 값" 레코드를 저장한다. 로드 시 키 검색 없이 오프셋에 바로 쓴다.
+ * - 에셋 참조는 파일 앞쪽의 에셋 테이블에 모아 두고 로드 시작 시 한 번에 해석한다. 레코드는 테이블 인덱스만 가진다.
+ * - 파생 클래스 Serialize가 직접 읽는 나머지 키(Id/ParentId, MaterialSlots 등)는 바이너리 JSON 트리로 남겨
+ *   기존 Serialize(true, ...)에 그대로 넘긴다. 이때 UObject::Serialize는 리플렉션 루프를 건너뛴다.
+ */
+class FCookedLevel
+{
+public:
+	// 원본 .scene 경로에 대응하는 쿠킹 파일 경로
+	static FString GetCookedPath(const FWideString& SourcePath);
+
+	// 파싱된 원본 JSON으로 쿠킹 파일을 쓴다. 알 수 없는 클래스가 있으면 false
+	static bool Cook(const FWideString& SourcePath, const FJsonDocument& Document);
+
+	// 최신 쿠킹 파일이 있으면 OutLevel을 채우고 true. 없거나 오래됐거나 손상됐으면 false (OutLevel은 비어 있음)
+	static bool Load(const FWideString& SourcePath, ULevel* OutLevel);
+
+	// 레벨의 액터를 모두 파괴하고 비운다 (실패한 로드/검증용 레벨 정리)
+	static void DestroyLevelActors(ULevel* Level);
+
+	// --- Serialize 훅 ---
+	// 쿠킹 레코드로 리플렉션 프로퍼티를 이미 채운 객체인지 (UObject::Serialize가 JSON 조회를 건너뜀)
+	static bool HasPreloadedProperties(const UObject* Object);
+	// AActor::Serialize에서 호출. Owner가 쿠킹 로드 중인 액터면 레코드로 컴포넌트를 만들어 반환
+	static bool CreatePendingComponents(AActor* Owner, TArray<UActorComponent*>& OutComponents);
+
+	static bool bEnabled;	// false면 항상 JSON 경로
+};
+
+// JSON 경로와 쿠킹 경로로 같은 레벨을 각각 읽어 결과 월드를 비교한다
+struct FCookedLevelVerifyResult
+{
+	bool bCooked = false;			// 쿠킹 성공 여부
+	bool bLoaded = false;			// 쿠킹 파일 로드 성공 여부
+	int32 NumActors = 0;
+	int32 NumMismatchedActors = 0;	// 직렬화 결과(UUID 정규화 후)가 다른 액터 수 (액터 수가 다르면 -1)
+	size_t JsonBytes = 0;
+	size_t CookedBytes = 0;
+	double CookMs = 0.0;
+	double JsonLoadMs = 0.0;		// 파일 읽기 + JSON 파싱 + Serialize
+	double CookedLoadMs = 0.0;		// 파일 읽기 + 레코드 적용 + Serialize(나머지 키)
+	int32 NumPerspectiveDecals = 0;
+	int32 NumFovYMismatches = 0;	// JSON 로드와 쿠킹 로드의 FovY가 다른 원근 데칼 수
+};
+
+FCookedLevelVerifyResult VerifyCookedLevel(const FWideString& SourcePath);
+
+// FovY를 기본값과 다르게 둔 원근 데칼 액터 하나로 임시 레벨을 만들어 VerifyCookedLevel을 돌린다
+FCookedLevelVerifyResult VerifyCookedPerspectiveDecal();
@@ -7,6 +7,9 @@
 #include <ObjManager.h>
 
 #include "MiniDump.h"
+#include "CpuProfiler.h"
+#include "AssetRegistry.h"
+#include "DebugDrawManager.h"
 
 
 float UEditorEngine::ClientWidth = 1024.0f;
@@ -194,6 +197,11 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     UI.Initialize(HWnd, RHIDevice.GetDevice(), RHIDevice.GetDeviceContext());
     INPUT.Initialize(HWnd);
 
+    // Data 폴더 인덱스 (캐시 로드 또는 전체 스캔) - 이후 Preload들이 공유
+    FAssetRegistry::Get().Initialize();
+    // 에디터는 컨텐츠 브라우저용으로 백그라운드 폴링을 켠다
+    FAssetRegistry::Get().StartWatching();
+
     FObjManager::Preload();
     UFbxLoader::PreLoad();
     FAudioDevice::Preload();
@@ -217,6 +225,9 @@ void UEditorEngine::Tick(float DeltaSeconds)
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
+    // 지난 프레임의 1프레임짜리/만료된 디버그 도형 정리 (이번 Tick에서 제출된 것만 그려지도록)
+    FDebugDrawManager::GetInstance().BeginFrame();
+
     //@TODO: Delta Time 계산 + EditorActor Tick은 어떻게 할 것인가
     for (auto& WorldContext : WorldContexts)
     {
@@ -232,6 +243,9 @@ void UEditorEngine::Tick(float DeltaSeconds)
         //}
     }
 
+    // 워커가 게시한 에셋 레지스트리 스냅샷 채택 (컨텐츠 브라우저는 이 메모리만 읽음)
+    FAssetRegistry::Get().Tick();
+
     SLATE.Update(DeltaSeconds);
     UI.Update(DeltaSeconds);
     INPUT.Update();
@@ -318,9 +332,16 @@ void UEditorEngine::MainLoop()
             bChangedPieToEditor = false;
         }
 
+        // 입력 녹화/재생 (INPUT RECORD/REPLAY 콘솔 명령). 재생 중이면 녹화된 DeltaSeconds로 진행
+        DeltaSeconds = INPUT.BeginFrame(DeltaSeconds);
+
         Tick(DeltaSeconds);
         Render();
 
+        // 프레임 단위 CPU 프로파일 집계 (StatsOverlay는 지난 프레임 값을 표시)
+        FCpuProfiler::EndFrame();
+        FMemoryManager::EndFrame();
+
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
@@ -351,6 +372,9 @@ void UEditorEngine::Shutdown()
     // before the global GEngine variable's destructor runs
     FObjManager::Clear();
 
+    // 에셋 레지스트리 캐시 저장 (변경이 있었을 때만)
+    FAssetRegistry::Get().Shutdown();
+
     // AudioDevice 종료
     FAudioDevice::Shutdown();
 
@@ -3,6 +3,7 @@
 #include "Object.h"
 #include "FAudioDevice.h"
 #include "../Audio/Sound.h" 
+#include "AssetRegistry.h"
 
 // Static 멤버 변수 정의
 IXAudio2* FAudioDevice::pXAudio2 = nullptr;
@@ -366,30 +367,14 @@ void FAudioDevice::Preload()
     }
 
     size_t LoadedCount = 0;
-    std::unordered_set<FString> ProcessedFiles; //중복 로딩 방지
 
-    for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
+    // 에셋 레지스트리 인덱스에서 Audio 폴더 이하의 .wav만 조회
+    TArray<const FAssetFileEntry*> WavFiles;
+    FAssetRegistry::Get().FindFiles(WavFiles, { ".wav" }, GDataDir + "/Audio");
+    for (const FAssetFileEntry* Entry : WavFiles)
     {
-        if (!Entry.is_regular_file())
-            continue;
-
-        const fs::path& Path = Entry.path();
-        FString Extension = Path.extension().string();
-        std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-
-        if (Extension == ".wav")
-        {
-            FString PathStr = NormalizePath(Path.string());
-
-            // 이미 처리된 파일인지 확인
-            if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
-            {
-                ProcessedFiles.insert(PathStr);
-                // Load wav file 
-                ++LoadedCount;
-                UResourceManager::GetInstance().Load<USound>(Path.string());
-            }
-        }
+        ++LoadedCount;
+        UResourceManager::GetInstance().Load<USound>(Entry->Path);
     }
     RESOURCE.SetAudioFiles();
 
@@ -6,6 +6,10 @@
 #include "PlayerCameraManager.h"
 #include <ObjManager.h>
 #include "FAudioDevice.h"
+#include "CpuProfiler.h"
+#include "AssetRegistry.h"
+#include "DebugDrawManager.h"
+#include "PlatformTime.h"
 #include <sol/sol.hpp>
 
 float UGameEngine::ClientWidth = 1024.0f;
@@ -43,6 +47,56 @@ static void SaveIniFile()
         outfile << pair.first << " = " << pair.second << std::endl;
 }
 
+// -Key=Value 또는 -Key="Value with spaces" 형태의 값 추출 (없으면 빈 문자열)
+static FString GetCommandLineValue(const FString& CommandLine, const char* Key)
+{
+    const size_t KeyPos = CommandLine.find(Key);
+    if (KeyPos == FString::npos)
+    {
+        return FString();
+    }
+
+    size_t Begin = KeyPos + strlen(Key);
+    size_t End;
+    if (Begin < CommandLine.size() && CommandLine[Begin] == '"')
+    {
+        ++Begin;
+        End = CommandLine.find('"', Begin);
+    }
+    else
+    {
+        End = CommandLine.find_first_of(" \t", Begin);
+    }
+    return CommandLine.substr(Begin, End == FString::npos ? FString::npos : End - Begin);
+}
+
+// 헤드리스 실행 옵션: -nullrhi [-frames=N] [-rhistats=<path>]
+static void ParseHeadlessOptions(bool& bOutHeadless, int32& OutFrameLimit, FString& OutStatsPath)
+{
+    const FString CommandLine = GetCommandLineA();
+    bOutHeadless = CommandLine.find("-nullrhi") != FString::npos;
+
+    const size_t FramesPos = CommandLine.find("-frames=");
+    if (FramesPos != FString::npos)
+    {
+        OutFrameLimit = std::max(0, std::atoi(CommandLine.c_str() + FramesPos + strlen("-frames=")));
+    }
+
+    OutStatsPath = GetCommandLineValue(CommandLine, "-rhistats=");
+    if (OutStatsPath.empty())
+    {
+        OutStatsPath = GDataDir + "/Profiling/NullRHIStats.log";
+    }
+}
+
+// 입력 녹화/재생 옵션: -recordinput=<path> | -replayinput=<path>
+static void ParseInputCaptureOptions(FString& OutRecordPath, FString& OutReplayPath)
+{
+    const FString CommandLine = GetCommandLineA();
+    OutRecordPath = GetCommandLineValue(CommandLine, "-recordinput=");
+    OutReplayPath = GetCommandLineValue(CommandLine, "-replayinput=");
+}
+
 UGameEngine::UGameEngine()
 {
 
@@ -172,16 +226,34 @@ bool UGameEngine::CreateMainWindow(HINSTANCE hInstance)
 bool UGameEngine::Startup(HINSTANCE hInstance)
 {
     LoadIniFile();
+    ParseHeadlessOptions(bHeadless, HeadlessFrameLimit, HeadlessStatsPath);
+    ParseInputCaptureOptions(InputRecordPath, InputReplayPath);
 
-    if (!CreateMainWindow(hInstance))
-        return false;
+    if (bHeadless)
+    {
+        // 창/GPU 없이 Null RHI로 실행 (CI 성능 측정, 서버 시뮬레이션). 클라이언트 크기는 기본값 사용
+        extern float CLIENTWIDTH;
+        extern float CLIENTHEIGHT;
+        CLIENTWIDTH = ClientWidth;
+        CLIENTHEIGHT = ClientHeight;
 
-    // 디바이스 리소스 및 렌더러 생성
-    RHIDevice.Initialize(HWnd);
+        RHIDevice.InitializeNull(static_cast<UINT>(ClientWidth), static_cast<UINT>(ClientHeight));
+    }
+    else
+    {
+        if (!CreateMainWindow(hInstance))
+            return false;
+
+        // 디바이스 리소스 및 렌더러 생성
+        RHIDevice.Initialize(HWnd);
+    }
     Renderer = std::make_unique<URenderer>(&RHIDevice);
 
-    // Initialize audio device for game runtime
-    FAudioDevice::Initialize();
+    // Initialize audio device for game runtime (헤드리스에서는 오디오 장치 없이 실행)
+    if (!bHeadless)
+    {
+        FAudioDevice::Initialize();
+    }
 
     // 뷰포트 생성
     GameViewport = std::make_unique<FViewport>();
@@ -194,10 +266,16 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     // 매니저 초기화
     INPUT.Initialize(HWnd);
 
+    // Data 폴더 인덱스 (캐시 로드 또는 전체 스캔) - 이후 Preload들이 공유
+    FAssetRegistry::Get().Initialize();
+
     FObjManager::Preload();
 
     // Preload audio assets
-    FAudioDevice::Preload();
+    if (!bHeadless)
+    {
+        FAudioDevice::Preload();
+    }
 
     ///////////////////////////////////
     WorldContexts.Add(FWorldContext(NewObject<UWorld>(), EWorldType::Game));
@@ -221,6 +299,19 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
         Actor->BeginPlay();
     }
 
+    // 입력 녹화/재생은 BeginPlay 이후 첫 프레임부터 시작해야 같은 상태에서 재현된다
+    if (!InputReplayPath.empty())
+    {
+        if (!INPUT.StartReplay(InputReplayPath))
+        {
+            return false;
+        }
+    }
+    else if (!InputRecordPath.empty())
+    {
+        INPUT.StartRecording();
+    }
+
     bPlayActive = true;
     bRunning = true;
     return true;
@@ -231,6 +322,8 @@ void UGameEngine::Tick(float DeltaSeconds)
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
+    FDebugDrawManager::GetInstance().BeginFrame();
+
     for (auto& WorldContext : WorldContexts)
     {
         WorldContext.World->Tick(DeltaSeconds);
@@ -293,11 +386,19 @@ void UGameEngine::MainLoop()
 
     MSG msg;
 
+    // 헤드리스: 시작 이후(로딩 제외) 프레임 구간의 통계만 집계한다
+    const FRHIStats StartStats = RHIDevice.GetStats();
+    double TotalFrameMs = 0.0;
+
     while (bRunning)
     {
         QueryPerformanceCounter(&CurrTime);
         float DeltaSeconds = static_cast<float>((CurrTime.QuadPart - PrevTime.QuadPart) / double(Frequency.QuadPart));
         PrevTime = CurrTime;
+        if (bHeadless)
+        {
+            DeltaSeconds = HeadlessDeltaSeconds;
+        }
 
         // 처리할 메시지가 더 이상 없을때 까지 수행
         while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
@@ -313,13 +414,98 @@ void UGameEngine::MainLoop()
 
         if (!bRunning) break;
 
+        // 입력 녹화/재생: 재생 중이면 녹화된 입력과 DeltaSeconds로 프레임을 진행하고, 끝나면 종료한다
+        DeltaSeconds = INPUT.BeginFrame(DeltaSeconds);
+        if (!InputReplayPath.empty() && !INPUT.IsReplaying())
+        {
+            bRunning = false;
+            break;
+        }
+
+        const uint64 FrameStart = FPlatformTime::Cycles64();
         Tick(DeltaSeconds);
         Render();
+        TotalFrameMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStart);
+
+        // 프레임 단위 CPU 프로파일 집계 (StatsOverlay는 지난 프레임 값을 표시)
+        FCpuProfiler::EndFrame();
+        FMemoryManager::EndFrame();
 
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        if (bHeadless)
+        {
+            ++HeadlessFrameCount;
+            if (HeadlessFrameLimit > 0 && HeadlessFrameCount >= HeadlessFrameLimit)
+            {
+                bRunning = false;
+            }
+        }
+    }
+
+    if (bHeadless)
+    {
+        ReportHeadlessStats(StartStats, TotalFrameMs);
+    }
+
+    if (INPUT.IsRecording())
+    {
+        INPUT.StopRecording(InputRecordPath);
+    }
+    INPUT.StopReplay();
+}
+
+void UGameEngine::ReportHeadlessStats(const FRHIStats& StartStats, double TotalFrameMs) const
+{
+    const FRHIStats& Stats = RHIDevice.GetStats();
+    const double Frames = static_cast<double>(std::max(1, HeadlessFrameCount));
+    auto PerFrame = [Frames](uint64 End, uint64 Start) { return static_cast<double>(End - Start) / Frames; };
+
+    char Buffer[2048];
+    sprintf_s(Buffer,
+        "[NullRHI] %d frames, %.3f ms/frame (Tick + Render CPU)\n"
+        "[NullRHI] per frame: draws %.1f, dispatches %.1f, vertices %.0f, state changes %.1f (redundant %.1f), binds %.1f, clears %.1f, copies %.1f\n"
+        "[NullRHI] per frame: buffer uploads %.1f (%.1f KB), texture uploads %.1f (%.1f KB)\n"
+        "[NullRHI] created total: buffers %llu (%.1f MB), textures %llu, views %llu, shaders %llu, states %llu, queries %llu\n",
+        HeadlessFrameCount, TotalFrameMs / Frames,
+        PerFrame(Stats.DrawCalls, StartStats.DrawCalls),
+        PerFrame(Stats.DispatchCalls, StartStats.DispatchCalls),
+        PerFrame(Stats.Vertices, StartStats.Vertices),
+        PerFrame(Stats.StateChanges, StartStats.StateChanges),
+        PerFrame(Stats.RedundantStateSets, StartStats.RedundantStateSets),
+        PerFrame(Stats.ResourceBinds, StartStats.ResourceBinds),
+        PerFrame(Stats.Clears, StartStats.Clears),
+        PerFrame(Stats.Copies, StartStats.Copies),
+        PerFrame(Stats.BufferUploads, StartStats.BufferUploads),
+        PerFrame(Stats.BufferUploadBytes, StartStats.BufferUploadBytes) / 1024.0,
+        PerFrame(Stats.TextureUploads, StartStats.TextureUploads),
+        PerFrame(Stats.TextureUploadBytes, StartStats.TextureUploadBytes) / 1024.0,
+        Stats.BuffersCreated, Stats.BufferBytesCreated / (1024.0 * 1024.0),
+        Stats.TexturesCreated, Stats.ViewsCreated, Stats.ShadersCreated, Stats.StatesCreated, Stats.QueriesCreated);
+
+    // 창이 없으므로 파일로 남기고(CI 아티팩트), 부모 콘솔이 있으면 그쪽에도 출력한다
+    std::error_code Ec;
+    std::filesystem::create_directories(std::filesystem::path(UTF8ToWide(HeadlessStatsPath)).parent_path(), Ec);
+    std::ofstream StatsFile(UTF8ToWide(HeadlessStatsPath), std::ios::out | std::ios::trunc);
+    if (StatsFile)
+    {
+        StatsFile << Buffer;
     }
+
+    // SubSystem=Windows 실행 파일이라 stdout은 리다이렉트됐을 때만 유효하다. 아니면 실행한 콘솔에 붙는다
+    HANDLE StdOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    if ((StdOut == nullptr || StdOut == INVALID_HANDLE_VALUE) && AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        StdOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    }
+    if (StdOut != nullptr && StdOut != INVALID_HANDLE_VALUE)
+    {
+        DWORD Written = 0;
+        WriteFile(StdOut, Buffer, static_cast<DWORD>(strlen(Buffer)), &Written, nullptr);
+    }
+    OutputDebugStringA(Buffer);
 }
 
 void UGameEngine::Shutdown()
@@ -341,12 +527,18 @@ void UGameEngine::Shutdown()
     // before the global GEngine variable's destructor runs
     FObjManager::Clear();
 
+    // 에셋 레지스트리 캐시 저장 (변경이 있었을 때만)
+    FAssetRegistry::Get().Shutdown();
+
     // IMPORTANT: Explicitly release Renderer before RHIDevice destructor runs
     // Renderer may hold references to D3D resources
     Renderer.reset();
 
     // Shutdown audio device
-    FAudioDevice::Shutdown();
+    if (!bHeadless)
+    {
+        FAudioDevice::Shutdown();
+    }
 
     // Explicitly release D3D11RHI resources before global destruction
     RHIDevice.Release();
@@ -17,6 +17,7 @@ public:
     void Shutdown();
 
     bool IsPlayActive() const { return bPlayActive; }
+    bool IsHeadless() const { return bHeadless; }
 
     HWND GetHWND() const { return HWnd; }
 
@@ -40,6 +41,9 @@ private:
 
     void HandleUVInput(float DeltaSeconds);
 
+    // 헤드리스 실행 종료 시 프레임당 RHI 통계를 파일(-rhistats=)과 부모 콘솔로 보고
+    void ReportHeadlessStats(const FRHIStats& StartStats, double TotalFrameMs) const;
+
 private:
     //윈도우 핸들
     HWND HWnd = nullptr;
@@ -61,6 +65,17 @@ private:
     float UVScrollTime = 0.0f;
     FVector2D UVScrollSpeed = FVector2D(0.5f, 0.5f);
 
+    // 헤드리스 실행 (-nullrhi [-frames=N]): 창/GPU 없이 Null RHI로 월드 Tick + 렌더 CPU 경로만 돈다
+    bool bHeadless = false;
+    int32 HeadlessFrameLimit = 0;   // 0이면 무제한
+    int32 HeadlessFrameCount = 0;
+    FString HeadlessStatsPath;      // 기본 Data/Profiling/NullRHIStats.log
+    static constexpr float HeadlessDeltaSeconds = 1.0f / 60.0f; // 고정 스텝으로 돌려 측정을 재현 가능하게 한다
+
+    // 입력 녹화/재생 (-recordinput=<path>, -replayinput=<path>)
+    FString InputRecordPath;
+    FString InputReplayPath;
+
     // 클라이언트 사이즈
     static float ClientWidth;
     static float ClientHeight;
@@ -13,6 +13,7 @@ public:
 
     const TArray<AActor*>& GetActors() const { return Actors; }
     void AddActor(AActor* Actor) { if (Actor) Actors.Add(Actor); }
+    void ReserveActors(int32 Num) { Actors.Reserve(Num); }
     void SpawnDefaultActors();
     bool RemoveActor(AActor* Actor)
     {
@@ -20,6 +21,16 @@ public:
         if (it != Actors.end()) { Actors.erase(it); return true; }
         return false;
     }
+    // 여러 액터를 순서를 유지하며 한 번에 제거 (O(N)). 실제로 제거된 액터를 OutRemoved에 담는다
+    void RemoveActors(const TSet<AActor*>& InActors, TArray<AActor*>& OutRemoved)
+    {
+        auto NewEnd = std::remove_if(Actors.begin(), Actors.end(), [&](AActor* Actor)
+        {
+            if (InActors.Contains(Actor)) { OutRemoved.Add(Actor); return true; }
+            return false;
+        });
+        Actors.erase(NewEnd, Actors.end());
+    }
     void Clear() { Actors.Empty(); }
 
     void Serialize(const bool bInIsLoading, JSON& InOutHandle);
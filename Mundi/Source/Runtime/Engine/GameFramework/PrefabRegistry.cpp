@@ -0,0 +1,234 @@
+﻿#include "pch.h"
+#include "PrefabRegistry.h"
+#include "AssetRegistry.h"
+#include "ObjectFactory.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	FString ToPrefabKey(const FWideString& PrefabPath)
+	{
+		return FAssetRegistry::ToRegistryPath(WideToUTF8(PrefabPath));
+	}
+
+	int64 GetIndexedWriteTime(const FString& RegistryPath)
+	{
+		const FAssetFileEntry* Entry = FAssetRegistry::Get().FindFile(RegistryPath);
+		return Entry ? Entry->LastWriteTime : 0;
+	}
+}
+
+AActor* FPrefabRegistry::LoadActorFromFile(const FWideString& PrefabPath, UClass** OutClass)
+{
+	JSON ActorDataJson;
+	if (!FJsonSerializer::LoadJsonFromFile(ActorDataJson, PrefabPath))
+	{
+		UE_LOG("[error] 존재하지 않는 Prefab 경로입니다. - %s", WideToUTF8(PrefabPath).c_str());
+		return nullptr;
+	}
+
+	FString TypeString;
+	if (!FJsonSerializer::ReadString(ActorDataJson, "Type", TypeString))
+	{
+		UE_LOG("[error] Prefab에 Type이 없습니다. - %s", WideToUTF8(PrefabPath).c_str());
+		return nullptr;
+	}
+
+	UClass* NewClass = UClass::FindClass(TypeString);
+
+	// 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
+	if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
+	{
+		UE_LOG("[error] SpawnActor failed: Invalid class provided.");
+		return nullptr;
+	}
+
+	// ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
+	AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
+	if (!NewActor)
+	{
+		UE_LOG("[error] SpawnActor failed: ObjectFactory could not create an instance of");
+		return nullptr;
+	}
+
+	// 데이터 불러오기
+	NewActor->Serialize(true, ActorDataJson);
+
+	if (OutClass)
+	{
+		*OutClass = NewClass;
+	}
+	return NewActor;
+}
+
+const FPrefabTemplate* FPrefabRegistry::FindOrLoad(const FWideString& PrefabPath)
+{
+	ValidateAgainstAssetRegistry();
+
+	const FString Key = ToPrefabKey(PrefabPath);
+	if (FPrefabTemplate* Found = Templates.Find(Key))
+	{
+		++Stats.NumHits;
+		return Found;
+	}
+
+	return Compile(Key, PrefabPath);
+}
+
+AActor* FPrefabRegistry::Instantiate(const FPrefabTemplate& Template) const
+{
+	if (!Template.Archetype)
+	{
+		return nullptr;
+	}
+
+	// PIE 복제와 같은 경로: 컴포넌트/MID 깊은 복사 + 부착 관계 재구성, UUID 재발급
+	return Template.Archetype->Duplicate();
+}
+
+void FPrefabRegistry::Invalidate(const FWideString& PrefabPath)
+{
+	const FString Key = ToPrefabKey(PrefabPath);
+	if (FPrefabTemplate* Found = Templates.Find(Key))
+	{
+		ReleaseTemplate(*Found);
+		Templates.Remove(Key);
+		Stats.NumTemplates = Templates.Num();
+	}
+}
+
+void FPrefabRegistry::InvalidateAll()
+{
+	for (auto& Pair : Templates)
+	{
+		ReleaseTemplate(Pair.second);
+	}
+	Templates.Empty();
+	Stats.NumTemplates = 0;
+}
+
+FPrefabTemplate* FPrefabRegistry::Compile(const FString& RegistryPath, const FWideString& PrefabPath)
+{
+	const uint64 Start = FPlatformTime::Cycles64();
+
+	UClass* Class = nullptr;
+	AActor* Archetype = LoadActorFromFile(PrefabPath, &Class);
+	if (!Archetype)
+	{
+		// 실패는 캐시하지 않는다 (파일이 생기면 다음 호출에서 다시 시도)
+		return nullptr;
+	}
+
+	FPrefabTemplate& Template = Templates[RegistryPath];
+	Template.Path = RegistryPath;
+	Template.Class = Class;
+	Template.Archetype = Archetype;
+	Template.LastWriteTime = GetIndexedWriteTime(RegistryPath);
+
+	++Stats.NumCompiles;
+	Stats.NumTemplates = Templates.Num();
+	Stats.TotalCompileMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	return &Template;
+}
+
+void FPrefabRegistry::ReleaseTemplate(FPrefabTemplate& Template)
+{
+	if (Template.Archetype)
+	{
+		// 월드에 등록된 적이 없으므로 바로 삭제해도 된다 (컴포넌트는 소멸자에서 정리)
+		ObjectFactory::DeleteObject(Template.Archetype);
+		Template.Archetype = nullptr;
+	}
+}
+
+void FPrefabRegistry::ValidateAgainstAssetRegistry()
+{
+	// 인덱스가 바뀌었을 때만 수정 시각을 비교 (스폰마다 디스크를 보지 않음)
+	const uint32 Generation = FAssetRegistry::Get().GetGeneration();
+	if (Generation == ValidatedGeneration)
+	{
+		return;
+	}
+	ValidatedGeneration = Generation;
+
+	TArray<FString> Stale;
+	for (const auto& Pair : Templates)
+	{
+		if (GetIndexedWriteTime(Pair.first) != Pair.second.LastWriteTime)
+		{
+			Stale.Add(Pair.first);
+		}
+	}
+
+	for (const FString& Key : Stale)
+	{
+		UE_LOG("PrefabRegistry: %s changed, recompiling on next spawn", Key.c_str());
+		ReleaseTemplate(Templates[Key]);
+		Templates.Remove(Key);
+	}
+	Stats.NumTemplates = Templates.Num();
+}
+
+FPrefabSpawnBenchmarkResult RunPrefabSpawnBenchmark(const FWideString& PrefabPath, int32 NumSpawns)
+{
+	FPrefabSpawnBenchmarkResult Result;
+	if (NumSpawns <= 0)
+	{
+		return Result;
+	}
+
+	TArray<AActor*> Spawned;
+	Spawned.Reserve(NumSpawns);
+
+	auto CountComponents = [](const TArray<AActor*>& Actors)
+	{
+		size_t Count = 0;
+		for (AActor* Actor : Actors)
+		{
+			Count += Actor ? Actor->GetOwnedComponents().size() : 0;
+		}
+		return Count;
+	};
+	auto DestroySpawned = [&Spawned]()
+	{
+		for (int32 i = Spawned.Num() - 1; i >= 0; --i)
+		{
+			ObjectFactory::DeleteObject(Spawned[i]);
+		}
+		Spawned.Empty();
+	};
+
+	// 1. 기존 방식: 매번 파일 로드 + 파싱 + 클래스 조회 + 역직렬화
+	uint64 Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < NumSpawns; ++i)
+	{
+		Spawned.Add(FPrefabRegistry::LoadActorFromFile(PrefabPath));
+	}
+	Result.FileLoadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	const size_t FileLoadComponents = CountComponents(Spawned);
+	DestroySpawned();
+
+	// 2. 템플릿: 최초 1회 컴파일 후 복제
+	FPrefabRegistry& Registry = FPrefabRegistry::GetInstance();
+	Registry.Invalidate(PrefabPath);
+
+	Start = FPlatformTime::Cycles64();
+	const FPrefabTemplate* Template = Registry.FindOrLoad(PrefabPath);
+	Result.CompileMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	if (!Template)
+	{
+		return Result;
+	}
+
+	Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < NumSpawns; ++i)
+	{
+		Spawned.Add(Registry.Instantiate(*Template));
+	}
+	Result.TemplateMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	Result.bSameComponentCount = CountComponents(Spawned) == FileLoadComponents;
+	DestroySpawned();
+
+	Result.NumSpawns = NumSpawns;
+	return Result;
+}
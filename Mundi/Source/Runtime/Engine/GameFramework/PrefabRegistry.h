@@ -0,0 +1,85 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class AActor;
+class UClass;
+class UWorld;
+
+/**
+ * @brief 한 번 읽어 컴파일해 둔 프리팹
+ * - Archetype은 프리팹 JSON으로 역직렬화만 하고 어느 월드에도 등록하지 않은 원본 액터다.
+ *   클래스 조회, 에셋 로드(메시/머티리얼/텍스처 포인터), 프로퍼티 디코딩이 이미 끝난 상태이므로
+ *   스폰은 PIE 복제와 같은 Duplicate 경로로 이 액터를 복사하기만 한다.
+ */
+struct FPrefabTemplate
+{
+	FString Path;					// 레지스트리 경로 (작업 디렉토리 기준, '/' 구분자)
+	UClass* Class = nullptr;
+	AActor* Archetype = nullptr;
+	int64 LastWriteTime = 0;		// 컴파일 당시 파일 수정 시각 (AssetRegistry 기준)
+};
+
+struct FPrefabRegistryStats
+{
+	int32 NumTemplates = 0;
+	uint64 NumHits = 0;
+	uint64 NumCompiles = 0;
+	double TotalCompileMs = 0.0;
+};
+
+/**
+ * @brief 프리팹 템플릿 캐시
+ * - UWorld::SpawnPrefabActor(및 Lua SpawnPrefab)가 매번 파일을 읽고 파싱하지 않도록 경로별 템플릿을 보관한다.
+ * - 무효화: 에디터에서 프리팹을 저장하면 Invalidate를 호출하고,
+ *   그 외 외부 편집은 AssetRegistry 세대가 바뀌었을 때 파일 수정 시각을 비교해 다시 컴파일한다.
+ * - 메인 스레드 전용.
+ */
+class FPrefabRegistry
+{
+public:
+	static FPrefabRegistry& GetInstance()
+	{
+		static FPrefabRegistry Instance;
+		return Instance;
+	}
+
+	// 캐시된 템플릿을 돌려주고, 없거나 오래됐으면 파일에서 컴파일. 실패 시 nullptr
+	const FPrefabTemplate* FindOrLoad(const FWideString& PrefabPath);
+
+	// 템플릿으로부터 새 액터 생성 (월드 등록은 호출 측에서)
+	AActor* Instantiate(const FPrefabTemplate& Template) const;
+
+	void Invalidate(const FWideString& PrefabPath);
+	void InvalidateAll();
+
+	const FPrefabRegistryStats& GetStats() const { return Stats; }
+
+	// 캐시 없이 파일을 읽어 액터를 만든다 (템플릿 컴파일 및 기존 경로 비교용)
+	static AActor* LoadActorFromFile(const FWideString& PrefabPath, UClass** OutClass = nullptr);
+
+private:
+	FPrefabRegistry() = default;
+	~FPrefabRegistry() = default;
+	FPrefabRegistry(const FPrefabRegistry&) = delete;
+	FPrefabRegistry& operator=(const FPrefabRegistry&) = delete;
+
+	FPrefabTemplate* Compile(const FString& RegistryPath, const FWideString& PrefabPath);
+	void ReleaseTemplate(FPrefabTemplate& Template);
+	void ValidateAgainstAssetRegistry();
+
+	TMap<FString, FPrefabTemplate> Templates;
+	uint32 ValidatedGeneration = 0;
+	FPrefabRegistryStats Stats;
+};
+
+// 프리팹 NumSpawns개 생성 비용: 매번 파일 로드/파싱 vs 템플릿 복제 (월드 등록 비용은 두 경로가 같으므로 제외)
+struct FPrefabSpawnBenchmarkResult
+{
+	int32 NumSpawns = 0;
+	double FileLoadMs = 0.0;
+	double TemplateMs = 0.0;
+	double CompileMs = 0.0;
+	bool bSameComponentCount = false;
+};
+
+FPrefabSpawnBenchmarkResult RunPrefabSpawnBenchmark(const FWideString& PrefabPath, int32 NumSpawns);
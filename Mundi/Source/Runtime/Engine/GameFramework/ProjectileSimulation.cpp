@@ -0,0 +1,440 @@
+﻿#include "pch.h"
+#include "ProjectileSimulation.h"
+#include "ProjectileMovementComponent.h"
+#include "PrimitiveComponent.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "PlatformTime.h"
+
+void FProjectileSimulation::Register(UProjectileMovementComponent* Component)
+{
+	if (!Component || Component->Simulation)
+	{
+		return;
+	}
+
+	Component->Simulation = this;
+	Component->SimulationSlot = States.Num();
+	States.Add(FProjectileState{});
+	Components.Add(Component);
+}
+
+void FProjectileSimulation::Unregister(UProjectileMovementComponent* Component)
+{
+	if (!Component || Component->Simulation != this)
+	{
+		return;
+	}
+
+	const int32 Slot = Component->SimulationSlot;
+	Component->Simulation = nullptr;
+	Component->SimulationSlot = -1;
+	if (Slot < 0 || Slot >= Components.Num() || Components[Slot] != Component)
+	{
+		return;
+	}
+
+	if (bDispatchingEvents)
+	{
+		// 이벤트 전달 중에는 슬롯을 옮기지 않고 비워만 둔다 (남은 이벤트의 슬롯 인덱스 유지)
+		Components[Slot] = nullptr;
+		States[Slot].bSimulating = false;
+		States[Slot].bActive = false;
+		PendingRemoveSlots.Add(Slot);
+		return;
+	}
+	RemoveSlot(Slot);
+}
+
+int32 FProjectileSimulation::AddProjectile(const FProjectileState& State)
+{
+	const int32 Slot = States.Num();
+	States.Add(State);
+	States[Slot].bSimulating = State.bActive;
+	Components.Add(nullptr);
+	return Slot;
+}
+
+void FProjectileSimulation::Reset()
+{
+	for (UProjectileMovementComponent* Component : Components)
+	{
+		if (Component)
+		{
+			Component->Simulation = nullptr;
+			Component->SimulationSlot = -1;
+		}
+	}
+	States.Empty();
+	Components.Empty();
+	Events.Empty();
+	PendingRemoveSlots.Empty();
+}
+
+void FProjectileSimulation::RemoveSlot(int32 Slot)
+{
+	const int32 Last = States.Num() - 1;
+	if (Slot != Last)
+	{
+		States[Slot] = States[Last];
+		Components[Slot] = Components[Last];
+		if (Components[Slot])
+		{
+			Components[Slot]->SimulationSlot = Slot;
+		}
+	}
+	States.Pop();
+	Components.Pop();
+}
+
+void FProjectileSimulation::Tick(UWorld* World, float DeltaSeconds)
+{
+	if (States.IsEmpty() || !World)
+	{
+		return;
+	}
+
+	TIME_PROFILE(ProjectileSimulation)
+
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	const FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+
+	GatherFromComponents(World->bPie);
+	Simulate(BVH, DeltaSeconds);
+	ScatterToComponents();
+	DispatchEvents();
+}
+
+void FProjectileSimulation::GatherFromComponents(bool bIsPIE)
+{
+	for (int32 Slot = 0; Slot < Components.Num(); ++Slot)
+	{
+		UProjectileMovementComponent* Component = Components[Slot];
+		FProjectileState& State = States[Slot];
+		if (!Component)
+		{
+			// 컴포넌트 없는 발사체는 배열의 상태가 곧 원본
+			State.bSimulating = State.bActive;
+			continue;
+		}
+
+		// 기존 컴포넌트 틱과 같은 조건 (액터 Tick -> 컴포넌트 TickComponent 경로)
+		State.bSimulating = false;
+		AActor* Owner = Component->GetOwner();
+		USceneComponent* Updated = Component->UpdatedComponent;
+		if (!Updated || !Owner || !Component->bIsActive || !Component->IsRegistered()
+			|| !Component->UActorComponent::bIsActive || !Component->bTickEnabled)
+		{
+			continue;
+		}
+		if (Owner->IsPendingDestroy() || !Owner->IsActorActive() || !Owner->CanEverTick()
+			|| !(bIsPIE || Owner->CanTickInEditor()))
+		{
+			continue;
+		}
+
+		if (Component->bIsHomingProjectile)
+		{
+			Component->ComputeHomingAcceleration(0.0f);
+		}
+
+		State.Location = Updated->GetWorldLocation();
+		State.Velocity = Component->Velocity;
+		State.Acceleration = Component->Acceleration;
+		State.Gravity = Component->Gravity;
+		State.MaxSpeed = Component->MaxSpeed;
+		State.CollisionRadius = Component->CollisionRadius;
+		State.Bounciness = Component->Bounciness;
+		State.Friction = Component->Friction;
+		State.BounceVelocityStopThreshold = Component->BounceVelocityStopThreshold;
+		State.Lifetime = Component->CurrentLifetime;
+		State.Lifespan = Component->ProjectileLifespan;
+		State.TimeScale = Owner->GetCustomTimeDillation();
+		State.IgnoreActor = Owner;
+		State.bActive = true;
+		State.bShouldBounce = Component->bShouldBounce;
+		State.bSweepCollision = Component->bSweepCollision;
+		State.bSimulating = true;
+	}
+}
+
+void FProjectileSimulation::Simulate(const FBVHierarchy* BVH, float DeltaSeconds)
+{
+	Stats = FProjectileSimulationStats{};
+
+	FCollisionQueryParams Params;
+	FHitResult Hit;
+
+	auto PushEvent = [this](int32 Slot, EProjectileEventType Type, const FHitResult& InHit, const FVector& ImpactVelocity)
+	{
+		FProjectileEvent& Event = Events.emplace_back();
+		Event.Slot = Slot;
+		Event.Component = Components[Slot];
+		Event.Type = Type;
+		Event.Hit = InHit;
+		Event.ImpactVelocity = ImpactVelocity;
+	};
+
+	const int32 NumStates = States.Num();
+	for (int32 Slot = 0; Slot < NumStates; ++Slot)
+	{
+		FProjectileState& State = States[Slot];
+		if (!State.bSimulating || !State.bActive)
+		{
+			continue;
+		}
+
+		const float Dt = DeltaSeconds * State.TimeScale;
+		if (Dt <= 0.0f)
+		{
+			continue;
+		}
+		++Stats.NumSimulated;
+
+		// 1. 생명주기
+		if (State.Lifespan > 0.0f)
+		{
+			State.Lifetime += Dt;
+			if (State.Lifetime >= State.Lifespan)
+			{
+				State.bActive = false;
+				++Stats.NumExpired;
+				PushEvent(Slot, EProjectileEventType::LifespanExpired, FHitResult{}, State.Velocity);
+				continue;
+			}
+		}
+
+		// 2. 중력 + 가속도 + 속도 제한
+		State.Velocity.Z += State.Gravity * Dt;
+		State.Velocity += State.Acceleration * Dt;
+		if (State.MaxSpeed > 0.0f && State.Velocity.SizeSquared() > State.MaxSpeed * State.MaxSpeed)
+		{
+			State.Velocity = State.Velocity.GetNormalized() * State.MaxSpeed;
+		}
+
+		// 3. 이동 구간 스윕. 튕기면 남은 시간만큼 다시 스윕
+		float RemainingTime = Dt;
+		for (int32 SubStep = 0; SubStep < MaxSubSteps && RemainingTime > 0.0f; ++SubStep)
+		{
+			const FVector Delta = State.Velocity * RemainingTime;
+			if (Delta.SizeSquared() <= KINDA_SMALL_NUMBER)
+			{
+				break;
+			}
+
+			const FVector Start = State.Location;
+			const FVector End = Start + Delta;
+			bool bHit = false;
+			if (BVH && State.bSweepCollision)
+			{
+				Params.IgnoreActor = State.IgnoreActor;
+				++Stats.NumSweeps;
+				bHit = State.CollisionRadius > 0.0f
+					? WorldCollision::SweepSphereSingle(BVH, Hit, Start, End, State.CollisionRadius, Params)
+					: WorldCollision::LineTraceSingle(BVH, Hit, Start, End, Params);
+			}
+
+			if (!bHit)
+			{
+				State.Location = End;
+				break;
+			}
+			++Stats.NumHits;
+
+			// 충돌 순간의 중심까지 이동하고 표면 밖으로 살짝 띄운다
+			FVector Normal = Hit.Normal;
+			if (FVector::Dot(Normal, State.Velocity) > 0.0f)
+			{
+				Normal = -Normal;
+			}
+			State.Location = Start + Delta * Hit.Time + Normal * HitSurfaceOffset;
+			RemainingTime *= (1.0f - Hit.Time);
+
+			const FVector ImpactVelocity = State.Velocity;
+			if (State.bShouldBounce)
+			{
+				// 법선 성분은 Bounciness만큼 반사, 접선 성분은 Friction만큼 감쇠
+				const FVector NormalVelocity = Normal * FVector::Dot(State.Velocity, Normal);
+				const FVector TangentVelocity = State.Velocity - NormalVelocity;
+				State.Velocity = TangentVelocity * (1.0f - State.Friction) - NormalVelocity * State.Bounciness;
+
+				if (State.Velocity.SizeSquared() >= State.BounceVelocityStopThreshold * State.BounceVelocityStopThreshold)
+				{
+					++Stats.NumBounces;
+					PushEvent(Slot, EProjectileEventType::Bounce, Hit, ImpactVelocity);
+					continue;
+				}
+			}
+
+			State.Velocity = FVector(0.0f, 0.0f, 0.0f);
+			State.bActive = false;
+			++Stats.NumStopped;
+			PushEvent(Slot, EProjectileEventType::Stop, Hit, ImpactVelocity);
+			break;
+		}
+	}
+}
+
+void FProjectileSimulation::ScatterToComponents()
+{
+	for (int32 Slot = 0; Slot < Components.Num(); ++Slot)
+	{
+		UProjectileMovementComponent* Component = Components[Slot];
+		const FProjectileState& State = States[Slot];
+		if (!Component || !State.bSimulating)
+		{
+			continue;
+		}
+
+		Component->Velocity = State.Velocity;
+		Component->CurrentLifetime = State.Lifetime;
+		Component->bIsActive = State.bActive;
+
+		USceneComponent* Updated = Component->UpdatedComponent;
+		if (Updated && !(Updated->GetWorldLocation() == State.Location))
+		{
+			Updated->SetWorldLocation(State.Location);
+		}
+
+		if (Component->bRotationFollowsVelocity)
+		{
+			Component->UpdateRotationFromVelocity();
+		}
+	}
+}
+
+void FProjectileSimulation::DispatchEvents()
+{
+	if (Events.IsEmpty())
+	{
+		return;
+	}
+
+	bDispatchingEvents = true;
+	for (int32 i = 0; i < Events.Num(); ++i)
+	{
+		const FProjectileEvent& Event = Events[i];
+		UProjectileMovementComponent* Component = Event.Component;
+		if (!Component || Event.Slot >= Components.Num() || Components[Event.Slot] != Component)
+		{
+			continue;   // 컴포넌트 없는 발사체이거나 앞선 콜백에서 해제됨
+		}
+		AActor* Owner = Component->GetOwner();
+
+		switch (Event.Type)
+		{
+		case EProjectileEventType::LifespanExpired:
+			if (Component->bAutoDestroyWhenLifespanExceeded && Owner)
+			{
+				// 지연 삭제 (UWorld::ProcessPendingKillActors)
+				Owner->Destroy();
+			}
+			break;
+		case EProjectileEventType::Bounce:
+		case EProjectileEventType::Stop:
+			if (Owner)
+			{
+				Owner->OnComponentHit.Broadcast(Cast<UPrimitiveComponent>(Component->UpdatedComponent), Event.Hit.Component);
+			}
+			if (Components[Event.Slot] != Component)
+			{
+				break;
+			}
+			if (Event.Type == EProjectileEventType::Bounce)
+			{
+				Component->OnProjectileBounce.Broadcast(Event.Hit, Event.ImpactVelocity);
+			}
+			else
+			{
+				Component->OnProjectileStop.Broadcast(Event.Hit);
+			}
+			break;
+		}
+	}
+	Events.Empty();
+	bDispatchingEvents = false;
+
+	// 전달 중 해제된 슬롯은 큰 인덱스부터 swap-remove (아직 남은 빈 슬롯이 끝으로 오지 않도록)
+	if (!PendingRemoveSlots.IsEmpty())
+	{
+		std::sort(PendingRemoveSlots.begin(), PendingRemoveSlots.end(), std::greater<int32>());
+		for (int32 Slot : PendingRemoveSlots)
+		{
+			RemoveSlot(Slot);
+		}
+		PendingRemoveSlots.Empty();
+	}
+}
+
+// ============================================================================
+// 스트레스 테스트
+// ============================================================================
+
+FProjectileStressResult RunProjectileStressTest(UWorld* World, int32 NumProjectiles, int32 NumFrames, float DeltaSeconds)
+{
+	FProjectileStressResult Result;
+	if (NumProjectiles <= 0 || NumFrames <= 0)
+	{
+		return Result;
+	}
+
+	UWorldPartitionManager* Partition = World ? World->GetPartitionManager() : nullptr;
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	FAABB Bounds(FVector(-50.0f, -50.0f, 0.0f), FVector(50.0f, 50.0f, 20.0f));
+	if (BVH)
+	{
+		BVH->FlushRebuild();
+		Result.NumColliders = BVH->TotalActorCount();
+		if (Result.NumColliders > 0)
+		{
+			Bounds = BVH->GetBounds();
+		}
+	}
+
+	uint32 Seed = 1;
+	auto Random = [&Seed]()
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return (Seed >> 8) * (1.0f / 16777216.0f);
+	};
+
+	// 씬 위쪽에서 사방으로 흩뿌리는 튕기는 발사체 (파이어볼/파편 형태)
+	FProjectileSimulation Simulation;
+	for (int32 i = 0; i < NumProjectiles; ++i)
+	{
+		FProjectileState State;
+		State.Location = FVector(
+			Bounds.Min.X + (Bounds.Max.X - Bounds.Min.X) * Random(),
+			Bounds.Min.Y + (Bounds.Max.Y - Bounds.Min.Y) * Random(),
+			Bounds.Max.Z + 1.0f + 4.0f * Random());
+		State.Velocity = FVector(Random() * 20.0f - 10.0f, Random() * 20.0f - 10.0f, Random() * -20.0f);
+		State.Gravity = -9.8f;
+		State.CollisionRadius = 0.25f;
+		State.Bounciness = 0.5f;
+		State.Friction = 0.2f;
+		State.BounceVelocityStopThreshold = 0.5f;
+		State.bShouldBounce = true;
+		Simulation.AddProjectile(State);
+	}
+
+	Result.NumProjectiles = NumProjectiles;
+	Result.NumFrames = NumFrames;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		Simulation.Simulate(BVH, DeltaSeconds);
+		const double FrameMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		Result.TotalMs += FrameMs;
+		Result.MaxFrameMs = std::max(Result.MaxFrameMs, FrameMs);
+		const FProjectileSimulationStats& Stats = Simulation.GetStats();
+		Result.NumSweeps += Stats.NumSweeps;
+		Result.NumHits += Stats.NumHits;
+		Result.NumBounces += Stats.NumBounces;
+		Result.NumStopped += Stats.NumStopped;
+
+		// 측정 구간 밖에서 이벤트를 비워 프레임마다 배열이 커지지 않게 한다
+		Simulation.DispatchEvents();
+	}
+	return Result;
+}
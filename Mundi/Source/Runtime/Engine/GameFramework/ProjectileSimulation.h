@@ -0,0 +1,125 @@
+﻿#pragma once
+#include "Vector.h"
+#include "UEContainer.h"
+#include "WorldCollision.h"
+
+class AActor;
+class UWorld;
+class FBVHierarchy;
+class UProjectileMovementComponent;
+
+// 발사체 하나의 시뮬레이션 상태. 연속 배열에 그대로 담기는 POD
+struct FProjectileState
+{
+	FVector Location;
+	FVector Velocity;
+	FVector Acceleration;
+	float Gravity = 0.0f;
+	float MaxSpeed = 0.0f;                      // 0 = 제한 없음
+	float CollisionRadius = 0.0f;               // 0이면 라인 트레이스, 아니면 구 스윕
+	float Bounciness = 0.0f;                    // 튕길 때 법선 방향 속도 보존 비율
+	float Friction = 0.0f;                      // 튕길 때 접선 방향 속도 감쇠 비율
+	float BounceVelocityStopThreshold = 0.0f;   // 튕긴 뒤 속력이 이보다 작으면 정지
+	float Lifetime = 0.0f;
+	float Lifespan = 0.0f;                      // 0 = 무제한
+	float TimeScale = 1.0f;                     // 소유 액터의 시간 배율
+	const AActor* IgnoreActor = nullptr;        // 자기 자신은 맞지 않도록
+	bool bActive = true;
+	bool bShouldBounce = false;
+	bool bSweepCollision = true;
+	bool bSimulating = false;                   // 이번 프레임 컴포넌트에서 값을 가져왔는지 (Gather에서 결정, 결과 반영 대상)
+};
+
+enum class EProjectileEventType : uint8
+{
+	Bounce,
+	Stop,
+	LifespanExpired,
+};
+
+// 시뮬레이션 중에는 기록만 하고, 상태를 컴포넌트에 반영한 뒤 한꺼번에 전달한다
+// (콜백에서 발사체를 스폰/파괴해도 순회 중인 배열이 흔들리지 않도록)
+struct FProjectileEvent
+{
+	int32 Slot = -1;
+	UProjectileMovementComponent* Component = nullptr;
+	EProjectileEventType Type = EProjectileEventType::Stop;
+	FHitResult Hit;
+	FVector ImpactVelocity;
+};
+
+struct FProjectileSimulationStats
+{
+	int32 NumSimulated = 0;
+	int32 NumSweeps = 0;
+	int32 NumHits = 0;
+	int32 NumBounces = 0;
+	int32 NumStopped = 0;
+	int32 NumExpired = 0;
+};
+
+/**
+ * 월드의 모든 UProjectileMovementComponent를 한 번에 시뮬레이션한다.
+ * - 컴포넌트마다 가상 TickComponent를 부르는 대신, 상태를 연속 배열(FProjectileState)에 모아
+ *   적분 -> 파티션 BVH 스윕 -> 튕김/정지 처리를 한 루프에서 돌린다.
+ * - 슬롯은 swap-remove로 빈틈 없이 유지하고, 컴포넌트는 자기 슬롯 인덱스만 기억한다.
+ * - 컴포넌트 없이 상태만 넣어 돌릴 수도 있어서 렌더러/액터 없이 스트레스 테스트가 가능하다.
+ */
+class FProjectileSimulation
+{
+public:
+	void Register(UProjectileMovementComponent* Component);
+	void Unregister(UProjectileMovementComponent* Component);
+
+	// 컴포넌트 없는 발사체 추가 (스트레스 테스트용). 슬롯 인덱스 반환
+	int32 AddProjectile(const FProjectileState& State);
+	void Reset();
+
+	// 컴포넌트 값 수집 -> Simulate -> 결과 반영 -> 이벤트 전달
+	void Tick(UWorld* World, float DeltaSeconds);
+
+	// 상태 배열만 DeltaSeconds만큼 진행한다. BVH가 nullptr이면 충돌 없이 적분만 한다
+	// 이벤트는 쌓이기만 하므로 Tick 없이 직접 돌릴 때는 프레임마다 DispatchEvents를 불러 비워야 한다
+	void Simulate(const FBVHierarchy* BVH, float DeltaSeconds);
+
+	// 쌓인 튕김/정지/수명 이벤트를 컴포넌트에 전달하고 비운다 (컴포넌트 없는 발사체 이벤트는 버려진다)
+	void DispatchEvents();
+
+	int32 Num() const { return States.Num(); }
+	const TArray<FProjectileState>& GetStates() const { return States; }
+	const FProjectileSimulationStats& GetStats() const { return Stats; }
+
+private:
+	void GatherFromComponents(bool bIsPIE);
+	void ScatterToComponents();
+	void RemoveSlot(int32 Slot);
+
+	// 한 프레임 안에서 튕긴 뒤 남은 시간으로 다시 스윕하는 최대 횟수
+	static constexpr int32 MaxSubSteps = 3;
+	// 충돌 지점에서 표면 밖으로 띄우는 거리 (다음 스윕이 시작부터 겹치지 않도록)
+	static constexpr float HitSurfaceOffset = 0.01f;
+
+	TArray<FProjectileState> States;
+	TArray<UProjectileMovementComponent*> Components;   // States와 1:1 (nullptr = 컴포넌트 없는 발사체)
+	TArray<FProjectileEvent> Events;
+	TArray<int32> PendingRemoveSlots;                   // 이벤트 전달 중 해제된 슬롯
+	bool bDispatchingEvents = false;
+	FProjectileSimulationStats Stats;
+};
+
+// 컴포넌트/액터 없이 발사체 상태만으로 월드 BVH에 대해 시뮬레이션 비용을 측정한다
+struct FProjectileStressResult
+{
+	int32 NumProjectiles = 0;
+	int32 NumFrames = 0;
+	int32 NumColliders = 0;
+	double TotalMs = 0.0;
+	double MaxFrameMs = 0.0;
+	int64 NumSweeps = 0;
+	int64 NumHits = 0;
+	int64 NumBounces = 0;
+	int32 NumStopped = 0;
+};
+
+// World가 nullptr이거나 파티션이 없으면 충돌 없이 적분만 측정한다
+FProjectileStressResult RunProjectileStressTest(UWorld* World, int32 NumProjectiles, int32 NumFrames, float DeltaSeconds = 1.0f / 60.0f);
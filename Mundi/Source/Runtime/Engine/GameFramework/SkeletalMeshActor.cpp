@@ -320,6 +320,9 @@ void ASkeletalMeshActor::BuildBoneLinesCache()
 
     const int NumSegments = CachedSegments;
 
+    // 본마다 콘 2 * NumSegments + 링 3 * NumSegments 개
+    BoneLineComponent->ReserveLines(BoneLineComponent->GetLineCount() + BoneCount * NumSegments * 5);
+
     for (int32 i = 0; i < BoneCount; ++i)
     {
         FBoneDebugLines& BL = BoneLinesCache[i];
@@ -393,7 +396,7 @@ void ASkeletalMeshActor::BuildBoneLinesCache()
 
 void ASkeletalMeshActor::UpdateBoneSelectionHighlight(int32 SelectedBoneIndex)
 {
-    if (!SkeletalMeshComponent)
+    if (!SkeletalMeshComponent || !BoneLineComponent)
     {
         return;
     }
@@ -425,9 +428,9 @@ void ASkeletalMeshActor::UpdateBoneSelectionHighlight(int32 SelectedBoneIndex)
         FBoneDebugLines& BL = BoneLinesCache[i];
 
         // Update joint ring colors
-        for (ULine* L : BL.Rings)
+        for (const FLineHandle& L : BL.Rings)
         {
-            if (L) L->SetColor(RingColor);
+            BoneLineComponent->SetLineColor(L, RingColor);
         }
 
         // Update cone colors
@@ -435,21 +438,21 @@ void ASkeletalMeshActor::UpdateBoneSelectionHighlight(int32 SelectedBoneIndex)
         const bool bConeSelected = (i == SelectedBoneIndex || parent == SelectedBoneIndex);
         const FVector4 ConeColor = bConeSelected ? SelCone : NormalCone;
 
-        for (ULine* L : BL.ConeEdges)
+        for (const FLineHandle& L : BL.ConeEdges)
         {
-            if (L) L->SetColor(ConeColor);
+            BoneLineComponent->SetLineColor(L, ConeColor);
         }
 
-        for (ULine* L : BL.ConeBase)
+        for (const FLineHandle& L : BL.ConeBase)
         {
-            if (L) L->SetColor(ConeColor);
+            BoneLineComponent->SetLineColor(L, ConeColor);
         }
     }
 }
 
 void ASkeletalMeshActor::UpdateBoneSubtreeTransforms(int32 BoneIndex)
 {
-    if (!SkeletalMeshComponent)
+    if (!SkeletalMeshComponent || !BoneLineComponent)
     {
         return;
     }
@@ -533,15 +536,12 @@ void ASkeletalMeshActor::UpdateBoneSubtreeTransforms(int32 BoneIndex)
                 const FVector BaseVertex1 = ParentPos + Right * (Radius * std::cos(angle1)) + Forward * (Radius * std::sin(angle1));
 
                 // Update cone edge
-                if (BL.ConeEdges[k])
-                {
-                    BL.ConeEdges[k]->SetLine(BaseVertex0, ChildPos);
-                }
+                BoneLineComponent->SetLine(BL.ConeEdges[k], BaseVertex0, ChildPos);
 
                 // Update base circle edge
-                if (k < BL.ConeBase.Num() && BL.ConeBase[k])
+                if (k < BL.ConeBase.Num())
                 {
-                    BL.ConeBase[k]->SetLine(BaseVertex0, BaseVertex1);
+                    BoneLineComponent->SetLine(BL.ConeBase[k], BaseVertex0, BaseVertex1);
                 }
             }
         }
@@ -555,13 +555,13 @@ void ASkeletalMeshActor::UpdateBoneSubtreeTransforms(int32 BoneIndex)
             const float a1 = (static_cast<float>((k + 1) % NumSegments) / NumSegments) * TWO_PI;
             const int base = k * 3;
             if (BL.Rings.IsEmpty() || base + 2 >= BL.Rings.Num()) break;
-            BL.Rings[base+0]->SetLine(
+            BoneLineComponent->SetLine(BL.Rings[base+0],
                 Center + FVector(BoneJointRadius * std::cos(a0), BoneJointRadius * std::sin(a0), 0.0f),
                 Center + FVector(BoneJointRadius * std::cos(a1), BoneJointRadius * std::sin(a1), 0.0f));
-            BL.Rings[base+1]->SetLine(
+            BoneLineComponent->SetLine(BL.Rings[base+1],
                 Center + FVector(BoneJointRadius * std::cos(a0), 0.0f, BoneJointRadius * std::sin(a0)),
                 Center + FVector(BoneJointRadius * std::cos(a1), 0.0f, BoneJointRadius * std::sin(a1)));
-            BL.Rings[base+2]->SetLine(
+            BoneLineComponent->SetLine(BL.Rings[base+2],
                 Center + FVector(0.0f, BoneJointRadius * std::cos(a0), BoneJointRadius * std::sin(a0)),
                 Center + FVector(0.0f, BoneJointRadius * std::cos(a1), BoneJointRadius * std::sin(a1)));
         }
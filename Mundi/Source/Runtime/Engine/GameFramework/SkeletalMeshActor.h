@@ -67,9 +67,9 @@ protected:
     // Incremental bone line overlay cache (avoid ClearLines every frame)   
     struct FBoneDebugLines
     {
-        TArray<ULine*> ConeEdges;         // NumSegments lines from base circle to tip (child joint)
-        TArray<ULine*> ConeBase;          // NumSegments lines forming the base circle at parent
-        TArray<ULine*> Rings;             // 3 * NumSegments lines per bone (joint spheres)
+        TArray<FLineHandle> ConeEdges;    // NumSegments lines from base circle to tip (child joint)
+        TArray<FLineHandle> ConeBase;     // NumSegments lines forming the base circle at parent
+        TArray<FLineHandle> Rings;        // 3 * NumSegments lines per bone (joint spheres)
     };
 
     bool bBoneLinesInitialized = false;
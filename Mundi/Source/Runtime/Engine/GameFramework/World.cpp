@@ -28,6 +28,11 @@
 #include "Level.h"
 #include "LightManager.h"
 #include "LuaManager.h"
+#include "ProjectileSimulation.h"
+#include "ActorPool.h"
+#include "DebugDrawManager.h"
+#include "PrefabRegistry.h"
+#include "PlatformTime.h"
 #include "SkeletalMeshComponent.h"
 #include "FAudioDevice.h"
 #include "ResourceManager.h"
@@ -39,9 +44,16 @@
 #include "Hash.h"
 #include"Character.h"
 #include "LuaBindHelpers.h"
+#include "CookedLevel.h"
+#include "WorldDuplication.h"
 
 IMPLEMENT_CLASS(UWorld)
 
+TDelegate<UWorld*, AActor*> UWorld::OnActorAdded;
+TDelegate<UWorld*, AActor*> UWorld::OnActorRemoved;
+TDelegate<UWorld*> UWorld::OnLevelChanged;
+TDelegate<UWorld*> UWorld::OnWorldDestroyed;
+
 UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based on world type
 {
 	SelectionMgr = std::make_unique<USelectionManager>();
@@ -50,6 +62,8 @@ UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based
 	LightManager = std::make_unique<FLightManager>();
 	LightManager->SetOwningWorld(this);  // Set owning world for optimization decisions
 	LuaManager = std::make_unique<FLuaManager>();
+	ProjectileSimulation = std::make_unique<FProjectileSimulation>();
+	ActorPool = std::make_unique<FActorPoolManager>(this);
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -65,6 +79,14 @@ UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based
 UWorld::~UWorld()
 {
 	bIsTearingDown = true;	// 월드 삭제 중에는 새로운 액터 생성을 방지하기 위해
+	OnWorldDestroyed.Broadcast(this);
+	FDebugDrawManager::GetInstance().RemoveWorld(this);
+
+	// 대기 중인 풀 액터 삭제 (레벨에 나가 있는 풀 액터는 아래에서 일반 액터와 함께 삭제)
+	if (ActorPool)
+	{
+		ActorPool->Clear();
+	}
 
 	if (Level)
 	{
@@ -78,10 +100,7 @@ UWorld::~UWorld()
 		}
 
 		TArray<AActor*> TempActors =  Level->GetActors();
-		for (AActor* Actor : TempActors)
-		{
-			DestroyActor(Actor);
-		}
+		DestroyActors(TempActors);
 		Level->Clear();
 	}
 
@@ -102,7 +121,7 @@ void UWorld::Initialize()
 	// Skip for preview worlds to save ~190 MB
 	if (!IsPreviewWorld())
 	{
-		Partition = std::make_unique<UWorldPartitionManager>();
+		InitializePartition();
 	}
 
 	// 기본 씬을 생성합니다.
@@ -113,6 +132,14 @@ void UWorld::Initialize()
 	InitializeGizmo();
 }
 
+void UWorld::InitializePartition()
+{
+	if (!Partition)
+	{
+		Partition = std::make_unique<UWorldPartitionManager>();
+	}
+}
+
 void UWorld::InitializeGrid()
 {
 	GridActor = NewObject<AGridActor>();
@@ -139,16 +166,25 @@ void UWorld::InitializeGizmo()
 bool UWorld::LoadLevelFromFile(const FWideString& Path)
 {
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-	JSON LevelJsonData;
 
-	if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, Path))
+	// 원본 JSON과 스키마가 그대로면 쿠킹된 바이너리에서 바로 로드
+	if (!FCookedLevel::Load(Path, NewLevel.get()))
 	{
+		FJsonDocument LevelDocument;
+		if (!FJsonSerializer::LoadJsonDocumentFromFile(LevelDocument, Path))
+		{
+			UE_LOG("[error] MainToolbar: Failed To Load Level From: %s", WideToUTF8(Path).c_str());
+			return false;
+		}
+
+		JSON LevelJsonData = LevelDocument.ToJSON();
 		NewLevel->Serialize(true, LevelJsonData);
-	}
-	else
-	{
-		UE_LOG("[error] MainToolbar: Failed To Load Level From: %s", WideToUTF8(Path).c_str());
-		return false;
+
+		// 다음 로드를 위해 쿠킹 (실패해도 JSON 경로는 그대로 동작)
+		if (FCookedLevel::bEnabled)
+		{
+			FCookedLevel::Cook(Path, LevelDocument);
+		}
 	}
 
 	SetLevel(std::move(NewLevel));
@@ -160,6 +196,8 @@ bool UWorld::LoadLevelFromFile(const FWideString& Path)
 // 함수 내부 코드 순서 유지 필요
 void UWorld::Tick(float DeltaSeconds)
 {
+	TIME_PROFILE(WorldTick)
+
 	// GameDelat: Unscaled * finalScale
 	float UnscaledDeltaSeconds = DeltaSeconds;
 
@@ -245,6 +283,12 @@ void UWorld::Tick(float DeltaSeconds)
 		}
     }
 
+	// 발사체는 컴포넌트 틱 대신 월드에서 한 번에 이동/충돌 처리
+	if (ProjectileSimulation)
+	{
+		ProjectileSimulation->Tick(this, GetDeltaTime(EDeltaTime::Game));
+	}
+
     for (AActor* EditorActor : EditorActors)
     {
 		if (EditorActor && !bPie)
@@ -274,39 +318,33 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	//ULevel* NewLevel = ULevelService::CreateNewLevel();
 	UWorld* PIEWorld = NewObject<UWorld>(); // 레벨도 새로 생성됨
 	PIEWorld->bPie = true;
+	// 게임 월드와 같이 파티션을 두어 라인 트레이스/데칼/충돌 broad phase가 PIE에서도 동작하게 한다
+	PIEWorld->InitializePartition();
 
 	FWorldContext PIEWorldContext = FWorldContext(PIEWorld, EWorldType::Game);
 	GEngine.AddWorldContext(PIEWorldContext);
 
 	const TArray<AActor*>& SourceActors = InEditorWorld->GetLevel()->GetActors();
-	for (AActor* SourceActor : SourceActors)
-	{
-		if (!SourceActor)
-		{
-			UE_LOG("Duplicate failed: SourceActor is nullptr");
-			continue;
-		}
-
-		AActor* NewActor = SourceActor->Duplicate();
+	TArray<AActor*> NewActors;
+	FWorldDuplicationStats Stats;
+	PIEWorld->DuplicateActorsFrom(SourceActors, NewActors, &Stats);
 
-		if (!NewActor)
-		{
-			UE_LOG("Duplicate failed: NewActor is nullptr");
-			continue;
-		}
-
-		// PlayerCameraManager 복사
-		if (InEditorWorld->PlayerCameraManager == SourceActor)
+	// PlayerCameraManager 복사 (NewActors는 SourceActors와 같은 순서)
+	for (int32 i = 0; i < SourceActors.Num(); ++i)
+	{
+		if (SourceActors[i] && SourceActors[i] == InEditorWorld->PlayerCameraManager)
 		{
-			if (APlayerCameraManager* NewPlayerCameraManager = Cast<APlayerCameraManager>(NewActor))
+			if (APlayerCameraManager* NewPlayerCameraManager = Cast<APlayerCameraManager>(NewActors[i]))
 			{
 				PIEWorld->PlayerCameraManager = NewPlayerCameraManager;
 			}
+			break;
 		}
-
-		PIEWorld->AddActorToLevel(NewActor);
 	}
 
+	UE_LOG("[World] PIE world duplicated: %d actors, %d components in %.2f ms (duplicate %.2f, attach %.2f, register %.2f, partition %.2f)",
+		Stats.NumActors, Stats.NumComponents, Stats.TotalMs, Stats.DuplicateMs, Stats.AttachMs, Stats.RegisterMs, Stats.PartitionMs);
+
 	PIEWorld->RenderSettings = InEditorWorld->RenderSettings;
 
 	// PlayerController 자동 생성 (GameMode 없이)
@@ -410,6 +448,8 @@ bool UWorld::DestroyActor(AActor* Actor)
 	// 레벨에서 제거 시도
 	if (Level && Level->RemoveActor(Actor))
 	{
+		OnActorRemoved.Broadcast(this, Actor);
+
 		// 메모리 해제
 		ObjectFactory::DeleteObject(Actor);
 		return true; // 성공적으로 삭제
@@ -418,6 +458,38 @@ bool UWorld::DestroyActor(AActor* Actor)
 	return false; // 레벨에 없는 액터
 }
 
+// 여러 액터 즉시 제거. 액터마다 RemoveActor(선형 탐색 + erase)를 부르면 O(N^2)이 되므로
+// 컴포넌트 정리 후 레벨 배열을 한 번만 훑어 제거한다.
+void UWorld::DestroyActors(const TArray<AActor*>& Actors)
+{
+	TSet<AActor*> KillSet;
+	KillSet.reserve(Actors.Num());
+	for (AActor* Actor : Actors)
+	{
+		if (!Actor || KillSet.Contains(Actor))
+			continue;
+
+		KillSet.Add(Actor);
+		if (SelectionMgr) SelectionMgr->DeselectActor(Actor);
+		Actor->DestroyAllComponents();
+	}
+
+	if (!Level || KillSet.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<AActor*> Removed;
+	Removed.Reserve(KillSet.Num());
+	Level->RemoveActors(KillSet, Removed);
+
+	for (AActor* Actor : Removed)
+	{
+		OnActorRemoved.Broadcast(this, Actor);
+		ObjectFactory::DeleteObject(Actor);
+	}
+}
+
 inline FString RemoveObjExtension(const FString& FileName)
 {
 	const FString Extension = ".obj";
@@ -486,9 +558,16 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
 {
     // Make UI/selection safe before destroying previous actors
     if (SelectionMgr) SelectionMgr->ClearSelection();
+    OnLevelChanged.Broadcast(this);
 
 	PlayerCameraManager = nullptr;
 
+	// 이전 레벨용 풀 정리 (나가 있던 풀 액터는 아래에서 레벨과 함께 삭제됨)
+	if (ActorPool)
+	{
+		ActorPool->Clear();
+	}
+
     // Cleanup current
     if (Level)
     {
@@ -540,6 +619,95 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
 		SelectionMgr->CleanupInvalidActors();
 }
 
+void UWorld::DuplicateActorsFrom(const TArray<AActor*>& SourceActors, TArray<AActor*>& OutNewActors, FWorldDuplicationStats* OutStats)
+{
+	FWorldDuplicationStats Stats;
+	OutNewActors.Empty();
+	if (!Level)
+	{
+		return;
+	}
+
+	// 1. 사전 할당: 결과/레벨 배열, 전역 오브젝트 배열, 원본 -> 사본 컴포넌트 테이블
+	int32 NumSourceComponents = 0;
+	for (AActor* SourceActor : SourceActors)
+	{
+		if (SourceActor)
+		{
+			NumSourceComponents += static_cast<int32>(SourceActor->GetOwnedComponents().size());
+		}
+	}
+	OutNewActors.Reserve(SourceActors.Num());
+	Level->ReserveActors(Level->GetActors().Num() + SourceActors.Num());
+	GUObjectArray.Reserve(GUObjectArray.Num() + SourceActors.Num() + NumSourceComponents);
+
+	const uint64 Start = FPlatformTime::Cycles64();
+	uint64 StepStart = Start;
+	auto EndStep = [&StepStart](double& OutMs)
+	{
+		const uint64 Now = FPlatformTime::Cycles64();
+		OutMs = FPlatformTime::ToMilliseconds(Now - StepStart);
+		StepStart = Now;
+	};
+
+	// 2. 복제: 컴포넌트는 전역 테이블에 기록되고 부모 재연결은 모든 액터 복제 후 한 번에
+	{
+		FWorldDuplicationContext Context(NumSourceComponents);
+		for (AActor* SourceActor : SourceActors)
+		{
+			AActor* NewActor = SourceActor ? SourceActor->Duplicate() : nullptr;
+			if (!NewActor)
+			{
+				UE_LOG("Duplicate failed: %s", SourceActor ? "NewActor is nullptr" : "SourceActor is nullptr");
+			}
+			OutNewActors.Add(NewActor);
+		}
+		Stats.NumComponents = Context.GetNumComponents();
+		EndStep(Stats.DuplicateMs);
+
+		Context.ResolveAttachments();
+		EndStep(Stats.AttachMs);
+	}
+
+	// 3. 레벨 추가 + 컴포넌트 등록. 파티션 등록은 막아두었다가 BulkRegister로 한 번에 (BVH 1회 구축)
+	if (Partition)
+	{
+		Partition->SetDeferRegistration(true);
+	}
+	for (AActor* NewActor : OutNewActors)
+	{
+		if (NewActor)
+		{
+			Level->AddActor(NewActor);
+			NewActor->SetWorld(this);
+			NewActor->RegisterAllComponents(this);
+			++Stats.NumActors;
+		}
+	}
+	EndStep(Stats.RegisterMs);
+
+	if (Partition)
+	{
+		Partition->SetDeferRegistration(false);
+		Partition->BulkRegister(OutNewActors);
+	}
+	EndStep(Stats.PartitionMs);
+
+	for (AActor* NewActor : OutNewActors)
+	{
+		if (NewActor)
+		{
+			OnActorAdded.Broadcast(this, NewActor);
+		}
+	}
+	Stats.TotalMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+}
+
 void UWorld::AddActorToLevel(AActor* Actor)
 {
 	if (Level)
@@ -549,6 +717,8 @@ void UWorld::AddActorToLevel(AActor* Actor)
 		Actor->SetWorld(this);
 
 		Actor->RegisterAllComponents(this);
+
+		OnActorAdded.Broadcast(this, Actor);
 	}
 }
 
@@ -571,17 +741,23 @@ void UWorld::ProcessPendingKillActors()
 	// 3. 원본 목록은 즉시 비워 다음 프레임을 준비합니다.
 	PendingKillActors.Empty();
 
-	// 4. '사본'을 순회하며 실제 파괴를 수행합니다.
-	for (AActor* Actor : ActorsToKill)
+	// 풀 액터는 삭제하지 않고 풀로 회수 (EndPlay/등록 해제/레벨 제거까지 풀에서 처리)
+	if (ActorPool)
 	{
-		// 게임 수명 종료
-		if (bPie)
+		ActorPool->ReclaimPendingKillActors(ActorsToKill);
+	}
+
+	// 4. '사본'을 순회하며 게임 수명을 종료합니다.
+	if (bPie)
+	{
+		for (AActor* Actor : ActorsToKill)
 		{
 			Actor->EndPlay();
 		}
-
-		DestroyActor(Actor);
 	}
+
+	// 5. 실제 파괴는 한 번에 수행합니다. (대량 파괴 시 레벨 배열을 액터마다 훑지 않도록)
+	DestroyActors(ActorsToKill);
 }
 
 AActor* UWorld::SpawnActor(UClass* Class)
@@ -647,7 +823,8 @@ AActor* UWorld::SpawnActor(UClass* Class, const FTransform& Transform)
 		return nullptr;
 	}
 
-	// ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
+	// ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성 (생성자에서 만드는 컴포넌트 포함 World 태그로 집계)
+	MEM_SCOPE(World);
 	AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(Class));
 	if (!NewActor)
 	{
@@ -677,55 +854,30 @@ AActor* UWorld::SpawnPrefabActor(const FWideString& PrefabPath)
 		return nullptr;
 	}
 
-	JSON ActorDataJson;
-
-	if (FJsonSerializer::LoadJsonFromFile(ActorDataJson, PrefabPath))
+	// 파일 로드/파싱/클래스 조회/역직렬화는 프리팹마다 한 번만 하고 이후에는 템플릿을 복제한다
+	FPrefabRegistry& Registry = FPrefabRegistry::GetInstance();
+	const FPrefabTemplate* Template = Registry.FindOrLoad(PrefabPath);
+	if (!Template)
 	{
-		// Pair.first는 ID 문자열, Pair.second는 단일 프리미티브의 JSON 데이터입니다.
-
-		FString TypeString;
-		if (FJsonSerializer::ReadString(ActorDataJson, "Type", TypeString))
-		{
-			//UClass* NewClass = FActorTypeMapper::TypeToActor(TypeString);
-			UClass* NewClass = UClass::FindClass(TypeString);
-
-			UWorld* World = GWorld;
-
-			// 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
-			if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
-			{
-				UE_LOG("[error] SpawnActor failed: Invalid class provided.");
-				return nullptr;
-			}
-
-			// ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
-			AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
-			if (!NewActor)
-			{
-				UE_LOG("[error] SpawnActor failed: ObjectFactory could not create an instance of");
-				return nullptr;
-			}
-
-			// 데이터 불러오기
-			NewActor->Serialize(true, ActorDataJson);
+		return nullptr;
+	}
 
-			// 현재 레벨에 액터 등록
-			AddActorToLevel(NewActor);
+	AActor* NewActor = Registry.Instantiate(*Template);
+	if (!NewActor)
+	{
+		UE_LOG("[error] SpawnActor failed: ObjectFactory could not create an instance of");
+		return nullptr;
+	}
 
-			if (this->bPie)
-			{
-				NewActor->BeginPlay();
-			}
+	// 현재 레벨에 액터 등록
+	AddActorToLevel(NewActor);
 
-			return NewActor;
-		}
-	}
-	else
+	if (this->bPie)
 	{
-		UE_LOG("[error] 존재하지 않는 Prefab 경로입니다. - %s", WideToUTF8(PrefabPath).c_str());
+		NewActor->BeginPlay();
 	}
 
-	return nullptr;
+	return NewActor;
 }
 
 bool UWorld::TryMarkOverlapPair(const AActor* Actor, const AActor* B)
@@ -754,6 +906,31 @@ bool UWorld::TryMarkOverlapPair(const AActor* Actor, const AActor* B)
 	return true;
 }
 
+bool UWorld::LineTraceSingle(FHitResult& OutHit, const FVector& Start, const FVector& End, const FCollisionQueryParams& Params) const
+{
+	return WorldCollision::LineTraceSingle(Partition ? Partition->GetBVH() : nullptr, OutHit, Start, End, Params);
+}
+
+int32 UWorld::LineTraceMulti(TArray<FHitResult>& OutHits, const FVector& Start, const FVector& End, const FCollisionQueryParams& Params) const
+{
+	return WorldCollision::LineTraceMulti(Partition ? Partition->GetBVH() : nullptr, OutHits, Start, End, Params);
+}
+
+void UWorld::LineTraceBatch(const TArray<FLineTraceRequest>& Requests, TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params) const
+{
+	WorldCollision::LineTraceBatch(Partition ? Partition->GetBVH() : nullptr, Requests, OutHits, Params);
+}
+
+bool UWorld::SweepSphereSingle(FHitResult& OutHit, const FVector& Start, const FVector& End, float Radius, const FCollisionQueryParams& Params) const
+{
+	return WorldCollision::SweepSphereSingle(Partition ? Partition->GetBVH() : nullptr, OutHit, Start, End, Radius, Params);
+}
+
+bool UWorld::SweepBoxSingle(FHitResult& OutHit, const FVector& Start, const FVector& End, const FVector& HalfExtent, const FCollisionQueryParams& Params) const
+{
+	return WorldCollision::SweepBoxSingle(Partition ? Partition->GetBVH() : nullptr, OutHit, Start, End, HalfExtent, Params);
+}
+
 // XXX(KHJ): 지금은 굳이 필요하지 않음. AnimNotify 용도로 생성했으나 추후 간단하게 수정해서 쓸 수 있다고 보고 놔두기로 함
 void UWorld::RegisterAnimNotifyHandler(USkeletalMeshComponent* SkeletalMeshComp, AActor* OwnerActor)
 {
@@ -5,6 +5,8 @@
 #include "Level.h"
 #include "Gizmo/GizmoActor.h"
 #include "LightManager.h"
+#include "Delegates.h"
+#include "WorldCollision.h"
 
 // Forward Declarations
 class UResourceManager;
@@ -26,9 +28,12 @@ class AStaticMeshActor;
 class BVHierachy;
 class UStaticMesh;
 class FOcclusionCullingManagerCPU;
+class FProjectileSimulation;
+class FActorPoolManager;
 class APlayerCameraManager;
 
 struct FTransform;
+struct FWorldDuplicationStats;
 struct FSceneCompData;
 struct Frustum;
 struct FCandidateDrawable;
@@ -85,6 +90,7 @@ public:
 
     void AddPendingKillActor(AActor* Actor);
     void ProcessPendingKillActors();
+    bool IsTearingDown() const { return bIsTearingDown; }
 
     void CreateLevel();
 
@@ -95,6 +101,8 @@ public:
     ULevel* GetLevel() const { return Level.get(); }
     FLightManager* GetLightManager() const { return LightManager.get(); }
     FLuaManager* GetLuaManager() const { return LuaManager.get(); }
+    FProjectileSimulation* GetProjectileSimulation() const { return ProjectileSimulation.get(); }
+    FActorPoolManager* GetActorPool() const { return ActorPool.get(); }
 
     ACameraActor* GetEditorCameraActor() { return MainEditorCameraActor; }
     void SetEditorCameraActor(ACameraActor* InCamera);
@@ -121,6 +129,13 @@ public:
     UFUNCTION(LuaBind)
     void PlaySound3D(const FString& SoundPath, const FVector& Location, float Volume = 1.0f);
 
+    /** === 라인 트레이스 / 스윕 (파티션 BVH 기반, WorldCollision 참고) === */
+    bool LineTraceSingle(FHitResult& OutHit, const FVector& Start, const FVector& End, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+    int32 LineTraceMulti(TArray<FHitResult>& OutHits, const FVector& Start, const FVector& End, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+    void LineTraceBatch(const TArray<FLineTraceRequest>& Requests, TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+    bool SweepSphereSingle(FHitResult& OutHit, const FVector& Start, const FVector& End, float Radius, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+    bool SweepBoxSingle(FHitResult& OutHit, const FVector& Start, const FVector& End, const FVector& HalfExtent, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+
     /** === 타임 / 틱 === */
     virtual void Tick(float DeltaSeconds);
     // Overlap pair de-duplication (per-frame)
@@ -128,15 +143,26 @@ public:
 
     TMap<TWeakObjectPtr<AActor>, FActorTimeState> ActorTimingMap;
 
+    /** === 액터 추가/제거 이벤트 (모든 월드 공용, 에디터 아웃라이너 등의 증분 갱신용) === */
+    static DECLARE_DELEGATE_TwoParam(OnActorAdded, UWorld*, AActor*);      // AddActorToLevel 직후
+    static DECLARE_DELEGATE_TwoParam(OnActorRemoved, UWorld*, AActor*);    // 레벨에서 빠진 직후, 메모리 해제 전
+    static DECLARE_DELEGATE_OneParam(OnLevelChanged, UWorld*);             // SetLevel로 기존 액터가 통째로 삭제되기 직전
+    static DECLARE_DELEGATE_OneParam(OnWorldDestroyed, UWorld*);           // 월드 소멸 시작
+
     /** === 필요한 엑터 게터 === */
     const TArray<AActor*>& GetActors() { static TArray<AActor*> Empty; return Level ? Level->GetActors() : Empty; }
     const TArray<AActor*>& GetEditorActors() { return EditorActors; }
     AGizmoActor* GetGizmoActor() { return GizmoActor; }
     AGridActor* GetGridActor() { return GridActor; }
     UWorldPartitionManager* GetPartitionManager() { return Partition.get(); }
+    // Initialize 없이 만든 월드(PIE 등)에 파티션 생성
+    void InitializePartition();
 
     // PIE용 World 생성
     static UWorld* DuplicateWorldForPIE(UWorld* InEditorWorld);
+    // 다른 월드의 액터들을 한 번에 복제해 이 월드 레벨에 추가 (전역 매핑 테이블, 컴포넌트 등록 지연, 파티션 일괄 등록).
+    // OutNewActors는 SourceActors와 같은 순서 (복제 실패 시 nullptr)
+    void DuplicateActorsFrom(const TArray<AActor*>& SourceActors, TArray<AActor*>& OutNewActors, FWorldDuplicationStats* OutStats = nullptr);
 
     /** Timing Function */
     float GetDeltaTime(EDeltaTime type);
@@ -148,6 +174,7 @@ public:
 	void SetTimeDilation(float NewDilation) { TimeDilation = NewDilation; }
 private:
     bool DestroyActor(AActor* Actor);   // 즉시 삭제
+    void DestroyActors(const TArray<AActor*>& Actors);   // 일괄 즉시 삭제 (레벨 배열을 한 번만 훑음)
 
 private:
     /** === 에디터 특수 액터 관리 === */
@@ -166,6 +193,12 @@ private:
 
     /** === 루아 매니저 ===*/
     std::unique_ptr<FLuaManager> LuaManager;
+
+    /** === 발사체 일괄 시뮬레이션 ===*/
+    std::unique_ptr<FProjectileSimulation> ProjectileSimulation;
+
+    /** === 액터 풀 (Destroy된 풀 액터는 삭제 대신 회수) ===*/
+    std::unique_ptr<FActorPoolManager> ActorPool;
     
     // Object naming system
     TMap<FString, int32> ObjectTypeCounts;
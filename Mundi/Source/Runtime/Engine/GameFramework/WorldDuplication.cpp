@@ -0,0 +1,146 @@
+﻿#include "pch.h"
+#include "WorldDuplication.h"
+#include "World.h"
+#include "Level.h"
+#include "Actor.h"
+#include "SceneComponent.h"
+#include "StaticMeshActor.h"
+#include "StaticMeshComponent.h"
+#include "PlatformTime.h"
+
+FWorldDuplicationContext* FWorldDuplicationContext::Active = nullptr;
+
+FWorldDuplicationContext::FWorldDuplicationContext(int32 ExpectedComponents)
+	: PreviousActive(Active)
+{
+	ComponentRemap.reserve(ExpectedComponents);
+	PendingAttachments.Reserve(ExpectedComponents);
+	Active = this;
+}
+
+FWorldDuplicationContext::~FWorldDuplicationContext()
+{
+	Active = PreviousActive;
+}
+
+void FWorldDuplicationContext::AddComponent(UActorComponent* Original, UActorComponent* Duplicated)
+{
+	ComponentRemap.Add(Original, Duplicated);
+}
+
+UActorComponent* FWorldDuplicationContext::FindDuplicate(UActorComponent* Original) const
+{
+	return ComponentRemap.FindRef(Original);
+}
+
+void FWorldDuplicationContext::AddPendingAttachment(USceneComponent* Duplicated, USceneComponent* OriginalParent)
+{
+	PendingAttachments.Add(TPair<USceneComponent*, USceneComponent*>(Duplicated, OriginalParent));
+}
+
+void FWorldDuplicationContext::ResolveAttachments()
+{
+	for (const TPair<USceneComponent*, USceneComponent*>& Pending : PendingAttachments)
+	{
+		// 원본 부모가 복제 대상이 아니었으면(에디터 전용 컴포넌트 등) 기존과 같이 떼어진 채로 둔다
+		if (USceneComponent* NewParent = Cast<USceneComponent>(FindDuplicate(Pending.second)))
+		{
+			Pending.first->SetupAttachment(NewParent, EAttachmentRule::KeepRelative);
+		}
+	}
+	PendingAttachments.Empty();
+}
+
+namespace
+{
+	// 부모가 있는 씬 컴포넌트 수와 루트 위치 합 (복제 결과 비교용)
+	void GatherHierarchySignature(const TArray<AActor*>& Actors, int32& OutAttachedCount, FVector& OutRootLocationSum)
+	{
+		OutAttachedCount = 0;
+		OutRootLocationSum = FVector(0.0f, 0.0f, 0.0f);
+		for (AActor* Actor : Actors)
+		{
+			if (!Actor)
+			{
+				continue;
+			}
+			for (USceneComponent* SceneComp : Actor->GetSceneComponents())
+			{
+				if (SceneComp && SceneComp->GetAttachParent())
+				{
+					++OutAttachedCount;
+				}
+			}
+			OutRootLocationSum += Actor->GetActorLocation();
+		}
+	}
+}
+
+FWorldDuplicationBenchmarkResult RunWorldDuplicationBenchmark(int32 NumActors)
+{
+	FWorldDuplicationBenchmarkResult Result;
+	if (NumActors <= 0)
+	{
+		return Result;
+	}
+	Result.NumActors = NumActors;
+
+	// 1. 원본 월드: 격자 배치 큐브 액터, 4개 중 1개는 자식 메시 컴포넌트를 하나 더 가진다
+	const FString MeshPath = GDataDir + "/Model/Cube.obj";
+	const int32 GridWidth = std::max(1, static_cast<int32>(std::ceil(std::sqrt(static_cast<float>(NumActors)))));
+
+	UWorld* SourceWorld = NewObject<UWorld>();
+	uint64 Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < NumActors; ++i)
+	{
+		AStaticMeshActor* Actor = SourceWorld->SpawnActor<AStaticMeshActor>();
+		if (!Actor)
+		{
+			break;
+		}
+		Actor->GetStaticMeshComponent()->SetStaticMesh(MeshPath);
+		Actor->SetActorLocation(FVector((i % GridWidth) * 2.0f, (i / GridWidth) * 2.0f, 0.0f));
+
+		if ((i & 3) == 0)
+		{
+			if (UStaticMeshComponent* Child = Cast<UStaticMeshComponent>(Actor->AddNewComponent(UStaticMeshComponent::StaticClass())))
+			{
+				Child->SetStaticMesh(MeshPath);
+				Child->SetRelativeLocation(FVector(0.0f, 0.0f, 1.0f));
+			}
+		}
+	}
+	Result.BuildSourceMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	const TArray<AActor*>& SourceActors = SourceWorld->GetActors();
+
+	// 2. 기존 PIE 경로: 액터마다 Duplicate (액터별 TMap/TSet) + AddActorToLevel (파티션 없는 월드)
+	UWorld* PerActorWorld = NewObject<UWorld>();
+	Start = FPlatformTime::Cycles64();
+	for (AActor* SourceActor : SourceActors)
+	{
+		if (AActor* NewActor = SourceActor->Duplicate())
+		{
+			PerActorWorld->AddActorToLevel(NewActor);
+		}
+	}
+	Result.PerActorMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	ObjectFactory::DeleteObject(PerActorWorld);
+
+	// 3. 일괄 복제 (파티션 BVH 구축 포함)
+	UWorld* BulkWorld = NewObject<UWorld>();
+	BulkWorld->InitializePartition();
+	TArray<AActor*> NewActors;
+	BulkWorld->DuplicateActorsFrom(SourceActors, NewActors, &Result.Bulk);
+
+	int32 SourceAttached = 0, BulkAttached = 0;
+	FVector SourceLocationSum, BulkLocationSum;
+	GatherHierarchySignature(SourceActors, SourceAttached, SourceLocationSum);
+	GatherHierarchySignature(NewActors, BulkAttached, BulkLocationSum);
+	Result.bHierarchyMatches = NewActors.Num() == SourceActors.Num() && SourceAttached == BulkAttached &&
+		(SourceLocationSum - BulkLocationSum).SizeSquared() < KINDA_SMALL_NUMBER;
+
+	ObjectFactory::DeleteObject(BulkWorld);
+	ObjectFactory::DeleteObject(SourceWorld);
+	return Result;
+}
@@ -0,0 +1,66 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class UActorComponent;
+class USceneComponent;
+
+// UWorld::DuplicateActorsFrom 단계별 소요 시간
+struct FWorldDuplicationStats
+{
+	int32 NumActors = 0;
+	int32 NumComponents = 0;
+	double DuplicateMs = 0.0;		// 액터/컴포넌트 복제 (전역 매핑 기록)
+	double AttachMs = 0.0;			// 부모-자식 재연결
+	double RegisterMs = 0.0;		// 레벨 추가 + 컴포넌트 등록 (파티션 등록 제외)
+	double PartitionMs = 0.0;		// BulkRegister (BVH 한 번에 구축)
+	double TotalMs = 0.0;
+};
+
+/**
+ * @brief 월드 단위 일괄 복제 컨텍스트
+ * - 스코프 동안 활성화되며, AActor::DuplicateSubObjects는 액터마다 TMap/TSet을 만드는 대신
+ *   미리 크기를 잡아둔 전역 원본 -> 사본 테이블에 기록한다.
+ * - 부모 재연결은 모든 액터 복제가 끝난 뒤 ResolveAttachments에서 한 번에 수행하므로
+ *   다른 액터의 컴포넌트에 붙어 있던 관계(액터 간 부착)도 사본끼리 그대로 복원된다.
+ * - 메인 스레드 전용.
+ */
+class FWorldDuplicationContext
+{
+public:
+	explicit FWorldDuplicationContext(int32 ExpectedComponents);
+	~FWorldDuplicationContext();
+
+	FWorldDuplicationContext(const FWorldDuplicationContext&) = delete;
+	FWorldDuplicationContext& operator=(const FWorldDuplicationContext&) = delete;
+
+	static FWorldDuplicationContext* GetActive() { return Active; }
+
+	void AddComponent(UActorComponent* Original, UActorComponent* Duplicated);
+	UActorComponent* FindDuplicate(UActorComponent* Original) const;
+
+	// Duplicated를 OriginalParent의 사본에 붙이도록 예약
+	void AddPendingAttachment(USceneComponent* Duplicated, USceneComponent* OriginalParent);
+	void ResolveAttachments();
+
+	int32 GetNumComponents() const { return ComponentRemap.Num(); }
+
+private:
+	static FWorldDuplicationContext* Active;
+	FWorldDuplicationContext* PreviousActive = nullptr;
+
+	TMap<UActorComponent*, UActorComponent*> ComponentRemap;
+	TArray<TPair<USceneComponent*, USceneComponent*>> PendingAttachments;	// (사본, 원본 부모)
+};
+
+// NumActors개 스태틱 메시 액터 월드를 만들어 복제 비용을 비교한다:
+// 액터별 Duplicate + AddActorToLevel(기존 PIE 경로) vs UWorld::DuplicateActorsFrom 일괄 복제
+struct FWorldDuplicationBenchmarkResult
+{
+	int32 NumActors = 0;
+	double BuildSourceMs = 0.0;
+	double PerActorMs = 0.0;
+	FWorldDuplicationStats Bulk;
+	bool bHierarchyMatches = false;	// 일괄 복제 결과의 액터 수/부착 관계가 원본과 같은지
+};
+
+FWorldDuplicationBenchmarkResult RunWorldDuplicationBenchmark(int32 NumActors);
@@ -59,17 +59,19 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 	TArray<UPrimitiveComponent*> StaticMeshComponents;
 	StaticMeshComponents.Reserve(Actors.size());
 
+	const TArray<AActor*>& EditorActors = GWorld->GetEditorActors();
 	for (AActor* Actor : Actors)
 	{
-		TArray<AActor*> EditorActors = GWorld->GetEditorActors();
+		if (!Actor) continue;
 		auto it = std::find(EditorActors.begin(), EditorActors.end(), Actor);
 		if (it != EditorActors.end())
 			continue; // 에디터 액터는 포함하지 않는다.
 
-		const TArray<USceneComponent*> Components = Actor->GetSceneComponents();
+		const TArray<USceneComponent*>& Components = Actor->GetSceneComponents();
 		for (USceneComponent* Component : Components)
 		{
-			if (UPrimitiveComponent* Smc = Cast<UPrimitiveComponent>(Component))
+			UPrimitiveComponent* Smc = Cast<UPrimitiveComponent>(Component);
+			if (Smc && Smc->IsEditable()) // Register(MarkDirty)와 같은 기준
 			{
 				StaticMeshComponents.push_back(Smc);
 				ComponentDirtySet.erase(Smc);
@@ -114,7 +116,7 @@ void UWorldPartitionManager::MarkDirty(AActor* Actor)
 // (신규 등록에도 사용할 수 있지만 코드 가독성을 위해 Register API 사용 권장)
 void UWorldPartitionManager::MarkDirty(UPrimitiveComponent* Smc)
 {
-	if (!Smc) return;
+	if (!Smc || bDeferRegistration) return; // 지연 중에는 BulkRegister가 한 번에 반영
 	AActor* Owner = Smc->GetOwner();
 	if (!Owner) return;
 
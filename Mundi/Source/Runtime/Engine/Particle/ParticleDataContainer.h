@@ -1,5 +1,6 @@
 #pragma once
 #include "pch.h"
+#include "MemoryManager.h"
 /**
  * Container for particle data arrays
  * Manages memory allocation for particle data and indices
@@ -70,7 +71,11 @@ struct FParticleDataContainer
 		MemBlockSize = ParticleDataNumBytes + IndicesBytes;
 
 		// Allocate single block for both particle data and indices
-		ParticleData = new uint8[MemBlockSize];
+		// FMemoryManager 경유로 Particle 태그에 집계 (16바이트 정렬이라 SIMD 접근에도 안전)
+		{
+			MEM_SCOPE(Particle);
+			ParticleData = static_cast<uint8*>(FMemoryManager::Allocate(MemBlockSize, 16));
+		}
 		memset(ParticleData, 0, MemBlockSize); // 메모리 잡자마자 0으로 초기화
 
 		// ParticleIndices points to the end of ParticleData
@@ -89,7 +94,7 @@ struct FParticleDataContainer
 	{
 		if (ParticleData)
 		{
-			delete[] ParticleData;
+			FMemoryManager::Deallocate(ParticleData);
 			ParticleData = nullptr;
 			ParticleIndices = nullptr; // Don't delete separtely - same memory block
 		}
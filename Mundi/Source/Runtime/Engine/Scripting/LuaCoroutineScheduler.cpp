@@ -1,31 +1,49 @@
 ﻿#include "pch.h"
 #include "LuaCoroutineScheduler.h"
+#include <algorithm>
 
 void FLuaCoroutineScheduler::ShutdownBeforeLuaClose()
 {
 	for (auto& Task : Tasks)
 	{
-		if (Task.Co.valid())
+		if (!Task.Finished && Task.Co.valid())
 		{
 			Task.Co.abandon(); // Lua쪽 Coroutine 무력화 필수
 		}
 	}
 	Tasks.Empty(); 
+	FreeSlots.Empty();
+	TimerHeap.Empty();
+	ReadyTasks.Empty();
+	PredicateTasks.Empty();
+	PredicateScratch.Empty();
+	EventWaiters.Empty();
+	DueTasks.Empty();
+	StaleTimerCount = 0;
 }
 
 FLuaCoroutineScheduler::FLuaCoroutineScheduler()
 {
 	Tasks.Reserve(100);
+	TimerHeap.Reserve(100);
 }
 
 FLuaCoroHandle FLuaCoroutineScheduler::Register(sol::thread&& Thread, sol::coroutine&& Co, void* Owner)
 {
-	FCoroTask Task;
+	if (++NextId == 0)
+	{
+		++NextId; // 0은 무효 핸들
+	}
+
+	const int32 Slot = AllocateSlot();
+	FCoroTask& Task = Tasks[Slot];
 	Task.Thread = std::move(Thread); /* Thread Anchoring */
 	Task.Co     = std::move(Co);
 	Task.Owner  = Owner;
-	Task.Id     = ++NextId;
-	Tasks.push_back(std::move(Task));
+	Task.Id     = NextId;
+
+	// 첫 resume은 다음 Process에서 (Process 도중 등록되어도 순회 중인 목록은 건드리지 않음)
+	ReadyTasks.Add(FTaskRef{ Slot, Task.Id });
 	
 	return FLuaCoroHandle{ Task.Id };
 }
@@ -38,113 +56,304 @@ void FLuaCoroutineScheduler::Tick(double DeltaTime)
 
 	Process(NowSeconds);
 }
+
 void FLuaCoroutineScheduler::Process(double Now)
 {
-	for (auto& task : Tasks)
+	DueTasks.Empty();
+
+	// 1. 시간 대기: 힙 top만 확인하므로 깨어날 태스크 수에만 비례
+	while (TimerHeap.Num() > 0 && TimerHeap[0].WakeTime <= Now)
+	{
+		std::pop_heap(TimerHeap.begin(), TimerHeap.end());
+		const FTimerEntry Entry = TimerHeap.Pop();
+
+		if (IsAlive(Entry.Ref.Slot, Entry.Ref.Id) && Tasks[Entry.Ref.Slot].WaitType == EWaitType::Time)
+		{
+			DueTasks.Add(Entry.Ref);
+		}
+		else if (StaleTimerCount > 0)
+		{
+			--StaleTimerCount;
+		}
+	}
+
+	// 2. 대기 조건 없이 yield한 태스크 / 새로 등록된 태스크
+	for (const FTaskRef& Ref : ReadyTasks)
 	{
-		if (task.Finished)
+		if (IsAlive(Ref.Slot, Ref.Id))
+		{
+			DueTasks.Add(Ref);
+		}
+	}
+	ReadyTasks.Empty();
+
+	// 3. 조건 대기: 조건 함수는 매 프레임 평가해야 하므로 이 목록만 순회
+	//    (평가 중 다른 태스크가 조건 대기로 들어올 수 있어 스크래치 버퍼와 교체 후 순회)
+	std::swap(PredicateTasks, PredicateScratch);
+	for (const FTaskRef& Ref : PredicateScratch)
+	{
+		if (!IsAlive(Ref.Slot, Ref.Id) || Tasks[Ref.Slot].WaitType != EWaitType::Predicate)
+		{
 			continue;
+		}
 
-		// 조건 충족 여부
-		switch (task.WaitType)
+		sol::protected_function Predicate = Tasks[Ref.Slot].Predicate;
+		sol::protected_function_result Result = Predicate();
+		const bool bSatisfied = Result.valid() && Result.get<bool>();
+
+		if (!IsAlive(Ref.Slot, Ref.Id))
 		{
-		case EWaitType::Time:
-			// UE_LOG("Now=%.3f Wake=%.3f", TotalTime, task.WakeTime);
-			if (task.WakeTime > Now) continue;
-			break;
-		case EWaitType::Predicate:
-			// 람다 함수가 있지만, 조건이 달성 안 됐을 때
-			if (task.Predicate && !task.Predicate()) continue; 
-			break;
-			// case EWaitType::Event: // Event "Trigger"는 Tick 함수 내에서 조건 확인하지 않음
+			continue; // 조건 평가 도중 취소됨
 		}
 
-		// 조건 충족 시 resume 실행
-		sol::protected_function_result Result = task.Co();
+		if (bSatisfied)
+		{
+			DueTasks.Add(Ref);
+		}
+		else
+		{
+			PredicateTasks.Add(Ref);
+		}
+	}
+	PredicateScratch.Empty();
+
+	// 4. 조건 충족 시 resume 실행
+	for (int32 i = 0; i < DueTasks.Num(); ++i)
+	{
+		const FTaskRef Ref = DueTasks[i];
+		if (IsAlive(Ref.Slot, Ref.Id))
+		{
+			Resume(Ref.Slot, Ref.Id);
+		}
+	}
+	DueTasks.Empty();
+
+	CompactTimerHeapIfNeeded();
+}
+
+void FLuaCoroutineScheduler::Resume(int32 Slot, uint32 Id)
+{
+	// resume 도중 Register로 Tasks가 재할당되거나 CancelByOwner로 슬롯이 해제될 수 있으므로
+	// 참조를 지역 변수로 붙잡아 두고, 이후에는 슬롯을 다시 조회한다
+	sol::thread Thread = Tasks[Slot].Thread;
+	sol::coroutine Co = Tasks[Slot].Co;
+	Tasks[Slot].WaitType = EWaitType::None;
+	Tasks[Slot].Predicate = sol::protected_function();
+
+	bool bFinished = true;
+	EWaitType NextWait = EWaitType::None;
+	double WaitSeconds = 0.0;
+	sol::protected_function NextPredicate;
+	FString NextEvent;
+
+	{
+		sol::protected_function_result Result = Co();
 		if (!Result.valid())
 		{
 			sol::error Err = Result;
 			UE_LOG("[Lua][error] Coroutine error: %s\n", Err.what());
-			task.Finished = true;
-			continue;
 		}
-		
 		// 이후 yield가 다시 올 경우, 다음 조건 실행 = 재세팅
-		if (Result.status() == sol::call_status::yielded)
+		else if (Result.status() == sol::call_status::yielded)
 		{
-			std::string Tag = Result.get<FString>(0); // 해당 Co의 첫번째 string 매개변수
-			if (Tag == "wait_time")
+			bFinished = false;
+			NextWait = ParseWaitType(Result.get<sol::object>(0)); // 해당 Co의 첫번째 매개변수 (태그)
+			switch (NextWait)
 			{
-				double Sec = Result.get<double>(1);
-				task.WaitType = EWaitType::Time;
-				task.WakeTime = Now + Sec;
-			}
-			else if (Tag == "wait_predicate")
-			{
-				sol::function Condition = Result.get<sol::function>(1); 
-				task.WaitType = EWaitType::Predicate;
-				task.Predicate = [Condition]()
-				{
-					sol::protected_function_result Result = Condition();
-					if (!Result.valid()) return false; 
-					return Result.get<bool>();
-				};
-			}
-			else if (Tag == "wait_event")
-			{
-				task.WaitType = EWaitType::Event;
-				task.EventName = Result.get<FString>(1);
-			}
-			else
-			{
-				task.WaitType = EWaitType::None;
+			case EWaitType::Time:
+				WaitSeconds = Result.get<sol::optional<double>>(1).value_or(0.0);
+				break;
+			case EWaitType::Predicate:
+				NextPredicate = Result.get<sol::protected_function>(1);
+				break;
+			case EWaitType::Event:
+				NextEvent = Result.get<sol::optional<FString>>(1).value_or(FString());
+				break;
+			default:
+				break;
 			}
 		}
-		else if (Result.status() == sol::call_status::runtime)
-		{
-			task.Finished = true;
-		}
-		else if (Result.status() == sol::call_status::ok)
+		// ok / runtime / file / memory 등 나머지 상태는 모두 종료
+	}
+
+	if (!IsAlive(Slot, Id))
+	{
+		return; // resume 도중 취소됨
+	}
+
+	if (bFinished)
+	{
+		ReleaseSlot(Slot);
+		return;
+	}
+
+	FCoroTask& Task = Tasks[Slot];
+	Task.WaitType = NextWait;
+	Task.WakeTime = NowSeconds + WaitSeconds;
+	Task.Predicate = std::move(NextPredicate);
+	Task.EventName = std::move(NextEvent);
+	Schedule(Slot);
+}
+
+void FLuaCoroutineScheduler::Schedule(int32 Slot)
+{
+	FCoroTask& Task = Tasks[Slot];
+	const FTaskRef Ref{ Slot, Task.Id };
+
+	switch (Task.WaitType)
+	{
+	case EWaitType::Time:
+		PushTimer(Task.WakeTime, Ref);
+		break;
+	case EWaitType::Predicate:
+		if (Task.Predicate.valid())
 		{
-			task.Finished = true;
+			PredicateTasks.Add(Ref);
 		}
-		else if (Result.status() == sol::call_status::file)
+		else
 		{
-			task.Finished = true;
+			Task.WaitType = EWaitType::None;
+			ReadyTasks.Add(Ref);
 		}
-		else if (Result.status() == sol::call_status::memory)
+		break;
+	case EWaitType::Event:
+		// Event "Trigger"는 Process에서 조건 확인하지 않고 TriggerEvent에서만 깨운다
+		EventWaiters[Task.EventName].Add(Ref);
+		break;
+	default:
+		ReadyTasks.Add(Ref);
+		break;
+	}
+}
+
+EWaitType FLuaCoroutineScheduler::ParseWaitType(const sol::object& Tag)
+{
+	switch (Tag.get_type())
+	{
+	case sol::type::number:
+	{
+		// EWait.Time 등 enum 값
+		const int32 Value = Tag.as<int32>();
+		if (Value > static_cast<int32>(EWaitType::None) && Value <= static_cast<int32>(EWaitType::Event))
 		{
-			task.Finished = true;
+			return static_cast<EWaitType>(Value);
 		}
+		return EWaitType::None;
+	}
+	case sol::type::string:
+	{
+		// 기존 스크립트 호환용 문자열 태그
+		const std::string_view Str = Tag.as<std::string_view>();
+		if (Str == "wait_time")      return EWaitType::Time;
+		if (Str == "wait_predicate") return EWaitType::Predicate;
+		if (Str == "wait_event")     return EWaitType::Event;
+		return EWaitType::None;
+	}
+	default:
+		return EWaitType::None;
 	}
 }
 
+int32 FLuaCoroutineScheduler::AllocateSlot()
+{
+	if (FreeSlots.Num() > 0)
+	{
+		const int32 Slot = FreeSlots.Pop();
+		Tasks[Slot].Finished = false;
+		return Slot;
+	}
+
+	Tasks.emplace_back();
+	return Tasks.Num() - 1;
+}
+
+void FLuaCoroutineScheduler::ReleaseSlot(int32 Slot)
+{
+	// Lua 참조를 즉시 해제하고 슬롯은 free list로 재사용 (끝난 태스크를 순회하지 않음)
+	Tasks[Slot] = FCoroTask{};
+	Tasks[Slot].Finished = true;
+	FreeSlots.Add(Slot);
+}
+
+void FLuaCoroutineScheduler::PushTimer(double WakeTime, FTaskRef Ref)
+{
+	TimerHeap.Add(FTimerEntry{ WakeTime, Ref });
+	std::push_heap(TimerHeap.begin(), TimerHeap.end());
+}
+
+void FLuaCoroutineScheduler::CompactTimerHeapIfNeeded()
+{
+	// 취소된 태스크의 힙 엔트리는 만료될 때 버려지지만, 긴 대기가 대량으로 취소되면 힙이 부풀 수 있다
+	if (StaleTimerCount < 64 || StaleTimerCount * 2 < TimerHeap.Num())
+	{
+		return;
+	}
+
+	std::erase_if(TimerHeap, [this](const FTimerEntry& Entry)
+	{
+		return !IsAlive(Entry.Ref.Slot, Entry.Ref.Id) || Tasks[Entry.Ref.Slot].WaitType != EWaitType::Time;
+	});
+	std::make_heap(TimerHeap.begin(), TimerHeap.end());
+	StaleTimerCount = 0;
+}
 
 void FLuaCoroutineScheduler::AddCoroutine(sol::coroutine&& Co)
 {
-	Tasks.push_back({std::move(Co)});
+	Register(sol::thread(), std::move(Co), nullptr);
 }
 
 void FLuaCoroutineScheduler::TriggerEvent(const FString& EventName)
 {
-	for (auto& task : Tasks)
+	auto It = EventWaiters.find(EventName);
+	if (It == EventWaiters.end())
+	{
+		return;
+	}
+
+	// resume된 태스크가 같은 이벤트를 다시 기다리면 새 목록에 들어가므로 이번 트리거에서 중복 실행되지 않는다
+	TArray<FTaskRef> Waiters = std::move(It->second);
+	EventWaiters.erase(It);
+
+	for (const FTaskRef& Ref : Waiters)
 	{
-		if (task.Finished) continue;
-		if (task.WaitType != EWaitType::Event) continue;
-		if (task.EventName == EventName)
+		if (IsAlive(Ref.Slot, Ref.Id) && Tasks[Ref.Slot].WaitType == EWaitType::Event)
 		{
-			task.WaitType = EWaitType::None;
-			task.Co(); // resume
+			Resume(Ref.Slot, Ref.Id);
 		}
 	}
 }
 
 void FLuaCoroutineScheduler::CancelByOwner(void* Owner)
 {
-	for (auto& Task : Tasks) {
-		if (Task.Owner == Owner && !Task.Finished) {
-			Task.Finished = true;
-			Task.Co = sol::coroutine(); // 참조 해제
+	for (int32 Slot = 0; Slot < Tasks.Num(); ++Slot)
+	{
+		FCoroTask& Task = Tasks[Slot];
+		if (Task.Finished || Task.Owner != Owner)
+		{
+			continue;
 		}
+
+		if (Task.WaitType == EWaitType::Time)
+		{
+			++StaleTimerCount;
+		}
+		else if (Task.WaitType == EWaitType::Event)
+		{
+			auto It = EventWaiters.find(Task.EventName);
+			if (It != EventWaiters.end())
+			{
+				const uint32 Id = Task.Id;
+				std::erase_if(It->second, [Id](const FTaskRef& Ref) { return Ref.Id == Id; });
+				if (It->second.IsEmpty())
+				{
+					EventWaiters.erase(It);
+				}
+			}
+		}
+		// Ready/Predicate 목록의 참조는 다음 Process에서 Id 불일치로 걸러진다
+
+		ReleaseSlot(Slot);
 	}
+
+	CompactTimerHeapIfNeeded();
 }
@@ -7,7 +7,9 @@ struct FLuaCoroHandle {
     explicit operator bool() const { return Id != 0; }
 };
 
-enum class EWaitType
+// Lua에는 EWait 테이블로 노출된다 (coroutine.yield(EWait.Time, 1.0))
+// 기존 문자열 태그("wait_time" 등)도 yield 시점에 한 번 변환해서 받는다
+enum class EWaitType : uint8
 {
     None,
     Time,		// 시간, Wait
@@ -22,9 +24,9 @@ struct FCoroTask
     void* Owner = nullptr;          // ULuaScriptComponent*
     EWaitType WaitType  = EWaitType::None;
     double WakeTime = 0.0;			// wait_time(n초)
-    std::function<bool()> Predicate;// wait_until()
-    std::string EventName;			// wait_event("Test")
-    bool Finished = false;
+    sol::protected_function Predicate;// wait_until()
+    FString EventName;				// wait_event("Test")
+    bool Finished = false;			// 빈 슬롯도 Finished로 취급
     uint32 Id = 0;
 };
 
@@ -42,12 +44,61 @@ public:
     
     void CancelByOwner(void* Owner);
     void ShutdownBeforeLuaClose();
+
+    int32 GetNumLiveTasks() const { return Tasks.Num() - FreeSlots.Num(); }
     
 private:
+    // 깨어날 시간이 된 태스크만 꺼내서 실행한다 (전체 태스크 순회 없음)
     void Process(double Now);
 
+    int32 AllocateSlot();
+    void ReleaseSlot(int32 Slot);
+
+    // 태스크를 한 번 resume하고, 다시 yield했으면 대기 종류에 맞는 큐에 넣는다
+    void Resume(int32 Slot, uint32 Id);
+    void Schedule(int32 Slot);
+    static EWaitType ParseWaitType(const sol::object& Tag);
+
+    bool IsAlive(int32 Slot, uint32 Id) const
+    {
+        return Slot >= 0 && Slot < Tasks.Num() && Tasks[Slot].Id == Id && !Tasks[Slot].Finished;
+    }
+
+    struct FTaskRef
+    {
+        int32 Slot = -1;
+        uint32 Id = 0;              // 슬롯 재사용 후 남은 오래된 참조 판별용
+    };
+
+    struct FTimerEntry
+    {
+        double WakeTime = 0.0;
+        FTaskRef Ref;
+
+        // std::push_heap은 max-heap이므로 비교를 뒤집어 min-heap으로 사용
+        bool operator<(const FTimerEntry& Other) const
+        {
+            if (WakeTime != Other.WakeTime) return WakeTime > Other.WakeTime;
+            return Ref.Id > Other.Ref.Id;
+        }
+    };
+
+    void PushTimer(double WakeTime, FTaskRef Ref);
+    void CompactTimerHeapIfNeeded();
+
 private:
-    TArray<FCoroTask> Tasks;
+    TArray<FCoroTask> Tasks;                        // 슬롯 배열 (끝난 태스크는 free list로 재사용)
+    TArray<int32> FreeSlots;
+
+    TArray<FTimerEntry> TimerHeap;                  // wait_time: WakeTime 기준 min-heap
+    TArray<FTaskRef> ReadyTasks;                    // 대기 조건 없음: 다음 Process에서 resume
+    TArray<FTaskRef> PredicateTasks;                // wait_predicate: 매 Process마다 조건 평가
+    TArray<FTaskRef> PredicateScratch;
+    TMap<FString, TArray<FTaskRef>> EventWaiters;   // wait_event: 이벤트 이름별 대기 목록
+
+    TArray<FTaskRef> DueTasks;                      // Process 내부 임시 버퍼 (재할당 방지용)
+    int32 StaleTimerCount = 0;                      // 취소되어 무효가 된 힙 엔트리 수
+
     uint32 NextId = 0;
     
     double NowSeconds = 0.0;
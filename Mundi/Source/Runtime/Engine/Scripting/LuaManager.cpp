@@ -8,15 +8,87 @@
 #include "CameraComponent.h"
 #include "PlayerCameraManager.h"
 #include "SkeletalMeshComponent.h"
+#include "AnimationTypes.h"
+#include "PlatformTime.h"
+#include "DebugDrawManager.h"
+#include "ActorPool.h"
 #include "Source/Runtime/AssetManagement/ResourceManager.h"
 #include "Source/Runtime/Engine/Audio/Sound.h"
 #include "Source/Runtime/Engine/GameFramework/FAudioDevice.h"
 #include <tuple>
 #include <xaudio2.h>
 
+namespace
+{
+    // Lua VM 할당을 EMemoryTag::Lua로 집계하는 할당자 (ptr == nullptr일 때 OldSize는 타입 코드이므로 0으로 취급)
+    void* LuaTrackedAlloc(void* UserData, void* Ptr, size_t OldSize, size_t NewSize)
+    {
+        const size_t PrevSize = Ptr ? OldSize : 0;
+        if (NewSize == 0)
+        {
+            if (Ptr)
+            {
+                FMemoryManager::RecordFree(EMemoryTag::Lua, PrevSize);
+                free(Ptr);
+            }
+            return nullptr;
+        }
+
+        void* NewPtr = realloc(Ptr, NewSize);
+        if (!NewPtr)
+        {
+            return nullptr;
+        }
+        if (Ptr)
+        {
+            FMemoryManager::RecordFree(EMemoryTag::Lua, PrevSize);
+        }
+        FMemoryManager::RecordAlloc(EMemoryTag::Lua, NewSize);
+        return NewPtr;
+    }
+
+    // Lua 트레이스 인자 (ObjectTypes 마스크, 무시할 GameObject) -> FCollisionQueryParams
+    FCollisionQueryParams MakeLuaQueryParams(const sol::optional<uint32>& ObjectTypes, const sol::optional<sol::object>& IgnoreObject)
+    {
+        FCollisionQueryParams Params;
+        if (ObjectTypes)
+        {
+            Params.ObjectTypes = static_cast<ECollisionObjectType>(*ObjectTypes);
+        }
+        if (IgnoreObject && IgnoreObject->is<FGameObject&>())
+        {
+            Params.IgnoreActor = IgnoreObject->as<FGameObject&>().GetOwner();
+        }
+        return Params;
+    }
+
+    // 히트 결과 -> { Actor, Component, Location, Normal, Distance } 테이블
+    sol::object MakeLuaHitTable(sol::state& Lua, const FHitResult& Hit)
+    {
+        if (!Hit.bBlockingHit)
+        {
+            return sol::make_object(Lua, sol::nil);
+        }
+
+        sol::table Table = Lua.create_table();
+        Table["Actor"] = Hit.Actor ? Hit.Actor->GetGameObject() : nullptr;
+        Table["Component"] = Hit.Component ? MakeComponentProxy(Lua, Hit.Component, Hit.Component->GetClass()) : sol::make_object(Lua, sol::nil);
+        Table["Location"] = Hit.Location;
+        Table["Normal"] = Hit.Normal;
+        Table["Distance"] = Hit.Distance;
+        return sol::object(Table);
+    }
+
+    // Lua 디버그 드로우 색 인자 (생략 시 기본색)
+    FVector4 MakeLuaDebugColor(const sol::optional<FLinearColor>& Color, const FVector4& Default = FVector4(1.0f, 0.0f, 0.0f, 1.0f))
+    {
+        return Color ? FVector4(Color->R, Color->G, Color->B, Color->A) : Default;
+    }
+}
+
 FLuaManager::FLuaManager()
 {
-    Lua = new sol::state();
+    Lua = new sol::state(sol::default_at_panic, &LuaTrackedAlloc);
 
     // Open essential standard libraries for gameplay scripts
     Lua->open_libraries(
@@ -197,6 +269,87 @@ FLuaManager::FLuaManager()
             return NewObject;
         }
     ));
+
+    // 액터 풀: 스폰/파괴 대신 미리 만들어 둔 액터를 꺼내 쓰고 반납 (반납된 GameObject는 다시 쓰면 안 됨)
+    SharedLib.set_function("PrewarmPrefabPool",
+        [](const FString& PrefabPath, int32 Count) -> int32
+        {
+            if (!GWorld || !GWorld->GetActorPool())
+            {
+                return 0;
+            }
+            return GWorld->GetActorPool()->Prewarm(UTF8ToWide(PrefabPath), Count);
+        }
+    );
+    SharedLib.set_function("AcquirePooledPrefab",
+        [](const FString& PrefabPath, sol::optional<FVector> Location) -> FGameObject*
+        {
+            if (!GWorld || !GWorld->GetActorPool())
+            {
+                return nullptr;
+            }
+
+            FTransform Transform;
+            if (Location)
+            {
+                Transform.Translation = *Location;
+            }
+
+            AActor* Actor = GWorld->GetActorPool()->Acquire(UTF8ToWide(PrefabPath), Transform);
+            return Actor ? Actor->GetGameObject() : nullptr;
+        }
+    );
+    SharedLib.set_function("ReleaseToPool",
+        [](FGameObject& GameObject) -> bool
+        {
+            AActor* Actor = GameObject.GetOwner();
+            if (!GWorld || !GWorld->GetActorPool() || !Actor)
+            {
+                return false;
+            }
+            // 풀 액터가 아니면 false (이 경우 DeleteObject를 사용)
+            return GWorld->GetActorPool()->Release(Actor);
+        }
+    );
+    SharedLib.set_function("SetPoolMaxFree",
+        [](const FString& PrefabPath, int32 MaxFree)
+        {
+            if (GWorld && GWorld->GetActorPool())
+            {
+                GWorld->GetActorPool()->SetMaxFree(UTF8ToWide(PrefabPath), MaxFree);
+            }
+        }
+    );
+    // { { Name, Active, Free, PeakActive, Created, Acquired, Reused, Released, Discarded }, ... }
+    SharedLib.set_function("GetPoolStats",
+        [this]()
+        {
+            sol::table Result = Lua->create_table();
+            if (!GWorld || !GWorld->GetActorPool())
+            {
+                return Result;
+            }
+
+            TArray<FActorPoolStats> AllStats;
+            GWorld->GetActorPool()->GetStats(AllStats);
+            for (int32 i = 0; i < AllStats.Num(); ++i)
+            {
+                const FActorPoolStats& Stats = AllStats[i];
+                sol::table Entry = Lua->create_table();
+                Entry["Name"] = Stats.Name;
+                Entry["Active"] = Stats.NumActive;
+                Entry["Free"] = Stats.NumFree;
+                Entry["PeakActive"] = Stats.PeakActive;
+                Entry["Created"] = Stats.NumCreated;
+                Entry["Acquired"] = Stats.NumAcquired;
+                Entry["Reused"] = Stats.NumReused;
+                Entry["Released"] = Stats.NumReleased;
+                Entry["Discarded"] = Stats.NumDiscarded;
+                Result[i + 1] = Entry;
+            }
+            return Result;
+        }
+    );
     SharedLib.set_function("DeleteObject", sol::overload(
         [](const FGameObject& GameObject)
         {
@@ -313,6 +466,121 @@ FLuaManager::FLuaManager()
             }
         });
 
+    // 월드 트레이스: 맞으면 히트 테이블, 아니면 nil
+    sol::table CollisionObjectType = SharedLib.create_named("CollisionObjectType");
+    CollisionObjectType["StaticMesh"] = static_cast<uint32>(ECollisionObjectType::StaticMesh);
+    CollisionObjectType["SkeletalMesh"] = static_cast<uint32>(ECollisionObjectType::SkeletalMesh);
+    CollisionObjectType["Shape"] = static_cast<uint32>(ECollisionObjectType::Shape);
+    CollisionObjectType["Other"] = static_cast<uint32>(ECollisionObjectType::Other);
+    CollisionObjectType["Default"] = static_cast<uint32>(ECollisionObjectType::Default);
+    CollisionObjectType["All"] = static_cast<uint32>(ECollisionObjectType::All);
+
+    SharedLib.set_function("LineTrace",
+        [this](const FVector& Start, const FVector& End, sol::optional<uint32> ObjectTypes, sol::optional<sol::object> IgnoreObject)
+        {
+            FHitResult Hit;
+            if (GWorld)
+            {
+                GWorld->LineTraceSingle(Hit, Start, End, MakeLuaQueryParams(ObjectTypes, IgnoreObject));
+            }
+            return MakeLuaHitTable(*Lua, Hit);
+        });
+
+    SharedLib.set_function("LineTraceMulti",
+        [this](const FVector& Start, const FVector& End, sol::optional<uint32> ObjectTypes, sol::optional<sol::object> IgnoreObject)
+        {
+            TArray<FHitResult> Hits;
+            if (GWorld)
+            {
+                GWorld->LineTraceMulti(Hits, Start, End, MakeLuaQueryParams(ObjectTypes, IgnoreObject));
+            }
+            sol::table Result = Lua->create_table();
+            for (int32 i = 0; i < Hits.Num(); ++i)
+            {
+                Result[i + 1] = MakeLuaHitTable(*Lua, Hits[i]);
+            }
+            return Result;
+        });
+
+    // Requests = { {Start, End}, ... } -> 같은 순서의 결과 배열 (빗나간 요청은 false)
+    SharedLib.set_function("LineTraceBatch",
+        [this](sol::table Requests, sol::optional<uint32> ObjectTypes, sol::optional<sol::object> IgnoreObject)
+        {
+            TArray<FLineTraceRequest> TraceRequests;
+            TraceRequests.reserve(Requests.size());
+            for (size_t i = 1; i <= Requests.size(); ++i)
+            {
+                sol::table Pair = Requests[i];
+                TraceRequests.Add(FLineTraceRequest{ Pair[1].get<FVector>(), Pair[2].get<FVector>() });
+            }
+
+            TArray<FHitResult> Hits;
+            if (GWorld)
+            {
+                GWorld->LineTraceBatch(TraceRequests, Hits, MakeLuaQueryParams(ObjectTypes, IgnoreObject));
+            }
+            sol::table Result = Lua->create_table();
+            for (int32 i = 0; i < Hits.Num(); ++i)
+            {
+                Result[i + 1] = Hits[i].bBlockingHit ? MakeLuaHitTable(*Lua, Hits[i]) : sol::make_object(*Lua, false);
+            }
+            return Result;
+        });
+
+    SharedLib.set_function("SweepSphere",
+        [this](const FVector& Start, const FVector& End, float Radius, sol::optional<uint32> ObjectTypes, sol::optional<sol::object> IgnoreObject)
+        {
+            FHitResult Hit;
+            if (GWorld)
+            {
+                GWorld->SweepSphereSingle(Hit, Start, End, Radius, MakeLuaQueryParams(ObjectTypes, IgnoreObject));
+            }
+            return MakeLuaHitTable(*Lua, Hit);
+        });
+
+    SharedLib.set_function("SweepBox",
+        [this](const FVector& Start, const FVector& End, const FVector& HalfExtent, sol::optional<uint32> ObjectTypes, sol::optional<sol::object> IgnoreObject)
+        {
+            FHitResult Hit;
+            if (GWorld)
+            {
+                GWorld->SweepBoxSingle(Hit, Start, End, HalfExtent, MakeLuaQueryParams(ObjectTypes, IgnoreObject));
+            }
+            return MakeLuaHitTable(*Lua, Hit);
+        });
+
+    // 디버그 드로우: Duration 0 = 한 프레임, >0 = 초 단위 유지, <0 = 영구 (ClearDebugDraw로 제거)
+    SharedLib.set_function("DrawDebugLine",
+        [](const FVector& Start, const FVector& End, sol::optional<FLinearColor> Color, sol::optional<float> Duration, sol::optional<bool> bAlwaysOnTop)
+        {
+            FDebugDrawManager::GetInstance().DrawLine(GWorld, Start, End, MakeLuaDebugColor(Color), Duration.value_or(0.0f), bAlwaysOnTop.value_or(false));
+        });
+    SharedLib.set_function("DrawDebugBox",
+        [](const FVector& Center, const FVector& HalfExtent, sol::optional<FLinearColor> Color, sol::optional<float> Duration, sol::optional<bool> bAlwaysOnTop)
+        {
+            FDebugDrawManager::GetInstance().DrawBox(GWorld, Center, HalfExtent, FQuat::Identity(), MakeLuaDebugColor(Color), Duration.value_or(0.0f), bAlwaysOnTop.value_or(false));
+        });
+    SharedLib.set_function("DrawDebugSphere",
+        [](const FVector& Center, float Radius, sol::optional<FLinearColor> Color, sol::optional<float> Duration, sol::optional<bool> bAlwaysOnTop)
+        {
+            FDebugDrawManager::GetInstance().DrawSphere(GWorld, Center, Radius, MakeLuaDebugColor(Color), Duration.value_or(0.0f), bAlwaysOnTop.value_or(false));
+        });
+    SharedLib.set_function("DrawDebugArrow",
+        [](const FVector& Start, const FVector& End, sol::optional<FLinearColor> Color, sol::optional<float> Duration, sol::optional<bool> bAlwaysOnTop)
+        {
+            FDebugDrawManager::GetInstance().DrawArrow(GWorld, Start, End, MakeLuaDebugColor(Color), Duration.value_or(0.0f), bAlwaysOnTop.value_or(false));
+        });
+    SharedLib.set_function("DrawDebugText",
+        [](const FVector& Location, const FString& Text, sol::optional<FLinearColor> Color, sol::optional<float> Duration)
+        {
+            FDebugDrawManager::GetInstance().DrawString(GWorld, Location, Text, MakeLuaDebugColor(Color, FVector4(1.0f, 1.0f, 1.0f, 1.0f)), Duration.value_or(0.0f));
+        });
+    SharedLib.set_function("ClearDebugDraw",
+        []()
+        {
+            FDebugDrawManager::GetInstance().ClearPersistent(GWorld);
+        });
+
     // FVector usertype 등록 (메서드와 프로퍼티)
     SharedLib.new_usertype<FVector>("FVector",
         sol::no_constructor,  // 생성자는 위에서 Vector 함수로 등록했음
@@ -362,6 +630,13 @@ FLuaManager::FLuaManager()
     MetaTableShared[sol::meta_function::index] = Lua->globals();
     SharedLib[sol::metatable_key]  = MetaTableShared;
 
+    // 코루틴 yield 태그 (coroutine.yield(EWait.Time, 1.0)), 문자열 태그도 계속 지원
+    Lua->new_enum("EWait",
+        "Time", EWaitType::Time,
+        "Predicate", EWaitType::Predicate,
+        "Event", EWaitType::Event
+    );
+
     // AnimNotify 글로벌 테이블 생성
     (*Lua)["AnimNotify"] = Lua->create_table();
 
@@ -641,6 +916,11 @@ void FLuaManager::ShutdownBeforeLuaClose()
 {
     CoroutineSchedular.ShutdownBeforeLuaClose();
 
+    // Notify 캐시는 sol 참조를 들고 있으므로 state보다 먼저 정리
+    NotifyStateInstanceCache.clear();
+    NotifyStateClassCache.Empty();
+    NotifyClassCache.Empty();
+
     FLuaBindRegistry::Get().Reset();
 
     SharedLib = sol::nil;
@@ -664,189 +944,214 @@ sol::protected_function FLuaManager::GetFunc(sol::environment& Env, const char*
     return Func;
 }
 
-bool FLuaManager::ExecuteNotify(const FString& NotifyClassName, const FString& PropertyData, USkeletalMeshComponent* MeshComp, float TriggerTime, float Duration)
+FLuaManager::FNotifyClassEntry FLuaManager::MakeNotifyClassEntry(sol::table NotifyClass)
 {
-    if (!Lua || !MeshComp)
+    FNotifyClassEntry Entry;
+    Entry.Class = NotifyClass;
+
+    auto CacheFunc = [&NotifyClass](const char* Name) -> sol::protected_function
     {
-        return false;
+        sol::object Object = NotifyClass[Name];
+        if (Object.get_type() != sol::type::function)
+        {
+            return {};
+        }
+        return Object.as<sol::protected_function>();
+    };
+
+    Entry.Notify = CacheFunc("Notify");
+    Entry.NotifyBegin = CacheFunc("NotifyBegin");
+    Entry.NotifyTick = CacheFunc("NotifyTick");
+    Entry.NotifyEnd = CacheFunc("NotifyEnd");
+    Entry.ClassMetatable = Lua->create_table_with("__index", NotifyClass);
+
+    return Entry;
+}
+
+FLuaManager::FNotifyClassEntry* FLuaManager::FindNotifyClass(FName NotifyName)
+{
+    auto It = NotifyClassCache.find(NotifyName);
+    if (It != NotifyClassCache.end())
+    {
+        return &It->second;
     }
 
-    // AnimNotify 테이블에서 Notify 클래스 찾기
+    // LoadNotifyClasses 이후 스크립트에서 AnimNotify 테이블에 직접 등록한 클래스
     sol::optional<sol::table> AnimNotifyTable = (*Lua)["AnimNotify"];
     if (!AnimNotifyTable)
     {
         UE_LOG("[LuaManager] AnimNotify table not found!");
-        return false;
+        return nullptr;
     }
 
+    const FString NotifyClassName = NotifyName.ToString();
     sol::optional<sol::table> NotifyClassOpt = (*AnimNotifyTable)[NotifyClassName];
     if (!NotifyClassOpt)
     {
         UE_LOG("[LuaManager] Notify class '%s' not found in AnimNotify table", NotifyClassName.c_str());
-        return false;
+        return nullptr;
     }
 
-    sol::table NotifyClass = *NotifyClassOpt;
+    auto Result = NotifyClassCache.emplace(NotifyName, MakeNotifyClassEntry(*NotifyClassOpt));
+    return &Result.first->second;
+}
 
-    try
+FLuaManager::FNotifyClassEntry* FLuaManager::FindNotifyStateClass(FName NotifyName)
+{
+    auto It = NotifyStateClassCache.find(NotifyName);
+    if (It != NotifyStateClassCache.end())
     {
+        return It->second.IsValid() ? &It->second : nullptr;
+    }
 
-        sol::table NotifyInstance = Lua->create_table();
-        NotifyInstance[sol::metatable_key] = Lua->create_table_with("__index", NotifyClass);
+    // 첫 사용 시 한 번만 로드한다. 실패한 경우에도 빈 엔트리를 남겨 매 프레임 파일을 다시 읽지 않도록 한다.
+    FNotifyClassEntry& Entry = NotifyStateClassCache[NotifyName];
 
-        if (!PropertyData.empty() && PropertyData != "{}")
-        {
-            try
-            {
-                JSON Props = JSON::Load(PropertyData);
+    const FString NotifyClassName = NotifyName.ToString();
+    FString NotifyPath = "Data/Scripts/NotifyState/" + NotifyClassName + ".lua";
 
-                if (Props.JSONType() == JSON::Class::Object)
-                {
-                    auto ObjMap = Props.ObjectRange();
-                    for (auto& Pair : ObjMap)
-                    {
-                        const FString& Key = Pair.first;
-                        const JSON& Value = Pair.second;
-
-                        if (Value.JSONType() == JSON::Class::String)
-                        {
-                            NotifyInstance[Key] = Value.ToString();
-                        }
-                        else if (Value.JSONType() == JSON::Class::Floating)
-                        {
-                            NotifyInstance[Key] = Value.ToFloat();
-                        }
-                        else if (Value.JSONType() == JSON::Class::Integral)
-                        {
-                            NotifyInstance[Key] = Value.ToInt();
-                        }
-                        else if (Value.JSONType() == JSON::Class::Boolean)
-                        {
-                            NotifyInstance[Key] = Value.ToBool();
-                        }
-                    }
-                }
-            }
-            catch (const std::exception& e)
-            {
-                UE_LOG("[LuaManager] Failed to parse PropertyData for Notify '%s': %s", NotifyClassName.c_str(), e.what());
-            }
-        }
+    sol::load_result LoadResult = Lua->load_file(NotifyPath.c_str());
+    if (!LoadResult.valid())
+    {
+        sol::error Err = LoadResult;
+        UE_LOG("[LuaManager] Failed to load NotifyState script '%s': %s", NotifyPath.c_str(), Err.what());
+        return nullptr;
+    }
+
+    sol::protected_function_result ExecResult = LoadResult();
+    if (!ExecResult.valid())
+    {
+        sol::error Err = ExecResult;
+        UE_LOG("[LuaManager] Failed to execute NotifyState script '%s': %s", NotifyPath.c_str(), Err.what());
+        return nullptr;
+    }
+
+    if (ExecResult.get_type() != sol::type::table)
+    {
+        UE_LOG("[LuaManager] NotifyState script '%s' did not return a table", NotifyPath.c_str());
+        return nullptr;
+    }
+
+    Entry = MakeNotifyClassEntry(ExecResult.get<sol::table>());
+    return &Entry;
+}
+
+sol::table FLuaManager::CreateNotifyInstance(FNotifyClassEntry& Entry, const FAnimNotifyPayload& Payload)
+{
+    sol::table NotifyInstance = Lua->create_table();
 
-        if (Duration > 0.0f)
+    if (Payload.IsEmpty())
+    {
+        NotifyInstance[sol::metatable_key] = Entry.ClassMetatable;
+        return NotifyInstance;
+    }
+
+    auto It = Entry.PayloadMetatables.find(Payload.PayloadId);
+    if (It == Entry.PayloadMetatables.end())
+    {
+        // 프로퍼티 테이블은 인스턴스들이 읽기 전용으로 공유하고, 인스턴스에서의 쓰기는 인스턴스 자신에 남는다
+        sol::table Properties = Lua->create_table();
+        for (const FAnimNotifyProperty& Property : Payload.Properties)
         {
-            sol::function NotifyBegin = NotifyClass["NotifyBegin"];
-            if (NotifyBegin.valid())
+            switch (Property.Type)
             {
-                // MeshComp를 LuaComponentProxy로 래핑하여 전달
-                sol::object MeshCompProxy = MakeComponentProxy(sol::state_view(*Lua), MeshComp, MeshComp->GetClass());
-
-                sol::protected_function_result Result = NotifyBegin(NotifyInstance, MeshCompProxy, TriggerTime);
-                if (!Result.valid())
-                {
-                    sol::error Err = Result;
-                    UE_LOG("[LuaManager] NotifyBegin failed for '%s': %s", NotifyClassName.c_str(), Err.what());
-                    return false;
-                }
+            case EAnimNotifyPropertyType::String: Properties[Property.Key] = Property.StringValue; break;
+            case EAnimNotifyPropertyType::Float:  Properties[Property.Key] = Property.FloatValue; break;
+            case EAnimNotifyPropertyType::Int:    Properties[Property.Key] = Property.IntValue; break;
+            case EAnimNotifyPropertyType::Bool:   Properties[Property.Key] = Property.bBoolValue; break;
             }
         }
-        else
-        {
-            sol::function Notify = NotifyClass["Notify"];
-            if (Notify.valid())
-            {
-                // MeshComp를 LuaComponentProxy로 래핑하여 전달
-                sol::object MeshCompProxy = MakeComponentProxy(sol::state_view(*Lua), MeshComp, MeshComp->GetClass());
+        Properties[sol::metatable_key] = Entry.ClassMetatable;
 
-                sol::protected_function_result Result = Notify(NotifyInstance, MeshCompProxy, TriggerTime);
-                if (!Result.valid())
-                {
-                    sol::error Err = Result;
-                    UE_LOG("[LuaManager] Notify failed for '%s': %s", NotifyClassName.c_str(), Err.what());
-                    return false;
-                }
-            }
+        It = Entry.PayloadMetatables.emplace(Payload.PayloadId, Lua->create_table_with("__index", Properties)).first;
+    }
+
+    NotifyInstance[sol::metatable_key] = It->second;
+    return NotifyInstance;
+}
+
+bool FLuaManager::ExecuteNotify(const FAnimNotifyEvent& NotifyEvent, USkeletalMeshComponent* MeshComp)
+{
+    if (!Lua || !MeshComp)
+    {
+        return false;
+    }
+
+    TIME_PROFILE(AnimNotifyDispatch)
+
+    // AnimNotify 테이블에서 Notify 클래스 찾기 (캐시)
+    FNotifyClassEntry* Entry = FindNotifyClass(NotifyEvent.NotifyName);
+    if (!Entry)
+    {
+        return false;
+    }
+
+    // Duration이 있으면 NotifyBegin, 없으면 Notify
+    const bool bIsState = NotifyEvent.Duration > 0.0f;
+    sol::protected_function& Func = bIsState ? Entry->NotifyBegin : Entry->Notify;
+    if (!Func.valid())
+    {
+        return true;
+    }
+
+    try
+    {
+        sol::table NotifyInstance = CreateNotifyInstance(*Entry, NotifyEvent.GetPayload());
+
+        // MeshComp를 LuaComponentProxy로 래핑하여 전달
+        sol::object MeshCompProxy = MakeComponentProxy(sol::state_view(*Lua), MeshComp, MeshComp->GetClass());
+
+        sol::protected_function_result Result = Func(NotifyInstance, MeshCompProxy, NotifyEvent.TriggerTime);
+        if (!Result.valid())
+        {
+            sol::error Err = Result;
+            UE_LOG("[LuaManager] %s failed for '%s': %s", bIsState ? "NotifyBegin" : "Notify", NotifyEvent.NotifyName.ToString().c_str(), Err.what());
+            return false;
         }
 
         return true;
     }
     catch (const sol::error& e)
     {
-        UE_LOG("[LuaManager] Exception in ExecuteNotify for '%s': %s", NotifyClassName.c_str(), e.what());
+        UE_LOG("[LuaManager] Exception in ExecuteNotify for '%s': %s", NotifyEvent.NotifyName.ToString().c_str(), e.what());
         return false;
     }
 }
 
-bool FLuaManager::ExecuteNotifyStateBegin(const FString& NotifyClassName, const FString& PropertyData, USkeletalMeshComponent* MeshComp, float TriggerTime)
+bool FLuaManager::ExecuteNotifyStateBegin(const FAnimNotifyEvent& NotifyEvent, USkeletalMeshComponent* MeshComp, float TriggerTime)
 {
     if (!Lua || !MeshComp)
     {
         return false;
     }
 
-    FString NotifyPath = "Data/Scripts/NotifyState/" + NotifyClassName + ".lua";
+    TIME_PROFILE(AnimNotifyDispatch)
 
     try
     {
-        sol::load_result LoadResult = Lua->load_file(NotifyPath.c_str());
-        if (!LoadResult.valid())
-        {
-            sol::error Err = LoadResult;
-            UE_LOG("[LuaManager] Failed to load NotifyState script '%s': %s", NotifyPath.c_str(), Err.what());
-            return false;
-        }
-
-        sol::protected_function_result ExecResult = LoadResult();
-        if (!ExecResult.valid())
+        FNotifyClassEntry* Entry = FindNotifyStateClass(NotifyEvent.NotifyName);
+        if (!Entry)
         {
-            sol::error Err = ExecResult;
-            UE_LOG("[LuaManager] Failed to execute NotifyState script '%s': %s", NotifyPath.c_str(), Err.what());
             return false;
         }
 
-        sol::table NotifyClass = ExecResult;
-        if (!NotifyClass.valid())
-        {
-            UE_LOG("[LuaManager] NotifyState script '%s' did not return a table", NotifyPath.c_str());
-            return false;
-        }
-
-        sol::table NotifyInstance = Lua->create_table();
-        NotifyInstance[sol::metatable_key] = NotifyClass;
-
-        // PropertyData를 Notify 인스턴스에 복사
-        if (!PropertyData.empty() && PropertyData != "{}")
-        {
-            try
-            {
-                sol::table Props = (*Lua)["json"]["decode"](PropertyData);
-                for (const auto& Pair : Props)
-                {
-                    FString Key = Pair.first.as<FString>();
-                    NotifyInstance[Key] = Pair.second;
-                }
-            }
-            catch (const sol::error& e)
-            {
-                UE_LOG("[LuaManager] Failed to parse PropertyData for NotifyState '%s': %s", NotifyClassName.c_str(), e.what());
-            }
-        }
+        // PropertyData는 로드 시점에 파싱된 페이로드를 사용
+        sol::table NotifyInstance = CreateNotifyInstance(*Entry, NotifyEvent.GetPayload());
 
         // 캐시에 저장 (NotifyName + MeshComp 조합으로 식별)
         FNotifyStateKey CacheKey;
-        CacheKey.NotifyName = NotifyClassName;
+        CacheKey.NotifyName = NotifyEvent.NotifyName;
         CacheKey.MeshCompPtr = MeshComp;
-        NotifyStateInstanceCache[CacheKey] = NotifyInstance;
+        NotifyStateInstanceCache[CacheKey] = FNotifyStateInstance{ NotifyInstance, Entry };
 
-        sol::function NotifyBegin = NotifyClass["NotifyBegin"];
-        if (NotifyBegin.valid())
+        if (Entry->NotifyBegin.valid())
         {
             sol::object MeshCompProxy = MakeComponentProxy(sol::state_view(*Lua), MeshComp, MeshComp->GetClass());
-            sol::protected_function_result Result = NotifyBegin(NotifyInstance, MeshCompProxy, TriggerTime);
+            sol::protected_function_result Result = Entry->NotifyBegin(NotifyInstance, MeshCompProxy, TriggerTime);
             if (!Result.valid())
             {
                 sol::error Err = Result;
-                UE_LOG("[LuaManager] NotifyBegin failed for '%s': %s", NotifyClassName.c_str(), Err.what());
+                UE_LOG("[LuaManager] NotifyBegin failed for '%s': %s", NotifyEvent.NotifyName.ToString().c_str(), Err.what());
                 return false;
             }
         }
@@ -855,21 +1160,23 @@ bool FLuaManager::ExecuteNotifyStateBegin(const FString& NotifyClassName, const
     }
     catch (const sol::error& e)
     {
-        UE_LOG("[LuaManager] Exception in ExecuteNotifyStateBegin for '%s': %s", NotifyClassName.c_str(), e.what());
+        UE_LOG("[LuaManager] Exception in ExecuteNotifyStateBegin for '%s': %s", NotifyEvent.NotifyName.ToString().c_str(), e.what());
         return false;
     }
 }
 
-bool FLuaManager::ExecuteNotifyStateTick(const FString& NotifyClassName, const FString& PropertyData, USkeletalMeshComponent* MeshComp, float CurrentTime, float DeltaTime)
+bool FLuaManager::ExecuteNotifyStateTick(const FAnimNotifyEvent& NotifyEvent, USkeletalMeshComponent* MeshComp, float CurrentTime, float DeltaTime)
 {
     if (!Lua || !MeshComp)
     {
         return false;
     }
 
+    TIME_PROFILE(AnimNotifyDispatch)
+
     // 캐시에서 인스턴스 찾기
     FNotifyStateKey CacheKey;
-    CacheKey.NotifyName = NotifyClassName;
+    CacheKey.NotifyName = NotifyEvent.NotifyName;
     CacheKey.MeshCompPtr = MeshComp;
 
     auto It = NotifyStateInstanceCache.find(CacheKey);
@@ -879,30 +1186,23 @@ bool FLuaManager::ExecuteNotifyStateTick(const FString& NotifyClassName, const F
         return false;
     }
 
-    sol::table NotifyInstance = It->second;
+    FNotifyStateInstance& State = It->second;
+    if (!State.Entry->NotifyTick.valid())
+    {
+        return true;
+    }
 
     try
     {
-        // NotifyClass 가져오기 (metatable)
-        sol::table NotifyClass = NotifyInstance[sol::metatable_key];
-        if (!NotifyClass.valid())
+        sol::object MeshCompProxy = MakeComponentProxy(sol::state_view(*Lua), MeshComp, MeshComp->GetClass());
+        sol::protected_function_result Result = State.Entry->NotifyTick(State.Instance, MeshCompProxy, CurrentTime, DeltaTime);
+        if (!Result.valid())
         {
+            sol::error Err = Result;
+            UE_LOG("[LuaManager] NotifyTick failed for '%s': %s", NotifyEvent.NotifyName.ToString().c_str(), Err.what());
             return false;
         }
 
-        sol::function NotifyTick = NotifyClass["NotifyTick"];
-        if (NotifyTick.valid())
-        {
-            sol::object MeshCompProxy = MakeComponentProxy(sol::state_view(*Lua), MeshComp, MeshComp->GetClass());
-            sol::protected_function_result Result = NotifyTick(NotifyInstance, MeshCompProxy, CurrentTime, DeltaTime);
-            if (!Result.valid())
-            {
-                sol::error Err = Result;
-                UE_LOG("[LuaManager] NotifyTick failed for '%s': %s", NotifyClassName.c_str(), Err.what());
-                return false;
-            }
-        }
-
         return true;
     }
     catch (const sol::error&)
@@ -911,16 +1211,18 @@ bool FLuaManager::ExecuteNotifyStateTick(const FString& NotifyClassName, const F
     }
 }
 
-bool FLuaManager::ExecuteNotifyStateEnd(const FString& NotifyClassName, const FString& PropertyData, USkeletalMeshComponent* MeshComp, float EndTime)
+bool FLuaManager::ExecuteNotifyStateEnd(const FAnimNotifyEvent& NotifyEvent, USkeletalMeshComponent* MeshComp, float EndTime)
 {
     if (!Lua || !MeshComp)
     {
         return false;
     }
 
+    TIME_PROFILE(AnimNotifyDispatch)
+
     // 캐시에서 인스턴스 찾기
     FNotifyStateKey CacheKey;
-    CacheKey.NotifyName = NotifyClassName;
+    CacheKey.NotifyName = NotifyEvent.NotifyName;
     CacheKey.MeshCompPtr = MeshComp;
 
     auto It = NotifyStateInstanceCache.find(CacheKey);
@@ -930,40 +1232,30 @@ bool FLuaManager::ExecuteNotifyStateEnd(const FString& NotifyClassName, const FS
         return false;
     }
 
-    sol::table NotifyInstance = It->second;
+    // NotifyEnd 호출 여부와 관계없이 캐시에서 제거
+    FNotifyStateInstance State = std::move(It->second);
+    NotifyStateInstanceCache.erase(It);
+
+    if (!State.Entry->NotifyEnd.valid())
+    {
+        return true;
+    }
 
     try
     {
-        // NotifyClass 가져오기 (metatable)
-        sol::table NotifyClass = NotifyInstance[sol::metatable_key];
-        if (!NotifyClass.valid())
+        sol::object MeshCompProxy = MakeComponentProxy(sol::state_view(*Lua), MeshComp, MeshComp->GetClass());
+        sol::protected_function_result Result = State.Entry->NotifyEnd(State.Instance, MeshCompProxy, EndTime);
+        if (!Result.valid())
         {
+            sol::error Err = Result;
+            UE_LOG("[LuaManager] NotifyEnd failed for '%s': %s", NotifyEvent.NotifyName.ToString().c_str(), Err.what());
             return false;
         }
 
-        sol::function NotifyEnd = NotifyClass["NotifyEnd"];
-        if (NotifyEnd.valid())
-        {
-            sol::object MeshCompProxy = MakeComponentProxy(sol::state_view(*Lua), MeshComp, MeshComp->GetClass());
-            sol::protected_function_result Result = NotifyEnd(NotifyInstance, MeshCompProxy, EndTime);
-            if (!Result.valid())
-            {
-                sol::error Err = Result;
-                UE_LOG("[LuaManager] NotifyEnd failed for '%s': %s", NotifyClassName.c_str(), Err.what());
-                NotifyStateInstanceCache.erase(It);
-                return false;
-            }
-        }
-
-        // NotifyEnd 호출 완료 후 캐시에서 제거
-        NotifyStateInstanceCache.erase(It);
-
         return true;
     }
     catch (const sol::error&)
     {
-        // 예외 발생 시에도 캐시에서 제거
-        NotifyStateInstanceCache.erase(It);
         return false;
     }
 }
@@ -1044,6 +1336,7 @@ void FLuaManager::LoadNotifyClasses()
         {
             sol::table NotifyClass = Result;
             AnimNotifyTable[FileName] = NotifyClass;
+            NotifyClassCache[FName(FileName)] = MakeNotifyClassEntry(NotifyClass);
             ++LoadedCount;
             UE_LOG("[LuaManager] Loaded notify: %s", FileName.c_str());
         }
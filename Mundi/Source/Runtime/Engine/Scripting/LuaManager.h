@@ -28,26 +28,55 @@ public:
 
     class FLuaCoroutineScheduler& GetScheduler() { return CoroutineSchedular; }
 
-    bool ExecuteNotify(const FString& NotifyClassName, const FString& PropertyData, class USkeletalMeshComponent* MeshComp, float TriggerTime, float Duration);
-    bool ExecuteNotifyStateBegin(const FString& NotifyClassName, const FString& PropertyData, class USkeletalMeshComponent* MeshComp, float TriggerTime);
-    bool ExecuteNotifyStateTick(const FString& NotifyClassName, const FString& PropertyData, class USkeletalMeshComponent* MeshComp, float CurrentTime, float DeltaTime);
-    bool ExecuteNotifyStateEnd(const FString& NotifyClassName, const FString& PropertyData, class USkeletalMeshComponent* MeshComp, float EndTime);
+    // 디스패치 비용은 TIME_PROFILE(AnimNotifyDispatch)로 누적된다 (STAT NOTIFY)
+    bool ExecuteNotify(const struct FAnimNotifyEvent& NotifyEvent, class USkeletalMeshComponent* MeshComp);
+    bool ExecuteNotifyStateBegin(const struct FAnimNotifyEvent& NotifyEvent, class USkeletalMeshComponent* MeshComp, float TriggerTime);
+    bool ExecuteNotifyStateTick(const struct FAnimNotifyEvent& NotifyEvent, class USkeletalMeshComponent* MeshComp, float CurrentTime, float DeltaTime);
+    bool ExecuteNotifyStateEnd(const struct FAnimNotifyEvent& NotifyEvent, class USkeletalMeshComponent* MeshComp, float EndTime);
 
     // 등록된 모든 Notify 클래스 목록 가져오기 (AnimNotify 테이블의 모든 키)
     TArray<FString> GetRegisteredNotifyClasses() const;
 
 private:
+    // Notify 클래스 하나에 대한 캐시 (테이블 조회/함수 캐스팅을 디스패치마다 반복하지 않도록)
+    struct FNotifyClassEntry
+    {
+        sol::table Class;
+        sol::protected_function Notify;
+        sol::protected_function NotifyBegin;
+        sol::protected_function NotifyTick;
+        sol::protected_function NotifyEnd;
+
+        // 인스턴스 메타테이블: 빈 페이로드용 { __index = Class }
+        sol::table ClassMetatable;
+        // PayloadId -> { __index = 프로퍼티 테이블 (→ Class) }
+        std::unordered_map<uint32, sol::table> PayloadMetatables;
+
+        bool IsValid() const { return Class.valid(); }
+    };
+
     // Notifies 폴더의 모든 Lua 파일을 로드하여 AnimNotify 테이블에 등록
     void LoadNotifyClasses();
+
+    FNotifyClassEntry MakeNotifyClassEntry(sol::table NotifyClass);
+    FNotifyClassEntry* FindNotifyClass(FName NotifyName);
+    FNotifyClassEntry* FindNotifyStateClass(FName NotifyName);
+
+    // 페이로드별로 한 번만 Lua 테이블로 변환하고, 디스패치마다 빈 인스턴스에 메타테이블만 연결한다
+    sol::table CreateNotifyInstance(FNotifyClassEntry& Entry, const struct FAnimNotifyPayload& Payload);
+
     sol::state* Lua = nullptr;
     sol::table SharedLib;                         // 공용 유틸 테이블
 
     FLuaCoroutineScheduler CoroutineSchedular;    // 씬 단위 Coroutine Manager
 
+    TMap<FName, FNotifyClassEntry> NotifyClassCache;       // Scripts/Notify (AnimNotify 테이블)
+    TMap<FName, FNotifyClassEntry> NotifyStateClassCache;  // Scripts/NotifyState (첫 사용 시 한 번만 로드, 실패도 기록)
+
     // NotifyState 인스턴스 캐시 (NotifyName + MeshComp 조합으로 식별)
     struct FNotifyStateKey
     {
-        FString NotifyName;
+        FName NotifyName;
         void* MeshCompPtr;
 
         bool operator==(const FNotifyStateKey& Other) const
@@ -60,11 +89,17 @@ private:
     {
         size_t operator()(const FNotifyStateKey& Key) const
         {
-            return std::hash<FString>()(Key.NotifyName) ^ std::hash<void*>()(Key.MeshCompPtr);
+            return std::hash<FName>()(Key.NotifyName) ^ std::hash<void*>()(Key.MeshCompPtr);
         }
     };
 
-    std::unordered_map<FNotifyStateKey, sol::table, FNotifyStateKeyHash> NotifyStateInstanceCache;
+    struct FNotifyStateInstance
+    {
+        sol::table Instance;
+        FNotifyClassEntry* Entry = nullptr;    // NotifyStateClassCache 노드 (unordered_map이라 주소 고정)
+    };
+
+    std::unordered_map<FNotifyStateKey, FNotifyStateInstance, FNotifyStateKeyHash> NotifyStateInstanceCache;
 };
 
 // Helper function to wrap C++ object pointers in LuaComponentProxy for Lua
@@ -66,8 +66,14 @@ void FBVHierarchy::Clear()
     StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
     Nodes = TArray<FLBVHNode>();
+    ++TreeVersion;
     Bounds = FAABB();
     bPendingRebuild = false;
+
+    // 전체 초기화는 모든 캐시를 무효화한다
+    ChangedRegions = TArray<FChangedRegion>();
+    PendingChangedRegions = TArray<FAABB>();
+    OldestTrackedRevision = ++ChangeRevision;
 }
 
 void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
@@ -76,7 +82,13 @@ void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
     {
         if (SMC)
         {
-            StaticMeshComponentBounds.Add(SMC, SMC->GetWorldAABB());
+            const FAABB WorldBounds = SMC->GetWorldAABB();
+            if (const FAABB* OldBounds = StaticMeshComponentBounds.Find(SMC))
+            {
+                RecordChangedRegion(*OldBounds);
+            }
+            RecordChangedRegion(WorldBounds);
+            StaticMeshComponentBounds.Add(SMC, WorldBounds);
         }
     }
 
@@ -101,6 +113,17 @@ void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
 
     const FAABB WorldBounds = InComponent->GetWorldAABB();
 
+    const FAABB* OldBounds = StaticMeshComponentBounds.Find(InComponent);
+    if (!OldBounds)
+    {
+        RecordChangedRegion(WorldBounds);
+    }
+    else if (!(OldBounds->Min == WorldBounds.Min && OldBounds->Max == WorldBounds.Max))
+    {
+        RecordChangedRegion(*OldBounds);
+        RecordChangedRegion(WorldBounds);
+    }
+
     StaticMeshComponentBounds.Add(InComponent, WorldBounds);
     bPendingRebuild = true;
 }
@@ -112,8 +135,10 @@ void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
         return;
     }
 
-    if (StaticMeshComponentBounds.Find(InComponent))
+    if (const FAABB* OldBounds = StaticMeshComponentBounds.Find(InComponent))
     {
+        // 제거된 컴포넌트는 곧 해제될 수 있으므로 리빌드를 기다리지 않고 즉시 기록
+        RecordChangedRegion(*OldBounds);
         StaticMeshComponentBounds.Remove(InComponent);
         bPendingRebuild = true;
     }
@@ -179,43 +204,19 @@ void FBVHierarchy::DebugDraw(URenderer* Renderer) const
     if (!Renderer) return;
     if (Nodes.empty()) return;
 
-    for (size_t i = 0; i < Nodes.size(); ++i)
+    if (DebugLinesVersion != TreeVersion)
     {
-        const FLBVHNode& N = Nodes[i];
-        const FVector Min = N.Bounds.Min;
-        const FVector Max = N.Bounds.Max;
-        const FVector4 LineColor(1.0f, N.IsLeaf() ? 0.2f : 0.8f, 0.0f, 1.0f);
-
-        TArray<FVector> Start;
-        TArray<FVector> End;
-        TArray<FVector4> Color;
-
-        const FVector v0(Min.X, Min.Y, Min.Z);
-        const FVector v1(Max.X, Min.Y, Min.Z);
-        const FVector v2(Max.X, Max.Y, Min.Z);
-        const FVector v3(Min.X, Max.Y, Min.Z);
-        const FVector v4(Min.X, Min.Y, Max.Z);
-        const FVector v5(Max.X, Min.Y, Max.Z);
-        const FVector v6(Max.X, Max.Y, Max.Z);
-        const FVector v7(Min.X, Max.Y, Max.Z);
-
-        Start.Add(v0); End.Add(v1); Color.Add(LineColor);
-        Start.Add(v1); End.Add(v2); Color.Add(LineColor);
-        Start.Add(v2); End.Add(v3); Color.Add(LineColor);
-        Start.Add(v3); End.Add(v0); Color.Add(LineColor);
-
-        Start.Add(v4); End.Add(v5); Color.Add(LineColor);
-        Start.Add(v5); End.Add(v6); Color.Add(LineColor);
-        Start.Add(v6); End.Add(v7); Color.Add(LineColor);
-        Start.Add(v7); End.Add(v4); Color.Add(LineColor);
-
-        Start.Add(v0); End.Add(v4); Color.Add(LineColor);
-        Start.Add(v1); End.Add(v5); Color.Add(LineColor);
-        Start.Add(v2); End.Add(v6); Color.Add(LineColor);
-        Start.Add(v3); End.Add(v7); Color.Add(LineColor);
-
-        Renderer->AddLines(Start, End, Color);
+        DebugLines.Reset();
+        DebugLines.Reserve(static_cast<int32>(Nodes.size()) * 12);
+        for (const FLBVHNode& N : Nodes)
+        {
+            const FVector4 LineColor(1.0f, N.IsLeaf() ? 0.2f : 0.8f, 0.0f, 1.0f);
+            DebugLines.AddBox(N.Bounds.Min, N.Bounds.Max, LineColor);
+        }
+        DebugLinesVersion = TreeVersion;
     }
+
+    Renderer->AddLines(DebugLines);
 }
 
 int FBVHierarchy::TotalNodeCount() const
@@ -269,11 +270,56 @@ namespace
     }
 }
 
+void FBVHierarchy::RecordChangedRegion(const FAABB& Region)
+{
+    ChangedRegions.Add(FChangedRegion{ Region, ++ChangeRevision });
+    PendingChangedRegions.Add(Region);
+
+    if (ChangedRegions.Num() > MaxChangedRegions)
+    {
+        const int32 DropCount = ChangedRegions.Num() / 2;
+        OldestTrackedRevision = ChangedRegions[DropCount - 1].Revision;
+        ChangedRegions.erase(ChangedRegions.begin(), ChangedRegions.begin() + DropCount);
+    }
+}
+
+bool FBVHierarchy::HasChangesInRegion(const FAABB& Region, uint64 SinceRevision) const
+{
+    if (SinceRevision < OldestTrackedRevision)
+    {
+        return true;
+    }
+
+    // 최신 변경부터 거슬러 올라가며 SinceRevision 이후 것만 검사
+    for (int32 i = ChangedRegions.Num() - 1; i >= 0; --i)
+    {
+        const FChangedRegion& Changed = ChangedRegions[i];
+        if (Changed.Revision <= SinceRevision)
+        {
+            break;
+        }
+        if (Changed.Bounds.Intersects(Region))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void FBVHierarchy::BuildLBVH()
 {
+    // Update로 들어온 변경은 트리를 다시 만든 뒤에야 쿼리에 보이므로 리빌드 시점 리비전으로 한 번 더 남긴다
+    TArray<FAABB> Pending = std::move(PendingChangedRegions);
+    for (const FAABB& Region : Pending)
+    {
+        RecordChangedRegion(Region);
+    }
+    PendingChangedRegions.Empty();
+
     StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
     const int N = StaticMeshComponentArray.Num();
     Nodes = TArray<FLBVHNode>();
+    ++TreeVersion;
 
     if (N == 0)
     {
@@ -567,6 +613,102 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FOBB
     );
 }
 
+void FBVHierarchy::QueryIntersectedComponentsBatch(const TArray<FOBB>& InBounds, TArray<TArray<UPrimitiveComponent*>>& OutResults) const
+{
+    OutResults.SetNum(InBounds.Num());
+    for (TArray<UPrimitiveComponent*>& Result : OutResults)
+    {
+        Result.Empty();
+    }
+    if (Nodes.empty() || InBounds.IsEmpty())
+        return;
+
+    // OBB를 감싸는 AABB로 먼저 거르고, 통과한 것만 SAT 검사
+    TArray<FAABB> QueryAABBs;
+    QueryAABBs.reserve(InBounds.Num());
+    for (const FOBB& Obb : InBounds)
+    {
+        FVector Extent(0.0f, 0.0f, 0.0f);
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            Extent = Extent + FVector(std::abs(Obb.Axes[Axis].X), std::abs(Obb.Axes[Axis].Y), std::abs(Obb.Axes[Axis].Z)) * Obb.HalfExtent[Axis];
+        }
+        QueryAABBs.Add(FAABB(Obb.Center - Extent, Obb.Center + Extent));
+    }
+    auto Overlaps = [&](const FAABB& Box, int32 QueryIndex)
+    {
+        return QueryAABBs[QueryIndex].Intersects(Box) && Collision::Intersects(Box, InBounds[QueryIndex]);
+    };
+
+    // 스택 항목은 ActiveQueries[Begin, Begin + Count) 구간을 소유한다.
+    // 항목을 꺼낼 때 그 뒤에 쌓인 구간은 모두 처리가 끝난 것이므로 잘라내 메모리를 재사용한다.
+    struct FStackEntry
+    {
+        int32 NodeIndex;
+        int32 Begin;
+        int32 Count;
+    };
+    TArray<FStackEntry> Stack;
+    TArray<int32> ActiveQueries;
+
+    for (int32 i = 0; i < InBounds.Num(); ++i)
+    {
+        if (Overlaps(Nodes[0].Bounds, i))
+        {
+            ActiveQueries.Add(i);
+        }
+    }
+    if (ActiveQueries.IsEmpty())
+        return;
+    Stack.Add(FStackEntry{ 0, 0, ActiveQueries.Num() });
+
+    while (!Stack.IsEmpty())
+    {
+        const FStackEntry Entry = Stack.Pop();
+        ActiveQueries.SetNum(Entry.Begin + Entry.Count);
+        const FLBVHNode& Node = Nodes[Entry.NodeIndex];
+
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
+                const FAABB* Box = Component ? StaticMeshComponentBounds.Find(Component) : nullptr;
+                if (!Box)
+                    continue;
+                for (int32 q = Entry.Begin; q < Entry.Begin + Entry.Count; ++q)
+                {
+                    const int32 QueryIndex = ActiveQueries[q];
+                    if (Overlaps(*Box, QueryIndex))
+                    {
+                        OutResults[QueryIndex].Add(Component);
+                    }
+                }
+            }
+            continue;
+        }
+
+        for (const int32 Child : { Node.Left, Node.Right })
+        {
+            if (Child < 0)
+                continue;
+            const int32 ChildBegin = ActiveQueries.Num();
+            for (int32 q = Entry.Begin; q < Entry.Begin + Entry.Count; ++q)
+            {
+                const int32 QueryIndex = ActiveQueries[q];
+                if (Overlaps(Nodes[Child].Bounds, QueryIndex))
+                {
+                    ActiveQueries.Add(QueryIndex);
+                }
+            }
+            if (ActiveQueries.Num() > ChildBegin)
+            {
+                Stack.Add(FStackEntry{ Child, ChildBegin, ActiveQueries.Num() - ChildBegin });
+            }
+        }
+    }
+}
+
 // FBoundingSphere 오버로드
 TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FBoundingSphere& InBound) const
 {
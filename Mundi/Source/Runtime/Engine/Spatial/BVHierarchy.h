@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include "DebugDrawManager.h"
 
 struct FFrustum;
 struct FRay; // forward declaration for ray type
@@ -33,11 +34,33 @@ public:
     void FlushRebuild();
 
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
+
+    /**
+     * @brief Extent만큼 부풀린 노드 AABB와 광선이 만나는 컴포넌트를 가까운 노드부터 방문 (힙 할당 없음)
+     * @param InvDirection 정규화된 방향의 역수 (0 성분은 아주 큰 값으로 대체해서 전달)
+     * @param Visit float(UPrimitiveComponent*, const FAABB& WorldBox, float MaxDistance)
+     *        반환값이 새 최대 거리가 되어 그보다 먼 노드는 건너뛴다
+     */
+    template<typename VisitFunc>
+    void TraverseRay(const FVector& Origin, const FVector& InvDirection, const FVector& Extent, float MaxDistance, VisitFunc&& Visit) const;
     void QueryFrustum(const FFrustum& InFrustum);
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
 
+    /**
+     * @brief 여러 OBB를 한 번의 트리 순회로 처리 (OutResults[i] = InBounds[i]와 겹치는 컴포넌트)
+     * 노드마다 아직 겹치는 쿼리 인덱스만 자식으로 넘긴다. 데칼 리시버 일괄 갱신용
+     */
+    void QueryIntersectedComponentsBatch(const TArray<FOBB>& InBounds, TArray<TArray<UPrimitiveComponent*>>& OutResults) const;
+
+    /**
+     * 변경 리비전: 컴포넌트 추가/이동/제거 또는 리빌드마다 증가하고, 바뀐 영역(이전/이후 AABB)을 기록한다.
+     * 쿼리 결과를 캐시하는 쪽은 리비전을 저장해 두었다가 HasChangesInRegion으로 재사용 여부를 판단한다.
+     */
+    uint64 GetChangeRevision() const { return ChangeRevision; }
+    bool HasChangesInRegion(const FAABB& Region, uint64 SinceRevision) const;
+
     void DebugDraw(URenderer* Renderer) const;
 
     // Debug/Stats
@@ -71,6 +94,28 @@ private:
 
     int BuildRange(int s, int e);
 
+    void RecordChangedRegion(const FAABB& Region);
+
+    static bool IntersectsExpandedBox(const FAABB& Box, const FVector& Extent, const FVector& Origin, const FVector& InvDirection, float MaxDistance, float& OutEnter)
+    {
+        float Enter = 0.0f;
+        float Exit = MaxDistance;
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            float T0 = (Box.Min[Axis] - Extent[Axis] - Origin[Axis]) * InvDirection[Axis];
+            float T1 = (Box.Max[Axis] + Extent[Axis] - Origin[Axis]) * InvDirection[Axis];
+            if (T0 > T1) std::swap(T0, T1);
+            Enter = std::max(Enter, T0);
+            Exit = std::min(Exit, T1);
+            if (Enter > Exit) return false;
+        }
+        OutEnter = Enter;
+        return true;
+    }
+
+    // LBVH는 인덱스 중앙 분할이라 깊이가 log2(N) + 1을 넘지 않는다
+    static constexpr int32 MaxTraversalStack = 64;
+
     int Depth;
     int MaxDepth;
     int MaxObjects;
@@ -83,4 +128,92 @@ private:
     TArray<FLBVHNode> Nodes;
 
     bool bPendingRebuild = false;
+
+    // === 변경 영역 로그 ===
+    struct FChangedRegion
+    {
+        FAABB Bounds;
+        uint64 Revision = 0;
+    };
+    // 로그가 넘치면 오래된 절반을 버린다 (그보다 오래된 리비전은 전부 변경된 것으로 취급)
+    static constexpr int32 MaxChangedRegions = 4096;
+
+    TArray<FChangedRegion> ChangedRegions;
+    TArray<FAABB> PendingChangedRegions;   // 아직 트리에 반영되지 않은 변경 (리빌드 시 다시 기록)
+    uint64 ChangeRevision = 0;
+    uint64 OldestTrackedRevision = 0;
+
+    // === 디버그 드로우 ===
+    // 노드 박스 선분은 트리가 다시 만들어질 때만 재생성하고 그 외 프레임에는 그대로 재사용한다
+    uint64 TreeVersion = 0;
+    mutable uint64 DebugLinesVersion = ~0ull;
+    mutable FDebugLineBuffer DebugLines;
 };
+
+template<typename VisitFunc>
+void FBVHierarchy::TraverseRay(const FVector& Origin, const FVector& InvDirection, const FVector& Extent, float MaxDistance, VisitFunc&& Visit) const
+{
+    if (Nodes.empty()) return;
+
+    struct FStackEntry
+    {
+        int32 NodeIndex;
+        float EnterDistance;
+    };
+    FStackEntry Stack[MaxTraversalStack];
+    int32 StackSize = 0;
+
+    float RootEnter;
+    if (!IntersectsExpandedBox(Nodes[0].Bounds, Extent, Origin, InvDirection, MaxDistance, RootEnter)) return;
+    Stack[StackSize++] = { 0, RootEnter };
+
+    while (StackSize > 0)
+    {
+        const FStackEntry Entry = Stack[--StackSize];
+        if (Entry.EnterDistance > MaxDistance) continue;
+
+        const FLBVHNode& Node = Nodes[Entry.NodeIndex];
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
+                if (!Component) continue;
+
+                // 리빌드 전에 Remove된 컴포넌트는 이미 해제되었을 수 있으므로 맵에 남아있는 것만 방문
+                const FAABB* Box = StaticMeshComponentBounds.Find(Component);
+                float ComponentEnter;
+                if (!Box || !IntersectsExpandedBox(*Box, Extent, Origin, InvDirection, MaxDistance, ComponentEnter)) continue;
+
+                MaxDistance = Visit(Component, *Box, MaxDistance);
+            }
+            continue;
+        }
+
+        // 먼 자식을 먼저 쌓아 가까운 자식이 먼저 나오도록 한다
+        float LeftEnter = 0.0f, RightEnter = 0.0f;
+        const bool bHitLeft = Node.Left >= 0 && IntersectsExpandedBox(Nodes[Node.Left].Bounds, Extent, Origin, InvDirection, MaxDistance, LeftEnter);
+        const bool bHitRight = Node.Right >= 0 && IntersectsExpandedBox(Nodes[Node.Right].Bounds, Extent, Origin, InvDirection, MaxDistance, RightEnter);
+        if (bHitLeft && bHitRight && StackSize + 2 <= MaxTraversalStack)
+        {
+            if (LeftEnter <= RightEnter)
+            {
+                Stack[StackSize++] = { Node.Right, RightEnter };
+                Stack[StackSize++] = { Node.Left, LeftEnter };
+            }
+            else
+            {
+                Stack[StackSize++] = { Node.Left, LeftEnter };
+                Stack[StackSize++] = { Node.Right, RightEnter };
+            }
+        }
+        else if (bHitLeft && StackSize < MaxTraversalStack)
+        {
+            Stack[StackSize++] = { Node.Left, LeftEnter };
+        }
+        else if (bHitRight && StackSize < MaxTraversalStack)
+        {
+            Stack[StackSize++] = { Node.Right, RightEnter };
+        }
+    }
+}
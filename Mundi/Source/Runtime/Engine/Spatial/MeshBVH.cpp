@@ -1,333 +1,760 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
+#include "PlatformTime.h"
+#include <immintrin.h>
+#include <thread>
 
-void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+namespace
 {
-	TriIndices.Empty();
-	Nodes.Empty();
-	uint32 TriCount = Indices.Num() / 3;
-	if (TriCount == 0) return;
+	constexpr uint32 MeshBVHMagic = 0x34485642; // "BVH4"
+	constexpr uint32 MeshBVHVersion = 1;
+
+	constexpr int32 NumSAHBins = 16;
+	constexpr uint32 MaxLeafSize = 8;                  // 리프당 최대 삼각형 수 (패킷 2개)
+	constexpr uint32 ParallelBuildThreshold = 32768;   // 이보다 큰 서브트리는 별도 스레드에서 빌드
+	constexpr int32 MaxParallelDepth = 3;              // 최대 2^3개 스레드
+	constexpr int32 MaxSAHDepth = 48;                  // 이보다 깊어지면 중앙값 분할로 깊이를 제한 (탐색 스택 크기 보장)
+	constexpr int32 TraversalStackSize = 256;
+	constexpr float TraversalCost = 1.0f;
+	constexpr float PacketCost = 1.0f;
+
+	struct FBuildBounds
+	{
+		FVector Min = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
 
-	TriIndices.Reserve(TriCount);
-	for (uint32 t = 0; t < TriCount; ++t)
-		TriIndices.Add(t);
+		void Grow(const FVector& Point)
+		{
+			Min = Min.ComponentMin(Point);
+			Max = Max.ComponentMax(Point);
+		}
 
-	BuildRecursive(0, TriCount, Vertices, Indices);
-}
+		void Grow(const FBuildBounds& Other)
+		{
+			Min = Min.ComponentMin(Other.Min);
+			Max = Max.ComponentMax(Other.Max);
+		}
 
-// 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
-// Möller–Trumbore로 교차 체크 ! 
-bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
-	const TArray<FNormalVertex>& InVertices,
-	const TArray<uint32>& InIndices,
-	float& OutHitDistance)
-{
-	if (Nodes.Num() == 0)
+		float SurfaceArea() const
+		{
+			const FVector Extent = Max - Min;
+			if (Extent.X < 0.0f)
+			{
+				return 0.0f;
+			}
+			return 2.0f * (Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X);
+		}
+	};
+
+	// SAH 빌드 중간 결과 (이진 트리)
+	struct FBuildNode
 	{
-		return false;
+		FBuildBounds Bounds;
+		int32 Left = -1;
+		int32 Right = -1;
+		uint32 Start = 0;
+		uint32 Count = 0;   // 0보다 크면 리프
+	};
+
+	struct FBuildContext
+	{
+		TArray<FBuildBounds> TriBounds;
+		TArray<FVector> TriCenters;
+		TArray<uint32> TriIndices;   // 서브트리마다 겹치지 않는 구간만 재배치하므로 스레드 간 공유 가능
+	};
+
+	struct FSAHSplit
+	{
+		int32 Axis = -1;
+		int32 Bin = 0;         // [0, Bin) 빈은 왼쪽, [Bin, NumSAHBins) 빈은 오른쪽
+		float Cost = FLT_MAX;  // 자식 표면적 * 패킷 수의 합
+		float AxisMin = 0.0f;
+		float Scale = 0.0f;
+	};
+
+	uint32 NumPackets(uint32 TriCount)
+	{
+		return (TriCount + 3) / 4;
 	}
 
-	float RootEntry, RootExit;
-	if (!Nodes[0].Bounds.IntersectsRay(InLocalRay, RootEntry, RootExit))
+	// 분할 탐색과 실제 분할이 같은 식을 써야 빈 경계에서 어긋나지 않는다
+	int32 ComputeBin(const FVector& Center, int32 Axis, float AxisMin, float Scale)
 	{
-		return false;
+		const int32 Bin = static_cast<int32>((Center[Axis] - AxisMin) * Scale);
+		return std::min(std::max(Bin, 0), NumSAHBins - 1);
 	}
 
-	struct FHeapItem
+	FSAHSplit FindSAHSplit(const FBuildContext& Ctx, uint32 Start, uint32 Count)
 	{
-		int NodeIndex;
-		float EntryDistance;
+		FBuildBounds CentroidBounds;
+		for (uint32 i = Start; i < Start + Count; ++i)
+		{
+			CentroidBounds.Grow(Ctx.TriCenters[Ctx.TriIndices[i]]);
+		}
 
-		bool operator>(const FHeapItem& Other) const
+		FSAHSplit Best;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
 		{
-			return EntryDistance > Other.EntryDistance; // 최소 힙
+			const float AxisMin = CentroidBounds.Min[Axis];
+			const float Extent = CentroidBounds.Max[Axis] - AxisMin;
+			if (!(Extent > 0.0f))
+			{
+				continue;
+			}
+			const float Scale = NumSAHBins / Extent;
+
+			FBuildBounds BinBounds[NumSAHBins];
+			uint32 BinCounts[NumSAHBins] = {};
+			for (uint32 i = Start; i < Start + Count; ++i)
+			{
+				const uint32 Tri = Ctx.TriIndices[i];
+				const int32 Bin = ComputeBin(Ctx.TriCenters[Tri], Axis, AxisMin, Scale);
+				++BinCounts[Bin];
+				BinBounds[Bin].Grow(Ctx.TriBounds[Tri]);
+			}
+
+			// 오른쪽부터 누적한 표면적/개수
+			float RightArea[NumSAHBins] = {};
+			uint32 RightCount[NumSAHBins] = {};
+			FBuildBounds Accum;
+			uint32 AccumCount = 0;
+			for (int32 Bin = NumSAHBins - 1; Bin > 0; --Bin)
+			{
+				Accum.Grow(BinBounds[Bin]);
+				AccumCount += BinCounts[Bin];
+				RightArea[Bin] = Accum.SurfaceArea();
+				RightCount[Bin] = AccumCount;
+			}
+
+			Accum = FBuildBounds();
+			AccumCount = 0;
+			for (int32 Bin = 1; Bin < NumSAHBins; ++Bin)
+			{
+				Accum.Grow(BinBounds[Bin - 1]);
+				AccumCount += BinCounts[Bin - 1];
+				if (AccumCount == 0 || RightCount[Bin] == 0)
+				{
+					continue;
+				}
+
+				const float Cost = Accum.SurfaceArea() * NumPackets(AccumCount) + RightArea[Bin] * NumPackets(RightCount[Bin]);
+				if (Cost < Best.Cost)
+				{
+					Best.Axis = Axis;
+					Best.Bin = Bin;
+					Best.Cost = Cost;
+					Best.AxisMin = AxisMin;
+					Best.Scale = Scale;
+				}
+			}
 		}
-	};
+		return Best;
+	}
 
-	std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
-	Heap.push({ 0, RootEntry });
+	int32 BuildSubtree(FBuildContext& Ctx, TArray<FBuildNode>& OutNodes, uint32 Start, uint32 Count, int32 Depth);
 
-	while (!Heap.empty())
+	// 다른 스레드에서 만든 서브트리를 OutNodes 뒤에 붙이고 그 루트 인덱스를 반환
+	int32 AppendSubtree(TArray<FBuildNode>& OutNodes, const TArray<FBuildNode>& Subtree)
 	{
-		FHeapItem Current = Heap.top();
-		Heap.pop();
-
-		const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
-		if (Node.IsLeaf())
+		const int32 Offset = OutNodes.Num();
+		for (FBuildNode Node : Subtree)
 		{
-			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
+			if (Node.Count == 0)
 			{
-				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
+				Node.Left += Offset;
+				Node.Right += Offset;
+			}
+			OutNodes.Add(Node);
+		}
+		return Offset;
+	}
+
+	int32 BuildSubtree(FBuildContext& Ctx, TArray<FBuildNode>& OutNodes, uint32 Start, uint32 Count, int32 Depth)
+	{
+		const int32 NodeIndex = OutNodes.Num();
+		OutNodes.Add(FBuildNode());
 
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
+		FBuildBounds Bounds;
+		for (uint32 i = Start; i < Start + Count; ++i)
+		{
+			Bounds.Grow(Ctx.TriBounds[Ctx.TriIndices[i]]);
+		}
+		OutNodes[NodeIndex].Bounds = Bounds;
 
-				float HitT = 0.0f;
-				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
+		uint32 Mid = Start;
+		if (Count > 1 && Depth < MaxSAHDepth)
+		{
+			const FSAHSplit Split = FindSAHSplit(Ctx, Start, Count);
+			if (Split.Axis >= 0)
+			{
+				// 리프로 남기는 비용과 비교해 나누는 쪽이 싸거나, 리프에 담을 수 없을 때만 분할
+				const float SplitCost = TraversalCost + PacketCost * Split.Cost / std::max(Bounds.SurfaceArea(), 1e-20f);
+				const float LeafCost = PacketCost * NumPackets(Count);
+				if (Count > MaxLeafSize || SplitCost < LeafCost)
 				{
-					OutHitDistance = HitT;
-					return true; // 🚀 첫 번째 히트 → 바로 종료
+					auto SplitIt = std::partition(
+						Ctx.TriIndices.begin() + Start,
+						Ctx.TriIndices.begin() + Start + Count,
+						[&](uint32 Tri)
+						{
+							return ComputeBin(Ctx.TriCenters[Tri], Split.Axis, Split.AxisMin, Split.Scale) < Split.Bin;
+						});
+					Mid = static_cast<uint32>(SplitIt - Ctx.TriIndices.begin());
 				}
 			}
 		}
+
+		// 중심점이 모두 겹치거나 깊이 제한에 걸렸는데 리프에 담기엔 많으면 가장 긴 축 중앙값 분할
+		if (Mid == Start && Count > MaxLeafSize)
+		{
+			const FVector Extent = Bounds.Max - Bounds.Min;
+			const int32 Axis = (Extent.X >= Extent.Y && Extent.X >= Extent.Z) ? 0 : (Extent.Y >= Extent.Z ? 1 : 2);
+			Mid = Start + Count / 2;
+			std::nth_element(
+				Ctx.TriIndices.begin() + Start,
+				Ctx.TriIndices.begin() + Mid,
+				Ctx.TriIndices.begin() + Start + Count,
+				[&](uint32 A, uint32 B) { return Ctx.TriCenters[A][Axis] < Ctx.TriCenters[B][Axis]; });
+		}
+
+		if (Mid == Start || Mid == Start + Count)
+		{
+			OutNodes[NodeIndex].Start = Start;
+			OutNodes[NodeIndex].Count = Count;
+			return NodeIndex;
+		}
+
+		int32 Left, Right;
+		if (Count >= ParallelBuildThreshold && Depth < MaxParallelDepth)
+		{
+			// 왼쪽은 별도 스레드의 로컬 배열에, 오른쪽은 현재 스레드에서 바로 빌드한 뒤 합친다
+			TArray<FBuildNode> LeftNodes;
+			std::thread LeftThread([&Ctx, &LeftNodes, Start, Mid, Depth]()
+			{
+				BuildSubtree(Ctx, LeftNodes, Start, Mid - Start, Depth + 1);
+			});
+			Right = BuildSubtree(Ctx, OutNodes, Mid, Start + Count - Mid, Depth + 1);
+			LeftThread.join();
+			Left = AppendSubtree(OutNodes, LeftNodes);
+		}
 		else
 		{
-			if (Node.Left >= 0)
+			Left = BuildSubtree(Ctx, OutNodes, Start, Mid - Start, Depth + 1);
+			Right = BuildSubtree(Ctx, OutNodes, Mid, Start + Count - Mid, Depth + 1);
+		}
+
+		OutNodes[NodeIndex].Left = Left;
+		OutNodes[NodeIndex].Right = Right;
+		return NodeIndex;
+	}
+
+	// 리프 삼각형을 4개씩 SoA 패킷으로 복사하고 첫 패킷 인덱스를 반환
+	uint32 EmitPackets(const FBuildContext& Ctx, const FBuildNode& Leaf, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, TArray<FMeshBVHTriPacket>& OutPackets)
+	{
+		const uint32 FirstPacket = OutPackets.Num();
+		for (uint32 Offset = 0; Offset < Leaf.Count; Offset += 4)
+		{
+			FMeshBVHTriPacket Packet{};
+			for (uint32 Lane = 0; Lane < 4 && Offset + Lane < Leaf.Count; ++Lane)
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Left, ChildEntry });
-				}
+				const uint32 Tri = Ctx.TriIndices[Leaf.Start + Offset + Lane];
+				const FVector& A = Vertices[Indices[3 * Tri + 0]].pos;
+				const FVector Edge1 = Vertices[Indices[3 * Tri + 1]].pos - A;
+				const FVector Edge2 = Vertices[Indices[3 * Tri + 2]].pos - A;
+
+				Packet.V0X[Lane] = A.X;     Packet.V0Y[Lane] = A.Y;     Packet.V0Z[Lane] = A.Z;
+				Packet.E1X[Lane] = Edge1.X; Packet.E1Y[Lane] = Edge1.Y; Packet.E1Z[Lane] = Edge1.Z;
+				Packet.E2X[Lane] = Edge2.X; Packet.E2Y[Lane] = Edge2.Y; Packet.E2Z[Lane] = Edge2.Z;
+				Packet.TriangleId[Lane] = Tri;
 			}
-			if (Node.Right >= 0)
+			OutPackets.Add(Packet);
+		}
+		return FirstPacket;
+	}
+
+	// 이진 트리를 4-wide 노드로 접는다. 표면적이 가장 큰 내부 자식부터 펼쳐 4칸을 채운다.
+	int32 CollapseNode(const FBuildContext& Ctx, const TArray<FBuildNode>& BinNodes, int32 BinIndex,
+		const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices,
+		TArray<FMeshBVHNode4>& OutNodes, TArray<FMeshBVHTriPacket>& OutPackets)
+	{
+		int32 Slots[4];
+		int32 SlotCount = 0;
+		const FBuildNode& Root = BinNodes[BinIndex];
+		if (Root.Count > 0)
+		{
+			Slots[SlotCount++] = BinIndex;
+		}
+		else
+		{
+			Slots[SlotCount++] = Root.Left;
+			Slots[SlotCount++] = Root.Right;
+		}
+
+		while (SlotCount < 4)
+		{
+			int32 OpenSlot = -1;
+			float OpenArea = -1.0f;
+			for (int32 Slot = 0; Slot < SlotCount; ++Slot)
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
+				const FBuildNode& Candidate = BinNodes[Slots[Slot]];
+				if (Candidate.Count == 0 && Candidate.Bounds.SurfaceArea() > OpenArea)
 				{
-					Heap.push({ Node.Right, ChildEntry });
+					OpenSlot = Slot;
+					OpenArea = Candidate.Bounds.SurfaceArea();
 				}
 			}
+			if (OpenSlot < 0)
+			{
+				break;
+			}
+			const FBuildNode& Opened = BinNodes[Slots[OpenSlot]];
+			Slots[OpenSlot] = Opened.Left;
+			Slots[SlotCount++] = Opened.Right;
+		}
+
+		FMeshBVHNode4 Node;
+		for (int32 Slot = 0; Slot < 4; ++Slot)
+		{
+			Node.MinX[Slot] = Node.MinY[Slot] = Node.MinZ[Slot] = FLT_MAX;
+			Node.MaxX[Slot] = Node.MaxY[Slot] = Node.MaxZ[Slot] = -FLT_MAX;
+			Node.Child[Slot] = ~0;
+			Node.PacketCount[Slot] = 0;
+		}
+		const int32 NodeIndex = OutNodes.Num();
+		OutNodes.Add(Node);
+
+		for (int32 Slot = 0; Slot < SlotCount; ++Slot)
+		{
+			const FBuildNode& Child = BinNodes[Slots[Slot]];
+			int32 ChildRef;
+			uint32 ChildPackets = 0;
+			if (Child.Count > 0)
+			{
+				ChildRef = ~static_cast<int32>(EmitPackets(Ctx, Child, Vertices, Indices, OutPackets));
+				ChildPackets = NumPackets(Child.Count);
+			}
+			else
+			{
+				ChildRef = CollapseNode(Ctx, BinNodes, Slots[Slot], Vertices, Indices, OutNodes, OutPackets);
+			}
+
+			// 재귀 호출로 OutNodes가 재할당될 수 있으므로 인덱스로 다시 접근
+			FMeshBVHNode4& Dest = OutNodes[NodeIndex];
+			Dest.MinX[Slot] = Child.Bounds.Min.X;
+			Dest.MinY[Slot] = Child.Bounds.Min.Y;
+			Dest.MinZ[Slot] = Child.Bounds.Min.Z;
+			Dest.MaxX[Slot] = Child.Bounds.Max.X;
+			Dest.MaxY[Slot] = Child.Bounds.Max.Y;
+			Dest.MaxZ[Slot] = Child.Bounds.Max.Z;
+			Dest.Child[Slot] = ChildRef;
+			Dest.PacketCount[Slot] = ChildPackets;
+		}
+		return NodeIndex;
+	}
+
+	// 0인 방향 성분은 아주 작은 값으로 바꿔 역수가 항상 유한하도록 한다
+	float SafeInverse(float Value)
+	{
+		if (std::fabs(Value) < 1e-20f)
+		{
+			Value = (Value < 0.0f) ? -1e-20f : 1e-20f;
 		}
+		return 1.0f / Value;
 	}
 
-	return false;
+	struct FRayLanes
+	{
+		__m128 OX, OY, OZ;
+		__m128 DX, DY, DZ;
+		__m128 InvX, InvY, InvZ;
+	};
+
+	// 삼각형 4개에 대한 Möller–Trumbore. 더 가까운 교차가 있으면 InOutBestT/OutTriangleId 갱신
+	bool IntersectPacket(const FMeshBVHTriPacket& Packet, const FRayLanes& Ray, float& InOutBestT, uint32& OutTriangleId)
+	{
+		const __m128 E1X = _mm_load_ps(Packet.E1X);
+		const __m128 E1Y = _mm_load_ps(Packet.E1Y);
+		const __m128 E1Z = _mm_load_ps(Packet.E1Z);
+		const __m128 E2X = _mm_load_ps(Packet.E2X);
+		const __m128 E2Y = _mm_load_ps(Packet.E2Y);
+		const __m128 E2Z = _mm_load_ps(Packet.E2Z);
+
+		// P = D x E2
+		const __m128 PX = _mm_sub_ps(_mm_mul_ps(Ray.DY, E2Z), _mm_mul_ps(Ray.DZ, E2Y));
+		const __m128 PY = _mm_sub_ps(_mm_mul_ps(Ray.DZ, E2X), _mm_mul_ps(Ray.DX, E2Z));
+		const __m128 PZ = _mm_sub_ps(_mm_mul_ps(Ray.DX, E2Y), _mm_mul_ps(Ray.DY, E2X));
+
+		const __m128 Det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(E1X, PX), _mm_mul_ps(E1Y, PY)), _mm_mul_ps(E1Z, PZ));
+		const __m128 InvDet = _mm_div_ps(_mm_set1_ps(1.0f), Det);
+
+		// S = O - V0
+		const __m128 SX = _mm_sub_ps(Ray.OX, _mm_load_ps(Packet.V0X));
+		const __m128 SY = _mm_sub_ps(Ray.OY, _mm_load_ps(Packet.V0Y));
+		const __m128 SZ = _mm_sub_ps(Ray.OZ, _mm_load_ps(Packet.V0Z));
+		const __m128 U = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(SX, PX), _mm_mul_ps(SY, PY)), _mm_mul_ps(SZ, PZ)), InvDet);
+
+		// Q = S x E1
+		const __m128 QX = _mm_sub_ps(_mm_mul_ps(SY, E1Z), _mm_mul_ps(SZ, E1Y));
+		const __m128 QY = _mm_sub_ps(_mm_mul_ps(SZ, E1X), _mm_mul_ps(SX, E1Z));
+		const __m128 QZ = _mm_sub_ps(_mm_mul_ps(SX, E1Y), _mm_mul_ps(SY, E1X));
+		const __m128 V = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Ray.DX, QX), _mm_mul_ps(Ray.DY, QY)), _mm_mul_ps(Ray.DZ, QZ)), InvDet);
+		const __m128 T = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(E2X, QX), _mm_mul_ps(E2Y, QY)), _mm_mul_ps(E2Z, QZ)), InvDet);
+
+		// 빈 레인(Edge = 0)과 퇴화 삼각형은 행렬식 검사에서 걸러진다. NaN 레인은 비교 결과가 모두 false
+		const __m128 Epsilon = _mm_set1_ps(KINDA_SMALL_NUMBER);
+		const __m128 AbsDet = _mm_andnot_ps(_mm_set1_ps(-0.0f), Det);
+		__m128 Mask = _mm_cmpgt_ps(AbsDet, _mm_set1_ps(1e-20f));
+		Mask = _mm_and_ps(Mask, _mm_cmpge_ps(U, _mm_sub_ps(_mm_setzero_ps(), Epsilon)));
+		Mask = _mm_and_ps(Mask, _mm_cmpge_ps(V, _mm_sub_ps(_mm_setzero_ps(), Epsilon)));
+		Mask = _mm_and_ps(Mask, _mm_cmple_ps(_mm_add_ps(U, V), _mm_add_ps(_mm_set1_ps(1.0f), Epsilon)));
+		Mask = _mm_and_ps(Mask, _mm_cmpgt_ps(T, Epsilon));
+		Mask = _mm_and_ps(Mask, _mm_cmplt_ps(T, _mm_set1_ps(InOutBestT)));
+
+		const int32 HitBits = _mm_movemask_ps(Mask);
+		if (HitBits == 0)
+		{
+			return false;
+		}
+
+		alignas(16) float HitT[4];
+		_mm_store_ps(HitT, T);
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			if ((HitBits & (1 << Lane)) && HitT[Lane] < InOutBestT)
+			{
+				InOutBestT = HitT[Lane];
+				OutTriangleId = Packet.TriangleId[Lane];
+			}
+		}
+		return true;
+	}
 }
-//bool FMeshBVH::IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance)
-//{
-//	if (Nodes.Num() == 0)
-//	{
-//		return false;
-//	}
-//
-//	TArray<FStackItem> NodeStack;
-//
-//	float RootEntryDistance, RootExitDistance;
-//	// 루트 노드가 안맞으면 바로 리턴 
-//	if (!Nodes[0].Bounds.RayAABB_IntersectT(InLocalRay, RootEntryDistance, RootExitDistance))
-//	{
-//		return false;
-//	}
-//	// 가장 늦게 나간 RootEntryDistance
-//	// 삼각형 리스트 인덱스 , 디스턴스 값 저장 
-//	NodeStack.Add({ 0, RootEntryDistance });
-//	bool bHasHit = false;
-//	float ClosestHitDistance = std::numeric_limits<float>::infinity();
-//
-//	// 깊이 우선 탐색 (DFS). 
-//	// 이미 더 가까운 교차가 있으면 멀리 있는 노드는 스킵.
-//	while (!NodeStack.IsEmpty())
-//	{
-//		const FStackItem CurrentItem = NodeStack.Pop();
-//		// 이미 가까운 교차가 있으면 무시 
-//		if (CurrentItem.EntryDistance > ClosestHitDistance)
-//		{
-//			continue;
-//		}
-//
-//		const FMeshBVHNode& CurrentNode = Nodes[CurrentItem.NodeIndex];
-//		if (CurrentNode.IsLeaf())
-//		{
-//			// 총 삼각형의 개수 만큼 돈다. 
-//			for (uint32 TriangleOffset = 0; TriangleOffset < CurrentNode.Count; ++TriangleOffset)
-//			{
-//				// 삼각형 배열에서 시작 위치 Start, TriangleOffset 삼각형의 총 개수만큼 돈다. 
-//				// 그쪽 영역의 삼각형이기 때문이다
-//				const uint32 TriangleID = TriIndices[CurrentNode.Start + TriangleOffset];
-//
-//				const uint32 VertexIndex0 = InIndices[3 * TriangleID + 0];
-//				const uint32 VertexIndex1 = InIndices[3 * TriangleID + 1];
-//				const uint32 VertexIndex2 = InIndices[3 * TriangleID + 2];
-//
-//				const FVector& VertexA = InVertices[VertexIndex0].pos;
-//				const FVector& VertexB = InVertices[VertexIndex1].pos;
-//				const FVector& VertexC = InVertices[VertexIndex2].pos;
-//
-//				float HitDistance = 0.0f;
-//				if (IntersectRayTriangleMT(InLocalRay, VertexA, VertexB, VertexC, HitDistance))
-//				{
-//					if (HitDistance < ClosestHitDistance)
-//					{
-//						ClosestHitDistance = HitDistance;
-//						bHasHit = true;
-//					}
-//				}
-//			}
-//			continue;
-//		}
-//
-//		// 내부 노드 → 자식 검사
-//		// 삼각형에 맞으면, 검사 영역에 넣어주고 맞지 않으면 넣어주지 않는다. 
-//		if (CurrentNode.Left >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Left].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Left, ChildEntry });
-//			}
-//		}
-//		if (CurrentNode.Right >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Right].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Right, ChildEntry });
-//			}
-//		}
-//	}
-//
-//	if (bHasHit)
-//	{
-//		OutHitDistance = ClosestHitDistance;
-//		return true;
-//	}
-//	return false;
-//}
-
-FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+
+void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
 {
-	// TriangleID : 몇 번째 삼각형인지 (0번, 1번 , 2번)
-	uint32 VertexIndex0, VertexIndex1, VertexIndex2;
-
-	// 순차적으로 꺼내온다. 
-	VertexIndex0 = Indices[3 * TriangleID + 0];
-	VertexIndex1 = Indices[3 * TriangleID + 1];
-	VertexIndex2 = Indices[3 * TriangleID + 2];
-
-
-	// 실제 정점 좌표들을 가져온다. 
-	const FVector& VertexA = Vertices[VertexIndex0].pos;
-	const FVector& VertexB = Vertices[VertexIndex1].pos;
-	const FVector& VertexC = Vertices[VertexIndex2].pos;
-
-	// AABB 최소/최대 좌표 계산
-	FVector MinCorner(
-		std::min({ VertexA.X, VertexB.X, VertexC.X }),
-		std::min({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::min({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	FVector MaxCorner(
-		std::max({ VertexA.X, VertexB.X, VertexC.X }),
-		std::max({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::max({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	// 삼각형의 바운딩 박스 반환
-	return FAABB(MinCorner, MaxCorner);
+	Nodes.Empty();
+	Packets.Empty();
+	SourceHash = ComputeSourceHash(Vertices, Indices);
+
+	const uint32 TriCount = Indices.Num() / 3;
+	if (TriCount == 0)
+	{
+		return;
+	}
+
+	// 삼각형별 AABB/중심점은 빌드 동안 반복해서 쓰므로 미리 계산
+	FBuildContext Ctx;
+	Ctx.TriBounds.SetNum(TriCount);
+	Ctx.TriCenters.SetNum(TriCount);
+	Ctx.TriIndices.SetNum(TriCount);
+	for (uint32 Tri = 0; Tri < TriCount; ++Tri)
+	{
+		const FVector& A = Vertices[Indices[3 * Tri + 0]].pos;
+		const FVector& B = Vertices[Indices[3 * Tri + 1]].pos;
+		const FVector& C = Vertices[Indices[3 * Tri + 2]].pos;
+
+		FBuildBounds& TriBounds = Ctx.TriBounds[Tri];
+		TriBounds.Grow(A);
+		TriBounds.Grow(B);
+		TriBounds.Grow(C);
+		Ctx.TriCenters[Tri] = (A + B + C) / 3.0f;
+		Ctx.TriIndices[Tri] = Tri;
+	}
+
+	TArray<FBuildNode> BinNodes;
+	BinNodes.Reserve(2 * NumPackets(TriCount));
+	BuildSubtree(Ctx, BinNodes, 0, TriCount, 0);
+
+	Nodes.Reserve(BinNodes.Num() / 3 + 1);
+	Packets.Reserve(NumPackets(TriCount) + BinNodes.Num() / 2);
+	CollapseNode(Ctx, BinNodes, 0, Vertices, Indices, Nodes, Packets);
 }
 
-FVector FMeshBVH::ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+// 가까운 자식부터 방문하는 스택 탐색. 이미 찾은 교차보다 먼 노드는 건너뛴다.
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, float& OutHitDistance, uint32* OutTriangleId) const
 {
-	// 삼각형을 구성하는 세 개의 정점 인덱스
-	const uint32 VertexIndex0 = Indices[TriangleID * 3 + 0];
-	const uint32 VertexIndex1 = Indices[TriangleID * 3 + 1];
-	const uint32 VertexIndex2 = Indices[TriangleID * 3 + 2];
+	if (Nodes.Num() == 0)
+	{
+		return false;
+	}
 
-	// 실제 좌표
-	const FVector& Position0 = Vertices[VertexIndex0].pos;
-	const FVector& Position1 = Vertices[VertexIndex1].pos;
-	const FVector& Position2 = Vertices[VertexIndex2].pos;
+	const FVector& Origin = InLocalRay.Origin;
+	const FVector& Direction = InLocalRay.Direction;
+
+	FRayLanes Ray;
+	Ray.OX = _mm_set1_ps(Origin.X);
+	Ray.OY = _mm_set1_ps(Origin.Y);
+	Ray.OZ = _mm_set1_ps(Origin.Z);
+	Ray.DX = _mm_set1_ps(Direction.X);
+	Ray.DY = _mm_set1_ps(Direction.Y);
+	Ray.DZ = _mm_set1_ps(Direction.Z);
+	Ray.InvX = _mm_set1_ps(SafeInverse(Direction.X));
+	Ray.InvY = _mm_set1_ps(SafeInverse(Direction.Y));
+	Ray.InvZ = _mm_set1_ps(SafeInverse(Direction.Z));
+
+	// 방향 부호에 따라 진입/진출 평면을 고정해 두면 슬랩마다 min/max를 할 필요가 없다
+	const bool bNegX = Direction.X < 0.0f;
+	const bool bNegY = Direction.Y < 0.0f;
+	const bool bNegZ = Direction.Z < 0.0f;
+
+	struct FStackEntry
+	{
+		int32 Child;
+		uint32 PacketCount;
+		float EnterDistance;
+	};
+	FStackEntry Stack[TraversalStackSize];
+	int32 StackSize = 0;
+	Stack[StackSize++] = { 0, 0, 0.0f };
+
+	float BestT = FLT_MAX;
+	uint32 BestTriangle = 0;
+	bool bHit = false;
+
+	while (StackSize > 0)
+	{
+		const FStackEntry Entry = Stack[--StackSize];
+		if (Entry.EnterDistance > BestT)
+		{
+			continue;
+		}
+
+		if (Entry.Child < 0)
+		{
+			const uint32 FirstPacket = ~static_cast<uint32>(Entry.Child);
+			for (uint32 PacketOffset = 0; PacketOffset < Entry.PacketCount; ++PacketOffset)
+			{
+				bHit |= IntersectPacket(Packets[FirstPacket + PacketOffset], Ray, BestT, BestTriangle);
+			}
+			continue;
+		}
+
+		const FMeshBVHNode4& Node = Nodes[Entry.Child];
+		const __m128 EnterX = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(bNegX ? Node.MaxX : Node.MinX), Ray.OX), Ray.InvX);
+		const __m128 EnterY = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(bNegY ? Node.MaxY : Node.MinY), Ray.OY), Ray.InvY);
+		const __m128 EnterZ = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(bNegZ ? Node.MaxZ : Node.MinZ), Ray.OZ), Ray.InvZ);
+		const __m128 ExitX = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(bNegX ? Node.MinX : Node.MaxX), Ray.OX), Ray.InvX);
+		const __m128 ExitY = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(bNegY ? Node.MinY : Node.MaxY), Ray.OY), Ray.InvY);
+		const __m128 ExitZ = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(bNegZ ? Node.MinZ : Node.MaxZ), Ray.OZ), Ray.InvZ);
+
+		const __m128 Enter = _mm_max_ps(_mm_max_ps(EnterX, EnterY), _mm_max_ps(EnterZ, _mm_setzero_ps()));
+		const __m128 Exit = _mm_min_ps(_mm_min_ps(ExitX, ExitY), _mm_min_ps(ExitZ, _mm_set1_ps(BestT)));
+		const int32 HitMask = _mm_movemask_ps(_mm_cmple_ps(Enter, Exit));
+		if (HitMask == 0)
+		{
+			continue;
+		}
 
-	// 중심점(무게중심) 계산
+		alignas(16) float EnterDistance[4];
+		_mm_store_ps(EnterDistance, Enter);
 
-	const FVector TriangleCenter = (Position0 + Position1 + Position2) / 3.0f;
+		// 진입 거리 내림차순으로 쌓아 가장 가까운 자식이 스택 맨 위에 오도록 한다
+		int32 Order[4];
+		int32 HitCount = 0;
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			if ((HitMask & (1 << Lane)) == 0)
+			{
+				continue;
+			}
+			int32 Pos = HitCount++;
+			while (Pos > 0 && EnterDistance[Order[Pos - 1]] < EnterDistance[Lane])
+			{
+				Order[Pos] = Order[Pos - 1];
+				--Pos;
+			}
+			Order[Pos] = Lane;
+		}
+		for (int32 i = 0; i < HitCount; ++i)
+		{
+			const int32 Lane = Order[i];
+			Stack[StackSize++] = { Node.Child[Lane], Node.PacketCount[Lane], EnterDistance[Lane] };
+		}
+	}
 
-	return TriangleCenter;
+	if (bHit)
+	{
+		OutHitDistance = BestT;
+		if (OutTriangleId)
+		{
+			*OutTriangleId = BestTriangle;
+		}
+	}
+	return bHit;
 }
 
-// 여러 삼각형을 한 번에 감싸는 AABB를 계산 
-FAABB FMeshBVH::ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+uint64 FMeshBVH::ComputeSourceHash(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
 {
-	// 첫 번째 삼각형 ID로 AABB 초기화 
-	FAABB Bounds = ComputeTriBounds(TriIndices[Start], Vertices, Indices);
-	// Start+1 ~ Start+Count-1 까지 모든 삼각형에 대해 반복 
-	// 가장 큰 MIN , MAX 찾아낸다. 
-	for (uint32 i = 1; i < Count; i++)
-	{
-		FAABB TB = ComputeTriBounds(TriIndices[Start + i], Vertices, Indices);
-		Bounds.Min = Bounds.Min.ComponentMin(TB.Min);
-		Bounds.Max = Bounds.Max.ComponentMax(TB.Max);
+	uint64 Hash = 14695981039346656037ull;
+	auto HashBytes = [&Hash](const void* Data, size_t Size)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(Data);
+		for (size_t i = 0; i < Size; ++i)
+		{
+			Hash = (Hash ^ Bytes[i]) * 1099511628211ull;
+		}
+	};
+
+	const uint32 VertexCount = Vertices.Num();
+	const uint32 IndexCount = Indices.Num();
+	HashBytes(&VertexCount, sizeof(VertexCount));
+	HashBytes(&IndexCount, sizeof(IndexCount));
+	for (const FNormalVertex& Vertex : Vertices)
+	{
+		HashBytes(&Vertex.pos, sizeof(FVector));
+	}
+	if (IndexCount > 0)
+	{
+		HashBytes(Indices.data(), sizeof(uint32) * IndexCount);
 	}
-	return Bounds;
+	return Hash;
 }
 
-// BVH 트리 -> 재귀 구축 
-int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+FArchive& operator<<(FArchive& Ar, FMeshBVH& BVH)
 {
-	FMeshBVHNode Node;
-	Node.Start = Start;
-	Node.Count = Count;
+	uint32 Magic = MeshBVHMagic;
+	uint32 Version = MeshBVHVersion;
+	Ar << Magic;
+	Ar << Version;
+	if (Ar.IsLoading() && (Magic != MeshBVHMagic || Version != MeshBVHVersion))
+	{
+		throw std::runtime_error("Mesh BVH cache version mismatch.");
+	}
+
+	Ar << BVH.SourceHash;
+	if (Ar.IsSaving())
+	{
+		Serialization::WriteArray(Ar, BVH.Nodes);
+		Serialization::WriteArray(Ar, BVH.Packets);
+
+		// 끝 표식: 읽는 쪽에서 잘린 파일을 알아챌 수 있도록 한다
+		Ar << Magic;
+	}
+	else if (Ar.IsLoading())
+	{
+		Serialization::ReadArray(Ar, BVH.Nodes);
+		Serialization::ReadArray(Ar, BVH.Packets);
+
+		uint32 EndMagic = 0;
+		Ar << EndMagic;
+		if (EndMagic != MeshBVHMagic)
+		{
+			throw std::runtime_error("Mesh BVH cache is truncated.");
+		}
+
+		// 범위를 벗어난 자식 참조는 탐색 중 크래시로 이어지므로 모두 검증
+		for (const FMeshBVHNode4& Node : BVH.Nodes)
+		{
+			for (int32 Slot = 0; Slot < 4; ++Slot)
+			{
+				const int32 Child = Node.Child[Slot];
+				const bool bValid = (Child >= 0)
+					? (Child < BVH.Nodes.Num())
+					: (static_cast<uint64>(~static_cast<uint32>(Child)) + Node.PacketCount[Slot] <= static_cast<uint64>(BVH.Packets.Num()));
+				if (!bValid)
+				{
+					throw std::runtime_error("Mesh BVH cache is corrupt.");
+				}
+			}
+		}
+	}
+	return Ar;
+}
 
-	// 이 노드가 감싸는 AABB 계산
-	Node.Bounds = ComputeBounds(Start, Count, Vertices, Indices);
+FMeshBVHBenchmarkResult RunMeshBVHBenchmark(int32 NumTriangles, int32 NumRays)
+{
+	FMeshBVHBenchmarkResult Result;
+	if (NumTriangles <= 0 || NumRays <= 0)
+	{
+		return Result;
+	}
 
-	// 현재 노드 인덱스 확보 & 추가 -> 자식으로 쪼갤 때 사용 
-	int NodeIndex = Nodes.Num();
-	Nodes.Add(Node);
+	// 표면이 울퉁불퉁한 UV 구 (스캔 메시처럼 작은 삼각형이 빽빽한 경우)
+	const int32 Segments = std::max(4, static_cast<int32>(std::sqrt(NumTriangles / 2.0f)));
+	TArray<FNormalVertex> Vertices;
+	TArray<uint32> Indices;
+	Vertices.SetNum((Segments + 1) * (Segments + 1));
+	for (int32 Ring = 0; Ring <= Segments; ++Ring)
+	{
+		const float Theta = PI * Ring / Segments;
+		for (int32 Seg = 0; Seg <= Segments; ++Seg)
+		{
+			const float Phi = 2.0f * PI * Seg / Segments;
+			const float Radius = 1.0f + 0.05f * std::sin(7.0f * Theta) * std::cos(5.0f * Phi);
+			Vertices[Ring * (Segments + 1) + Seg].pos = FVector(
+				Radius * std::sin(Theta) * std::cos(Phi),
+				Radius * std::sin(Theta) * std::sin(Phi),
+				Radius * std::cos(Theta));
+		}
+	}
+	for (int32 Ring = 0; Ring < Segments; ++Ring)
+	{
+		for (int32 Seg = 0; Seg < Segments; ++Seg)
+		{
+			const uint32 I0 = Ring * (Segments + 1) + Seg;
+			const uint32 I1 = I0 + Segments + 1;
+			Indices.Add(I0); Indices.Add(I1); Indices.Add(I0 + 1);
+			Indices.Add(I0 + 1); Indices.Add(I1); Indices.Add(I1 + 1);
+		}
+	}
+	Result.NumTriangles = Indices.Num() / 3;
+
+	FMeshBVH BVH;
+	uint64 Start = FPlatformTime::Cycles64();
+	BVH.Build(Vertices, Indices);
+	Result.BuildMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	Result.NumNodes = BVH.GetNodeCount();
+
+	// 구 바깥에서 구 안쪽 임의 지점을 향하는 광선
+	TArray<FRay> Rays;
+	Rays.SetNum(NumRays);
+	uint32 Seed = 1;
+	auto Random = [&Seed]()
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return (Seed >> 8) * (1.0f / 16777216.0f) * 2.0f - 1.0f;
+	};
+	for (FRay& Ray : Rays)
+	{
+		Ray.Origin = FVector(Random(), Random(), Random()).GetNormalized() * 3.0f;
+		const FVector Target(Random() * 1.2f, Random() * 1.2f, Random() * 1.2f);
+		Ray.Direction = Target - Ray.Origin;
+	}
 
-	// 리프 조건: 삼각형 개수가 LeafSize 이하
-	if (Count <= LeafSize)
+	TArray<float> BVHHits;
+	BVHHits.SetNum(NumRays);
+	Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < NumRays; ++i)
 	{
-		return NodeIndex;
+		float HitT = -1.0f;
+		BVH.IntersectRay(Rays[i], HitT);
+		BVHHits[i] = HitT;
 	}
+	const double BVHMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	Result.BVHRaysPerSec = NumRays / std::max(BVHMs * 0.001, 1e-9);
 
-	// -------------------------------
-	// 분할 축 선택 (가장 긴 축)
-	// -------------------------------
-	FVector Extent = Node.Bounds.GetHalfExtent();
-	EAxis Axis = EAxis::X;
-
-	if (Extent.Y > Extent.X && Extent.Y >= Extent.Z)
-		Axis = EAxis::Y;
-	else if (Extent.Z > Extent.X && Extent.Z >= Extent.Y)
-		Axis = EAxis::Z;
-
-	// 중간 지점 -> 반으로 쪼갤 준비하기 
-	uint32 Mid = Start + Count / 2;
-
-	// -------------------------------
-	// 삼각형 중심 좌표 기준으로 분할
-	// -------------------------------
-	// 오른쪽 왼쪽으로 나누기 좋은 
-	// nth_element 가이드 
-	// nth_element(first, nth, last, comp)
-	// nth 위치에 "정렬했을 때 올 원소"를 제자리에 넣음
-	// 왼쪽 구간 [first, nth) 에는 그 원소보다 "작은 것들"만
-	// 오른쪽 구간 [nth+1, last) 에는 "큰 것들"만 놓음
-
-	// 선택된 Axis를 방향으로 왼쪽과 오른쪽으로 나눈다. 
-	// 전체를 정렬하지 않고, n번째 작은 원소를 찾아서 놓는다. 
-	std::nth_element(
-		TriIndices.begin() + Start, // 분할할 구간 시작
-		TriIndices.begin() + Mid, // 중간 값의 위치 
-		TriIndices.begin() + Start + Count, // 분할할 구간의 끝 
-		[&](uint32 A, uint32 B)			// 비교함수 
-		{
-			FVector CenterA = ComputeTriCenter(A, Vertices, Indices);
-			FVector CenterB = ComputeTriCenter(B, Vertices, Indices);
-
-			switch (Axis)
+	// 무차별 대입은 느리므로 일부 광선만 측정하고 결과 검증에도 사용
+	const int32 NumBruteForceRays = std::min(NumRays, 200);
+	Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < NumBruteForceRays; ++i)
+	{
+		float ClosestT = FLT_MAX;
+		for (int32 Tri = 0; Tri < Result.NumTriangles; ++Tri)
+		{
+			float HitT;
+			if (IntersectRayTriangleMT(Rays[i], Vertices[Indices[3 * Tri]].pos, Vertices[Indices[3 * Tri + 1]].pos, Vertices[Indices[3 * Tri + 2]].pos, HitT))
 			{
-			case EAxis::X: return CenterA.X < CenterB.X;
-			case EAxis::Y: return CenterA.Y < CenterB.Y;
-			case EAxis::Z: return CenterA.Z < CenterB.Z;
-			default:       return CenterA.X < CenterB.X;
+				ClosestT = std::min(ClosestT, HitT);
 			}
-		});
-
-	// -------------------------------
-	// 내부 노드로 전환 & 자식 생성
-	// -------------------------------
-	// 자식 생성으로 본인 Count 초기화.
-	// Left, Right에 자식 달기 
-	Nodes[NodeIndex].Count = 0;
-	Nodes[NodeIndex].Left = BuildRecursive(Start, Mid - Start, Vertices, Indices);
-	Nodes[NodeIndex].Right = BuildRecursive(Mid, Start + Count - Mid, Vertices, Indices);
-
-	return NodeIndex;
+		}
+		const float BruteT = (ClosestT < FLT_MAX) ? ClosestT : -1.0f;
+		if (std::fabs(BruteT - BVHHits[i]) > 1e-3f)
+		{
+			++Result.Mismatches;
+		}
+	}
+	const double BruteMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	Result.BruteForceRaysPerSec = NumBruteForceRays / std::max(BruteMs * 0.001, 1e-9);
+
+	return Result;
 }
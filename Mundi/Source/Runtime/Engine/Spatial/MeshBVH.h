@@ -1,47 +1,72 @@
 ﻿#pragma once
 #include "AABB.h"
 
-struct FMeshBVHNode
-{
-	FAABB Bounds;     // 이 노드가 감싸는 AABB
-	int Left = -1;     // 왼쪽 자식 인덱스
-	int Right = -1;    // 오른쪽 자식 인덱스
-	uint32 Start = 0;  // TriIndices 배열에서 시작 위치
-	uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수 
+class FArchive;
 
-	bool IsLeaf() const { return Count > 0; }
+// 4-wide BVH 노드. 자식 4개의 AABB를 SoA로 보관해 SSE 한 번에 4개 박스를 검사한다.
+// Child[i] >= 0 : 내부 노드 인덱스
+// Child[i] <  0 : 리프, ~Child[i]부터 PacketCount[i]개의 삼각형 패킷
+// 빈 슬롯은 뒤집힌 박스(Min > Max)로 채워 슬랩 테스트에서 항상 실패하게 한다.
+struct alignas(16) FMeshBVHNode4
+{
+	float MinX[4];
+	float MinY[4];
+	float MinZ[4];
+	float MaxX[4];
+	float MaxY[4];
+	float MaxZ[4];
+	int32 Child[4];
+	uint32 PacketCount[4];
 };
 
-struct FStackItem
+// 삼각형 4개를 묶은 SoA 패킷 (V0, Edge1 = V1 - V0, Edge2 = V2 - V0)
+// 채워지지 않은 레인은 Edge가 0이라 행렬식이 0이 되어 자동으로 제외된다.
+struct alignas(16) FMeshBVHTriPacket
 {
-	int32 NodeIndex;
-	float EntryDistance;
+	float V0X[4], V0Y[4], V0Z[4];
+	float E1X[4], E1Y[4], E1Z[4];
+	float E2X[4], E2Y[4], E2Z[4];
+	uint32 TriangleId[4];
 };
+
+// 정적 메시용 BVH.
+// - 빌드: 빈(bin) 기반 SAH 이진 트리를 만든 뒤 4-wide 트리로 접는다. 큰 메시는 서브트리를 병렬로 빌드한다.
+// - 탐색: SSE 슬랩 테스트 + 가까운 자식 우선 스택 탐색, 리프는 삼각형 4개씩 Möller–Trumbore를 동시에 수행한다.
+// - 정점/인덱스 버퍼를 참조하지 않고 패킷에 좌표를 복사해 두므로 디스크에 그대로 저장/로드할 수 있다.
 class FMeshBVH
 {
 public:
-
 	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	// 가장 가까운 교차를 찾는다. OutHitDistance는 InLocalRay.Direction 기준의 파라메트릭 거리
+	bool IntersectRay(const FRay& InLocalRay, float& OutHitDistance, uint32* OutTriangleId = nullptr) const;
 
+	bool IsEmpty() const { return Nodes.Num() == 0; }
+	uint64 GetSourceHash() const { return SourceHash; }
+	int32 GetNodeCount() const { return Nodes.Num(); }
+	int32 GetPacketCount() const { return Packets.Num(); }
 
-private:
-	// Helper 함수들
-	FAABB ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	// 디스크 캐시 무효화 판단용 (정점 위치 + 인덱스 FNV-1a 해시)
+	static uint64 ComputeSourceHash(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-	FVector ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
-
-	FAABB ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
-
-	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+	// 버전/매직이 맞지 않으면 std::runtime_error를 던진다 (ObjManager 캐시 로드와 동일한 처리 방식)
+	friend FArchive& operator<<(FArchive& Ar, FMeshBVH& BVH);
 
 private:
+	TArray<FMeshBVHNode4> Nodes;
+	TArray<FMeshBVHTriPacket> Packets;
+	uint64 SourceHash = 0;
+};
 
-	TArray<FMeshBVHNode> Nodes;
-	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다. 
-	//삼각형 순서만 재배치  , 정점 좌표와 인덱스 버퍼를 직접적으로 건들면 안되기 때문이다.
-	TArray<uint32> TriIndices;
-	const uint32 LeafSize = 4;
+// 합성 메시로 BVH 빌드 시간과 광선 처리량을 측정한다 (무차별 대입 대비)
+struct FMeshBVHBenchmarkResult
+{
+	int32 NumTriangles = 0;
+	int32 NumNodes = 0;
+	double BuildMs = 0.0;
+	double BVHRaysPerSec = 0.0;
+	double BruteForceRaysPerSec = 0.0;
+	int32 Mismatches = 0;
 };
 
+FMeshBVHBenchmarkResult RunMeshBVHBenchmark(int32 NumTriangles, int32 NumRays);
@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "Octree.h"
 #include "Actor.h"
+#include "DebugDrawManager.h"
 
 FOctree::FOctree(const FAABB& InBounds, int InDepth, int InMaxDepth, int InMaxObjects)
 	: Bounds(InBounds), Depth(InDepth), MaxDepth(InMaxDepth), MaxObjects(InMaxObjects)
@@ -397,38 +398,6 @@ void FOctree::DebugDump() const
     UE_LOG("===== OCTREE DUMP END =====\r\n");
 }
 
-static void CreateLineDataFromAABB(
-    const FVector& Min, const FVector& Max,
-    OUT TArray<FVector>& Start,
-    OUT TArray<FVector>& End,
-    OUT TArray<FVector4>& Color,
-    const FVector4& LineColor)
-{
-    const FVector v0(Min.X, Min.Y, Min.Z);
-    const FVector v1(Max.X, Min.Y, Min.Z);
-    const FVector v2(Max.X, Max.Y, Min.Z);
-    const FVector v3(Min.X, Max.Y, Min.Z);
-    const FVector v4(Min.X, Min.Y, Max.Z);
-    const FVector v5(Max.X, Min.Y, Max.Z);
-    const FVector v6(Max.X, Max.Y, Max.Z);
-    const FVector v7(Min.X, Max.Y, Max.Z);
-
-    Start.Add(v0); End.Add(v1); Color.Add(LineColor);
-    Start.Add(v1); End.Add(v2); Color.Add(LineColor);
-    Start.Add(v2); End.Add(v3); Color.Add(LineColor);
-    Start.Add(v3); End.Add(v0); Color.Add(LineColor);
-
-    Start.Add(v4); End.Add(v5); Color.Add(LineColor);
-    Start.Add(v5); End.Add(v6); Color.Add(LineColor);
-    Start.Add(v6); End.Add(v7); Color.Add(LineColor);
-    Start.Add(v7); End.Add(v4); Color.Add(LineColor);
-
-    Start.Add(v0); End.Add(v4); Color.Add(LineColor);
-    Start.Add(v1); End.Add(v5); Color.Add(LineColor);
-    Start.Add(v2); End.Add(v6); Color.Add(LineColor);
-    Start.Add(v3); End.Add(v7); Color.Add(LineColor);
-}
-
 // 해당 함수 사용 
 void FOctree::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT)
 {
@@ -543,18 +512,15 @@ void FOctree::DebugDraw(URenderer* InRenderer) const
     TArray<FStackItem> Stack;
     Stack.Add({ this, Depth });
 
+    // 노드마다 임시 배열을 만들지 않고 한 버퍼에 모아서 한 번에 제출
+    FDebugLineBuffer Lines;
     while (Stack.Num() > 0)
     {
         FStackItem Current = Stack.Pop();
         const FOctree* CurrentNode = Current.Node;
         const int32 DepthIndex = Current.DepthLevel % 8;
-        FVector4 NodeColor = LevelColors[DepthIndex];
         // AABB 박스 라인 그리기
-        TArray<FVector> LineStarts;
-        TArray<FVector> LineEnds;
-        TArray<FVector4> LineColors;
-        CreateLineDataFromAABB(CurrentNode->Bounds.Min, CurrentNode->Bounds.Max, LineStarts, LineEnds, LineColors, NodeColor);
-        InRenderer->AddLines(LineStarts, LineEnds, LineColors);
+        Lines.AddBox(CurrentNode->Bounds.Min, CurrentNode->Bounds.Max, LevelColors[DepthIndex]);
 
         // 자식 노드 탐색
         if (CurrentNode->Children[0])
@@ -568,4 +534,6 @@ void FOctree::DebugDraw(URenderer* InRenderer) const
             }
         }
     }
+
+    InRenderer->AddLines(Lines);
 }
@@ -33,6 +33,9 @@ public:
 	void MarkDirty(AActor* Actor);
 	void MarkDirty(UPrimitiveComponent* Smc);
 
+	// true인 동안 Register/MarkDirty를 무시한다. 대량 추가 후 BulkRegister로 한 번에 반영할 때 사용
+	void SetDeferRegistration(bool bDefer) { bDeferRegistration = bDefer; }
+
 	void Update(float DeltaTime, const uint32 BudgetCount = 256);
 
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
@@ -58,4 +61,5 @@ private:
 	TSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
+	bool bDeferRegistration = false;
 };
@@ -1,4 +1,5 @@
 ﻿#include "pch.h"
+#include "PlatformTime.h"
 #include <windowsx.h> // GET_X_LPARAM / GET_Y_LPARAM
 
 #ifndef GET_X_LPARAM
@@ -70,11 +71,11 @@ void UInputManager::Update()
     // 마우스 휠 델타 초기화 (프레임마다 리셋)
     MouseWheelDelta = 0.0f;
 
-    // 매 프레임마다 실시간 마우스 위치 업데이트
+    // 매 프레임마다 실시간 마우스 위치 업데이트 (재생 중에는 녹화된 위치를 사용)
     if (WindowHandle)
     {
         POINT CursorPos;
-        if (GetCursorPos(&CursorPos))
+        if (!IsReplaying() && GetCursorPos(&CursorPos))
         {
             ScreenToClient(WindowHandle, &CursorPos);
 
@@ -115,6 +116,12 @@ void UInputManager::Update()
 
 void UInputManager::ProcessMessage(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
+    // 재생 중에는 실제 입력을 무시 (창 크기 변경만 반영)
+    if (IsReplaying() && message != WM_SIZE)
+    {
+        return;
+    }
+
     bool IsUIHover = false;
     bool IsKeyBoardCapture = false;
     
@@ -441,9 +448,13 @@ void UInputManager::LockCursor()
 {
     if (!WindowHandle) return;
 
-    // 현재 커서 위치를 기준점으로 저장
+    // 현재 커서 위치를 기준점으로 저장 (재생 중에는 실제 커서 대신 재생된 위치)
     POINT currentCursor;
-    if (GetCursorPos(&currentCursor))
+    if (IsReplaying())
+    {
+        LockedCursorPosition = MousePosition;
+    }
+    else if (GetCursorPos(&currentCursor))
     {
         ScreenToClient(WindowHandle, &currentCursor);
         LockedCursorPosition = FVector2D(static_cast<float>(currentCursor.x), static_cast<float>(currentCursor.y));
@@ -465,11 +476,192 @@ void UInputManager::ReleaseCursor()
     bIsCursorLocked = false;
 
     // 원래 커서 위치로 복원
-    POINT lockedPoint = { static_cast<int>(LockedCursorPosition.X), static_cast<int>(LockedCursorPosition.Y) };
-    ClientToScreen(WindowHandle, &lockedPoint);
-    SetCursorPos(lockedPoint.x, lockedPoint.y);
+    if (!IsReplaying())
+    {
+        POINT lockedPoint = { static_cast<int>(LockedCursorPosition.X), static_cast<int>(LockedCursorPosition.Y) };
+        ClientToScreen(WindowHandle, &lockedPoint);
+        SetCursorPos(lockedPoint.x, lockedPoint.y);
+    }
 
     // 마우스 위치 동기화
     MousePosition = LockedCursorPosition;
     PreviousMousePosition = LockedCursorPosition;
 }
+
+void UInputManager::StartRecording()
+{
+    if (IsReplaying())
+    {
+        UE_LOG("[InputRecord] Cannot record while replaying");
+        return;
+    }
+
+    Recording.Reset();
+    Recording.ScreenSize = GetScreenSize();
+    RecordMode = EInputRecordMode::Recording;
+    UE_LOG("[InputRecord] Recording started");
+}
+
+bool UInputManager::StopRecording(const FString& Path)
+{
+    if (!IsRecording())
+    {
+        return false;
+    }
+    RecordMode = EInputRecordMode::None;
+
+    if (!Recording.SaveToFile(Path))
+    {
+        UE_LOG("[error] [InputRecord] Failed to save %s", Path.c_str());
+        return false;
+    }
+    UE_LOG("[InputRecord] Saved %d frames (%.1f KB) to %s",
+        Recording.GetNumFrames(), Recording.GetEncodedBytes() / 1024.0, Path.c_str());
+    return true;
+}
+
+bool UInputManager::StartReplay(const FString& Path)
+{
+    if (IsRecording())
+    {
+        UE_LOG("[InputRecord] Cannot replay while recording");
+        return false;
+    }
+    if (!Recording.LoadFromFile(Path) || Recording.GetNumFrames() == 0)
+    {
+        UE_LOG("[error] [InputRecord] Failed to load %s", Path.c_str());
+        return false;
+    }
+
+    const FVector2D CurrentScreenSize = GetScreenSize();
+    if (CurrentScreenSize != Recording.ScreenSize)
+    {
+        UE_LOG("[warning] [InputRecord] Screen size differs from recording (%.0fx%.0f vs %.0fx%.0f), mouse picking may diverge",
+            CurrentScreenSize.X, CurrentScreenSize.Y, Recording.ScreenSize.X, Recording.ScreenSize.Y);
+    }
+
+    ReplayPath = Path;
+    ReplayFrameIndex = 0;
+    ReplayFrameStartCycles = 0;
+    ReplayFrameMs.Empty();
+    ReplayFrameMs.Reserve(Recording.GetNumFrames());
+    ClearButtonAndKeyStates();
+    RecordMode = EInputRecordMode::Replaying;
+    UE_LOG("[InputRecord] Replaying %d frames from %s", Recording.GetNumFrames(), Path.c_str());
+    return true;
+}
+
+void UInputManager::StopReplay()
+{
+    if (!IsReplaying())
+    {
+        return;
+    }
+    RecordMode = EInputRecordMode::None;
+    ClearButtonAndKeyStates();
+    UE_LOG("[InputRecord] Replay stopped at frame %d/%d", ReplayFrameIndex, Recording.GetNumFrames());
+}
+
+float UInputManager::BeginFrame(float DeltaSeconds)
+{
+    if (IsRecording())
+    {
+        Recording.AddFrame(CaptureFrame(DeltaSeconds));
+        return DeltaSeconds;
+    }
+
+    if (!IsReplaying())
+    {
+        return DeltaSeconds;
+    }
+
+    // 지난 BeginFrame 이후 경과 시간 = 직전 재생 프레임 전체 시간 (메시지, Tick, Render, Present 포함)
+    const uint64 Now = FPlatformTime::Cycles64();
+    if (ReplayFrameIndex > 0)
+    {
+        ReplayFrameMs.Add(FPlatformTime::ToMilliseconds(Now - ReplayFrameStartCycles));
+    }
+    ReplayFrameStartCycles = Now;
+
+    if (ReplayFrameIndex >= Recording.GetNumFrames())
+    {
+        FinishReplay();
+        return DeltaSeconds;
+    }
+
+    const FInputFrame& Frame = Recording.GetFrame(ReplayFrameIndex++);
+    ApplyFrame(Frame);
+    return Frame.DeltaSeconds;
+}
+
+FInputFrame UInputManager::CaptureFrame(float DeltaSeconds) const
+{
+    FInputFrame Frame;
+    Frame.DeltaSeconds = DeltaSeconds;
+    Frame.MousePosition = MousePosition;
+    Frame.PreviousMousePosition = PreviousMousePosition;
+    Frame.MouseWheelDelta = MouseWheelDelta;
+    for (int i = 0; i < MaxMouseButtons; ++i)
+    {
+        if (MouseButtons[i])
+        {
+            Frame.MouseButtons |= static_cast<uint8>(1 << i);
+        }
+    }
+    for (int KeyCode = 0; KeyCode < 256; ++KeyCode)
+    {
+        if (KeyStates[KeyCode])
+        {
+            Frame.SetKeyDown(KeyCode);
+        }
+    }
+    return Frame;
+}
+
+void UInputManager::ApplyFrame(const FInputFrame& Frame)
+{
+    // Previous* 배열은 직전 프레임 Update()에서 복사된 값(= 직전 재생 프레임)이므로 Pressed/Released 판정도 그대로 재현된다
+    MousePosition = Frame.MousePosition;
+    PreviousMousePosition = Frame.PreviousMousePosition;
+    MouseWheelDelta = Frame.MouseWheelDelta;
+    for (int i = 0; i < MaxMouseButtons; ++i)
+    {
+        MouseButtons[i] = (Frame.MouseButtons >> i) & 1;
+    }
+    for (int KeyCode = 0; KeyCode < 256; ++KeyCode)
+    {
+        KeyStates[KeyCode] = Frame.IsKeyDown(KeyCode);
+    }
+}
+
+void UInputManager::FinishReplay()
+{
+    RecordMode = EInputRecordMode::None;
+    ClearButtonAndKeyStates();
+
+    const FInputReplayTimingSummary Summary = SummarizeReplayTiming(ReplayFrameMs);
+    const FString CsvPath = ReplayPath + ".timing.csv";
+    const bool bWroteCsv = WriteReplayTimingCsv(CsvPath, Recording, ReplayFrameMs);
+
+    char Buffer[512];
+    sprintf_s(Buffer,
+        "[InputReplay] %d frames, total %.1f ms, avg %.3f ms, median %.3f ms, p95 %.3f ms, p99 %.3f ms, max %.3f ms\n"
+        "[InputReplay] per-frame timing: %s\n",
+        Summary.NumFrames, Summary.TotalMs, Summary.AverageMs, Summary.MedianMs, Summary.P95Ms, Summary.P99Ms, Summary.MaxMs,
+        bWroteCsv ? CsvPath.c_str() : "(failed to write csv)");
+
+    // 헤드리스 게임 빌드에서는 콘솔 위젯이 없으므로 표준 출력/디버거로도 내보낸다
+    UE_LOG("%s", Buffer);
+    std::fputs(Buffer, stdout);
+    std::fflush(stdout);
+    OutputDebugStringA(Buffer);
+}
+
+void UInputManager::ClearButtonAndKeyStates()
+{
+    memset(MouseButtons, false, sizeof(MouseButtons));
+    memset(PreviousMouseButtons, false, sizeof(PreviousMouseButtons));
+    memset(KeyStates, false, sizeof(KeyStates));
+    memset(PreviousKeyStates, false, sizeof(PreviousKeyStates));
+    MouseWheelDelta = 0.0f;
+}
@@ -5,6 +5,7 @@
 
 #include "Object.h"
 #include "Vector.h"
+#include "InputRecording.h"
 #include "ImGui/imgui.h"
 
 // 마우스 버튼 상수
@@ -18,6 +19,14 @@ enum EMouseButton
     MaxMouseButtons = 5
 };
 
+// 입력 녹화/재생 상태
+enum class EInputRecordMode : uint8
+{
+    None,
+    Recording,
+    Replaying
+};
+
 class UInputManager : public UObject
 {
 public:
@@ -76,12 +85,31 @@ public:
     void ReleaseCursor();
     bool IsCursorLocked() const { return bIsCursorLocked; }
 
+    // 입력 녹화/재생 (성능 캡처 시나리오를 빌드 간에 똑같이 재현하기 위함)
+    void StartRecording();
+    bool StopRecording(const FString& Path);
+    bool StartReplay(const FString& Path);
+    void StopReplay();
+    bool IsRecording() const { return RecordMode == EInputRecordMode::Recording; }
+    bool IsReplaying() const { return RecordMode == EInputRecordMode::Replaying; }
+
+    // 메인 루프에서 메시지 처리 후 Tick 직전에 호출.
+    // 녹화 중이면 이번 프레임 입력과 DeltaSeconds를 기록하고,
+    // 재생 중이면 녹화된 입력으로 상태를 덮어쓰고 녹화된 DeltaSeconds를 돌려준다.
+    float BeginFrame(float DeltaSeconds);
+
 private:
     // 내부 헬퍼 함수들
     void UpdateMousePosition(int X, int Y);
     void UpdateMouseButton(EMouseButton Button, bool bPressed);
     void UpdateKeyState(int KeyCode, bool bPressed);
 
+    // 녹화/재생 헬퍼
+    FInputFrame CaptureFrame(float DeltaSeconds) const;
+    void ApplyFrame(const FInputFrame& Frame);
+    void FinishReplay();
+    void ClearButtonAndKeyStates();
+
     // 윈도우 핸들
     HWND WindowHandle;
 
@@ -109,4 +137,12 @@ private:
     // 커서 잠금 상태
     bool bIsCursorLocked = false;
     FVector2D LockedCursorPosition; // 우클릭한 위치 (기준점)
+
+    // 입력 녹화/재생 상태
+    EInputRecordMode RecordMode = EInputRecordMode::None;
+    FInputRecording Recording;
+    FString ReplayPath;
+    int32 ReplayFrameIndex = 0;
+    uint64 ReplayFrameStartCycles = 0;
+    TArray<double> ReplayFrameMs;    // 재생 프레임별 시간 (BeginFrame 간격)
 };
@@ -0,0 +1,360 @@
+﻿#include "pch.h"
+#include "InputRecording.h"
+#include "WindowsBinWriter.h"
+#include "WindowsBinReader.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    constexpr uint32 InputRecordingMagic = 0x43455249; // "IREC"
+    constexpr uint32 InputRecordingVersion = 1;
+
+    // 프레임 헤더 플래그: 이전 프레임과 달라진 필드만 뒤따른다
+    enum EInputFrameFlags : uint8
+    {
+        FrameFlag_MousePosition         = 1 << 0,
+        FrameFlag_PreviousMousePosition = 1 << 1, // 명시적 값
+        FrameFlag_PreviousMouseHeld     = 1 << 2, // 이전 프레임의 기준점 유지 (커서 잠금). 둘 다 없으면 이전 프레임 MousePosition
+        FrameFlag_Wheel                 = 1 << 3,
+        FrameFlag_Buttons               = 1 << 4,
+        FrameFlag_KeyToggles            = 1 << 5, // 바뀐 키 코드 목록
+        FrameFlag_KeyBits               = 1 << 6, // 256비트 전체
+    };
+
+    // 바뀐 키가 이보다 많으면 전체 비트셋(32바이트)을 쓰는 편이 작다
+    constexpr int32 MaxKeyTogglesPerFrame = 31;
+
+    // 모든 프레임은 최소한 플래그(1바이트)와 DeltaSeconds(4바이트)를 가진다
+    constexpr uint32 MinEncodedFrameBytes = sizeof(uint8) + sizeof(float);
+
+    // 재현성이 목적이므로 근사 비교(FVector2D::operator==)가 아니라 비트 단위로 비교한다
+    bool IsSameBits(const FVector2D& A, const FVector2D& B)
+    {
+        return std::memcmp(&A, &B, sizeof(FVector2D)) == 0;
+    }
+
+    bool IsSameBits(float A, float B)
+    {
+        return std::memcmp(&A, &B, sizeof(float)) == 0;
+    }
+
+    template<typename T>
+    void Append(TArray<uint8>& Stream, const T& Value)
+    {
+        const uint8* Bytes = reinterpret_cast<const uint8*>(&Value);
+        Stream.insert(Stream.end(), Bytes, Bytes + sizeof(T));
+    }
+
+    // 경계 검사를 하는 스트림 커서
+    struct FStreamCursor
+    {
+        const uint8* Data = nullptr;
+        size_t Size = 0;
+        size_t Offset = 0;
+
+        template<typename T>
+        bool Read(T& OutValue)
+        {
+            if (Offset + sizeof(T) > Size)
+            {
+                return false;
+            }
+            std::memcpy(&OutValue, Data + Offset, sizeof(T));
+            Offset += sizeof(T);
+            return true;
+        }
+    };
+
+    struct FInputRecordingHeader
+    {
+        uint32 Magic = InputRecordingMagic;
+        uint32 Version = InputRecordingVersion;
+        uint32 NumFrames = 0;
+        uint32 StreamBytes = 0;
+        float ScreenWidth = 0.0f;
+        float ScreenHeight = 0.0f;
+    };
+}
+
+void FInputRecording::Reset()
+{
+    Stream.Empty();
+    Frames.Empty();
+    LastEncodedFrame = FInputFrame();
+    NumFrames = 0;
+}
+
+void FInputRecording::AddFrame(const FInputFrame& Frame)
+{
+    const FInputFrame& Last = LastEncodedFrame;
+
+    uint8 Flags = 0;
+    if (!IsSameBits(Frame.MousePosition, Last.MousePosition))
+    {
+        Flags |= FrameFlag_MousePosition;
+    }
+    if (IsSameBits(Frame.PreviousMousePosition, Last.PreviousMousePosition))
+    {
+        Flags |= FrameFlag_PreviousMouseHeld;
+    }
+    else if (!IsSameBits(Frame.PreviousMousePosition, Last.MousePosition))
+    {
+        Flags |= FrameFlag_PreviousMousePosition;
+    }
+    if (!IsSameBits(Frame.MouseWheelDelta, Last.MouseWheelDelta))
+    {
+        Flags |= FrameFlag_Wheel;
+    }
+    if (Frame.MouseButtons != Last.MouseButtons)
+    {
+        Flags |= FrameFlag_Buttons;
+    }
+
+    // 바뀐 키 수집
+    uint8 Toggles[MaxKeyTogglesPerFrame];
+    int32 NumToggles = 0;
+    for (int32 Word = 0; Word < 4; ++Word)
+    {
+        uint64 Changed = Frame.KeyBits[Word] ^ Last.KeyBits[Word];
+        while (Changed && NumToggles <= MaxKeyTogglesPerFrame)
+        {
+            unsigned long Bit = 0;
+            _BitScanForward64(&Bit, Changed);
+            Changed &= Changed - 1;
+            if (NumToggles < MaxKeyTogglesPerFrame)
+            {
+                Toggles[NumToggles] = static_cast<uint8>((Word << 6) + Bit);
+            }
+            ++NumToggles;
+        }
+    }
+    if (NumToggles > MaxKeyTogglesPerFrame)
+    {
+        Flags |= FrameFlag_KeyBits;
+    }
+    else if (NumToggles > 0)
+    {
+        Flags |= FrameFlag_KeyToggles;
+    }
+
+    Append(Stream, Flags);
+    Append(Stream, Frame.DeltaSeconds);
+    if (Flags & FrameFlag_MousePosition)
+    {
+        Append(Stream, Frame.MousePosition);
+    }
+    if (Flags & FrameFlag_PreviousMousePosition)
+    {
+        Append(Stream, Frame.PreviousMousePosition);
+    }
+    if (Flags & FrameFlag_Wheel)
+    {
+        Append(Stream, Frame.MouseWheelDelta);
+    }
+    if (Flags & FrameFlag_Buttons)
+    {
+        Append(Stream, Frame.MouseButtons);
+    }
+    if (Flags & FrameFlag_KeyToggles)
+    {
+        Append(Stream, static_cast<uint8>(NumToggles));
+        Stream.insert(Stream.end(), Toggles, Toggles + NumToggles);
+    }
+    else if (Flags & FrameFlag_KeyBits)
+    {
+        Append(Stream, Frame.KeyBits);
+    }
+
+    LastEncodedFrame = Frame;
+    ++NumFrames;
+}
+
+bool FInputRecording::SaveToFile(const FString& Path) const
+{
+    const std::filesystem::path FilePath(UTF8ToWide(Path));
+    if (FilePath.has_parent_path())
+    {
+        std::error_code Ec;
+        std::filesystem::create_directories(FilePath.parent_path(), Ec);
+    }
+
+    FInputRecordingHeader Header;
+    Header.NumFrames = static_cast<uint32>(NumFrames);
+    Header.StreamBytes = static_cast<uint32>(Stream.Num());
+    Header.ScreenWidth = ScreenSize.X;
+    Header.ScreenHeight = ScreenSize.Y;
+
+    FWindowsBinWriter Writer(Path);
+    Writer << Header;
+    if (Stream.Num() > 0)
+    {
+        Writer.Serialize(const_cast<uint8*>(Stream.GetData()), Stream.Num());
+    }
+    return Writer.Close();
+}
+
+bool FInputRecording::LoadFromFile(const FString& Path)
+{
+    Reset();
+
+    // FWindowsBinReader는 읽기 실패를 알려 주지 않으므로 잘린 파일은 크기로 걸러 낸다
+    std::error_code Ec;
+    const uintmax_t FileSize = std::filesystem::file_size(std::filesystem::path(UTF8ToWide(Path)), Ec);
+    if (Ec || FileSize < sizeof(FInputRecordingHeader))
+    {
+        return false;
+    }
+
+    FWindowsBinReader Reader(Path);
+    if (!Reader.IsOpen())
+    {
+        return false;
+    }
+
+    FInputRecordingHeader Header;
+    Header.Magic = 0;
+    Reader << Header;
+    if (Header.Magic != InputRecordingMagic || Header.Version != InputRecordingVersion ||
+        Header.StreamBytes > Serialization::MAX_REASONABLE_ARRAY_SIZE ||
+        FileSize != sizeof(FInputRecordingHeader) + static_cast<uintmax_t>(Header.StreamBytes))
+    {
+        return false;
+    }
+
+    // 프레임 수는 Reserve와 int32 변환에 그대로 쓰이므로 스트림 크기로 담을 수 있는 만큼만 허용한다
+    if (Header.NumFrames > static_cast<uint32>(INT32_MAX) || Header.NumFrames > Header.StreamBytes / MinEncodedFrameBytes)
+    {
+        return false;
+    }
+
+    Stream.SetNum(static_cast<int32>(Header.StreamBytes));
+    if (Header.StreamBytes > 0)
+    {
+        Reader.Serialize(Stream.GetData(), Header.StreamBytes);
+    }
+    ScreenSize = FVector2D(Header.ScreenWidth, Header.ScreenHeight);
+    NumFrames = static_cast<int32>(Header.NumFrames);
+
+    if (!DecodeStream())
+    {
+        Reset();
+        return false;
+    }
+    return true;
+}
+
+bool FInputRecording::DecodeStream()
+{
+    Frames.Empty();
+    Frames.Reserve(NumFrames);
+
+    FStreamCursor Cursor{ Stream.GetData(), static_cast<size_t>(Stream.Num()), 0 };
+    FInputFrame Frame;
+    for (int32 Index = 0; Index < NumFrames; ++Index)
+    {
+        const FVector2D LastMousePosition = Frame.MousePosition;
+
+        uint8 Flags = 0;
+        if (!Cursor.Read(Flags) || !Cursor.Read(Frame.DeltaSeconds))
+        {
+            return false;
+        }
+        if ((Flags & FrameFlag_MousePosition) && !Cursor.Read(Frame.MousePosition))
+        {
+            return false;
+        }
+        if (Flags & FrameFlag_PreviousMousePosition)
+        {
+            if (!Cursor.Read(Frame.PreviousMousePosition))
+            {
+                return false;
+            }
+        }
+        else if (!(Flags & FrameFlag_PreviousMouseHeld))
+        {
+            Frame.PreviousMousePosition = LastMousePosition;
+        }
+        if ((Flags & FrameFlag_Wheel) && !Cursor.Read(Frame.MouseWheelDelta))
+        {
+            return false;
+        }
+        if ((Flags & FrameFlag_Buttons) && !Cursor.Read(Frame.MouseButtons))
+        {
+            return false;
+        }
+        if (Flags & FrameFlag_KeyToggles)
+        {
+            uint8 NumToggles = 0;
+            if (!Cursor.Read(NumToggles))
+            {
+                return false;
+            }
+            for (uint8 i = 0; i < NumToggles; ++i)
+            {
+                uint8 KeyCode = 0;
+                if (!Cursor.Read(KeyCode))
+                {
+                    return false;
+                }
+                Frame.KeyBits[KeyCode >> 6] ^= (1ull << (KeyCode & 63));
+            }
+        }
+        else if ((Flags & FrameFlag_KeyBits) && !Cursor.Read(Frame.KeyBits))
+        {
+            return false;
+        }
+
+        Frames.Add(Frame);
+    }
+    return Cursor.Offset == Cursor.Size;
+}
+
+FInputReplayTimingSummary SummarizeReplayTiming(const TArray<double>& FrameMs)
+{
+    FInputReplayTimingSummary Summary;
+    Summary.NumFrames = FrameMs.Num();
+    if (FrameMs.IsEmpty())
+    {
+        return Summary;
+    }
+
+    TArray<double> Sorted = FrameMs;
+    Sorted.Sort();
+    auto Percentile = [&Sorted](double Ratio)
+    {
+        const int32 Index = static_cast<int32>(Ratio * (Sorted.Num() - 1) + 0.5);
+        return Sorted[std::clamp(Index, 0, Sorted.Num() - 1)];
+    };
+
+    for (double Ms : FrameMs)
+    {
+        Summary.TotalMs += Ms;
+    }
+    Summary.AverageMs = Summary.TotalMs / Summary.NumFrames;
+    Summary.MedianMs = Percentile(0.5);
+    Summary.P95Ms = Percentile(0.95);
+    Summary.P99Ms = Percentile(0.99);
+    Summary.MaxMs = Sorted.Last();
+    return Summary;
+}
+
+bool WriteReplayTimingCsv(const FString& Path, const FInputRecording& Recording, const TArray<double>& FrameMs)
+{
+    std::ofstream File(std::filesystem::path(UTF8ToWide(Path)), std::ios::out | std::ios::trunc);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    File << "Frame,RecordedDeltaMs,FrameMs\n";
+    char Line[96];
+    const int32 NumRows = std::min(FrameMs.Num(), Recording.GetNumFrames());
+    for (int32 i = 0; i < NumRows; ++i)
+    {
+        sprintf_s(Line, "%d,%.4f,%.4f\n", i, Recording.GetFrame(i).DeltaSeconds * 1000.0, FrameMs[i]);
+        File << Line;
+    }
+    return true;
+}
@@ -0,0 +1,65 @@
+﻿#pragma once
+
+#include "UEContainer.h"
+#include "Vector.h"
+
+// 한 프레임 동안 게임플레이(Tick)가 보는 입력 스냅샷
+struct FInputFrame
+{
+    float DeltaSeconds = 0.0f;
+    FVector2D MousePosition = FVector2D(0.0f, 0.0f);
+    FVector2D PreviousMousePosition = FVector2D(0.0f, 0.0f); // GetMouseDelta 기준점 (커서 잠금 시 고정)
+    float MouseWheelDelta = 0.0f;
+    uint8 MouseButtons = 0;   // EMouseButton 비트마스크
+    uint64 KeyBits[4] = {};   // Virtual Key Code 256개 상태
+
+    bool IsKeyDown(int32 KeyCode) const { return (KeyBits[KeyCode >> 6] >> (KeyCode & 63)) & 1ull; }
+    void SetKeyDown(int32 KeyCode) { KeyBits[KeyCode >> 6] |= (1ull << (KeyCode & 63)); }
+};
+
+// 입력 녹화 스트림.
+// - 녹화 중에는 프레임마다 이전 프레임과 달라진 필드만 바이트 스트림에 덧붙인다 (보통 프레임당 5~13바이트).
+// - 재생 시에는 파일 전체를 한 번에 디코딩해 두고 프레임마다 복사만 한다.
+class FInputRecording
+{
+public:
+    void Reset();
+
+    // 녹화: 프레임 인코딩 후 스트림에 추가
+    void AddFrame(const FInputFrame& Frame);
+
+    bool SaveToFile(const FString& Path) const;
+    bool LoadFromFile(const FString& Path);
+
+    int32 GetNumFrames() const { return NumFrames; }
+    const FInputFrame& GetFrame(int32 Index) const { return Frames[Index]; }
+    uint32 GetEncodedBytes() const { return static_cast<uint32>(Stream.Num()); }
+
+    // 녹화 당시 화면 크기 (마우스 좌표 해석이 달라지면 재생 결과도 달라지므로 비교용으로 보관)
+    FVector2D ScreenSize = FVector2D(0.0f, 0.0f);
+
+private:
+    bool DecodeStream();
+
+    TArray<uint8> Stream;          // 델타 인코딩된 프레임 스트림
+    TArray<FInputFrame> Frames;    // 디코딩된 프레임 (재생용)
+    FInputFrame LastEncodedFrame;  // 인코딩 기준 프레임
+    int32 NumFrames = 0;
+};
+
+// 재생 세션 프레임 시간 요약 (빌드 간 비교용)
+struct FInputReplayTimingSummary
+{
+    int32 NumFrames = 0;
+    double TotalMs = 0.0;
+    double AverageMs = 0.0;
+    double MedianMs = 0.0;
+    double P95Ms = 0.0;
+    double P99Ms = 0.0;
+    double MaxMs = 0.0;
+};
+
+FInputReplayTimingSummary SummarizeReplayTiming(const TArray<double>& FrameMs);
+
+// Frame, RecordedDeltaMs, FrameMs 열의 CSV로 프레임별 시간을 기록한다
+bool WriteReplayTimingCsv(const FString& Path, const FInputRecording& Recording, const TArray<double>& FrameMs);
@@ -1,11 +1,32 @@
 ﻿#include "pch.h"
 #include "StatsOverlayD2D.h"
 #include "Color.h"
+#include "NullRHI.h"
 
 void D3D11RHI::Initialize(HWND hWindow)
 {
+    Backend = ERHIBackend::D3D11;
+
     // 이곳에서 Device, DeviceContext, viewport, swapchain를 초기화한다
     CreateDeviceAndSwapChain(hWindow);
+    CreatePipelineResources();
+
+    // Initialize Direct2D overlay after device/swapchain ready
+    UStatsOverlayD2D::Get().Initialize(Device, DeviceContext, SwapChain);
+}
+
+void D3D11RHI::InitializeNull(UINT Width, UINT Height)
+{
+    Backend = ERHIBackend::Null;
+    Stats.Reset();
+
+    // D2D 오버레이는 DXGI 서피스가 필요하므로 Null 백엔드에서는 만들지 않는다
+    CreateNullDeviceAndSwapChain(Width, Height);
+    CreatePipelineResources();
+}
+
+void D3D11RHI::CreatePipelineResources()
+{
     CreateFrameBuffer();
     CreateIdBuffer();
     CreateRasterizerState();
@@ -15,9 +36,6 @@ void D3D11RHI::Initialize(HWND hWindow)
 	CreateDepthStencilState();
 	CreateSamplerState();
     UResourceManager::GetInstance().Initialize(Device,DeviceContext);
-
-    // Initialize Direct2D overlay after device/swapchain ready
-    UStatsOverlayD2D::Get().Initialize(Device, DeviceContext, SwapChain);
 }
 
 void D3D11RHI::Release()
@@ -27,7 +45,10 @@ void D3D11RHI::Release()
     bReleased = true;
 
     // Direct2D 오버레이를 먼저 정리하여 D3D 리소스에 대한 참조를 제거
-    UStatsOverlayD2D::Get().Shutdown();
+    if (Backend == ERHIBackend::D3D11)
+    {
+        UStatsOverlayD2D::Get().Shutdown();
+    }
 
     if (DeviceContext)
     {
@@ -498,7 +519,10 @@ void D3D11RHI::DrawFullScreenQuad()
 void D3D11RHI::Present()
 {
     // Draw any Direct2D overlays before present
-    UStatsOverlayD2D::Get().Draw();
+    if (Backend == ERHIBackend::D3D11)
+    {
+        UStatsOverlayD2D::Get().Draw();
+    }
     SwapChain->Present(0, 0); // vsync on
 }
 
@@ -554,6 +578,24 @@ void D3D11RHI::CreateDeviceAndSwapChain(HWND hWindow)
     ViewportInfo = { 0.0f, 0.0f, (float)swapchaindesc.BufferDesc.Width, (float)swapchaindesc.BufferDesc.Height, 0.0f, 1.0f };
 }
 
+void D3D11RHI::CreateNullDeviceAndSwapChain(UINT Width, UINT Height)
+{
+    // 실제 스왑체인과 같은 포맷/버퍼 구성을 쓰되 창 대신 크기를 직접 지정한다
+    DXGI_SWAP_CHAIN_DESC swapchaindesc = {};
+    swapchaindesc.BufferDesc.Width = Width;
+    swapchaindesc.BufferDesc.Height = Height;
+    swapchaindesc.BufferDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+    swapchaindesc.SampleDesc.Count = 1;
+    swapchaindesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
+    swapchaindesc.BufferCount = 2;
+    swapchaindesc.Windowed = TRUE;
+    swapchaindesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+
+    NullRHI::CreateDeviceAndSwapChain(swapchaindesc, &Stats, &Device, &DeviceContext, &SwapChain);
+
+    ViewportInfo = { 0.0f, 0.0f, (float)Width, (float)Height, 0.0f, 1.0f };
+}
+
 void D3D11RHI::CreateFrameBuffer()
 {
     DXGI_SWAP_CHAIN_DESC swapDesc;
@@ -1198,13 +1240,13 @@ void D3D11RHI::PrepareShader(UShader* InVertexShader, UShader* InPixelShader)
 // Structured Buffer 관련 메서드 (타일 기반 라이트 컬링용)
 // ──────────────────────────────────────────────────────
 
-HRESULT D3D11RHI::CreateStructuredBuffer(UINT InElementSize, UINT InElementCount, const void* InInitData, ID3D11Buffer** OutBuffer)
+HRESULT D3D11RHI::CreateStructuredBuffer(UINT InElementSize, UINT InElementCount, const void* InInitData, ID3D11Buffer** OutBuffer, bool bDynamic)
 {
     D3D11_BUFFER_DESC bufferDesc = {};
-    bufferDesc.Usage = D3D11_USAGE_DYNAMIC;  // CPU에서 업데이트 가능
+    bufferDesc.Usage = bDynamic ? D3D11_USAGE_DYNAMIC : D3D11_USAGE_DEFAULT;  // DYNAMIC: Map으로 전체 갱신, DEFAULT: 구간 갱신
     bufferDesc.ByteWidth = InElementSize * InElementCount;
     bufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-    bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    bufferDesc.CPUAccessFlags = bDynamic ? D3D11_CPU_ACCESS_WRITE : 0;
     bufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
     bufferDesc.StructureByteStride = InElementSize;
 
@@ -1250,3 +1292,19 @@ void D3D11RHI::UpdateStructuredBuffer(ID3D11Buffer* InBuffer, const void* InData
         DeviceContext->Unmap(InBuffer, 0);
     }
 }
+
+void D3D11RHI::UpdateStructuredBufferRange(ID3D11Buffer* InBuffer, const void* InData, UINT InOffsetBytes, UINT InSizeBytes)
+{
+    if (!InBuffer || !InData || InSizeBytes == 0)
+        return;
+
+    // DEFAULT 버퍼 전용: 바뀐 구간만 복사 (DYNAMIC 버퍼는 UpdateStructuredBuffer 사용)
+    D3D11_BOX Box = {};
+    Box.left = InOffsetBytes;
+    Box.right = InOffsetBytes + InSizeBytes;
+    Box.top = 0;
+    Box.bottom = 1;
+    Box.front = 0;
+    Box.back = 1;
+    DeviceContext->UpdateSubresource(InBuffer, 0, &Box, InData, 0, 0);
+}
@@ -71,9 +71,18 @@ public:
 
 public:
 	void Initialize(HWND hWindow);
+	// GPU/윈도우 없이 Null 백엔드로 초기화 (헤드리스 실행용). 렌더 타겟은 Width x Height로 만든다
+	void InitializeNull(UINT Width, UINT Height);
 
 	void Release();
 
+	ERHIBackend GetBackend() const { return Backend; }
+	bool IsNullRHI() const { return Backend == ERHIBackend::Null; }
+
+	// Null 백엔드가 누적하는 호출 통계 (D3D11 백엔드에서는 항상 0)
+	const FRHIStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats.Reset(); }
+
 
 public:
 	// clear
@@ -187,9 +196,11 @@ public:
 	void PrepareShader(UShader* InVertexShader, UShader* InPixelShader);
 
 	// Structured Buffer 관련 메서드 (타일 기반 라이트 컬링용)
-	HRESULT CreateStructuredBuffer(UINT InElementSize, UINT InElementCount, const void* InInitData, ID3D11Buffer** OutBuffer);
+	// bDynamic=false면 DEFAULT 버퍼로 생성 (UpdateStructuredBufferRange로 일부 구간만 갱신할 때 사용)
+	HRESULT CreateStructuredBuffer(UINT InElementSize, UINT InElementCount, const void* InInitData, ID3D11Buffer** OutBuffer, bool bDynamic = true);
 	HRESULT CreateStructuredBufferSRV(ID3D11Buffer* InBuffer, ID3D11ShaderResourceView** OutSRV);
 	void UpdateStructuredBuffer(ID3D11Buffer* InBuffer, const void* InData, UINT InDataSize);
+	void UpdateStructuredBufferRange(ID3D11Buffer* InBuffer, const void* InData, UINT InOffsetBytes, UINT InSizeBytes);
 
 	// NOTE: 추후 private 로 이동 필요?
 	// 현재 SRV, RTV 를 다루는 함수
@@ -230,6 +241,8 @@ public:
 
 private:
 	void CreateDeviceAndSwapChain(HWND hWindow); // 여기서 디바이스, 디바이스 컨택스트, 스왑체인, 뷰포트를 초기화한다
+	void CreateNullDeviceAndSwapChain(UINT Width, UINT Height);
+	void CreatePipelineResources(); // 디바이스 생성 이후 백엔드 공통 리소스 (프레임버퍼, 상태, 상수버퍼...)
 	void CreateFrameBuffer();
 	void CreateIdBuffer();
 	void CreateRasterizerState();
@@ -311,6 +324,9 @@ private:
 
 	UShader* PreShader = nullptr; // Shaders, Inputlayout
 
+	ERHIBackend Backend = ERHIBackend::D3D11;
+	FRHIStats Stats;
+
 	bool bReleased = false; // Prevent double Release() calls
 };
 
@@ -0,0 +1,1453 @@
+﻿#include "pch.h"
+#include "NullRHI.h"
+#include <atomic>
+
+namespace
+{
+	// 포맷과 무관하게 텍셀당 최대 크기(R32G32B32A32)로 잡는다. 스크래치 메모리만 넉넉하면 된다.
+	constexpr UINT MaxTexelBytes = 16;
+
+	SIZE_T ComputeMapLayout(const D3D11_BUFFER_DESC& Desc, UINT& OutRowPitch, UINT& OutDepthPitch)
+	{
+		OutRowPitch = Desc.ByteWidth;
+		OutDepthPitch = Desc.ByteWidth;
+		return Desc.ByteWidth;
+	}
+
+	SIZE_T ComputeMapLayout(const D3D11_TEXTURE1D_DESC& Desc, UINT& OutRowPitch, UINT& OutDepthPitch)
+	{
+		OutRowPitch = Desc.Width * MaxTexelBytes;
+		OutDepthPitch = OutRowPitch;
+		return OutRowPitch;
+	}
+
+	SIZE_T ComputeMapLayout(const D3D11_TEXTURE2D_DESC& Desc, UINT& OutRowPitch, UINT& OutDepthPitch)
+	{
+		OutRowPitch = Desc.Width * MaxTexelBytes;
+		OutDepthPitch = OutRowPitch * Desc.Height;
+		return OutDepthPitch;
+	}
+
+	SIZE_T ComputeMapLayout(const D3D11_TEXTURE3D_DESC& Desc, UINT& OutRowPitch, UINT& OutDepthPitch)
+	{
+		OutRowPitch = Desc.Width * MaxTexelBytes;
+		OutDepthPitch = OutRowPitch * Desc.Height;
+		return static_cast<SIZE_T>(OutDepthPitch) * Desc.Depth;
+	}
+
+	// 모든 Null 객체의 IUnknown / ID3D11DeviceChild 공통 구현.
+	// 실제 D3D11처럼 자식 객체가 디바이스 참조를 잡고 있어 디바이스가 먼저 사라지지 않는다.
+	template<typename TInterface, typename TBase = ID3D11DeviceChild>
+	class TNullDeviceChild : public TInterface
+	{
+	public:
+		explicit TNullDeviceChild(ID3D11Device* InDevice)
+			: Device(InDevice)
+		{
+			Device->AddRef();
+		}
+
+		virtual ~TNullDeviceChild()
+		{
+			Device->Release();
+		}
+
+		HRESULT STDMETHODCALLTYPE QueryInterface(REFIID Riid, void** OutObject) override
+		{
+			if (!OutObject)
+			{
+				return E_POINTER;
+			}
+			if (Riid == __uuidof(IUnknown) || Riid == __uuidof(ID3D11DeviceChild) || Riid == __uuidof(TBase) || Riid == __uuidof(TInterface))
+			{
+				*OutObject = static_cast<TInterface*>(this);
+				AddRef();
+				return S_OK;
+			}
+			*OutObject = nullptr;
+			return E_NOINTERFACE;
+		}
+
+		ULONG STDMETHODCALLTYPE AddRef() override
+		{
+			return ++RefCount;
+		}
+
+		ULONG STDMETHODCALLTYPE Release() override
+		{
+			const ULONG Remaining = --RefCount;
+			if (Remaining == 0)
+			{
+				delete this;
+			}
+			return Remaining;
+		}
+
+		void STDMETHODCALLTYPE GetDevice(ID3D11Device** OutDevice) override
+		{
+			Device->AddRef();
+			*OutDevice = Device;
+		}
+
+		HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID, UINT* InOutDataSize, void*) override
+		{
+			if (InOutDataSize)
+			{
+				*InOutDataSize = 0;
+			}
+			return DXGI_ERROR_NOT_FOUND;
+		}
+
+		HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID, UINT, const void*) override { return S_OK; }
+		HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID, const IUnknown*) override { return S_OK; }
+
+	protected:
+		ID3D11Device* Device;
+		std::atomic<ULONG> RefCount{ 1 };
+	};
+
+	// Map()이 돌려줄 CPU 메모리. GPU 메모리 대신 리소스마다 한 번 할당해 재사용한다.
+	class FNullMappable
+	{
+	public:
+		virtual ~FNullMappable() = default;
+
+		virtual SIZE_T GetMapLayout(UINT& OutRowPitch, UINT& OutDepthPitch) const = 0;
+		virtual bool IsBuffer() const = 0;
+
+		void* GetScratch(SIZE_T InSize)
+		{
+			if (static_cast<SIZE_T>(Scratch.Num()) < InSize)
+			{
+				Scratch.SetNum(static_cast<int32>(InSize));
+			}
+			return Scratch.GetData();
+		}
+
+	private:
+		TArray<uint8> Scratch;
+	};
+
+	template<typename TInterface, typename TDesc, D3D11_RESOURCE_DIMENSION Dimension>
+	class TNullResource : public TNullDeviceChild<TInterface, ID3D11Resource>, public FNullMappable
+	{
+	public:
+		TNullResource(ID3D11Device* InDevice, const TDesc& InDesc)
+			: TNullDeviceChild<TInterface, ID3D11Resource>(InDevice)
+			, Desc(InDesc)
+		{
+		}
+
+		void STDMETHODCALLTYPE GetType(D3D11_RESOURCE_DIMENSION* OutDimension) override { *OutDimension = Dimension; }
+		void STDMETHODCALLTYPE SetEvictionPriority(UINT InPriority) override { EvictionPriority = InPriority; }
+		UINT STDMETHODCALLTYPE GetEvictionPriority() override { return EvictionPriority; }
+		void STDMETHODCALLTYPE GetDesc(TDesc* OutDesc) override { *OutDesc = Desc; }
+
+		SIZE_T GetMapLayout(UINT& OutRowPitch, UINT& OutDepthPitch) const override
+		{
+			return ComputeMapLayout(Desc, OutRowPitch, OutDepthPitch);
+		}
+
+		bool IsBuffer() const override { return Dimension == D3D11_RESOURCE_DIMENSION_BUFFER; }
+
+	private:
+		TDesc Desc;
+		UINT EvictionPriority = 0;
+	};
+
+	using FNullBuffer = TNullResource<ID3D11Buffer, D3D11_BUFFER_DESC, D3D11_RESOURCE_DIMENSION_BUFFER>;
+	using FNullTexture1D = TNullResource<ID3D11Texture1D, D3D11_TEXTURE1D_DESC, D3D11_RESOURCE_DIMENSION_TEXTURE1D>;
+	using FNullTexture2D = TNullResource<ID3D11Texture2D, D3D11_TEXTURE2D_DESC, D3D11_RESOURCE_DIMENSION_TEXTURE2D>;
+	using FNullTexture3D = TNullResource<ID3D11Texture3D, D3D11_TEXTURE3D_DESC, D3D11_RESOURCE_DIMENSION_TEXTURE3D>;
+
+	template<typename TInterface, typename TDesc>
+	class TNullView : public TNullDeviceChild<TInterface, ID3D11View>
+	{
+	public:
+		TNullView(ID3D11Device* InDevice, ID3D11Resource* InResource, const TDesc* InDesc)
+			: TNullDeviceChild<TInterface, ID3D11View>(InDevice)
+			, Resource(InResource)
+		{
+			Resource->AddRef();
+			if (InDesc)
+			{
+				Desc = *InDesc;
+			}
+		}
+
+		~TNullView() override
+		{
+			Resource->Release();
+		}
+
+		void STDMETHODCALLTYPE GetResource(ID3D11Resource** OutResource) override
+		{
+			Resource->AddRef();
+			*OutResource = Resource;
+		}
+
+		void STDMETHODCALLTYPE GetDesc(TDesc* OutDesc) override { *OutDesc = Desc; }
+
+	private:
+		ID3D11Resource* Resource;
+		TDesc Desc{};
+	};
+
+	using FNullShaderResourceView = TNullView<ID3D11ShaderResourceView, D3D11_SHADER_RESOURCE_VIEW_DESC>;
+	using FNullRenderTargetView = TNullView<ID3D11RenderTargetView, D3D11_RENDER_TARGET_VIEW_DESC>;
+	using FNullDepthStencilView = TNullView<ID3D11DepthStencilView, D3D11_DEPTH_STENCIL_VIEW_DESC>;
+	using FNullUnorderedAccessView = TNullView<ID3D11UnorderedAccessView, D3D11_UNORDERED_ACCESS_VIEW_DESC>;
+
+	template<typename TInterface, typename TDesc>
+	class TNullState : public TNullDeviceChild<TInterface>
+	{
+	public:
+		TNullState(ID3D11Device* InDevice, const TDesc& InDesc)
+			: TNullDeviceChild<TInterface>(InDevice)
+			, Desc(InDesc)
+		{
+		}
+
+		void STDMETHODCALLTYPE GetDesc(TDesc* OutDesc) override { *OutDesc = Desc; }
+
+	private:
+		TDesc Desc;
+	};
+
+	using FNullRasterizerState = TNullState<ID3D11RasterizerState, D3D11_RASTERIZER_DESC>;
+	using FNullBlendState = TNullState<ID3D11BlendState, D3D11_BLEND_DESC>;
+	using FNullDepthStencilState = TNullState<ID3D11DepthStencilState, D3D11_DEPTH_STENCIL_DESC>;
+	using FNullSamplerState = TNullState<ID3D11SamplerState, D3D11_SAMPLER_DESC>;
+
+	// 셰이더와 입력 레이아웃은 추가 메서드가 없으므로 공통 구현 그대로 쓴다
+	using FNullVertexShader = TNullDeviceChild<ID3D11VertexShader>;
+	using FNullPixelShader = TNullDeviceChild<ID3D11PixelShader>;
+	using FNullGeometryShader = TNullDeviceChild<ID3D11GeometryShader>;
+	using FNullHullShader = TNullDeviceChild<ID3D11HullShader>;
+	using FNullDomainShader = TNullDeviceChild<ID3D11DomainShader>;
+	using FNullComputeShader = TNullDeviceChild<ID3D11ComputeShader>;
+	using FNullInputLayout = TNullDeviceChild<ID3D11InputLayout>;
+
+	template<typename TInterface>
+	class TNullQuery : public TNullDeviceChild<TInterface, ID3D11Asynchronous>
+	{
+	public:
+		TNullQuery(ID3D11Device* InDevice, const D3D11_QUERY_DESC& InDesc)
+			: TNullDeviceChild<TInterface, ID3D11Asynchronous>(InDevice)
+			, Desc(InDesc)
+		{
+		}
+
+		UINT STDMETHODCALLTYPE GetDataSize() override
+		{
+			switch (Desc.Query)
+			{
+			case D3D11_QUERY_TIMESTAMP:
+			case D3D11_QUERY_OCCLUSION:
+				return sizeof(UINT64);
+			case D3D11_QUERY_TIMESTAMP_DISJOINT:
+				return sizeof(D3D11_QUERY_DATA_TIMESTAMP_DISJOINT);
+			case D3D11_QUERY_PIPELINE_STATISTICS:
+				return sizeof(D3D11_QUERY_DATA_PIPELINE_STATISTICS);
+			case D3D11_QUERY_OCCLUSION_PREDICATE:
+				return sizeof(BOOL);
+			case D3D11_QUERY_EVENT:
+				return sizeof(BOOL);
+			default:
+				return 0;
+			}
+		}
+
+		void STDMETHODCALLTYPE GetDesc(D3D11_QUERY_DESC* OutDesc) override { *OutDesc = Desc; }
+
+	private:
+		D3D11_QUERY_DESC Desc;
+	};
+
+	using FNullQuery = TNullQuery<ID3D11Query>;
+	using FNullPredicate = TNullQuery<ID3D11Predicate>;
+
+	class FNullBlob : public ID3DBlob
+	{
+	public:
+		explicit FNullBlob(SIZE_T InSize)
+		{
+			Data.SetNum(static_cast<int32>(InSize));
+		}
+
+		virtual ~FNullBlob() = default;
+
+		HRESULT STDMETHODCALLTYPE QueryInterface(REFIID Riid, void** OutObject) override
+		{
+			if (!OutObject)
+			{
+				return E_POINTER;
+			}
+			if (Riid == __uuidof(IUnknown) || Riid == __uuidof(ID3D10Blob))
+			{
+				*OutObject = static_cast<ID3DBlob*>(this);
+				AddRef();
+				return S_OK;
+			}
+			*OutObject = nullptr;
+			return E_NOINTERFACE;
+		}
+
+		ULONG STDMETHODCALLTYPE AddRef() override { return ++RefCount; }
+
+		ULONG STDMETHODCALLTYPE Release() override
+		{
+			const ULONG Remaining = --RefCount;
+			if (Remaining == 0)
+			{
+				delete this;
+			}
+			return Remaining;
+		}
+
+		LPVOID STDMETHODCALLTYPE GetBufferPointer() override { return Data.GetData(); }
+		SIZE_T STDMETHODCALLTYPE GetBufferSize() override { return static_cast<SIZE_T>(Data.Num()); }
+
+	private:
+		TArray<uint8> Data;
+		std::atomic<ULONG> RefCount{ 1 };
+	};
+
+	// 참조를 잡는 상태 슬롯 갱신 (실제 D3D11처럼 바인딩된 객체는 컨텍스트가 AddRef). 값이 바뀌면 true
+	template<typename T>
+	bool SetTracked(T*& Slot, T* Value)
+	{
+		if (Slot == Value)
+		{
+			return false;
+		}
+		if (Value)
+		{
+			Value->AddRef();
+		}
+		if (Slot)
+		{
+			Slot->Release();
+		}
+		Slot = Value;
+		return true;
+	}
+
+	template<typename T>
+	void GetTracked(T* Slot, T** OutValue)
+	{
+		if (!OutValue)
+		{
+			return;
+		}
+		if (Slot)
+		{
+			Slot->AddRef();
+		}
+		*OutValue = Slot;
+	}
+
+	// 추적하지 않는 슬롯 배열의 Get: 비어 있다고 응답
+	template<typename T>
+	void GetUntracked(UINT NumSlots, T** OutValues)
+	{
+		if (!OutValues)
+		{
+			return;
+		}
+		for (UINT i = 0; i < NumSlots; ++i)
+		{
+			OutValues[i] = nullptr;
+		}
+	}
+
+	// 즉시 컨텍스트. 수명은 디바이스가 소유하므로 참조 카운트는 디바이스로 넘긴다.
+	class FNullDeviceContext : public ID3D11DeviceContext
+	{
+	public:
+		FNullDeviceContext(ID3D11Device* InDevice, FRHIStats* InStats)
+			: Device(InDevice)
+			, Stats(InStats)
+		{
+		}
+
+		virtual ~FNullDeviceContext() = default;
+
+		// IUnknown
+		HRESULT STDMETHODCALLTYPE QueryInterface(REFIID Riid, void** OutObject) override
+		{
+			if (!OutObject)
+			{
+				return E_POINTER;
+			}
+			if (Riid == __uuidof(IUnknown) || Riid == __uuidof(ID3D11DeviceChild) || Riid == __uuidof(ID3D11DeviceContext))
+			{
+				*OutObject = static_cast<ID3D11DeviceContext*>(this);
+				AddRef();
+				return S_OK;
+			}
+			// ID3DUserDefinedAnnotation 등은 지원하지 않음 (GPU 이벤트 마커는 조용히 생략됨)
+			*OutObject = nullptr;
+			return E_NOINTERFACE;
+		}
+
+		ULONG STDMETHODCALLTYPE AddRef() override { return Device->AddRef(); }
+		ULONG STDMETHODCALLTYPE Release() override { return Device->Release(); }
+
+		// ID3D11DeviceChild
+		void STDMETHODCALLTYPE GetDevice(ID3D11Device** OutDevice) override
+		{
+			Device->AddRef();
+			*OutDevice = Device;
+		}
+
+		HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID, UINT* InOutDataSize, void*) override
+		{
+			if (InOutDataSize)
+			{
+				*InOutDataSize = 0;
+			}
+			return DXGI_ERROR_NOT_FOUND;
+		}
+
+		HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID, UINT, const void*) override { return S_OK; }
+		HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID, const IUnknown*) override { return S_OK; }
+
+		// --- 슬롯 바인딩 (추적하지 않고 슬롯 수만 센다) ---
+		void STDMETHODCALLTYPE VSSetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer* const*) override { CountBinds(NumBuffers); }
+		void STDMETHODCALLTYPE PSSetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView* const*) override { CountBinds(NumViews); }
+		void STDMETHODCALLTYPE PSSetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState* const*) override { CountBinds(NumSamplers); }
+		void STDMETHODCALLTYPE PSSetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer* const*) override { CountBinds(NumBuffers); }
+		void STDMETHODCALLTYPE IASetVertexBuffers(UINT, UINT NumBuffers, ID3D11Buffer* const*, const UINT*, const UINT*) override { CountBinds(NumBuffers); }
+		void STDMETHODCALLTYPE GSSetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer* const*) override { CountBinds(NumBuffers); }
+		void STDMETHODCALLTYPE VSSetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView* const*) override { CountBinds(NumViews); }
+		void STDMETHODCALLTYPE VSSetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState* const*) override { CountBinds(NumSamplers); }
+		void STDMETHODCALLTYPE GSSetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView* const*) override { CountBinds(NumViews); }
+		void STDMETHODCALLTYPE GSSetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState* const*) override { CountBinds(NumSamplers); }
+		void STDMETHODCALLTYPE SOSetTargets(UINT NumBuffers, ID3D11Buffer* const*, const UINT*) override { CountBinds(NumBuffers); }
+		void STDMETHODCALLTYPE HSSetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView* const*) override { CountBinds(NumViews); }
+		void STDMETHODCALLTYPE HSSetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState* const*) override { CountBinds(NumSamplers); }
+		void STDMETHODCALLTYPE HSSetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer* const*) override { CountBinds(NumBuffers); }
+		void STDMETHODCALLTYPE DSSetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView* const*) override { CountBinds(NumViews); }
+		void STDMETHODCALLTYPE DSSetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState* const*) override { CountBinds(NumSamplers); }
+		void STDMETHODCALLTYPE DSSetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer* const*) override { CountBinds(NumBuffers); }
+		void STDMETHODCALLTYPE CSSetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView* const*) override { CountBinds(NumViews); }
+		void STDMETHODCALLTYPE CSSetUnorderedAccessViews(UINT, UINT NumUAVs, ID3D11UnorderedAccessView* const*, const UINT*) override { CountBinds(NumUAVs); }
+		void STDMETHODCALLTYPE CSSetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState* const*) override { CountBinds(NumSamplers); }
+		void STDMETHODCALLTYPE CSSetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer* const*) override { CountBinds(NumBuffers); }
+
+		void STDMETHODCALLTYPE IASetIndexBuffer(ID3D11Buffer* InIndexBuffer, DXGI_FORMAT InFormat, UINT InOffset) override
+		{
+			CountBinds(1);
+			SetTracked(IndexBuffer, InIndexBuffer);
+			IndexFormat = InFormat;
+			IndexOffset = InOffset;
+		}
+
+		// --- 파이프라인 상태 (추적 + 변경 여부 카운트) ---
+		void STDMETHODCALLTYPE VSSetShader(ID3D11VertexShader* InShader, ID3D11ClassInstance* const*, UINT) override { CountState(SetTracked(VertexShader, InShader)); }
+		void STDMETHODCALLTYPE PSSetShader(ID3D11PixelShader* InShader, ID3D11ClassInstance* const*, UINT) override { CountState(SetTracked(PixelShader, InShader)); }
+		void STDMETHODCALLTYPE GSSetShader(ID3D11GeometryShader* InShader, ID3D11ClassInstance* const*, UINT) override { CountState(SetTracked(GeometryShader, InShader)); }
+		void STDMETHODCALLTYPE HSSetShader(ID3D11HullShader* InShader, ID3D11ClassInstance* const*, UINT) override { CountState(SetTracked(HullShader, InShader)); }
+		void STDMETHODCALLTYPE DSSetShader(ID3D11DomainShader* InShader, ID3D11ClassInstance* const*, UINT) override { CountState(SetTracked(DomainShader, InShader)); }
+		void STDMETHODCALLTYPE CSSetShader(ID3D11ComputeShader* InShader, ID3D11ClassInstance* const*, UINT) override { CountState(SetTracked(ComputeShader, InShader)); }
+		void STDMETHODCALLTYPE IASetInputLayout(ID3D11InputLayout* InInputLayout) override { CountState(SetTracked(InputLayout, InInputLayout)); }
+		void STDMETHODCALLTYPE RSSetState(ID3D11RasterizerState* InState) override { CountState(SetTracked(RasterizerState, InState)); }
+
+		void STDMETHODCALLTYPE IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) override
+		{
+			CountState(Topology != InTopology);
+			Topology = InTopology;
+		}
+
+		void STDMETHODCALLTYPE OMSetBlendState(ID3D11BlendState* InState, const FLOAT InBlendFactor[4], UINT InSampleMask) override
+		{
+			const FLOAT DefaultFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			const FLOAT* Factor = InBlendFactor ? InBlendFactor : DefaultFactor;
+			bool bChanged = SetTracked(BlendState, InState);
+			bChanged |= std::memcmp(BlendFactor, Factor, sizeof(BlendFactor)) != 0 || SampleMask != InSampleMask;
+			std::memcpy(BlendFactor, Factor, sizeof(BlendFactor));
+			SampleMask = InSampleMask;
+			CountState(bChanged);
+		}
+
+		void STDMETHODCALLTYPE OMSetDepthStencilState(ID3D11DepthStencilState* InState, UINT InStencilRef) override
+		{
+			bool bChanged = SetTracked(DepthStencilState, InState);
+			bChanged |= StencilRef != InStencilRef;
+			StencilRef = InStencilRef;
+			CountState(bChanged);
+		}
+
+		void STDMETHODCALLTYPE OMSetRenderTargets(UINT NumViews, ID3D11RenderTargetView* const* InRenderTargets, ID3D11DepthStencilView* InDepthStencil) override
+		{
+			bool bChanged = false;
+			for (UINT i = 0; i < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT; ++i)
+			{
+				ID3D11RenderTargetView* View = (InRenderTargets && i < NumViews) ? InRenderTargets[i] : nullptr;
+				bChanged |= SetTracked(RenderTargets[i], View);
+			}
+			bChanged |= SetTracked(DepthStencil, InDepthStencil);
+			CountState(bChanged);
+		}
+
+		void STDMETHODCALLTYPE OMSetRenderTargetsAndUnorderedAccessViews(UINT NumRTVs, ID3D11RenderTargetView* const* InRenderTargets, ID3D11DepthStencilView* InDepthStencil,
+			UINT, UINT NumUAVs, ID3D11UnorderedAccessView* const*, const UINT*) override
+		{
+			if (NumRTVs != D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL)
+			{
+				OMSetRenderTargets(NumRTVs, InRenderTargets, InDepthStencil);
+			}
+			if (NumUAVs != D3D11_KEEP_UNORDERED_ACCESS_VIEWS)
+			{
+				CountBinds(NumUAVs);
+			}
+		}
+
+		void STDMETHODCALLTYPE RSSetViewports(UINT NumInViewports, const D3D11_VIEWPORT* InViewports) override
+		{
+			NumInViewports = std::min<UINT>(NumInViewports, D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE);
+			const bool bChanged = NumViewports != NumInViewports
+				|| (NumInViewports > 0 && std::memcmp(Viewports, InViewports, sizeof(D3D11_VIEWPORT) * NumInViewports) != 0);
+			if (NumInViewports > 0)
+			{
+				std::memcpy(Viewports, InViewports, sizeof(D3D11_VIEWPORT) * NumInViewports);
+			}
+			NumViewports = NumInViewports;
+			CountState(bChanged);
+		}
+
+		void STDMETHODCALLTYPE RSSetScissorRects(UINT NumRects, const D3D11_RECT* InRects) override
+		{
+			NumRects = std::min<UINT>(NumRects, D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE);
+			const bool bChanged = NumScissorRects != NumRects
+				|| (NumRects > 0 && std::memcmp(ScissorRects, InRects, sizeof(D3D11_RECT) * NumRects) != 0);
+			if (NumRects > 0)
+			{
+				std::memcpy(ScissorRects, InRects, sizeof(D3D11_RECT) * NumRects);
+			}
+			NumScissorRects = NumRects;
+			CountState(bChanged);
+		}
+
+		void STDMETHODCALLTYPE SetPredication(ID3D11Predicate*, BOOL) override { CountState(true); }
+
+		// --- 드로우 / 디스패치 ---
+		void STDMETHODCALLTYPE DrawIndexed(UINT IndexCount, UINT, INT) override { CountDraw(IndexCount); }
+		void STDMETHODCALLTYPE Draw(UINT VertexCount, UINT) override { CountDraw(VertexCount); }
+		void STDMETHODCALLTYPE DrawIndexedInstanced(UINT IndexCountPerInstance, UINT InstanceCount, UINT, INT, UINT) override { CountDraw(static_cast<uint64>(IndexCountPerInstance) * InstanceCount); }
+		void STDMETHODCALLTYPE DrawInstanced(UINT VertexCountPerInstance, UINT InstanceCount, UINT, UINT) override { CountDraw(static_cast<uint64>(VertexCountPerInstance) * InstanceCount); }
+		void STDMETHODCALLTYPE DrawAuto() override { CountDraw(0); }
+		void STDMETHODCALLTYPE DrawIndexedInstancedIndirect(ID3D11Buffer*, UINT) override { CountDraw(0); }
+		void STDMETHODCALLTYPE DrawInstancedIndirect(ID3D11Buffer*, UINT) override { CountDraw(0); }
+		void STDMETHODCALLTYPE Dispatch(UINT, UINT, UINT) override { ++Stats->DispatchCalls; }
+		void STDMETHODCALLTYPE DispatchIndirect(ID3D11Buffer*, UINT) override { ++Stats->DispatchCalls; }
+
+		// --- 리소스 접근 / 업로드 ---
+		HRESULT STDMETHODCALLTYPE Map(ID3D11Resource* Resource, UINT, D3D11_MAP MapType, UINT, D3D11_MAPPED_SUBRESOURCE* OutMapped) override
+		{
+			FNullMappable* Mappable = Resource ? dynamic_cast<FNullMappable*>(Resource) : nullptr;
+			if (!Mappable || !OutMapped)
+			{
+				return E_INVALIDARG;
+			}
+
+			UINT RowPitch = 0;
+			UINT DepthPitch = 0;
+			const SIZE_T Size = Mappable->GetMapLayout(RowPitch, DepthPitch);
+			OutMapped->pData = Mappable->GetScratch(Size);
+			OutMapped->RowPitch = RowPitch;
+			OutMapped->DepthPitch = DepthPitch;
+
+			if (MapType != D3D11_MAP_READ)
+			{
+				CountUpload(Mappable->IsBuffer(), Size);
+			}
+			return S_OK;
+		}
+
+		void STDMETHODCALLTYPE Unmap(ID3D11Resource*, UINT) override {}
+
+		void STDMETHODCALLTYPE UpdateSubresource(ID3D11Resource* DstResource, UINT, const D3D11_BOX* DstBox, const void*, UINT SrcRowPitch, UINT SrcDepthPitch) override
+		{
+			FNullMappable* Mappable = DstResource ? dynamic_cast<FNullMappable*>(DstResource) : nullptr;
+			if (!Mappable)
+			{
+				return;
+			}
+
+			SIZE_T Size = 0;
+			if (Mappable->IsBuffer())
+			{
+				UINT RowPitch = 0;
+				UINT DepthPitch = 0;
+				Size = DstBox ? (DstBox->right - DstBox->left) : Mappable->GetMapLayout(RowPitch, DepthPitch);
+			}
+			else if (DstBox)
+			{
+				Size = static_cast<SIZE_T>(SrcRowPitch) * (DstBox->bottom - DstBox->top) * std::max<UINT>(1, DstBox->back - DstBox->front);
+			}
+			else
+			{
+				Size = SrcDepthPitch > 0 ? SrcDepthPitch : SrcRowPitch;
+			}
+			CountUpload(Mappable->IsBuffer(), Size);
+		}
+
+		void STDMETHODCALLTYPE CopySubresourceRegion(ID3D11Resource*, UINT, UINT, UINT, UINT, ID3D11Resource*, UINT, const D3D11_BOX*) override { ++Stats->Copies; }
+		void STDMETHODCALLTYPE CopyResource(ID3D11Resource*, ID3D11Resource*) override { ++Stats->Copies; }
+		void STDMETHODCALLTYPE CopyStructureCount(ID3D11Buffer*, UINT, ID3D11UnorderedAccessView*) override { ++Stats->Copies; }
+		void STDMETHODCALLTYPE ResolveSubresource(ID3D11Resource*, UINT, ID3D11Resource*, UINT, DXGI_FORMAT) override { ++Stats->Copies; }
+
+		void STDMETHODCALLTYPE ClearRenderTargetView(ID3D11RenderTargetView*, const FLOAT[4]) override { ++Stats->Clears; }
+		void STDMETHODCALLTYPE ClearUnorderedAccessViewUint(ID3D11UnorderedAccessView*, const UINT[4]) override { ++Stats->Clears; }
+		void STDMETHODCALLTYPE ClearUnorderedAccessViewFloat(ID3D11UnorderedAccessView*, const FLOAT[4]) override { ++Stats->Clears; }
+		void STDMETHODCALLTYPE ClearDepthStencilView(ID3D11DepthStencilView*, UINT, FLOAT, UINT8) override { ++Stats->Clears; }
+
+		void STDMETHODCALLTYPE GenerateMips(ID3D11ShaderResourceView*) override {}
+		void STDMETHODCALLTYPE SetResourceMinLOD(ID3D11Resource*, FLOAT) override {}
+		FLOAT STDMETHODCALLTYPE GetResourceMinLOD(ID3D11Resource*) override { return 0.0f; }
+
+		// --- 쿼리: 결과는 항상 준비되어 있고 0. 타임스탬프는 disjoint로 보고해 GPU 시간을 무시하게 한다 ---
+		void STDMETHODCALLTYPE Begin(ID3D11Asynchronous*) override {}
+		void STDMETHODCALLTYPE End(ID3D11Asynchronous*) override {}
+
+		HRESULT STDMETHODCALLTYPE GetData(ID3D11Asynchronous* Async, void* OutData, UINT DataSize, UINT) override
+		{
+			if (!Async)
+			{
+				return E_INVALIDARG;
+			}
+			if (OutData && DataSize > 0)
+			{
+				std::memset(OutData, 0, DataSize);
+
+				ID3D11Query* Query = nullptr;
+				if (SUCCEEDED(Async->QueryInterface(__uuidof(ID3D11Query), reinterpret_cast<void**>(&Query))))
+				{
+					D3D11_QUERY_DESC QueryDesc{};
+					Query->GetDesc(&QueryDesc);
+					Query->Release();
+
+					if (QueryDesc.Query == D3D11_QUERY_TIMESTAMP_DISJOINT && DataSize >= sizeof(D3D11_QUERY_DATA_TIMESTAMP_DISJOINT))
+					{
+						D3D11_QUERY_DATA_TIMESTAMP_DISJOINT* Disjoint = static_cast<D3D11_QUERY_DATA_TIMESTAMP_DISJOINT*>(OutData);
+						Disjoint->Frequency = 1;
+						Disjoint->Disjoint = TRUE;
+					}
+				}
+			}
+			return S_OK;
+		}
+
+		// --- Get 계열 ---
+		void STDMETHODCALLTYPE VSGetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer** OutBuffers) override { GetUntracked(NumBuffers, OutBuffers); }
+		void STDMETHODCALLTYPE PSGetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView** OutViews) override { GetUntracked(NumViews, OutViews); }
+		void STDMETHODCALLTYPE PSGetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState** OutSamplers) override { GetUntracked(NumSamplers, OutSamplers); }
+		void STDMETHODCALLTYPE PSGetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer** OutBuffers) override { GetUntracked(NumBuffers, OutBuffers); }
+		void STDMETHODCALLTYPE GSGetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer** OutBuffers) override { GetUntracked(NumBuffers, OutBuffers); }
+		void STDMETHODCALLTYPE VSGetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView** OutViews) override { GetUntracked(NumViews, OutViews); }
+		void STDMETHODCALLTYPE VSGetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState** OutSamplers) override { GetUntracked(NumSamplers, OutSamplers); }
+		void STDMETHODCALLTYPE GSGetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView** OutViews) override { GetUntracked(NumViews, OutViews); }
+		void STDMETHODCALLTYPE GSGetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState** OutSamplers) override { GetUntracked(NumSamplers, OutSamplers); }
+		void STDMETHODCALLTYPE SOGetTargets(UINT NumBuffers, ID3D11Buffer** OutBuffers) override { GetUntracked(NumBuffers, OutBuffers); }
+		void STDMETHODCALLTYPE HSGetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView** OutViews) override { GetUntracked(NumViews, OutViews); }
+		void STDMETHODCALLTYPE HSGetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState** OutSamplers) override { GetUntracked(NumSamplers, OutSamplers); }
+		void STDMETHODCALLTYPE HSGetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer** OutBuffers) override { GetUntracked(NumBuffers, OutBuffers); }
+		void STDMETHODCALLTYPE DSGetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView** OutViews) override { GetUntracked(NumViews, OutViews); }
+		void STDMETHODCALLTYPE DSGetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState** OutSamplers) override { GetUntracked(NumSamplers, OutSamplers); }
+		void STDMETHODCALLTYPE DSGetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer** OutBuffers) override { GetUntracked(NumBuffers, OutBuffers); }
+		void STDMETHODCALLTYPE CSGetShaderResources(UINT, UINT NumViews, ID3D11ShaderResourceView** OutViews) override { GetUntracked(NumViews, OutViews); }
+		void STDMETHODCALLTYPE CSGetUnorderedAccessViews(UINT, UINT NumUAVs, ID3D11UnorderedAccessView** OutUAVs) override { GetUntracked(NumUAVs, OutUAVs); }
+		void STDMETHODCALLTYPE CSGetSamplers(UINT, UINT NumSamplers, ID3D11SamplerState** OutSamplers) override { GetUntracked(NumSamplers, OutSamplers); }
+		void STDMETHODCALLTYPE CSGetConstantBuffers(UINT, UINT NumBuffers, ID3D11Buffer** OutBuffers) override { GetUntracked(NumBuffers, OutBuffers); }
+
+		void STDMETHODCALLTYPE IAGetVertexBuffers(UINT, UINT NumBuffers, ID3D11Buffer** OutBuffers, UINT* OutStrides, UINT* OutOffsets) override
+		{
+			GetUntracked(NumBuffers, OutBuffers);
+			for (UINT i = 0; i < NumBuffers; ++i)
+			{
+				if (OutStrides) OutStrides[i] = 0;
+				if (OutOffsets) OutOffsets[i] = 0;
+			}
+		}
+
+		void STDMETHODCALLTYPE IAGetIndexBuffer(ID3D11Buffer** OutIndexBuffer, DXGI_FORMAT* OutFormat, UINT* OutOffset) override
+		{
+			GetTracked(IndexBuffer, OutIndexBuffer);
+			if (OutFormat) *OutFormat = IndexFormat;
+			if (OutOffset) *OutOffset = IndexOffset;
+		}
+
+		void STDMETHODCALLTYPE PSGetShader(ID3D11PixelShader** OutShader, ID3D11ClassInstance**, UINT* OutNumInstances) override { GetShader(PixelShader, OutShader, OutNumInstances); }
+		void STDMETHODCALLTYPE VSGetShader(ID3D11VertexShader** OutShader, ID3D11ClassInstance**, UINT* OutNumInstances) override { GetShader(VertexShader, OutShader, OutNumInstances); }
+		void STDMETHODCALLTYPE GSGetShader(ID3D11GeometryShader** OutShader, ID3D11ClassInstance**, UINT* OutNumInstances) override { GetShader(GeometryShader, OutShader, OutNumInstances); }
+		void STDMETHODCALLTYPE HSGetShader(ID3D11HullShader** OutShader, ID3D11ClassInstance**, UINT* OutNumInstances) override { GetShader(HullShader, OutShader, OutNumInstances); }
+		void STDMETHODCALLTYPE DSGetShader(ID3D11DomainShader** OutShader, ID3D11ClassInstance**, UINT* OutNumInstances) override { GetShader(DomainShader, OutShader, OutNumInstances); }
+		void STDMETHODCALLTYPE CSGetShader(ID3D11ComputeShader** OutShader, ID3D11ClassInstance**, UINT* OutNumInstances) override { GetShader(ComputeShader, OutShader, OutNumInstances); }
+
+		void STDMETHODCALLTYPE IAGetInputLayout(ID3D11InputLayout** OutInputLayout) override { GetTracked(InputLayout, OutInputLayout); }
+		void STDMETHODCALLTYPE IAGetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY* OutTopology) override { *OutTopology = Topology; }
+		void STDMETHODCALLTYPE RSGetState(ID3D11RasterizerState** OutState) override { GetTracked(RasterizerState, OutState); }
+
+		void STDMETHODCALLTYPE GetPredication(ID3D11Predicate** OutPredicate, BOOL* OutValue) override
+		{
+			if (OutPredicate) *OutPredicate = nullptr;
+			if (OutValue) *OutValue = FALSE;
+		}
+
+		void STDMETHODCALLTYPE OMGetRenderTargets(UINT NumViews, ID3D11RenderTargetView** OutRenderTargets, ID3D11DepthStencilView** OutDepthStencil) override
+		{
+			if (OutRenderTargets)
+			{
+				for (UINT i = 0; i < NumViews; ++i)
+				{
+					GetTracked(i < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT ? RenderTargets[i] : nullptr, &OutRenderTargets[i]);
+				}
+			}
+			GetTracked(DepthStencil, OutDepthStencil);
+		}
+
+		void STDMETHODCALLTYPE OMGetRenderTargetsAndUnorderedAccessViews(UINT NumRTVs, ID3D11RenderTargetView** OutRenderTargets, ID3D11DepthStencilView** OutDepthStencil,
+			UINT, UINT NumUAVs, ID3D11UnorderedAccessView** OutUAVs) override
+		{
+			OMGetRenderTargets(NumRTVs, OutRenderTargets, OutDepthStencil);
+			GetUntracked(NumUAVs, OutUAVs);
+		}
+
+		void STDMETHODCALLTYPE OMGetBlendState(ID3D11BlendState** OutState, FLOAT OutBlendFactor[4], UINT* OutSampleMask) override
+		{
+			GetTracked(BlendState, OutState);
+			if (OutBlendFactor) std::memcpy(OutBlendFactor, BlendFactor, sizeof(BlendFactor));
+			if (OutSampleMask) *OutSampleMask = SampleMask;
+		}
+
+		void STDMETHODCALLTYPE OMGetDepthStencilState(ID3D11DepthStencilState** OutState, UINT* OutStencilRef) override
+		{
+			GetTracked(DepthStencilState, OutState);
+			if (OutStencilRef) *OutStencilRef = StencilRef;
+		}
+
+		void STDMETHODCALLTYPE RSGetViewports(UINT* InOutNumViewports, D3D11_VIEWPORT* OutViewports) override
+		{
+			if (!InOutNumViewports)
+			{
+				return;
+			}
+			if (OutViewports)
+			{
+				const UINT NumToCopy = std::min(*InOutNumViewports, NumViewports);
+				std::memcpy(OutViewports, Viewports, sizeof(D3D11_VIEWPORT) * NumToCopy);
+				for (UINT i = NumToCopy; i < *InOutNumViewports; ++i)
+				{
+					OutViewports[i] = D3D11_VIEWPORT{};
+				}
+			}
+			else
+			{
+				*InOutNumViewports = NumViewports;
+			}
+		}
+
+		void STDMETHODCALLTYPE RSGetScissorRects(UINT* InOutNumRects, D3D11_RECT* OutRects) override
+		{
+			if (!InOutNumRects)
+			{
+				return;
+			}
+			if (OutRects)
+			{
+				const UINT NumToCopy = std::min(*InOutNumRects, NumScissorRects);
+				std::memcpy(OutRects, ScissorRects, sizeof(D3D11_RECT) * NumToCopy);
+				for (UINT i = NumToCopy; i < *InOutNumRects; ++i)
+				{
+					OutRects[i] = D3D11_RECT{};
+				}
+			}
+			else
+			{
+				*InOutNumRects = NumScissorRects;
+			}
+		}
+
+		// --- 컨텍스트 ---
+		void STDMETHODCALLTYPE ClearState() override
+		{
+			SetTracked<ID3D11VertexShader>(VertexShader, nullptr);
+			SetTracked<ID3D11PixelShader>(PixelShader, nullptr);
+			SetTracked<ID3D11GeometryShader>(GeometryShader, nullptr);
+			SetTracked<ID3D11HullShader>(HullShader, nullptr);
+			SetTracked<ID3D11DomainShader>(DomainShader, nullptr);
+			SetTracked<ID3D11ComputeShader>(ComputeShader, nullptr);
+			SetTracked<ID3D11InputLayout>(InputLayout, nullptr);
+			SetTracked<ID3D11Buffer>(IndexBuffer, nullptr);
+			SetTracked<ID3D11RasterizerState>(RasterizerState, nullptr);
+			SetTracked<ID3D11BlendState>(BlendState, nullptr);
+			SetTracked<ID3D11DepthStencilState>(DepthStencilState, nullptr);
+			for (ID3D11RenderTargetView*& View : RenderTargets)
+			{
+				SetTracked<ID3D11RenderTargetView>(View, nullptr);
+			}
+			SetTracked<ID3D11DepthStencilView>(DepthStencil, nullptr);
+
+			Topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+			IndexFormat = DXGI_FORMAT_UNKNOWN;
+			IndexOffset = 0;
+			for (FLOAT& Factor : BlendFactor)
+			{
+				Factor = 1.0f;
+			}
+			SampleMask = 0xffffffff;
+			StencilRef = 0;
+			NumViewports = 0;
+			NumScissorRects = 0;
+		}
+
+		void STDMETHODCALLTYPE Flush() override {}
+		void STDMETHODCALLTYPE ExecuteCommandList(ID3D11CommandList*, BOOL) override {}
+		D3D11_DEVICE_CONTEXT_TYPE STDMETHODCALLTYPE GetType() override { return D3D11_DEVICE_CONTEXT_IMMEDIATE; }
+		UINT STDMETHODCALLTYPE GetContextFlags() override { return 0; }
+
+		HRESULT STDMETHODCALLTYPE FinishCommandList(BOOL, ID3D11CommandList** OutCommandList) override
+		{
+			if (OutCommandList) *OutCommandList = nullptr;
+			return DXGI_ERROR_INVALID_CALL; // 즉시 컨텍스트에서는 호출 불가
+		}
+
+	private:
+		void CountBinds(UINT NumSlots) { Stats->ResourceBinds += NumSlots; }
+
+		void CountState(bool bChanged)
+		{
+			if (bChanged)
+			{
+				++Stats->StateChanges;
+			}
+			else
+			{
+				++Stats->RedundantStateSets;
+			}
+		}
+
+		void CountDraw(uint64 NumVertices)
+		{
+			++Stats->DrawCalls;
+			Stats->Vertices += NumVertices;
+		}
+
+		void CountUpload(bool bBuffer, SIZE_T Size)
+		{
+			if (bBuffer)
+			{
+				++Stats->BufferUploads;
+				Stats->BufferUploadBytes += Size;
+			}
+			else
+			{
+				++Stats->TextureUploads;
+				Stats->TextureUploadBytes += Size;
+			}
+		}
+
+		template<typename T>
+		static void GetShader(T* Slot, T** OutShader, UINT* OutNumInstances)
+		{
+			GetTracked(Slot, OutShader);
+			if (OutNumInstances)
+			{
+				*OutNumInstances = 0;
+			}
+		}
+
+		ID3D11Device* Device;
+		FRHIStats* Stats;
+
+		ID3D11VertexShader* VertexShader = nullptr;
+		ID3D11PixelShader* PixelShader = nullptr;
+		ID3D11GeometryShader* GeometryShader = nullptr;
+		ID3D11HullShader* HullShader = nullptr;
+		ID3D11DomainShader* DomainShader = nullptr;
+		ID3D11ComputeShader* ComputeShader = nullptr;
+		ID3D11InputLayout* InputLayout = nullptr;
+		D3D11_PRIMITIVE_TOPOLOGY Topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+		ID3D11Buffer* IndexBuffer = nullptr;
+		DXGI_FORMAT IndexFormat = DXGI_FORMAT_UNKNOWN;
+		UINT IndexOffset = 0;
+
+		ID3D11RasterizerState* RasterizerState = nullptr;
+		ID3D11BlendState* BlendState = nullptr;
+		FLOAT BlendFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		UINT SampleMask = 0xffffffff;
+		ID3D11DepthStencilState* DepthStencilState = nullptr;
+		UINT StencilRef = 0;
+
+		ID3D11RenderTargetView* RenderTargets[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT] = {};
+		ID3D11DepthStencilView* DepthStencil = nullptr;
+
+		D3D11_VIEWPORT Viewports[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE] = {};
+		UINT NumViewports = 0;
+		D3D11_RECT ScissorRects[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE] = {};
+		UINT NumScissorRects = 0;
+	};
+
+	class FNullDevice : public ID3D11Device
+	{
+	public:
+		explicit FNullDevice(FRHIStats* InStats)
+			: Stats(InStats ? InStats : &OwnedStats)
+			, ImmediateContext(this, Stats)
+		{
+		}
+
+		virtual ~FNullDevice() = default;
+
+		// IUnknown
+		HRESULT STDMETHODCALLTYPE QueryInterface(REFIID Riid, void** OutObject) override
+		{
+			if (!OutObject)
+			{
+				return E_POINTER;
+			}
+			if (Riid == __uuidof(IUnknown) || Riid == __uuidof(ID3D11Device))
+			{
+				*OutObject = static_cast<ID3D11Device*>(this);
+				AddRef();
+				return S_OK;
+			}
+			// IDXGIDevice, ID3D11InfoQueue, ID3D11Debug 등은 없음
+			*OutObject = nullptr;
+			return E_NOINTERFACE;
+		}
+
+		ULONG STDMETHODCALLTYPE AddRef() override { return ++RefCount; }
+
+		ULONG STDMETHODCALLTYPE Release() override
+		{
+			const ULONG Remaining = --RefCount;
+			if (Remaining == 0)
+			{
+				delete this;
+			}
+			return Remaining;
+		}
+
+		// --- 리소스 ---
+		HRESULT STDMETHODCALLTYPE CreateBuffer(const D3D11_BUFFER_DESC* Desc, const D3D11_SUBRESOURCE_DATA* InitialData, ID3D11Buffer** OutBuffer) override
+		{
+			if (!Desc || Desc->ByteWidth == 0)
+			{
+				return E_INVALIDARG;
+			}
+			if (!OutBuffer)
+			{
+				return S_FALSE; // 검증만 요청한 경우
+			}
+			++Stats->BuffersCreated;
+			Stats->BufferBytesCreated += Desc->ByteWidth;
+			if (InitialData)
+			{
+				++Stats->BufferUploads;
+				Stats->BufferUploadBytes += Desc->ByteWidth;
+			}
+			*OutBuffer = new FNullBuffer(this, *Desc);
+			return S_OK;
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateTexture1D(const D3D11_TEXTURE1D_DESC* Desc, const D3D11_SUBRESOURCE_DATA* InitialData, ID3D11Texture1D** OutTexture) override
+		{
+			return CreateTexture<FNullTexture1D>(Desc, InitialData, OutTexture);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateTexture2D(const D3D11_TEXTURE2D_DESC* Desc, const D3D11_SUBRESOURCE_DATA* InitialData, ID3D11Texture2D** OutTexture) override
+		{
+			return CreateTexture<FNullTexture2D>(Desc, InitialData, OutTexture);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateTexture3D(const D3D11_TEXTURE3D_DESC* Desc, const D3D11_SUBRESOURCE_DATA* InitialData, ID3D11Texture3D** OutTexture) override
+		{
+			return CreateTexture<FNullTexture3D>(Desc, InitialData, OutTexture);
+		}
+
+		// --- 뷰 ---
+		HRESULT STDMETHODCALLTYPE CreateShaderResourceView(ID3D11Resource* Resource, const D3D11_SHADER_RESOURCE_VIEW_DESC* Desc, ID3D11ShaderResourceView** OutView) override
+		{
+			return CreateView<FNullShaderResourceView>(Resource, Desc, OutView);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateUnorderedAccessView(ID3D11Resource* Resource, const D3D11_UNORDERED_ACCESS_VIEW_DESC* Desc, ID3D11UnorderedAccessView** OutView) override
+		{
+			return CreateView<FNullUnorderedAccessView>(Resource, Desc, OutView);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateRenderTargetView(ID3D11Resource* Resource, const D3D11_RENDER_TARGET_VIEW_DESC* Desc, ID3D11RenderTargetView** OutView) override
+		{
+			return CreateView<FNullRenderTargetView>(Resource, Desc, OutView);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateDepthStencilView(ID3D11Resource* Resource, const D3D11_DEPTH_STENCIL_VIEW_DESC* Desc, ID3D11DepthStencilView** OutView) override
+		{
+			return CreateView<FNullDepthStencilView>(Resource, Desc, OutView);
+		}
+
+		// --- 셰이더 / 입력 레이아웃 (바이트코드는 검사하지 않음) ---
+		HRESULT STDMETHODCALLTYPE CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC*, UINT, const void*, SIZE_T, ID3D11InputLayout** OutInputLayout) override
+		{
+			if (!OutInputLayout)
+			{
+				return S_FALSE;
+			}
+			++Stats->StatesCreated;
+			*OutInputLayout = new FNullInputLayout(this);
+			return S_OK;
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateVertexShader(const void*, SIZE_T, ID3D11ClassLinkage*, ID3D11VertexShader** OutShader) override
+		{
+			return CreateShader<FNullVertexShader>(OutShader);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateGeometryShader(const void*, SIZE_T, ID3D11ClassLinkage*, ID3D11GeometryShader** OutShader) override
+		{
+			return CreateShader<FNullGeometryShader>(OutShader);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateGeometryShaderWithStreamOutput(const void*, SIZE_T, const D3D11_SO_DECLARATION_ENTRY*, UINT, const UINT*, UINT, UINT,
+			ID3D11ClassLinkage*, ID3D11GeometryShader** OutShader) override
+		{
+			return CreateShader<FNullGeometryShader>(OutShader);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreatePixelShader(const void*, SIZE_T, ID3D11ClassLinkage*, ID3D11PixelShader** OutShader) override
+		{
+			return CreateShader<FNullPixelShader>(OutShader);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateHullShader(const void*, SIZE_T, ID3D11ClassLinkage*, ID3D11HullShader** OutShader) override
+		{
+			return CreateShader<FNullHullShader>(OutShader);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateDomainShader(const void*, SIZE_T, ID3D11ClassLinkage*, ID3D11DomainShader** OutShader) override
+		{
+			return CreateShader<FNullDomainShader>(OutShader);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateComputeShader(const void*, SIZE_T, ID3D11ClassLinkage*, ID3D11ComputeShader** OutShader) override
+		{
+			return CreateShader<FNullComputeShader>(OutShader);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateClassLinkage(ID3D11ClassLinkage** OutLinkage) override
+		{
+			if (OutLinkage) *OutLinkage = nullptr;
+			return E_NOTIMPL;
+		}
+
+		// --- 상태 객체 ---
+		HRESULT STDMETHODCALLTYPE CreateBlendState(const D3D11_BLEND_DESC* Desc, ID3D11BlendState** OutState) override
+		{
+			return CreateState<FNullBlendState>(Desc, OutState);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateDepthStencilState(const D3D11_DEPTH_STENCIL_DESC* Desc, ID3D11DepthStencilState** OutState) override
+		{
+			return CreateState<FNullDepthStencilState>(Desc, OutState);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateRasterizerState(const D3D11_RASTERIZER_DESC* Desc, ID3D11RasterizerState** OutState) override
+		{
+			return CreateState<FNullRasterizerState>(Desc, OutState);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateSamplerState(const D3D11_SAMPLER_DESC* Desc, ID3D11SamplerState** OutState) override
+		{
+			return CreateState<FNullSamplerState>(Desc, OutState);
+		}
+
+		// --- 쿼리 ---
+		HRESULT STDMETHODCALLTYPE CreateQuery(const D3D11_QUERY_DESC* Desc, ID3D11Query** OutQuery) override
+		{
+			return CreateQueryObject<FNullQuery>(Desc, OutQuery);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreatePredicate(const D3D11_QUERY_DESC* Desc, ID3D11Predicate** OutPredicate) override
+		{
+			return CreateQueryObject<FNullPredicate>(Desc, OutPredicate);
+		}
+
+		HRESULT STDMETHODCALLTYPE CreateCounter(const D3D11_COUNTER_DESC*, ID3D11Counter** OutCounter) override
+		{
+			if (OutCounter) *OutCounter = nullptr;
+			return E_NOTIMPL;
+		}
+
+		// --- 미지원 기능 ---
+		HRESULT STDMETHODCALLTYPE CreateDeferredContext(UINT, ID3D11DeviceContext** OutContext) override
+		{
+			if (OutContext) *OutContext = nullptr;
+			return E_NOTIMPL;
+		}
+
+		HRESULT STDMETHODCALLTYPE OpenSharedResource(HANDLE, REFIID, void** OutResource) override
+		{
+			if (OutResource) *OutResource = nullptr;
+			return E_NOTIMPL;
+		}
+
+		// --- 기능 조회: 모든 포맷/기능을 지원한다고 응답 (텍스처 로더 분기 유지) ---
+		HRESULT STDMETHODCALLTYPE CheckFormatSupport(DXGI_FORMAT, UINT* OutFormatSupport) override
+		{
+			if (!OutFormatSupport)
+			{
+				return E_INVALIDARG;
+			}
+			*OutFormatSupport = ~0u;
+			return S_OK;
+		}
+
+		HRESULT STDMETHODCALLTYPE CheckMultisampleQualityLevels(DXGI_FORMAT, UINT SampleCount, UINT* OutNumQualityLevels) override
+		{
+			if (!OutNumQualityLevels)
+			{
+				return E_INVALIDARG;
+			}
+			*OutNumQualityLevels = SampleCount == 1 ? 1 : 0;
+			return S_OK;
+		}
+
+		void STDMETHODCALLTYPE CheckCounterInfo(D3D11_COUNTER_INFO* OutCounterInfo) override
+		{
+			if (OutCounterInfo) *OutCounterInfo = D3D11_COUNTER_INFO{};
+		}
+
+		HRESULT STDMETHODCALLTYPE CheckCounter(const D3D11_COUNTER_DESC*, D3D11_COUNTER_TYPE*, UINT*, LPSTR, UINT*, LPSTR, UINT*, LPSTR, UINT*) override
+		{
+			return E_NOTIMPL;
+		}
+
+		HRESULT STDMETHODCALLTYPE CheckFeatureSupport(D3D11_FEATURE, void* OutFeatureSupportData, UINT FeatureSupportDataSize) override
+		{
+			if (!OutFeatureSupportData)
+			{
+				return E_INVALIDARG;
+			}
+			std::memset(OutFeatureSupportData, 0, FeatureSupportDataSize);
+			return S_OK;
+		}
+
+		HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID, UINT* InOutDataSize, void*) override
+		{
+			if (InOutDataSize)
+			{
+				*InOutDataSize = 0;
+			}
+			return DXGI_ERROR_NOT_FOUND;
+		}
+
+		HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID, UINT, const void*) override { return S_OK; }
+		HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID, const IUnknown*) override { return S_OK; }
+
+		D3D_FEATURE_LEVEL STDMETHODCALLTYPE GetFeatureLevel() override { return D3D_FEATURE_LEVEL_11_0; }
+		UINT STDMETHODCALLTYPE GetCreationFlags() override { return 0; }
+		HRESULT STDMETHODCALLTYPE GetDeviceRemovedReason() override { return S_OK; }
+
+		void STDMETHODCALLTYPE GetImmediateContext(ID3D11DeviceContext** OutContext) override
+		{
+			ImmediateContext.AddRef();
+			*OutContext = &ImmediateContext;
+		}
+
+		HRESULT STDMETHODCALLTYPE SetExceptionMode(UINT) override { return S_OK; }
+		UINT STDMETHODCALLTYPE GetExceptionMode() override { return 0; }
+
+		FRHIStats* GetStats() const { return Stats; }
+
+	private:
+		template<typename TResource, typename TDesc, typename TInterface>
+		HRESULT CreateTexture(const TDesc* Desc, const D3D11_SUBRESOURCE_DATA* InitialData, TInterface** OutTexture)
+		{
+			if (!Desc)
+			{
+				return E_INVALIDARG;
+			}
+			if (!OutTexture)
+			{
+				return S_FALSE;
+			}
+			++Stats->TexturesCreated;
+			TResource* Texture = new TResource(this, *Desc);
+			if (InitialData)
+			{
+				UINT RowPitch = 0;
+				UINT DepthPitch = 0;
+				++Stats->TextureUploads;
+				Stats->TextureUploadBytes += Texture->GetMapLayout(RowPitch, DepthPitch);
+			}
+			*OutTexture = Texture;
+			return S_OK;
+		}
+
+		template<typename TView, typename TDesc, typename TInterface>
+		HRESULT CreateView(ID3D11Resource* Resource, const TDesc* Desc, TInterface** OutView)
+		{
+			if (!Resource)
+			{
+				return E_INVALIDARG;
+			}
+			if (!OutView)
+			{
+				return S_FALSE;
+			}
+			++Stats->ViewsCreated;
+			*OutView = new TView(this, Resource, Desc);
+			return S_OK;
+		}
+
+		template<typename TShader, typename TInterface>
+		HRESULT CreateShader(TInterface** OutShader)
+		{
+			if (!OutShader)
+			{
+				return S_FALSE;
+			}
+			++Stats->ShadersCreated;
+			*OutShader = new TShader(this);
+			return S_OK;
+		}
+
+		template<typename TState, typename TDesc, typename TInterface>
+		HRESULT CreateState(const TDesc* Desc, TInterface** OutState)
+		{
+			if (!Desc)
+			{
+				return E_INVALIDARG;
+			}
+			if (!OutState)
+			{
+				return S_FALSE;
+			}
+			++Stats->StatesCreated;
+			*OutState = new TState(this, *Desc);
+			return S_OK;
+		}
+
+		template<typename TQuery, typename TInterface>
+		HRESULT CreateQueryObject(const D3D11_QUERY_DESC* Desc, TInterface** OutQuery)
+		{
+			if (!Desc)
+			{
+				return E_INVALIDARG;
+			}
+			if (!OutQuery)
+			{
+				return S_FALSE;
+			}
+			++Stats->QueriesCreated;
+			*OutQuery = new TQuery(this, *Desc);
+			return S_OK;
+		}
+
+		FRHIStats OwnedStats;
+		FRHIStats* Stats;
+		FNullDeviceContext ImmediateContext;
+		std::atomic<ULONG> RefCount{ 1 };
+	};
+
+	// 윈도우 없는 스왑체인. 백 버퍼는 Null 텍스처이고 Present는 카운트만 한다.
+	class FNullSwapChain : public IDXGISwapChain
+	{
+	public:
+		FNullSwapChain(ID3D11Device* InDevice, FRHIStats* InStats, const DXGI_SWAP_CHAIN_DESC& InDesc)
+			: Device(InDevice)
+			, Stats(InStats)
+			, Desc(InDesc)
+		{
+			Device->AddRef();
+			CreateBackBuffer();
+		}
+
+		virtual ~FNullSwapChain()
+		{
+			if (BackBuffer)
+			{
+				BackBuffer->Release();
+			}
+			Device->Release();
+		}
+
+		// IUnknown
+		HRESULT STDMETHODCALLTYPE QueryInterface(REFIID Riid, void** OutObject) override
+		{
+			if (!OutObject)
+			{
+				return E_POINTER;
+			}
+			if (Riid == __uuidof(IUnknown) || Riid == __uuidof(IDXGIObject) || Riid == __uuidof(IDXGIDeviceSubObject) || Riid == __uuidof(IDXGISwapChain))
+			{
+				*OutObject = static_cast<IDXGISwapChain*>(this);
+				AddRef();
+				return S_OK;
+			}
+			*OutObject = nullptr;
+			return E_NOINTERFACE;
+		}
+
+		ULONG STDMETHODCALLTYPE AddRef() override { return ++RefCount; }
+
+		ULONG STDMETHODCALLTYPE Release() override
+		{
+			const ULONG Remaining = --RefCount;
+			if (Remaining == 0)
+			{
+				delete this;
+			}
+			return Remaining;
+		}
+
+		// IDXGIObject / IDXGIDeviceSubObject
+		HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID, UINT, const void*) override { return S_OK; }
+		HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID, const IUnknown*) override { return S_OK; }
+
+		HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID, UINT* InOutDataSize, void*) override
+		{
+			if (InOutDataSize)
+			{
+				*InOutDataSize = 0;
+			}
+			return DXGI_ERROR_NOT_FOUND;
+		}
+
+		HRESULT STDMETHODCALLTYPE GetParent(REFIID, void** OutParent) override
+		{
+			if (OutParent) *OutParent = nullptr;
+			return E_NOINTERFACE; // 어댑터/팩토리 없음
+		}
+
+		HRESULT STDMETHODCALLTYPE GetDevice(REFIID Riid, void** OutDevice) override
+		{
+			return Device->QueryInterface(Riid, OutDevice);
+		}
+
+		// IDXGISwapChain
+		HRESULT STDMETHODCALLTYPE Present(UINT, UINT) override
+		{
+			++Stats->Presents;
+			++PresentCount;
+			return S_OK;
+		}
+
+		HRESULT STDMETHODCALLTYPE GetBuffer(UINT, REFIID Riid, void** OutSurface) override
+		{
+			if (!BackBuffer)
+			{
+				return DXGI_ERROR_INVALID_CALL;
+			}
+			return BackBuffer->QueryInterface(Riid, OutSurface);
+		}
+
+		HRESULT STDMETHODCALLTYPE SetFullscreenState(BOOL, IDXGIOutput*) override { return S_OK; }
+
+		HRESULT STDMETHODCALLTYPE GetFullscreenState(BOOL* OutFullscreen, IDXGIOutput** OutTarget) override
+		{
+			if (OutFullscreen) *OutFullscreen = FALSE;
+			if (OutTarget) *OutTarget = nullptr;
+			return S_OK;
+		}
+
+		HRESULT STDMETHODCALLTYPE GetDesc(DXGI_SWAP_CHAIN_DESC* OutDesc) override
+		{
+			if (!OutDesc)
+			{
+				return E_INVALIDARG;
+			}
+			*OutDesc = Desc;
+			return S_OK;
+		}
+
+		HRESULT STDMETHODCALLTYPE ResizeBuffers(UINT BufferCount, UINT Width, UINT Height, DXGI_FORMAT NewFormat, UINT SwapChainFlags) override
+		{
+			// 0은 "기존 값 유지" (창이 없으므로 창 크기로 맞출 수 없음)
+			if (BufferCount > 0) Desc.BufferCount = BufferCount;
+			if (Width > 0) Desc.BufferDesc.Width = Width;
+			if (Height > 0) Desc.BufferDesc.Height = Height;
+			if (NewFormat != DXGI_FORMAT_UNKNOWN) Desc.BufferDesc.Format = NewFormat;
+			Desc.Flags = SwapChainFlags;
+
+			if (BackBuffer)
+			{
+				BackBuffer->Release();
+				BackBuffer = nullptr;
+			}
+			CreateBackBuffer();
+			return S_OK;
+		}
+
+		HRESULT STDMETHODCALLTYPE ResizeTarget(const DXGI_MODE_DESC*) override { return S_OK; }
+
+		HRESULT STDMETHODCALLTYPE GetContainingOutput(IDXGIOutput** OutOutput) override
+		{
+			if (OutOutput) *OutOutput = nullptr;
+			return DXGI_ERROR_UNSUPPORTED;
+		}
+
+		HRESULT STDMETHODCALLTYPE GetFrameStatistics(DXGI_FRAME_STATISTICS*) override { return DXGI_ERROR_UNSUPPORTED; }
+
+		HRESULT STDMETHODCALLTYPE GetLastPresentCount(UINT* OutLastPresentCount) override
+		{
+			if (!OutLastPresentCount)
+			{
+				return E_INVALIDARG;
+			}
+			*OutLastPresentCount = PresentCount;
+			return S_OK;
+		}
+
+	private:
+		void CreateBackBuffer()
+		{
+			D3D11_TEXTURE2D_DESC TextureDesc{};
+			TextureDesc.Width = std::max<UINT>(1, Desc.BufferDesc.Width);
+			TextureDesc.Height = std::max<UINT>(1, Desc.BufferDesc.Height);
+			TextureDesc.MipLevels = 1;
+			TextureDesc.ArraySize = 1;
+			TextureDesc.Format = Desc.BufferDesc.Format;
+			TextureDesc.SampleDesc = Desc.SampleDesc;
+			TextureDesc.Usage = D3D11_USAGE_DEFAULT;
+			TextureDesc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+
+			Device->CreateTexture2D(&TextureDesc, nullptr, &BackBuffer);
+		}
+
+		ID3D11Device* Device;
+		FRHIStats* Stats;
+		DXGI_SWAP_CHAIN_DESC Desc;
+		ID3D11Texture2D* BackBuffer = nullptr;
+		UINT PresentCount = 0;
+		std::atomic<ULONG> RefCount{ 1 };
+	};
+}
+
+bool NullRHI::CreateDeviceAndSwapChain(const DXGI_SWAP_CHAIN_DESC& SwapChainDesc, FRHIStats* InStats,
+	ID3D11Device** OutDevice, ID3D11DeviceContext** OutContext, IDXGISwapChain** OutSwapChain)
+{
+	if (!OutDevice || !OutContext || !OutSwapChain)
+	{
+		return false;
+	}
+
+	FNullDevice* NullDevice = new FNullDevice(InStats);
+	*OutSwapChain = new FNullSwapChain(NullDevice, NullDevice->GetStats(), SwapChainDesc);
+	NullDevice->GetImmediateContext(OutContext);
+	*OutDevice = NullDevice;
+	return true;
+}
+
+HRESULT NullRHI::CreateBlob(SIZE_T InSize, ID3DBlob** OutBlob)
+{
+	if (!OutBlob)
+	{
+		return E_INVALIDARG;
+	}
+	*OutBlob = new FNullBlob(InSize);
+	return S_OK;
+}
@@ -0,0 +1,23 @@
+﻿#pragma once
+#include "RHIDevice.h"
+#include <dxgi.h>
+
+// Null RHI 백엔드.
+// ID3D11Device / ID3D11DeviceContext / IDXGISwapChain을 GPU 없이 구현한다.
+// - 리소스/뷰/셰이더/상태 생성은 설명자만 보관하는 빈 객체를 돌려준다.
+// - 드로우, 상태 설정, 업로드 호출은 아무 일도 하지 않고 FRHIStats에 카운트만 한다.
+// - Map()은 리소스별 CPU 스크래치 메모리를 돌려주므로 기존 업로드 코드가 그대로 동작한다.
+// - RS/OM/IA/셰이더 등 Get 계열이 필요한 상태는 실제 디바이스처럼 참조를 잡고 추적한다.
+// d3d11.dll/dxgi.dll을 호출하지 않으므로 렌더러 CPU 경로를 GPU 없는 Windows 환경(CI 러너, 서버)에서 돌릴 수 있다.
+// 헤드리스 실행은 Windows 전용이다. D3D11/DXGI 인터페이스 자체를 경계로 삼아 Win32 + Windows SDK 헤더가 필요하므로
+// Linux에서는 빌드도 실행도 되지 않는다 (Linux 헤드리스는 플랫폼 독립 RHI 계층이 생겨야 가능).
+// CI 실행은 .github/workflows/headless_smoke.yml 참고.
+namespace NullRHI
+{
+	// D3D11CreateDeviceAndSwapChain 대응. InStats가 nullptr이면 디바이스 내부 통계에 누적한다.
+	bool CreateDeviceAndSwapChain(const DXGI_SWAP_CHAIN_DESC& SwapChainDesc, FRHIStats* InStats,
+		ID3D11Device** OutDevice, ID3D11DeviceContext** OutContext, IDXGISwapChain** OutSwapChain);
+
+	// 셰이더 컴파일 대신 쓰는 빈 바이트코드 블롭
+	HRESULT CreateBlob(SIZE_T InSize, ID3DBlob** OutBlob);
+}
@@ -3,61 +3,43 @@
 #include <d3dcompiler.h>
 #include "Vector.h"
 
-// NOTE: 개발 편의성을 위해서 DX11를 종속적으로 사용한다 (URHIDevice를 사용하지 않음)
+// NOTE: 렌더러는 D3D11 인터페이스(ID3D11Device/ID3D11DeviceContext)를 직접 사용한다.
+// 백엔드 교체는 그 인터페이스 구현을 바꾸는 방식으로 한다. (D3D11 = 실제 GPU, Null = NullRHI.h)
 
-//class URHIDevice
-//{
-//public:
-//    URHIDevice() {};
-//    virtual ~URHIDevice() {};
-//
-//private:
-//    // 복사생성자, 연산자 금지
-//    URHIDevice(const URHIDevice& RHIDevice) = delete;
-//    URHIDevice& operator=(const URHIDevice& RHIDevice) = delete;
-//
-//public:
-//    virtual void Initialize(HWND hWindow) = 0;
-//    virtual void Release() = 0;
-//public:
-//
-//    //getter
-//    virtual ID3D11Device* GetDevice() = 0;
-//    virtual ID3D11DeviceContext* GetDeviceContext() = 0;
-//
-//    // create
-//    virtual void CreateDeviceAndSwapChain(HWND hWindow) = 0;;
-//    virtual void CreateFrameBuffer() = 0;
-//    virtual void CreateRasterizerState() = 0;
-//    virtual void CreateConstantBuffer() = 0;
-//    virtual void CreateBlendState() = 0;
-//	virtual void CreateDepthStencilState() = 0;
-//    virtual void CreateShader(ID3D11InputLayout** OutSimpleInputLayout, ID3D11VertexShader** OutSimpleVertexShader, ID3D11PixelShader** OutSimplePixelShader) = 0;
-//
-//    // update
-//    virtual void UpdateConstantBuffers(const FMatrix& ModelMatrix, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix) = 0;
-//    virtual void UpdateBillboardConstantBuffers(const FVector& pos, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix, const FVector& CameraRight, const FVector& CameraUp)=0;
-//    virtual void UpdatePixelConstantBuffers(const FObjMaterialInfo& InMaterialInfo, bool bHasMaterial, bool bHasTexture) = 0;
-//    virtual void UpdateHighLightConstantBuffers(const uint32 InPicked, const FVector& InColor, const uint32 X, const uint32 Y, const uint32 Z, const uint32 Gizmo) = 0;
-//    virtual void UpdateColorConstantBuffers(const FVector4& InColor) = 0;
-//    virtual void UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeSec) = 0;
-//
-//    // clear
-//    virtual void ClearBackBuffer() = 0;
-//    virtual void ClearDepthBuffer(float Depth, UINT Stenci) = 0;
-//
-//    virtual void IASetPrimitiveTopology() = 0;
-//    virtual void RSSetViewport() = 0;
-//    virtual void RSSetState(EViewModeIndex ViewModeIndex) = 0;
-//    virtual void RSSetNoCullState() = 0;
-//    virtual void OMSetRenderTargets() = 0;
-//    virtual void OMSetBlendState(bool bIsBlendMode) = 0;
-//    virtual void OMSetDepthStencilState(EComparisonFunc Func) = 0;
-//    // Overlay precedence helpers (stencil-based)
-//    virtual void OMSetDepthStencilState_OverlayWriteStencil() = 0;      // writes stencil=1 where overlay draws
-//    virtual void OMSetDepthStencilState_StencilRejectOverlay() = 0;     // allows drawing only where stencil==0
-//    virtual void Present() = 0;
-//    virtual void PSSetDefaultSampler(UINT StartSlot) = 0;
-//};
-//
-//
+enum class ERHIBackend : uint8
+{
+	D3D11,	// 하드웨어 D3D11 디바이스 + 윈도우 스왑체인
+	Null,	// GPU 없이 모든 호출을 받아 카운트만 하는 헤드리스 백엔드
+};
+
+// RHI 호출 통계. Null 백엔드가 디바이스/컨텍스트 호출마다 누적한다.
+struct FRHIStats
+{
+	// 커맨드
+	uint64 DrawCalls = 0;
+	uint64 DispatchCalls = 0;
+	uint64 Vertices = 0;			// 드로우로 제출된 정점(인덱스) 수 (인스턴스 포함)
+	uint64 StateChanges = 0;		// 실제로 값이 바뀐 파이프라인 상태 설정 (셰이더, 레이아웃, RS/Blend/DS, RT, 뷰포트...)
+	uint64 RedundantStateSets = 0;	// 이미 바인딩된 값과 같은 상태를 다시 설정한 호출
+	uint64 ResourceBinds = 0;		// 바인딩된 슬롯 수 (SRV/CB/샘플러/VB/IB/UAV)
+	uint64 Clears = 0;
+	uint64 Copies = 0;
+	uint64 Presents = 0;
+
+	// 업로드 (Map 쓰기는 매핑된 전체 크기, UpdateSubresource는 갱신 구간 크기)
+	uint64 BufferUploads = 0;
+	uint64 BufferUploadBytes = 0;
+	uint64 TextureUploads = 0;
+	uint64 TextureUploadBytes = 0;
+
+	// 리소스 생성
+	uint64 BuffersCreated = 0;
+	uint64 BufferBytesCreated = 0;
+	uint64 TexturesCreated = 0;
+	uint64 ViewsCreated = 0;
+	uint64 ShadersCreated = 0;
+	uint64 StatesCreated = 0;		// RS/Blend/DS/샘플러 상태 + 입력 레이아웃
+	uint64 QueriesCreated = 0;
+
+	void Reset() { *this = FRHIStats(); }
+};
@@ -0,0 +1,351 @@
+﻿#include "pch.h"
+#include "DebugDrawManager.h"
+#include "AABB.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	double GetDebugDrawTime()
+	{
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64()) * 0.001;
+	}
+
+	// 박스 12개 모서리 (0~3 아랫면, 4~7 윗면)
+	constexpr int32 BoxEdges[12][2] = {
+		{0,1},{1,2},{2,3},{3,0},
+		{4,5},{5,6},{6,7},{7,4},
+		{0,4},{1,5},{2,6},{3,7}
+	};
+}
+
+// ─────────────────────────────────────────────
+// FDebugLineBuffer
+// ─────────────────────────────────────────────
+
+FDebugLineBuffer::FChunk& FDebugLineBuffer::GetWritableChunk()
+{
+	while (true)
+	{
+		if (ActiveChunk >= Chunks.Num())
+		{
+			FChunk& NewChunk = Chunks.emplace_back();
+			NewChunk.Starts.Reserve(LinesPerChunk);
+			NewChunk.Ends.Reserve(LinesPerChunk);
+			NewChunk.Colors.Reserve(LinesPerChunk);
+			return NewChunk;
+		}
+		FChunk& Chunk = Chunks[ActiveChunk];
+		if (Chunk.Starts.Num() < LinesPerChunk)
+		{
+			return Chunk;
+		}
+		++ActiveChunk;
+	}
+}
+
+void FDebugLineBuffer::AddLine(const FVector& Start, const FVector& End, const FVector4& Color)
+{
+	FChunk& Chunk = GetWritableChunk();
+	Chunk.Starts.Add(Start);
+	Chunk.Ends.Add(End);
+	Chunk.Colors.Add(Color);
+	++NumLines;
+}
+
+void FDebugLineBuffer::AddBox(const FVector& Min, const FVector& Max, const FVector4& Color)
+{
+	const FVector Corners[8] = {
+		FVector(Min.X, Min.Y, Min.Z), FVector(Max.X, Min.Y, Min.Z), FVector(Max.X, Max.Y, Min.Z), FVector(Min.X, Max.Y, Min.Z),
+		FVector(Min.X, Min.Y, Max.Z), FVector(Max.X, Min.Y, Max.Z), FVector(Max.X, Max.Y, Max.Z), FVector(Min.X, Max.Y, Max.Z),
+	};
+	for (const auto& Edge : BoxEdges)
+	{
+		AddLine(Corners[Edge[0]], Corners[Edge[1]], Color);
+	}
+}
+
+void FDebugLineBuffer::AddBoxes(const TArray<FAABB>& Boxes, const FVector4& Color)
+{
+	Reserve(NumLines + Boxes.Num() * 12);
+	for (const FAABB& Box : Boxes)
+	{
+		AddBox(Box.Min, Box.Max, Color);
+	}
+}
+
+void FDebugLineBuffer::AddOrientedBox(const FVector& Center, const FVector& HalfExtent, const FQuat& Rotation, const FVector4& Color)
+{
+	const FVector AxisX = Rotation.RotateVector(FVector(HalfExtent.X, 0.0f, 0.0f));
+	const FVector AxisY = Rotation.RotateVector(FVector(0.0f, HalfExtent.Y, 0.0f));
+	const FVector AxisZ = Rotation.RotateVector(FVector(0.0f, 0.0f, HalfExtent.Z));
+	const FVector Corners[8] = {
+		Center - AxisX - AxisY - AxisZ, Center + AxisX - AxisY - AxisZ, Center + AxisX + AxisY - AxisZ, Center - AxisX + AxisY - AxisZ,
+		Center - AxisX - AxisY + AxisZ, Center + AxisX - AxisY + AxisZ, Center + AxisX + AxisY + AxisZ, Center - AxisX + AxisY + AxisZ,
+	};
+	for (const auto& Edge : BoxEdges)
+	{
+		AddLine(Corners[Edge[0]], Corners[Edge[1]], Color);
+	}
+}
+
+void FDebugLineBuffer::AddCircle(const FVector& Center, const FVector& AxisX, const FVector& AxisY, float Radius, const FVector4& Color, int32 Segments)
+{
+	Segments = std::max(Segments, 3);
+	FVector Prev = Center + AxisX * Radius;
+	for (int32 i = 1; i <= Segments; ++i)
+	{
+		const float Angle = (static_cast<float>(i) / Segments) * TWO_PI;
+		const FVector Next = Center + AxisX * (Radius * std::cos(Angle)) + AxisY * (Radius * std::sin(Angle));
+		AddLine(Prev, Next, Color);
+		Prev = Next;
+	}
+}
+
+void FDebugLineBuffer::AddSphere(const FVector& Center, float Radius, const FVector4& Color, int32 Segments)
+{
+	// XY, XZ, YZ 세 대원
+	AddCircle(Center, FVector(1, 0, 0), FVector(0, 1, 0), Radius, Color, Segments);
+	AddCircle(Center, FVector(1, 0, 0), FVector(0, 0, 1), Radius, Color, Segments);
+	AddCircle(Center, FVector(0, 1, 0), FVector(0, 0, 1), Radius, Color, Segments);
+}
+
+void FDebugLineBuffer::AddArrow(const FVector& Start, const FVector& End, const FVector4& Color, float HeadSize)
+{
+	AddLine(Start, End, Color);
+
+	const FVector Delta = End - Start;
+	const float Length = Delta.Size();
+	if (Length <= KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+	if (HeadSize <= 0.0f)
+	{
+		HeadSize = Length * 0.2f;
+	}
+
+	// 화살표 방향에 수직인 두 축으로 머리 4갈래
+	const FVector Dir = Delta / Length;
+	const FVector Up = std::abs(Dir.Z) < 0.99f ? FVector(0, 0, 1) : FVector(0, 1, 0);
+	const FVector Side0 = FVector::Cross(Dir, Up).GetNormalized();
+	const FVector Side1 = FVector::Cross(Side0, Dir);
+	const FVector HeadBase = End - Dir * HeadSize;
+	const float HeadWidth = HeadSize * 0.5f;
+	AddLine(End, HeadBase + Side0 * HeadWidth, Color);
+	AddLine(End, HeadBase - Side0 * HeadWidth, Color);
+	AddLine(End, HeadBase + Side1 * HeadWidth, Color);
+	AddLine(End, HeadBase - Side1 * HeadWidth, Color);
+}
+
+void FDebugLineBuffer::AddCross(const FVector& Location, float Size, const FVector4& Color)
+{
+	AddLine(Location - FVector(Size, 0, 0), Location + FVector(Size, 0, 0), Color);
+	AddLine(Location - FVector(0, Size, 0), Location + FVector(0, Size, 0), Color);
+	AddLine(Location - FVector(0, 0, Size), Location + FVector(0, 0, Size), Color);
+}
+
+void FDebugLineBuffer::Append(const FDebugLineBuffer& Other)
+{
+	Reserve(NumLines + Other.NumLines);
+	Other.ForEachChunk([this](const FVector* Starts, const FVector* Ends, const FVector4* Colors, int32 Count)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			AddLine(Starts[i], Ends[i], Colors[i]);
+		}
+	});
+}
+
+void FDebugLineBuffer::Reserve(int32 InNumLines)
+{
+	const int32 NeededChunks = (InNumLines + LinesPerChunk - 1) / LinesPerChunk;
+	Chunks.Reserve(NeededChunks);
+}
+
+void FDebugLineBuffer::Reset()
+{
+	for (FChunk& Chunk : Chunks)
+	{
+		Chunk.Starts.clear();
+		Chunk.Ends.clear();
+		Chunk.Colors.clear();
+	}
+	ActiveChunk = 0;
+	NumLines = 0;
+}
+
+// ─────────────────────────────────────────────
+// FDebugDrawManager
+// ─────────────────────────────────────────────
+
+FDebugDrawManager::FWorldDebugDraw& FDebugDrawManager::GetWorldData(const UWorld* World)
+{
+	return Worlds[World];
+}
+
+template<typename GenerateFunc>
+void FDebugDrawManager::Submit(const UWorld* World, float Duration, bool bAlwaysOnTop, GenerateFunc&& Generate)
+{
+	FWorldDebugDraw& Data = GetWorldData(World);
+	const int32 Layer = bAlwaysOnTop ? 1 : 0;
+
+	if (Duration == 0.0f)
+	{
+		Generate(Data.FrameLines[Layer]);
+	}
+	else if (Duration < 0.0f)
+	{
+		Generate(Data.PersistentLines[Layer]);
+	}
+	else
+	{
+		// 시간 제한 도형은 선분마다 만료 시각을 붙여 보관
+		TimedScratch.Reset();
+		Generate(TimedScratch);
+		const double ExpireTime = GetDebugDrawTime() + Duration;
+		TArray<FTimedLine>& Timed = Data.TimedLines[Layer];
+		Timed.Reserve(Timed.Num() + TimedScratch.Num());
+		TimedScratch.ForEachChunk([&](const FVector* Starts, const FVector* Ends, const FVector4* Colors, int32 Count)
+		{
+			for (int32 i = 0; i < Count; ++i)
+			{
+				Timed.Add(FTimedLine{ Starts[i], Ends[i], Colors[i], ExpireTime });
+			}
+		});
+	}
+}
+
+void FDebugDrawManager::BeginFrame()
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	const double Now = GetDebugDrawTime();
+
+	for (auto& Pair : Worlds)
+	{
+		FWorldDebugDraw& Data = Pair.second;
+		for (int32 Layer = 0; Layer < 2; ++Layer)
+		{
+			Data.FrameLines[Layer].Reset();
+
+			TArray<FTimedLine>& Timed = Data.TimedLines[Layer];
+			Timed.erase(std::remove_if(Timed.begin(), Timed.end(),
+				[Now](const FTimedLine& Line) { return Line.ExpireTime <= Now; }), Timed.end());
+		}
+
+		Data.Texts.erase(std::remove_if(Data.Texts.begin(), Data.Texts.end(),
+			[Now](const FTimedText& Text) { return Text.ExpireTime >= 0.0 && Text.ExpireTime <= Now; }), Data.Texts.end());
+	}
+}
+
+void FDebugDrawManager::DrawLine(const UWorld* World, const FVector& Start, const FVector& End, const FVector4& Color, float Duration, bool bAlwaysOnTop)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	Submit(World, Duration, bAlwaysOnTop, [&](FDebugLineBuffer& Lines) { Lines.AddLine(Start, End, Color); });
+}
+
+void FDebugDrawManager::DrawBox(const UWorld* World, const FVector& Center, const FVector& HalfExtent, const FQuat& Rotation, const FVector4& Color, float Duration, bool bAlwaysOnTop)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	Submit(World, Duration, bAlwaysOnTop, [&](FDebugLineBuffer& Lines) { Lines.AddOrientedBox(Center, HalfExtent, Rotation, Color); });
+}
+
+void FDebugDrawManager::DrawSphere(const UWorld* World, const FVector& Center, float Radius, const FVector4& Color, float Duration, bool bAlwaysOnTop, int32 Segments)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	Submit(World, Duration, bAlwaysOnTop, [&](FDebugLineBuffer& Lines) { Lines.AddSphere(Center, Radius, Color, Segments); });
+}
+
+void FDebugDrawManager::DrawArrow(const UWorld* World, const FVector& Start, const FVector& End, const FVector4& Color, float Duration, bool bAlwaysOnTop)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	Submit(World, Duration, bAlwaysOnTop, [&](FDebugLineBuffer& Lines) { Lines.AddArrow(Start, End, Color); });
+}
+
+void FDebugDrawManager::DrawString(const UWorld* World, const FVector& Location, const FString& Text, const FVector4& Color, float Duration)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	const double ExpireTime = (Duration < 0.0f) ? -1.0 : (Duration == 0.0f ? 0.0 : GetDebugDrawTime() + Duration);
+	GetWorldData(World).Texts.Add(FTimedText{ FDebugTextAnchor{ Location, Text, Color }, ExpireTime });
+}
+
+void FDebugDrawManager::DrawLines(const UWorld* World, const FDebugLineBuffer& Lines, float Duration, bool bAlwaysOnTop)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	Submit(World, Duration, bAlwaysOnTop, [&](FDebugLineBuffer& Target) { Target.Append(Lines); });
+}
+
+void FDebugDrawManager::ClearPersistent(const UWorld* World)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	if (FWorldDebugDraw* Data = Worlds.Find(World))
+	{
+		Data->PersistentLines[0].Reset();
+		Data->PersistentLines[1].Reset();
+		Data->Texts.erase(std::remove_if(Data->Texts.begin(), Data->Texts.end(),
+			[](const FTimedText& Text) { return Text.ExpireTime < 0.0; }), Data->Texts.end());
+	}
+}
+
+void FDebugDrawManager::RemoveWorld(const UWorld* World)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	Worlds.Remove(World);
+}
+
+void FDebugDrawManager::CollectLines(const UWorld* World, URenderer* Renderer, bool bAlwaysOnTop)
+{
+	if (!Renderer)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+	FWorldDebugDraw* Data = Worlds.Find(World);
+	if (!Data)
+	{
+		return;
+	}
+
+	const int32 Layer = bAlwaysOnTop ? 1 : 0;
+	Renderer->AddLines(Data->PersistentLines[Layer]);
+	Renderer->AddLines(Data->FrameLines[Layer]);
+
+	// 이미 만료된 선은 다음 BeginFrame에서 정리되므로 여기서는 거르기만 한다
+	const double Now = GetDebugDrawTime();
+	for (const FTimedLine& Line : Data->TimedLines[Layer])
+	{
+		if (Line.ExpireTime > Now)
+		{
+			Renderer->AddLine(Line.Start, Line.End, Line.Color);
+		}
+	}
+}
+
+void FDebugDrawManager::CollectTextAnchors(const UWorld* World, TArray<FDebugTextAnchor>& OutAnchors)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	if (FWorldDebugDraw* Data = Worlds.Find(World))
+	{
+		for (const FTimedText& Text : Data->Texts)
+		{
+			OutAnchors.Add(Text.Anchor);
+		}
+	}
+}
+
+int32 FDebugDrawManager::GetLineCount(const UWorld* World)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	FWorldDebugDraw* Data = Worlds.Find(World);
+	if (!Data)
+	{
+		return 0;
+	}
+
+	int32 Count = 0;
+	for (int32 Layer = 0; Layer < 2; ++Layer)
+	{
+		Count += Data->FrameLines[Layer].Num() + Data->PersistentLines[Layer].Num() + Data->TimedLines[Layer].Num();
+	}
+	return Count;
+}
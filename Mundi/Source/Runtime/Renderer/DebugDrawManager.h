@@ -0,0 +1,148 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+#include <mutex>
+
+class URenderer;
+class UWorld;
+struct FAABB;
+
+/**
+ * @brief 청크 단위로 늘어나는 선분 버퍼
+ * - 가득 차면 새 청크를 붙이므로 기존 데이터를 옮기지 않고, 선 개수 상한도 없다.
+ * - Reset은 청크 메모리를 남겨두므로 매 프레임 다시 채워도 할당이 생기지 않는다.
+ * - 박스/구/화살표 등 자주 쓰는 도형을 한 번에 선분으로 풀어주는 생성 함수를 제공한다.
+ */
+class FDebugLineBuffer
+{
+public:
+	static constexpr int32 LinesPerChunk = 4096;
+
+	struct FChunk
+	{
+		TArray<FVector> Starts;
+		TArray<FVector> Ends;
+		TArray<FVector4> Colors;
+	};
+
+	void AddLine(const FVector& Start, const FVector& End, const FVector4& Color);
+	void AddBox(const FVector& Min, const FVector& Max, const FVector4& Color);
+	void AddBoxes(const TArray<FAABB>& Boxes, const FVector4& Color);
+	void AddOrientedBox(const FVector& Center, const FVector& HalfExtent, const FQuat& Rotation, const FVector4& Color);
+	void AddCircle(const FVector& Center, const FVector& AxisX, const FVector& AxisY, float Radius, const FVector4& Color, int32 Segments = 16);
+	void AddSphere(const FVector& Center, float Radius, const FVector4& Color, int32 Segments = 16);
+	void AddArrow(const FVector& Start, const FVector& End, const FVector4& Color, float HeadSize = -1.0f);
+	void AddCross(const FVector& Location, float Size, const FVector4& Color);
+	void Append(const FDebugLineBuffer& Other);
+
+	void Reserve(int32 NumLines);
+	void Reset();
+	int32 Num() const { return NumLines; }
+	bool IsEmpty() const { return NumLines == 0; }
+
+	// Func(const FVector* Starts, const FVector* Ends, const FVector4* Colors, int32 Count)
+	template<typename Func>
+	void ForEachChunk(Func&& Visit) const
+	{
+		int32 Remaining = NumLines;
+		for (const FChunk& Chunk : Chunks)
+		{
+			if (Remaining <= 0)
+				break;
+			const int32 Count = std::min(Remaining, Chunk.Starts.Num());
+			Visit(Chunk.Starts.GetData(), Chunk.Ends.GetData(), Chunk.Colors.GetData(), Count);
+			Remaining -= Count;
+		}
+	}
+
+private:
+	FChunk& GetWritableChunk();
+
+	TArray<FChunk> Chunks;
+	int32 ActiveChunk = 0;   // 현재 채우는 청크
+	int32 NumLines = 0;
+};
+
+// 월드 공간 텍스트 앵커 (뷰포트 위에 2D 텍스트로 표시)
+struct FDebugTextAnchor
+{
+	FVector Location;
+	FString Text;
+	FVector4 Color;
+};
+
+/**
+ * @brief 엔진 전역 디버그 드로우 서비스
+ * 게임플레이/Lua/워커 스레드 어디서든 제출할 수 있고(내부 락), 각 월드의 디버그 패스가 모아서 그린다.
+ *
+ * Duration 규칙
+ * - 0  : 이번 프레임만 (다음 BeginFrame에서 사라짐)
+ * - >0 : 해당 초 동안 유지
+ * - <0 : ClearPersistent 전까지 유지 (한 번 만든 선분을 매 프레임 재사용)
+ */
+class FDebugDrawManager
+{
+public:
+	static FDebugDrawManager& GetInstance()
+	{
+		static FDebugDrawManager Instance;
+		return Instance;
+	}
+
+	// 엔진 Tick 시작 시 호출: 한 프레임짜리 도형을 비우고 만료된 도형을 정리
+	void BeginFrame();
+
+	void DrawLine(const UWorld* World, const FVector& Start, const FVector& End, const FVector4& Color, float Duration = 0.0f, bool bAlwaysOnTop = false);
+	void DrawBox(const UWorld* World, const FVector& Center, const FVector& HalfExtent, const FQuat& Rotation, const FVector4& Color, float Duration = 0.0f, bool bAlwaysOnTop = false);
+	void DrawSphere(const UWorld* World, const FVector& Center, float Radius, const FVector4& Color, float Duration = 0.0f, bool bAlwaysOnTop = false, int32 Segments = 16);
+	void DrawArrow(const UWorld* World, const FVector& Start, const FVector& End, const FVector4& Color, float Duration = 0.0f, bool bAlwaysOnTop = false);
+	void DrawString(const UWorld* World, const FVector& Location, const FString& Text, const FVector4& Color, float Duration = 0.0f);
+
+	// 미리 만든 선분 묶음을 한 번의 락으로 제출 (대량 생성용)
+	void DrawLines(const UWorld* World, const FDebugLineBuffer& Lines, float Duration = 0.0f, bool bAlwaysOnTop = false);
+
+	void ClearPersistent(const UWorld* World);
+	void RemoveWorld(const UWorld* World);
+
+	// 렌더 스레드(디버그 패스)에서 호출
+	void CollectLines(const UWorld* World, URenderer* Renderer, bool bAlwaysOnTop);
+	void CollectTextAnchors(const UWorld* World, TArray<FDebugTextAnchor>& OutAnchors);
+
+	int32 GetLineCount(const UWorld* World);
+
+private:
+	FDebugDrawManager() = default;
+
+	struct FTimedLine
+	{
+		FVector Start;
+		FVector End;
+		FVector4 Color;
+		double ExpireTime;
+	};
+
+	struct FTimedText
+	{
+		FDebugTextAnchor Anchor;
+		double ExpireTime;   // 0 = 이번 프레임, <0 = 영구
+	};
+
+	// [0] 깊이 테스트, [1] 항상 위
+	struct FWorldDebugDraw
+	{
+		FDebugLineBuffer FrameLines[2];
+		FDebugLineBuffer PersistentLines[2];
+		TArray<FTimedLine> TimedLines[2];
+		TArray<FTimedText> Texts;
+	};
+
+	FWorldDebugDraw& GetWorldData(const UWorld* World);
+
+	// Generate(FDebugLineBuffer&)로 만든 선분을 수명에 맞는 저장소에 넣는다 (락을 잡은 상태에서 호출)
+	template<typename GenerateFunc>
+	void Submit(const UWorld* World, float Duration, bool bAlwaysOnTop, GenerateFunc&& Generate);
+
+	std::mutex Mutex;
+	TMap<const UWorld*, FWorldDebugDraw> Worlds;
+	FDebugLineBuffer TimedScratch;
+};
@@ -31,15 +31,20 @@ void FLightManager::Initialize(D3D11RHI* RHIDevice, uint32 InShadowAtlasSize2D,
 	CubeArrayCount = InCubeArrayCount;
 
 	// --- 1. Structured Buffers (t17, t18) ---
+	// 구간 단위 UpdateSubresource를 위해 DEFAULT 사용 (슬롯 수가 늘어나면 UploadLightSlots에서 재생성)
 	if (!PointLightBuffer)
 	{
-		RHIDevice->CreateStructuredBuffer(sizeof(FPointLightInfo), NUM_POINT_LIGHT_MAX, nullptr, &PointLightBuffer);
+		PointLightCapacity = NUM_POINT_LIGHT_MAX;
+		RHIDevice->CreateStructuredBuffer(sizeof(FPointLightInfo), PointLightCapacity, nullptr, &PointLightBuffer, false);
 		RHIDevice->CreateStructuredBufferSRV(PointLightBuffer, &PointLightBufferSRV);
+		PointLightSlots.MarkAllDirty();
 	}
 	if (!SpotLightBuffer)
 	{
-		RHIDevice->CreateStructuredBuffer(sizeof(FSpotLightInfo), NUM_SPOT_LIGHT_MAX, nullptr, &SpotLightBuffer);
+		SpotLightCapacity = NUM_SPOT_LIGHT_MAX;
+		RHIDevice->CreateStructuredBuffer(sizeof(FSpotLightInfo), SpotLightCapacity, nullptr, &SpotLightBuffer, false);
 		RHIDevice->CreateStructuredBufferSRV(SpotLightBuffer, &SpotLightBufferSRV);
+		SpotLightSlots.MarkAllDirty();
 	}
 
 	// --- 2. 2D Atlas (t9) ---
@@ -281,7 +286,7 @@ void FLightManager::Release()
 void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
 {
 	// 1. 아무것도 변경되지 않았으면 모든 작업을 건너뜀
-	if (!bHaveToUpdate && !bPointLightDirty && !bSpotLightDirty && !bShadowDataDirty)
+	if (!bHaveToUpdate && DirtyPointLights.IsEmpty() && DirtySpotLights.IsEmpty())
 	{
 		return;
 	}
@@ -319,52 +324,15 @@ void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
 	}
 
 	// 4. Point Light Structured Buffer 업데이트 (t3)
-	if (bPointLightDirty || bShadowDataDirty)
-	{
-		PointLightInfoList.clear();
-		for (UPointLightComponent* Light : PointLightList)
-		{
-			if (Light->IsVisible() && Light->GetOwner()->IsActorVisible())
-			{
-				FPointLightInfo Info = Light->GetLightInfo(); // 기본 정보
-
-				// 섀도우 데이터 (큐브맵 인덱스) 병합
-				if (Light->IsCastShadows() && ShadowDataCacheCube.Contains(Light))
-				{
-					Info.ShadowArrayIndex = ShadowDataCacheCube[Light];
-					Info.bCastShadows = (Info.ShadowArrayIndex != -1);
-				}
-				PointLightInfoList.Add(Info);
-			}
-		}
-		PointLightNum = PointLightInfoList.Num();
-		RHIDevice->UpdateStructuredBuffer(PointLightBuffer, PointLightInfoList.data(), PointLightNum * sizeof(FPointLightInfo));
-		bPointLightDirty = false;
-	}
+	// 바뀐 라이트만 다시 패킹하고, 실제로 바이트가 달라진 슬롯 구간만 업로드
+	RefreshPointLightSlots();
+	UploadLightSlots(RHIDevice, PointLightSlots, PointLightBuffer, PointLightBufferSRV, PointLightCapacity);
+	PointLightNum = PointLightSlots.GetSlotCount();
 
 	// 5. Spot Light Structured Buffer 업데이트 (t4)
-	if (bSpotLightDirty || bShadowDataDirty)
-	{
-		SpotLightInfoList.clear();
-		for (USpotLightComponent* Light : SpotLightList)
-		{
-			if (Light->IsVisible() && Light->GetOwner()->IsActorVisible())
-			{
-				FSpotLightInfo Info = Light->GetLightInfo(); // 기본 정보
-
-				// 섀도우 데이터 (2D 아틀라스) 병합
-				if (Light->IsCastShadows() && ShadowDataCache2D.Contains(Light) && ShadowDataCache2D[Light].Num() > 0)
-				{
-					Info.ShadowData = ShadowDataCache2D[Light][0]; // 스포트라이트는 0번 인덱스 사용
-					Info.bCastShadows = 1;
-				}
-				SpotLightInfoList.Add(Info);
-			}
-		}
-		SpotLightNum = SpotLightInfoList.Num();
-		RHIDevice->UpdateStructuredBuffer(SpotLightBuffer, SpotLightInfoList.data(), SpotLightNum * sizeof(FSpotLightInfo));
-		bSpotLightDirty = false;
-	}
+	RefreshSpotLightSlots();
+	UploadLightSlots(RHIDevice, SpotLightSlots, SpotLightBuffer, SpotLightBufferSRV, SpotLightCapacity);
+	SpotLightNum = SpotLightSlots.GetSlotCount();
 
 	// 6. CBuffer에 라이트 개수 업데이트 및 바인딩
 	LightBuffer.PointLightCount = PointLightNum;
@@ -395,16 +363,148 @@ void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
 
 	// 8. 모든 Dirty Flag 클리어
 	bHaveToUpdate = false;
-	bShadowDataDirty = false;
-	// (bPointLightDirty, bSpotLightDirty는 이미 위에서 개별 클리어됨)
+	// (라이트별 dirty 목록은 Refresh*LightSlots에서 비워짐)
+}
+
+void FLightManager::RefreshPointLightSlots()
+{
+	for (UPointLightComponent* Light : DirtyPointLights)
+	{
+		int32& Slot = LightSlotIndices[Light];
+		if (!Light->IsVisible() || !Light->GetOwner()->IsActorVisible())
+		{
+			// 숨겨진 라이트는 슬롯을 반납 (구멍은 CompactIfNeeded에서 지연 압축)
+			if (Slot != -1)
+			{
+				PointLightSlots.FreeSlot(Slot);
+				Slot = -1;
+			}
+			continue;
+		}
+
+		FPointLightInfo Info = Light->GetLightInfo(); // 기본 정보
+
+		// 섀도우 데이터 (큐브맵 인덱스) 병합
+		if (Light->IsCastShadows() && ShadowDataCacheCube.Contains(Light))
+		{
+			Info.ShadowArrayIndex = ShadowDataCacheCube[Light];
+			Info.bCastShadows = (Info.ShadowArrayIndex != -1);
+		}
+
+		if (Slot == -1)
+		{
+			Slot = PointLightSlots.AllocateSlot(Light);
+		}
+		PointLightSlots.WriteSlot(Slot, Info);
+	}
+	DirtyPointLights.Empty();
+
+	PointLightSlots.CompactIfNeeded([this](UPointLightComponent* Owner, int32 NewSlot)
+	{
+		LightSlotIndices[Owner] = NewSlot;
+	});
+}
+
+void FLightManager::RefreshSpotLightSlots()
+{
+	for (USpotLightComponent* Light : DirtySpotLights)
+	{
+		int32& Slot = LightSlotIndices[Light];
+		if (!Light->IsVisible() || !Light->GetOwner()->IsActorVisible())
+		{
+			if (Slot != -1)
+			{
+				SpotLightSlots.FreeSlot(Slot);
+				Slot = -1;
+			}
+			continue;
+		}
+
+		FSpotLightInfo Info = Light->GetLightInfo(); // 기본 정보
+
+		// 섀도우 데이터 (2D 아틀라스) 병합
+		if (Light->IsCastShadows() && ShadowDataCache2D.Contains(Light) && ShadowDataCache2D[Light].Num() > 0)
+		{
+			Info.ShadowData = ShadowDataCache2D[Light][0]; // 스포트라이트는 0번 인덱스 사용
+			Info.bCastShadows = 1;
+		}
+
+		if (Slot == -1)
+		{
+			Slot = SpotLightSlots.AllocateSlot(Light);
+		}
+		SpotLightSlots.WriteSlot(Slot, Info);
+	}
+	DirtySpotLights.Empty();
+
+	SpotLightSlots.CompactIfNeeded([this](USpotLightComponent* Owner, int32 NewSlot)
+	{
+		LightSlotIndices[Owner] = NewSlot;
+	});
+}
+
+template<typename InfoType, typename OwnerType>
+void FLightManager::UploadLightSlots(D3D11RHI* RHIDevice, TLightSlotBuffer<InfoType, OwnerType>& SlotBuffer,
+	ID3D11Buffer*& Buffer, ID3D11ShaderResourceView*& BufferSRV, uint32& Capacity)
+{
+	const uint32 SlotCount = static_cast<uint32>(SlotBuffer.GetSlotCount());
+
+	// 용량 초과: 2배씩 늘려 재생성하고 전체 업로드
+	if (SlotCount > Capacity)
+	{
+		while (Capacity < SlotCount)
+		{
+			Capacity *= 2;
+		}
+		if (BufferSRV) { BufferSRV->Release(); BufferSRV = nullptr; }
+		if (Buffer) { Buffer->Release(); Buffer = nullptr; }
+		RHIDevice->CreateStructuredBuffer(sizeof(InfoType), Capacity, nullptr, &Buffer, false);
+		RHIDevice->CreateStructuredBufferSRV(Buffer, &BufferSRV);
+		SlotBuffer.MarkAllDirty();
+	}
+
+	SlotBuffer.BuildDirtyRanges(DirtyRanges);
+	const InfoType* SlotData = SlotBuffer.GetSlotData().GetData();
+	for (const FLightSlotRange& Range : DirtyRanges)
+	{
+		RHIDevice->UpdateStructuredBufferRange(Buffer, SlotData + Range.Begin,
+			Range.Begin * sizeof(InfoType), Range.Count * sizeof(InfoType));
+	}
+	SlotBuffer.ClearDirty();
+}
+
+void FLightManager::MarkShadowOwnerDirty(ULightComponent* Light)
+{
+	// 섀도우 데이터는 Point/Spot 슬롯에 병합되므로 해당 라이트만 다시 패킹
+	if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(Light))
+	{
+		if (LightSlotIndices.Contains(SpotLight))
+		{
+			DirtySpotLights.Add(SpotLight);
+		}
+	}
+	else if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(Light))
+	{
+		if (LightSlotIndices.Contains(PointLight))
+		{
+			DirtyPointLights.Add(PointLight);
+		}
+	}
 }
 
 void FLightManager::SetDirtyFlag()
 {
+	// 액터 가시성 변경 등 어떤 라이트가 바뀌었는지 모를 때: 전부 재검사
+	// (재패킹 결과가 같은 슬롯은 업로드되지 않음)
 	bHaveToUpdate = true;
-	bPointLightDirty = true;
-	bSpotLightDirty = true;
-	bShadowDataDirty = true;
+	for (UPointLightComponent* Light : PointLightList)
+	{
+		DirtyPointLights.Add(Light);
+	}
+	for (USpotLightComponent* Light : SpotLightList)
+	{
+		DirtySpotLights.Add(Light);
+	}
 }
 
 void FLightManager::SetShadowMapData(ULightComponent* Light, int32 SubViewIndex, const FShadowMapData& Data)
@@ -423,7 +523,7 @@ void FLightManager::SetShadowMapData(ULightComponent* Light, int32 SubViewIndex,
 	// 데이터 저장
 	Cascades[SubViewIndex] = Data;
 
-	bShadowDataDirty = true;
+	MarkShadowOwnerDirty(Light);
 	bHaveToUpdate = true;
 }
 
@@ -438,7 +538,7 @@ void FLightManager::SetShadowCubeMapData(ULightComponent* Light, int32 SliceInde
 	// TMap에 슬라이스 인덱스 저장
 	ShadowDataCacheCube[Light] = SliceIndex;
 
-	bShadowDataDirty = true;
+	MarkShadowOwnerDirty(Light);
 	bHaveToUpdate = true;
 }
 
@@ -649,9 +749,12 @@ void FLightManager::ClearAllLightList()
 	PointLightList.clear();
 	SpotLightList.clear();
 
-	//업데이트 시에만 clear하고 다시 수집할 실제 데이터 리스트
-	PointLightInfoList.clear();
-	SpotLightInfoList.clear();
+	// 슬롯 배열과 라이트별 슬롯 매핑
+	PointLightSlots.Reset();
+	SpotLightSlots.Reset();
+	LightSlotIndices.clear();
+	DirtyPointLights.clear();
+	DirtySpotLights.clear();
 
 	//이미 레지스터된 라이트인지 확인하는 용도
 	LightComponentList.clear();
@@ -700,9 +803,8 @@ void FLightManager::RegisterLight<UPointLightComponent>(UPointLightComponent* Li
 	}
 	LightComponentList.Add(LightComponent);
 	PointLightList.Add(LightComponent);
-	PointLightInfoList.Add(LightComponent->GetLightInfo());
-	PointLightNum++;
-	bPointLightDirty = true;
+	LightSlotIndices.Add(LightComponent, -1); // 슬롯은 보일 때 RefreshPointLightSlots에서 할당
+	DirtyPointLights.Add(LightComponent);
 	bHaveToUpdate = true;
 }
 
@@ -715,9 +817,8 @@ void FLightManager::RegisterLight<USpotLightComponent>(USpotLightComponent* Ligh
 	}
 	LightComponentList.Add(LightComponent);
 	SpotLightList.Add(LightComponent);
-	SpotLightInfoList.Add(LightComponent->GetLightInfo());
-	SpotLightNum++;
-	bSpotLightDirty = true;
+	LightSlotIndices.Add(LightComponent, -1);
+	DirtySpotLights.Add(LightComponent);
 	bHaveToUpdate = true;
 }
 
@@ -755,8 +856,12 @@ void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent*
 	}
 	LightComponentList.Remove(LightComponent);
 	PointLightList.Remove(LightComponent);
-	PointLightNum--;
-	bPointLightDirty = true;
+	if (const int32* Slot = LightSlotIndices.Find(LightComponent))
+	{
+		PointLightSlots.FreeSlot(*Slot);
+		LightSlotIndices.Remove(LightComponent);
+	}
+	DirtyPointLights.Remove(LightComponent);
 	bHaveToUpdate = true;
 
 	ShadowDataCacheCube.Remove(LightComponent);
@@ -770,8 +875,12 @@ void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* Li
 	}
 	LightComponentList.Remove(LightComponent);
 	SpotLightList.Remove(LightComponent);
-	SpotLightNum--;
-	bSpotLightDirty = true;
+	if (const int32* Slot = LightSlotIndices.Find(LightComponent))
+	{
+		SpotLightSlots.FreeSlot(*Slot);
+		LightSlotIndices.Remove(LightComponent);
+	}
+	DirtySpotLights.Remove(LightComponent);
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
@@ -801,7 +910,7 @@ template<> void FLightManager::UpdateLight<UPointLightComponent>(UPointLightComp
 	{
 		return;
 	}
-	bPointLightDirty = true;
+	DirtyPointLights.Add(LightComponent);
 	bHaveToUpdate = true;
 }
 template<> void FLightManager::UpdateLight<USpotLightComponent>(USpotLightComponent* LightComponent)
@@ -810,6 +919,6 @@ template<> void FLightManager::UpdateLight<USpotLightComponent>(USpotLightCompon
 	{
 		return;
 	}
-	bSpotLightDirty = true;
+	DirtySpotLights.Add(LightComponent);
 	bHaveToUpdate = true;
 }
\ No newline at end of file
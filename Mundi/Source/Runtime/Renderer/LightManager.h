@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include "LightSlotBuffer.h"
 #define CASCADED_MAX 8
 
 class UAmbientLightComponent;
@@ -163,8 +164,9 @@ public:
     TArray<UPointLightComponent*> GetPointLightList() { return PointLightList; }
     TArray<USpotLightComponent*> GetSpotLightList() { return SpotLightList; }
 
-    TArray<FPointLightInfo>& GetPointLightInfoList() { return PointLightInfoList; }
-    TArray<FSpotLightInfo>& GetSpotLightInfoList() { return SpotLightInfoList; }
+    // 슬롯 배열 그대로 노출 (빈 슬롯은 반경 0인 무효 라이트)
+    TArray<FPointLightInfo>& GetPointLightInfoList() { return PointLightSlots.GetSlotData(); }
+    TArray<FSpotLightInfo>& GetSpotLightInfoList() { return SpotLightSlots.GetSlotData(); }
 
     template<typename T>
     void RegisterLight(T* LightComponent);
@@ -176,10 +178,16 @@ public:
     void ClearAllLightList();
 
 private:
+    // dirty 라이트만 다시 패킹해서 슬롯에 기록 (보이지 않으면 슬롯 반납)
+    void RefreshPointLightSlots();
+    void RefreshSpotLightSlots();
+    // 슬롯 버퍼의 dirty 구간만 GPU 버퍼로 업로드 (용량 부족 시 버퍼 재생성)
+    template<typename InfoType, typename OwnerType>
+    void UploadLightSlots(D3D11RHI* RHIDevice, TLightSlotBuffer<InfoType, OwnerType>& SlotBuffer,
+        ID3D11Buffer*& Buffer, ID3D11ShaderResourceView*& BufferSRV, uint32& Capacity);
+    void MarkShadowOwnerDirty(ULightComponent* Light);
+
     bool bHaveToUpdate = true;
-    bool bPointLightDirty = true;
-    bool bSpotLightDirty = true;
-    bool bShadowDataDirty = true;
 
     // --- 섀도우 리소스 ---
     // Atlas 1: 2D 아틀라스 (Spot/Dir용)
@@ -226,9 +234,17 @@ private:
     // 키: ULightComponent 포인터, 값: 해당 라이트의 섀도우 데이터
     TMap<ULightComponent*, FShadowMapData> ShadowDataCache;
 
-    //업데이트 시에만 clear하고 다시 수집할 실제 데이터 리스트
-    TArray<FPointLightInfo> PointLightInfoList;
-    TArray<FSpotLightInfo> SpotLightInfoList;
+    // GPU Structured Buffer와 1:1로 대응하는 슬롯 배열 (라이트별 고정 슬롯 + free list)
+    TLightSlotBuffer<FPointLightInfo, UPointLightComponent> PointLightSlots;
+    TLightSlotBuffer<FSpotLightInfo, USpotLightComponent> SpotLightSlots;
+    // Key: 라이트, Value: 할당된 슬롯 인덱스 (-1 = 보이지 않아 슬롯 없음)
+    TMap<ULightComponent*, int32> LightSlotIndices;
+    // 다음 UpdateLightBuffer에서 다시 패킹할 라이트
+    TSet<UPointLightComponent*> DirtyPointLights;
+    TSet<USpotLightComponent*> DirtySpotLights;
+    TArray<FLightSlotRange> DirtyRanges;
+    uint32 PointLightCapacity = 0;
+    uint32 SpotLightCapacity = 0;
 
     //이미 레지스터된 라이트인지 확인하는 용도
     TSet<ULightComponent*> LightComponentList;
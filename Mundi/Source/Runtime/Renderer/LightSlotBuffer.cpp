@@ -0,0 +1,104 @@
+﻿#include "pch.h"
+#include "LightSlotBuffer.h"
+#include "LightManager.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	// 벤치마크용 가짜 라이트 (컴포넌트 대신 원본 데이터만 보관)
+	struct FBenchLight
+	{
+		FVector Position;
+		float Radius;
+		float Intensity;
+	};
+
+	FPointLightInfo PackBenchLight(const FBenchLight& Light)
+	{
+		FPointLightInfo Info{};
+		Info.Color = FLinearColor(Light.Intensity, Light.Intensity, Light.Intensity, 1.0f);
+		Info.Position = Light.Position;
+		Info.AttenuationRadius = Light.Radius;
+		Info.FalloffExponent = 2.0f;
+		Info.ShadowArrayIndex = -1;
+		return Info;
+	}
+}
+
+FLightSlotBenchmarkResult RunLightSlotPackingBenchmark(int32 NumLights, int32 NumDirtyPerFrame, int32 NumFrames)
+{
+	FLightSlotBenchmarkResult Result;
+	if (NumLights <= 0 || NumFrames <= 0)
+	{
+		return Result;
+	}
+	NumDirtyPerFrame = FMath::Clamp(NumDirtyPerFrame, 0, NumLights);
+
+	TArray<FBenchLight> Lights;
+	Lights.SetNum(NumLights);
+	for (int32 i = 0; i < NumLights; ++i)
+	{
+		Lights[i] = FBenchLight{ FVector((float)(i % 64), (float)(i / 64), 0.0f), 5.0f, 1.0f };
+	}
+
+	// GPU 버퍼 대신 업로드 대상 메모리
+	TArray<FPointLightInfo> FakeGPUBuffer;
+	FakeGPUBuffer.SetNum(NumLights);
+
+	// 1. 기존 방식: 매 프레임 전체 재구성 + 전체 업로드
+	TArray<FPointLightInfo> InfoList;
+	uint32 Seed = 1;
+	uint64 Start = FPlatformTime::Cycles64();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int32 i = 0; i < NumDirtyPerFrame; ++i)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			Lights[Seed % NumLights].Intensity += 0.01f;
+		}
+
+		InfoList.clear();
+		for (const FBenchLight& Light : Lights)
+		{
+			InfoList.Add(PackBenchLight(Light));
+		}
+		memcpy(FakeGPUBuffer.GetData(), InfoList.GetData(), InfoList.Num() * sizeof(FPointLightInfo));
+		Result.FullRebuildBytes += InfoList.Num() * sizeof(FPointLightInfo);
+	}
+	Result.FullRebuildMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 2. 슬롯 방식: 바뀐 라이트만 재패킹 + dirty 구간만 업로드
+	TLightSlotBuffer<FPointLightInfo, FBenchLight> Slots;
+	for (FBenchLight& Light : Lights)
+	{
+		Slots.WriteSlot(Slots.AllocateSlot(&Light), PackBenchLight(Light));
+	}
+	Slots.ClearDirty();
+
+	TArray<FLightSlotRange> Ranges;
+	Seed = 1;
+	Start = FPlatformTime::Cycles64();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int32 i = 0; i < NumDirtyPerFrame; ++i)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			const int32 Index = Seed % NumLights;
+			Lights[Index].Intensity += 0.01f;
+			Slots.WriteSlot(Index, PackBenchLight(Lights[Index]));
+		}
+
+		Slots.BuildDirtyRanges(Ranges);
+		const FPointLightInfo* SlotData = Slots.GetSlotData().GetData();
+		for (const FLightSlotRange& Range : Ranges)
+		{
+			memcpy(FakeGPUBuffer.GetData() + Range.Begin, SlotData + Range.Begin, Range.Count * sizeof(FPointLightInfo));
+			Result.DirtyRangeBytes += Range.Count * sizeof(FPointLightInfo);
+		}
+		Result.DirtyRangeCount += Ranges.Num();
+		Slots.ClearDirty();
+	}
+	Result.DirtyRangeMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	return Result;
+}
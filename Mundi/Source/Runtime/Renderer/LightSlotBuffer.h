@@ -0,0 +1,231 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 연속된 dirty 슬롯 구간 [Begin, Begin + Count)
+struct FLightSlotRange
+{
+	int32 Begin = 0;
+	int32 Count = 0;
+};
+
+// 라이트 Structured Buffer의 CPU 미러.
+// - 라이트마다 고정 슬롯을 할당하고 해제된 슬롯은 free list로 재사용한다.
+// - 슬롯별 dirty bit를 유지해 실제로 바뀐 구간만 GPU에 업로드할 수 있게 한다.
+// - 빈 슬롯은 0으로 채워진 "무효 라이트"(반경 0)로 남겨두고, 구멍이 일정 비율을 넘으면 지연 압축한다.
+//   셰이더의 CalculatePointLight/CalculateSpotLight는 AttenuationRadius <= 0인 슬롯을 건너뛴다.
+// 디바이스에 의존하지 않으므로 패킹 비용만 따로 벤치마크할 수 있다.
+template<typename InfoType, typename OwnerType>
+class TLightSlotBuffer
+{
+public:
+	// 새 슬롯 할당 (free list 우선)
+	int32 AllocateSlot(OwnerType* Owner)
+	{
+		int32 Slot;
+		if (FreeSlots.Num() > 0)
+		{
+			Slot = FreeSlots.Pop();
+		}
+		else
+		{
+			Slot = Slots.Num();
+			Slots.Add(InfoType{});
+			Owners.Add(nullptr);
+			if ((Slot >> 6) >= DirtyWords.Num())
+			{
+				DirtyWords.Add(0ull);
+			}
+		}
+		Owners[Slot] = Owner;
+		++LiveCount;
+		MarkDirty(Slot);
+		return Slot;
+	}
+
+	// 슬롯 해제: 내용을 0으로 지워 셰이더에서 무시되도록 하고 free list에 반납
+	void FreeSlot(int32 Slot)
+	{
+		if (Slot < 0 || Slot >= Slots.Num() || Owners[Slot] == nullptr)
+		{
+			return;
+		}
+		Slots[Slot] = InfoType{};
+		Owners[Slot] = nullptr;
+		--LiveCount;
+		MarkDirty(Slot);
+
+		// 꼬리 쪽 구멍은 즉시 잘라낸다 (free list 탐색 없이 개수만 줄이면 됨)
+		if (Slot == Slots.Num() - 1)
+		{
+			TrimTail();
+		}
+		else
+		{
+			FreeSlots.Add(Slot);
+		}
+	}
+
+	// 슬롯 내용 갱신. 바이트 단위로 달라졌을 때만 dirty 처리하고 true 반환
+	bool WriteSlot(int32 Slot, const InfoType& Info)
+	{
+		InfoType& Dest = Slots[Slot];
+		if (std::memcmp(&Dest, &Info, sizeof(InfoType)) == 0)
+		{
+			return false;
+		}
+		Dest = Info;
+		MarkDirty(Slot);
+		return true;
+	}
+
+	void MarkDirty(int32 Slot)
+	{
+		DirtyWords[Slot >> 6] |= (1ull << (Slot & 63));
+		bAnyDirty = true;
+	}
+
+	void MarkAllDirty()
+	{
+		for (int32 i = 0; i < Slots.Num(); ++i)
+		{
+			MarkDirty(i);
+		}
+	}
+
+	// 구멍 비율이 임계값을 넘으면 꼬리의 살아있는 슬롯을 앞쪽 구멍으로 옮긴다.
+	// OnMoved(Owner, NewSlot)로 소유자 측 슬롯 인덱스를 갱신할 기회를 준다.
+	template<typename MoveFunc>
+	bool CompactIfNeeded(MoveFunc OnMoved)
+	{
+		const int32 HoleCount = Slots.Num() - LiveCount;
+		if (HoleCount <= 0 || HoleCount < std::max(MinHolesForCompaction, Slots.Num() / 4))
+		{
+			return false;
+		}
+
+		TArray<int32> Holes = std::move(FreeSlots);
+		FreeSlots.Empty();
+		Holes.Sort();
+
+		for (int32 Hole : Holes)
+		{
+			TrimTail();
+			const int32 Last = Slots.Num() - 1;
+			if (Hole >= Last)
+			{
+				break;
+			}
+			Slots[Hole] = Slots[Last];
+			Owners[Hole] = Owners[Last];
+			Slots[Last] = InfoType{};
+			Owners[Last] = nullptr;
+			MarkDirty(Hole);
+			OnMoved(Owners[Hole], Hole);
+		}
+		TrimTail();
+		return true;
+	}
+
+	// dirty 슬롯을 MergeGap 이하로 떨어진 것끼리 합쳐 구간 목록으로 만든다
+	void BuildDirtyRanges(TArray<FLightSlotRange>& OutRanges, int32 MergeGap = 4) const
+	{
+		OutRanges.Empty();
+		if (!bAnyDirty)
+		{
+			return;
+		}
+
+		const int32 SlotNum = Slots.Num();
+		for (int32 Word = 0; Word < DirtyWords.Num(); ++Word)
+		{
+			uint64 Bits = DirtyWords[Word];
+			while (Bits)
+			{
+				const int32 Slot = (Word << 6) + CountTrailingZeros(Bits);
+				Bits &= Bits - 1;
+				if (Slot >= SlotNum)
+				{
+					return;
+				}
+
+				if (OutRanges.Num() > 0)
+				{
+					FLightSlotRange& Prev = OutRanges.Last();
+					if (Slot - (Prev.Begin + Prev.Count) <= MergeGap)
+					{
+						Prev.Count = Slot - Prev.Begin + 1;
+						continue;
+					}
+				}
+				OutRanges.Add(FLightSlotRange{ Slot, 1 });
+			}
+		}
+	}
+
+	void ClearDirty()
+	{
+		if (bAnyDirty)
+		{
+			std::fill(DirtyWords.begin(), DirtyWords.end(), 0ull);
+			bAnyDirty = false;
+		}
+	}
+
+	void Reset()
+	{
+		Slots.Empty();
+		Owners.Empty();
+		FreeSlots.Empty();
+		DirtyWords.Empty();
+		LiveCount = 0;
+		bAnyDirty = false;
+	}
+
+	bool IsDirty() const { return bAnyDirty; }
+	int32 GetSlotCount() const { return Slots.Num(); }
+	int32 GetLiveCount() const { return LiveCount; }
+	OwnerType* GetOwner(int32 Slot) const { return Owners[Slot]; }
+
+	TArray<InfoType>& GetSlotData() { return Slots; }
+	const TArray<InfoType>& GetSlotData() const { return Slots; }
+
+private:
+	void TrimTail()
+	{
+		while (Slots.Num() > 0 && Owners.Last() == nullptr)
+		{
+			const int32 Last = Slots.Num() - 1;
+			Slots.Pop();
+			Owners.Pop();
+			FreeSlots.Remove(Last);
+		}
+	}
+
+	static int32 CountTrailingZeros(uint64 Value)
+	{
+		unsigned long Index = 0;
+		_BitScanForward64(&Index, Value);
+		return static_cast<int32>(Index);
+	}
+
+	static constexpr int32 MinHolesForCompaction = 8;
+
+	TArray<InfoType> Slots;        // GPU 버퍼와 1:1로 대응하는 패킹 데이터
+	TArray<OwnerType*> Owners;     // 슬롯 소유자 (nullptr = 빈 슬롯)
+	TArray<int32> FreeSlots;       // 재사용 가능한 구멍
+	TArray<uint64> DirtyWords;     // 슬롯별 dirty bit (64개 단위)
+	int32 LiveCount = 0;
+	bool bAnyDirty = false;
+};
+
+// 디바이스 없이 라이트 버퍼 패킹 비용을 측정한다 (전체 재구성 vs dirty 구간 갱신)
+struct FLightSlotBenchmarkResult
+{
+	double FullRebuildMs = 0.0;
+	double DirtyRangeMs = 0.0;
+	uint64 FullRebuildBytes = 0;
+	uint64 DirtyRangeBytes = 0;
+	int32 DirtyRangeCount = 0;
+};
+
+FLightSlotBenchmarkResult RunLightSlotPackingBenchmark(int32 NumLights, int32 NumDirtyPerFrame, int32 NumFrames);
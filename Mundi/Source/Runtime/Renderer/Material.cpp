@@ -3,6 +3,7 @@
 #include "Shader.h"
 #include "Texture.h"
 #include "ResourceManager.h"
+#include "MeshDrawCommandCache.h"
 
 IMPLEMENT_CLASS(UMaterial)
 
@@ -55,6 +56,7 @@ void UMaterial::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 void UMaterial::SetShader(UShader* InShaderResource)
 {
 	Shader = InShaderResource;
+	FMeshDrawCommandCache::InvalidateAll();
 }
 
 void UMaterial::SetShaderByName(const FString& InShaderName)
@@ -80,6 +82,8 @@ void UMaterial::SetShaderMacros(const TArray<FShaderMacro>& InShaderMacro)
 	}
 
 	ShaderMacros = InShaderMacro;
+	ShaderMacroSetId = FShaderPermutation::RegisterMacroSet(ShaderMacros);
+	FMeshDrawCommandCache::InvalidateAll();
 }
 
 UTexture* UMaterial::GetTexture(EMaterialTextureSlot Slot) const
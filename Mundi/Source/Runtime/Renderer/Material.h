@@ -26,6 +26,8 @@ public:
 	virtual bool HasTexture(EMaterialTextureSlot Slot) const = 0;
 	virtual const FMaterialInfo& GetMaterialInfo() const = 0;
 	virtual const TArray<FShaderMacro> GetShaderMacros() const = 0;
+	// GetShaderMacros()를 FShaderPermutation::RegisterMacroSet()으로 등록한 세트 ID (0 = 매크로 없음)
+	virtual uint32 GetShaderMacroSetId() const = 0;
 };
 
 
@@ -59,11 +61,13 @@ public:
 
 	const TArray<FShaderMacro> GetShaderMacros() const override;
 	void SetShaderMacros(const TArray<FShaderMacro>& InShaderMacro);
+	uint32 GetShaderMacroSetId() const override { return ShaderMacroSetId; }
 
 protected:
 	// 이 머티리얼이 사용할 셰이더 프로그램 (예: UberLit.hlsl)
 	UShader* Shader = nullptr;
 	TArray<FShaderMacro> ShaderMacros;
+	uint32 ShaderMacroSetId = 0;
 
 	FMaterialInfo MaterialInfo;
 	// MaterialInfo 이름 기반으로 찾은 (Textures[0] = Diffuse, Textures[1] = Normal)
@@ -92,6 +96,7 @@ public:
 	UMaterialInterface* GetParentMaterial() const { return ParentMaterial; }
 	
 	const TArray<FShaderMacro> GetShaderMacros() const override;	// 이 인스턴스에 덮어쓴 매크로가 없다면 부모의 매크로를, 있다면 덮어쓴 매크로를 반환합니다.
+	uint32 GetShaderMacroSetId() const override { return ParentMaterial ? ParentMaterial->GetShaderMacroSetId() : 0; }
 
 	const TMap<EMaterialTextureSlot, UTexture*>& GetOverriddenTextures() const { return OverriddenTextures; }	// 덮어쓴 텍스처 맵 반환 (저장 시 사용)
 	void SetTextureParameterValue(EMaterialTextureSlot Slot, UTexture* Value);	// 텍스처 파라미터 값을 런타임에 변경하는 함수 (실시간 수정 시 사용)
@@ -28,6 +28,14 @@ struct FMeshBatchElement
 	// 프리미티브 토폴로지입니다. (TriangleList, LineList 등)
 	D3D11_PRIMITIVE_TOPOLOGY PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 
+	// 64비트 정렬 키를 만들기 위한 안정적인 작은 ID들입니다. (포인터 주소는 실행마다 달라지므로 사용하지 않음)
+	uint32 ShaderSortId = 0;	// FShaderVariant::SortId
+	uint32 MaterialSortId = 0;	// UResourceBase::GetSortId() (머티리얼)
+	uint32 MeshSortId = 0;		// UResourceBase::GetSortId() (메시 에셋)
+
+	// BuildMeshBatchSortKeys()가 채우는 정렬 키 (MeshBatchSort.h 참고)
+	uint64 SortKey = 0;
+
 
 	// --- 2. 드로우 데이터 (Draw Data) ---
 	// DrawIndexed() 호출에 직접 사용되는 파라미터입니다.
@@ -74,27 +82,11 @@ struct FMeshBatchElement
 
 	/**
 	 * @brief FMeshBatchElement 정렬을 위한 'less than' 연산자입니다.
-	 * TArray::Sort()가 A < B 를 비교하기 위해 이 함수를 호출합니다.
-	 * GPU 상태 변경을 최소화하는 순서로 정렬 키를 비교합니다.
+	 * 미리 계산된 SortKey만 비교합니다. 렌더러는 SortMeshBatches()의 기수 정렬을 사용하며,
+	 * 이 연산자는 TArray::Sort() 호환용입니다. (SortKey를 먼저 채워야 의미가 있음)
 	 */
 	bool operator<(const FMeshBatchElement& B) const
 	{
-		const FMeshBatchElement& A = *this; // A는 'this' (자신), B는 비교 대상
-
-		// 1순위: 셰이더 프로그램 (VS, PS)
-		if (A.VertexShader != B.VertexShader) return A.VertexShader < B.VertexShader;
-		if (A.PixelShader != B.PixelShader) return A.PixelShader < B.PixelShader;
-
-		// 2순위: 셰이더 파라미터 (Material)
-		if (A.Material != B.Material) return A.Material < B.Material;
-
-		// 3순위: IA(Input Assembler) 상태 (버퍼, 스트라이드, 토폴로지)
-		if (A.VertexBuffer != B.VertexBuffer) return A.VertexBuffer < B.VertexBuffer;
-		if (A.IndexBuffer != B.IndexBuffer) return A.IndexBuffer < B.IndexBuffer;
-		if (A.VertexStride != B.VertexStride) return A.VertexStride < B.VertexStride;
-		if (A.PrimitiveTopology != B.PrimitiveTopology) return A.PrimitiveTopology < B.PrimitiveTopology;
-
-		// 모든 키가 동일하면 순서가 중요하지 않으므로 false 반환 (Stable Sort 보장)
-		return false;
+		return SortKey < B.SortKey;
 	}
 };
@@ -0,0 +1,283 @@
+﻿#include "pch.h"
+#include "MeshBatchSort.h"
+#include "MeshBatchElement.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	struct FSortPair
+	{
+		uint64 Key;
+		uint32 Index;
+	};
+
+	// 렌더 스레드(게임 스레드)에서만 호출되므로 프레임 간에 재사용한다
+	TArray<FSortPair> GSortPairs;
+	TArray<FSortPair> GSortPairsTemp;
+	TArray<FMeshBatchElement> GSortedBatches;
+
+	uint64 QuantizeDepth(const FMeshBatchElement& Batch, const FVector& ViewLocation)
+	{
+		const float Dx = Batch.WorldMatrix.M[3][0] - ViewLocation.X;
+		const float Dy = Batch.WorldMatrix.M[3][1] - ViewLocation.Y;
+		const float Dz = Batch.WorldMatrix.M[3][2] - ViewLocation.Z;
+		const float DistSq = Dx * Dx + Dy * Dy + Dz * Dz;
+
+		uint32 Bits;
+		std::memcpy(&Bits, &DistSq, sizeof(Bits));
+		return Bits >> 16;
+	}
+
+	uint64 MakeSortKey(const FMeshBatchElement& Batch, uint64 Depth, EMeshSortMode Mode)
+	{
+		const uint64 Shader = Batch.ShaderSortId & 0xFFFu;
+		const uint64 Material = Batch.MaterialSortId & 0xFFFFu;
+		const uint64 Mesh = Batch.MeshSortId & 0xFFFFu;
+		const uint64 Topology = static_cast<uint64>(Batch.PrimitiveTopology) & 0xFu;
+
+		if (Mode == EMeshSortMode::Translucent)
+		{
+			return ((~Depth & 0xFFFFu) << 48) | (Shader << 36) | (Material << 20) | (Mesh << 4) | Topology;
+		}
+		return (Shader << 52) | (Material << 36) | (Mesh << 20) | (Topology << 16) | Depth;
+	}
+
+	// (키, 인덱스) 쌍의 안정 LSD 기수 정렬. 8개 자릿수의 히스토그램을 한 번의 순회로 모두 만든다.
+	void RadixSortPairs(TArray<FSortPair>& Pairs, TArray<FSortPair>& Temp)
+	{
+		const int32 Count = Pairs.Num();
+		if (Count < 2)
+		{
+			return;
+		}
+
+		uint32 Histograms[8][256] = {};
+		for (const FSortPair& Pair : Pairs)
+		{
+			for (int32 Digit = 0; Digit < 8; ++Digit)
+			{
+				++Histograms[Digit][(Pair.Key >> (Digit * 8)) & 0xFF];
+			}
+		}
+
+		Temp.SetNum(Count);
+		FSortPair* Src = Pairs.GetData();
+		FSortPair* Dst = Temp.GetData();
+
+		for (int32 Digit = 0; Digit < 8; ++Digit)
+		{
+			uint32* Histogram = Histograms[Digit];
+			const uint32 Shift = Digit * 8;
+
+			// 모든 키가 이 자릿수에서 같은 값이면 재배치해도 순서가 바뀌지 않는다
+			if (Histogram[(Src[0].Key >> Shift) & 0xFF] == static_cast<uint32>(Count))
+			{
+				continue;
+			}
+
+			uint32 Offset = 0;
+			for (int32 Bucket = 0; Bucket < 256; ++Bucket)
+			{
+				const uint32 BucketCount = Histogram[Bucket];
+				Histogram[Bucket] = Offset;
+				Offset += BucketCount;
+			}
+
+			for (int32 i = 0; i < Count; ++i)
+			{
+				Dst[Histogram[(Src[i].Key >> Shift) & 0xFF]++] = Src[i];
+			}
+			std::swap(Src, Dst);
+		}
+
+		if (Src != Pairs.GetData())
+		{
+			std::swap(Pairs, Temp);
+		}
+	}
+
+	// 기존 FMeshBatchElement::operator< (포인터 다중 필드 비교)
+	bool LegacyBatchLess(const FMeshBatchElement& A, const FMeshBatchElement& B)
+	{
+		if (A.VertexShader != B.VertexShader) return A.VertexShader < B.VertexShader;
+		if (A.PixelShader != B.PixelShader) return A.PixelShader < B.PixelShader;
+		if (A.Material != B.Material) return A.Material < B.Material;
+		if (A.VertexBuffer != B.VertexBuffer) return A.VertexBuffer < B.VertexBuffer;
+		if (A.IndexBuffer != B.IndexBuffer) return A.IndexBuffer < B.IndexBuffer;
+		if (A.VertexStride != B.VertexStride) return A.VertexStride < B.VertexStride;
+		if (A.PrimitiveTopology != B.PrimitiveTopology) return A.PrimitiveTopology < B.PrimitiveTopology;
+		return false;
+	}
+
+	// DrawMeshBatches와 같은 기준으로 셰이더/머티리얼/정점 버퍼 전환 횟수를 센다
+	int32 CountStateChanges(const TArray<FMeshBatchElement>& Batches)
+	{
+		int32 Changes = 0;
+		const FMeshBatchElement* Prev = nullptr;
+		for (const FMeshBatchElement& Batch : Batches)
+		{
+			if (!Prev || Prev->PixelShader != Batch.PixelShader) ++Changes;
+			if (!Prev || Prev->Material != Batch.Material) ++Changes;
+			if (!Prev || Prev->VertexBuffer != Batch.VertexBuffer) ++Changes;
+			Prev = &Batch;
+		}
+		return Changes;
+	}
+
+	// 가짜 리소스 포인터: 실행마다 달라지는 실제 주소처럼 ID 순서와 무관하게 섞는다
+	template<typename T>
+	T* FakePointer(uint32 Id, uint32 Salt)
+	{
+		uint64 Hash = (static_cast<uint64>(Id) + 1) * 0x9E3779B97F4A7C15ull ^ Salt;
+		return reinterpret_cast<T*>(static_cast<uintptr_t>((Hash & 0x0000FFFFFFFFFFF0ull) | 0x10));
+	}
+}
+
+void BuildMeshBatchSortKeys(TArray<FMeshBatchElement>& Batches, const FVector& ViewLocation, EMeshSortMode Mode)
+{
+	for (FMeshBatchElement& Batch : Batches)
+	{
+		Batch.SortKey = MakeSortKey(Batch, QuantizeDepth(Batch, ViewLocation), Mode);
+	}
+}
+
+void SortMeshBatches(TArray<FMeshBatchElement>& Batches, const FVector& ViewLocation, EMeshSortMode Mode)
+{
+	const int32 Count = Batches.Num();
+	if (Count < 2)
+	{
+		if (Count == 1)
+		{
+			BuildMeshBatchSortKeys(Batches, ViewLocation, Mode);
+		}
+		return;
+	}
+
+	GSortPairs.SetNum(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		FMeshBatchElement& Batch = Batches[i];
+		Batch.SortKey = MakeSortKey(Batch, QuantizeDepth(Batch, ViewLocation), Mode);
+		GSortPairs[i] = FSortPair{ Batch.SortKey, static_cast<uint32>(i) };
+	}
+
+	RadixSortPairs(GSortPairs, GSortPairsTemp);
+
+	// 이미 정렬된 경우(정적인 장면에서 흔함) 재배치 생략
+	bool bAlreadySorted = true;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		if (GSortPairs[i].Index != static_cast<uint32>(i))
+		{
+			bAlreadySorted = false;
+			break;
+		}
+	}
+	if (bAlreadySorted)
+	{
+		return;
+	}
+
+	GSortedBatches.clear();
+	GSortedBatches.reserve(Count);
+	for (const FSortPair& Pair : GSortPairs)
+	{
+		GSortedBatches.Add(std::move(Batches[Pair.Index]));
+	}
+	std::swap(Batches, GSortedBatches);
+}
+
+FMeshBatchSortBenchmarkResult RunMeshBatchSortBenchmark(int32 NumBatches, int32 NumIterations)
+{
+	FMeshBatchSortBenchmarkResult Result;
+	if (NumBatches <= 0 || NumIterations <= 0)
+	{
+		return Result;
+	}
+
+	// 셰이더 8종, 머티리얼 64종, 메시 128종의 무작위 조합으로 가짜 배치를 만든다
+	constexpr uint32 NumShaders = 8;
+	constexpr uint32 NumMaterials = 64;
+	constexpr uint32 NumMeshes = 128;
+
+	TArray<FMeshBatchElement> Source;
+	Source.SetNum(NumBatches);
+	uint32 Seed = 1;
+	auto NextRandom = [&Seed]()
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return Seed >> 8;
+	};
+	for (FMeshBatchElement& Batch : Source)
+	{
+		const uint32 Shader = NextRandom() % NumShaders;
+		const uint32 Material = NextRandom() % NumMaterials;
+		const uint32 Mesh = NextRandom() % NumMeshes;
+
+		Batch.VertexShader = FakePointer<ID3D11VertexShader>(Shader, 0x11);
+		Batch.PixelShader = FakePointer<ID3D11PixelShader>(Shader, 0x22);
+		Batch.Material = FakePointer<UMaterialInterface>(Material, 0x33);
+		Batch.VertexBuffer = FakePointer<ID3D11Buffer>(Mesh, 0x44);
+		Batch.IndexBuffer = FakePointer<ID3D11Buffer>(Mesh, 0x55);
+		Batch.ShaderSortId = Shader + 1;
+		Batch.MaterialSortId = Material + 1;
+		Batch.MeshSortId = Mesh + 1;
+		Batch.WorldMatrix = FMatrix::Identity();
+		Batch.WorldMatrix.M[3][0] = static_cast<float>(NextRandom() % 2000) - 1000.0f;
+		Batch.WorldMatrix.M[3][1] = static_cast<float>(NextRandom() % 2000) - 1000.0f;
+		Batch.WorldMatrix.M[3][2] = static_cast<float>(NextRandom() % 200);
+	}
+
+	const FVector ViewLocation(0.0f, 0.0f, 50.0f);
+	TArray<FMeshBatchElement> Work;
+
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		// 1. 기존 방식
+		Work = Source;
+		uint64 Start = FPlatformTime::Cycles64();
+		std::sort(Work.begin(), Work.end(), LegacyBatchLess);
+		Result.LegacySortMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		if (Iteration == NumIterations - 1)
+		{
+			Result.LegacyStateChanges = CountStateChanges(Work);
+		}
+
+		// 2. 키 생성만
+		Work = Source;
+		Start = FPlatformTime::Cycles64();
+		BuildMeshBatchSortKeys(Work, ViewLocation, EMeshSortMode::Opaque);
+		Result.KeyBuildMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		// 3. 키 생성 + 비교 정렬
+		Work = Source;
+		Start = FPlatformTime::Cycles64();
+		BuildMeshBatchSortKeys(Work, ViewLocation, EMeshSortMode::Opaque);
+		std::stable_sort(Work.begin(), Work.end());
+		Result.KeyComparisonSortMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		// 4. 키 생성 + 기수 정렬
+		Work = Source;
+		Start = FPlatformTime::Cycles64();
+		SortMeshBatches(Work, ViewLocation, EMeshSortMode::Opaque);
+		Result.RadixSortMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		if (Iteration == NumIterations - 1)
+		{
+			Result.RadixStateChanges = CountStateChanges(Work);
+		}
+	}
+
+	// 반투명 레이아웃도 한 번 돌려 뒤 -> 앞 순서가 나오는지 확인 (실패 시 로그)
+	Work = Source;
+	SortMeshBatches(Work, ViewLocation, EMeshSortMode::Translucent);
+	for (int32 i = 1; i < Work.Num(); ++i)
+	{
+		if (QuantizeDepth(Work[i - 1], ViewLocation) < QuantizeDepth(Work[i], ViewLocation))
+		{
+			UE_LOG("MeshBatchSort: translucent order violated at %d", i);
+			break;
+		}
+	}
+
+	return Result;
+}
@@ -0,0 +1,37 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+
+struct FMeshBatchElement;
+
+// 메시 배치 정렬 방식
+enum class EMeshSortMode : uint8
+{
+	Opaque,			// 상태(셰이더 > 머티리얼 > 메시) 우선, 같은 상태 안에서는 앞 -> 뒤
+	Translucent,	// 깊이 우선 (뒤 -> 앞), 같은 깊이 안에서는 상태 순
+};
+
+// 64비트 정렬 키 레이아웃 (상위 비트부터)
+//  Opaque      : Shader 12 | Material 16 | Mesh 16 | Topology 4 | Depth 16
+//  Translucent : ~Depth 16 | Shader 12 | Material 16 | Mesh 16 | Topology 4
+// ID는 에셋별로 1부터 조밀하게 발급된다(FShaderVariant::SortId, UResourceBase::GetSortId).
+// 비트 폭을 넘으면 발급 시 경고하고 잘라 쓰므로 서로 다른 상태가 섞일 수 있지만, 정렬 순서만 달라질 뿐 결과는 항상 올바르다.
+// Depth는 카메라-오브젝트 원점 거리 제곱(float)의 상위 16비트로, 양수 float의 비트 순서가 크기 순서와 같다는 점을 이용한다.
+void BuildMeshBatchSortKeys(TArray<FMeshBatchElement>& Batches, const FVector& ViewLocation, EMeshSortMode Mode);
+
+// 키를 만들고 (키, 인덱스) 쌍을 LSD 기수 정렬(8비트 x 최대 8패스, 안정 정렬)한 뒤 배치를 한 번만 재배치한다.
+// 모든 원소가 같은 값을 갖는 자릿수는 패스를 건너뛴다.
+void SortMeshBatches(TArray<FMeshBatchElement>& Batches, const FVector& ViewLocation, EMeshSortMode Mode);
+
+// 디바이스 없이 정렬 비용과 상태 전환 횟수를 측정한다 (기존 포인터 비교 정렬 vs 키 기수 정렬)
+struct FMeshBatchSortBenchmarkResult
+{
+	double LegacySortMs = 0.0;		// 포인터 다중 필드 비교 + std::sort
+	double KeyBuildMs = 0.0;		// 키 생성만
+	double KeyComparisonSortMs = 0.0;	// 키 생성 + std::stable_sort(키)
+	double RadixSortMs = 0.0;		// 키 생성 + 기수 정렬 + 재배치
+	int32 LegacyStateChanges = 0;	// 마지막 반복 결과 기준 셰이더/머티리얼/버퍼 전환 횟수
+	int32 RadixStateChanges = 0;
+};
+
+FMeshBatchSortBenchmarkResult RunMeshBatchSortBenchmark(int32 NumBatches, int32 NumIterations);
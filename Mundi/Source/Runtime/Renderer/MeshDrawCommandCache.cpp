@@ -0,0 +1,104 @@
+﻿#include "pch.h"
+#include "MeshDrawCommandCache.h"
+
+namespace
+{
+	// 0은 "아직 만들어진 적 없음"으로 쓰므로 1부터 시작
+	uint32 GMeshDrawCommandGeneration = 1;
+}
+
+void FMeshDrawCommandCache::InvalidateAll()
+{
+	++GMeshDrawCommandGeneration;
+}
+
+uint32 FMeshDrawCommandCache::GetGlobalGeneration()
+{
+	return GMeshDrawCommandGeneration;
+}
+
+bool FMeshDrawCommandCache::ValidateShared(const TArray<UMaterialInterface*>& MaterialSlots)
+{
+	if (CachedGeneration == GMeshDrawCommandGeneration && CachedMaterialSlots == MaterialSlots)
+	{
+		return true;
+	}
+
+	// 에디터의 프로퍼티 창은 MaterialSlots를 직접 수정하므로 SetMaterial 경로만 믿지 않고 매번 비교한다
+	Entries.Empty();
+	CachedMaterialSlots = MaterialSlots;
+	CachedGeneration = GMeshDrawCommandGeneration;
+	return false;
+}
+
+TArray<FMeshBatchElement>* FMeshDrawCommandCache::Find(const FMeshDrawCommandCacheKey& Key, const TArray<UMaterialInterface*>& MaterialSlots)
+{
+	if (!ValidateShared(MaterialSlots))
+	{
+		return nullptr;
+	}
+
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.Key == Key)
+		{
+			Entry.LastUsed = ++UseCounter;
+			return &Entry.Commands;
+		}
+	}
+	return nullptr;
+}
+
+TArray<FMeshBatchElement>& FMeshDrawCommandCache::Add(const FMeshDrawCommandCacheKey& Key, const TArray<UMaterialInterface*>& MaterialSlots)
+{
+	ValidateShared(MaterialSlots);
+
+	FEntry* Target = nullptr;
+	for (FEntry& Entry : Entries)
+	{
+		// 같은 뷰 매크로 조합인데 키가 달랐다면 메시/버퍼가 교체된 것이므로 그 자리를 재사용한다
+		if (Entry.Key.ViewMacroKey == Key.ViewMacroKey)
+		{
+			Target = &Entry;
+			break;
+		}
+	}
+
+	if (!Target)
+	{
+		if (Entries.Num() < MaxViewEntries)
+		{
+			Target = &Entries.emplace_back();
+		}
+		else
+		{
+			Target = &*std::min_element(Entries.begin(), Entries.end(),
+				[](const FEntry& A, const FEntry& B) { return A.LastUsed < B.LastUsed; });
+		}
+	}
+
+	Target->Key = Key;
+	Target->LastUsed = ++UseCounter;
+	Target->Commands.clear();
+	return Target->Commands;
+}
+
+void FMeshDrawCommandCache::Invalidate()
+{
+	Entries.Empty();
+	CachedMaterialSlots.Empty();
+	CachedGeneration = 0;
+	bTransformDirty = false;
+}
+
+void FMeshDrawCommandCache::UpdateWorldMatrix(const FMatrix& WorldMatrix)
+{
+	for (FEntry& Entry : Entries)
+	{
+		for (FMeshBatchElement& Command : Entry.Commands)
+		{
+			Command.WorldMatrix = WorldMatrix;
+		}
+	}
+	bTransformDirty = false;
+}
@@ -0,0 +1,67 @@
+﻿#pragma once
+#include "MeshBatchElement.h"
+
+class UObject;
+class UMaterialInterface;
+
+// 캐시된 드로우 커맨드가 유효한지 판단하는 키. 하나라도 바뀌면 해당 뷰 엔트리를 다시 만든다.
+struct FMeshDrawCommandCacheKey
+{
+	const UObject* Mesh = nullptr;
+	ID3D11Buffer* VertexBuffer = nullptr;	// 메시 리로드/CPU 스키닝 버퍼 교체 감지
+	ID3D11Buffer* IndexBuffer = nullptr;
+	uint32 ViewMacroKey = 0;				// FSceneView::ViewPermutationId (뷰 모드, 그림자 AA 등)
+
+	bool operator==(const FMeshDrawCommandCacheKey& Other) const
+	{
+		return Mesh == Other.Mesh && VertexBuffer == Other.VertexBuffer
+			&& IndexBuffer == Other.IndexBuffer && ViewMacroKey == Other.ViewMacroKey;
+	}
+};
+
+/**
+ * @brief 메시 컴포넌트별로 유지되는 드로우 커맨드(FMeshBatchElement) 캐시
+ * 머티리얼/셰이더 결정, 매크로 결합, 셰이더 Variant 해시 조회는 캐시를 다시 만들 때만 수행하고
+ * 매 프레임에는 캐시된 커맨드를 그대로 수집한다.
+ * - 메시, 버퍼, 뷰 매크로 조합이 바뀌면 해당 뷰 엔트리만 재구성 (멀티 뷰포트용으로 최대 MaxViewEntries개 유지)
+ * - 머티리얼 슬롯이 바뀌거나 전역 세대(셰이더 핫 리로드, 머티리얼 셰이더 변경)가 바뀌면 전체 폐기
+ * - 트랜스폼만 바뀐 경우에는 WorldMatrix만 갱신
+ */
+class FMeshDrawCommandCache
+{
+public:
+	// 키와 머티리얼 슬롯이 일치하는 커맨드 목록. 없으면 nullptr
+	TArray<FMeshBatchElement>* Find(const FMeshDrawCommandCacheKey& Key, const TArray<UMaterialInterface*>& MaterialSlots);
+
+	// 새 엔트리를 만들어 비어 있는 커맨드 목록을 반환한다. (호출자가 채움)
+	TArray<FMeshBatchElement>& Add(const FMeshDrawCommandCacheKey& Key, const TArray<UMaterialInterface*>& MaterialSlots);
+
+	void Invalidate();
+
+	void MarkTransformDirty() { bTransformDirty = true; }
+	bool IsTransformDirty() const { return bTransformDirty && !Entries.IsEmpty(); }
+	// 모든 엔트리의 WorldMatrix를 갱신하고 dirty 해제
+	void UpdateWorldMatrix(const FMatrix& WorldMatrix);
+
+	// 셰이더 리소스가 교체되는 등 모든 컴포넌트의 캐시를 버려야 할 때 호출
+	static void InvalidateAll();
+	static uint32 GetGlobalGeneration();
+
+private:
+	struct FEntry
+	{
+		FMeshDrawCommandCacheKey Key;
+		uint64 LastUsed = 0;
+		TArray<FMeshBatchElement> Commands;
+	};
+
+	bool ValidateShared(const TArray<UMaterialInterface*>& MaterialSlots);
+
+	static constexpr int32 MaxViewEntries = 4;
+
+	TArray<FEntry> Entries;
+	TArray<UMaterialInterface*> CachedMaterialSlots;
+	uint32 CachedGeneration = 0;
+	uint64 UseCounter = 0;
+	bool bTransformDirty = false;
+};
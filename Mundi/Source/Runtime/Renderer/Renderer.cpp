@@ -28,6 +28,7 @@
 #include "RenderSettings.h"
 #include "EditorEngine.h"
 #include "DecalComponent.h"
+#include "DebugDrawManager.h"
 #include "DecalStatManager.h"
 #include "SceneRenderer.h"
 #include "SceneView.h"
@@ -275,28 +276,44 @@ void URenderer::AddLines(const TArray<FVector>& StartPoints, const TArray<FVecto
 	}
 }
 
-void URenderer::EndLineBatch(const FMatrix& ModelMatrix)
+void URenderer::AddLines(const FDebugLineBuffer& Lines)
 {
-	if (!bLineBatchActive || !LineBatchData || !DynamicLineMesh || LineBatchData->Vertices.empty())
-	{
-		bLineBatchActive = false;
-		return;
-	}
+	if (!bLineBatchActive || !LineBatchData || Lines.IsEmpty()) return;
 
-	// Clamp to GPU buffer capacity to avoid full drop when overflowing
-	const uint32 totalLines = static_cast<uint32>(LineBatchData->Indices.size() / 2);
-	if (totalLines > MAX_LINES)
+	const size_t newVertexCount = LineBatchData->Vertices.size() + static_cast<size_t>(Lines.Num()) * 2;
+	LineBatchData->Vertices.reserve(newVertexCount);
+	LineBatchData->Color.reserve(newVertexCount);
+	LineBatchData->Indices.reserve(newVertexCount);
+
+	Lines.ForEachChunk([this](const FVector* Starts, const FVector* Ends, const FVector4* Colors, int32 Count)
 	{
-		const uint32 clampedLines = MAX_LINES;
-		const uint32 clampedVerts = clampedLines * 2;
-		const uint32 clampedIndices = clampedLines * 2;
-		LineBatchData->Vertices.resize(clampedVerts);
-		LineBatchData->Color.resize(clampedVerts);
-		LineBatchData->Indices.resize(clampedIndices);
-	}
+		uint32 currentIndex = static_cast<uint32>(LineBatchData->Vertices.size());
+		for (int32 i = 0; i < Count; ++i)
+		{
+			LineBatchData->Vertices.push_back(Starts[i]);
+			LineBatchData->Vertices.push_back(Ends[i]);
+			LineBatchData->Color.push_back(Colors[i]);
+			LineBatchData->Color.push_back(Colors[i]);
+			LineBatchData->Indices.push_back(currentIndex);
+			LineBatchData->Indices.push_back(currentIndex + 1);
+			currentIndex += 2;
+		}
+	});
+}
+
+void URenderer::EndLineBatch(const FMatrix& ModelMatrix)
+{
+	FlushLineBatch(ModelMatrix, false);
+}
+
+void URenderer::EndLineBatchAlwaysOnTop(const FMatrix& ModelMatrix)
+{
+	FlushLineBatch(ModelMatrix, true);
+}
 
-	// Efficiently update dynamic mesh data (no buffer recreation!)
-	if (!DynamicLineMesh->UpdateData(LineBatchData, RHIDevice->GetDeviceContext()))
+void URenderer::FlushLineBatch(const FMatrix& ModelMatrix, bool bAlwaysOnTop)
+{
+	if (!bLineBatchActive || !LineBatchData || !DynamicLineMesh || LineBatchData->Vertices.empty())
 	{
 		bLineBatchActive = false;
 		return;
@@ -307,80 +324,47 @@ void URenderer::EndLineBatch(const FMatrix& ModelMatrix)
 	RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(ModelMatrix, ModelInvTranspose));
 	RHIDevice->PrepareShader(LineShader);
 
-	// Render using dynamic mesh
-	if (DynamicLineMesh->GetCurrentVertexCount() > 0 && DynamicLineMesh->GetCurrentIndexCount() > 0)
-	{
-		UINT stride = sizeof(FVertexSimple);
-		UINT offset = 0;
+	UINT stride = sizeof(FVertexSimple);
+	UINT offset = 0;
+	ID3D11Buffer* vertexBuffer = DynamicLineMesh->GetVertexBuffer();
+	ID3D11Buffer* indexBuffer = DynamicLineMesh->GetIndexBuffer();
 
-		ID3D11Buffer* vertexBuffer = DynamicLineMesh->GetVertexBuffer();
-		ID3D11Buffer* indexBuffer = DynamicLineMesh->GetIndexBuffer();
-
-		RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &vertexBuffer, &stride, &offset);
-		RHIDevice->GetDeviceContext()->IASetIndexBuffer(indexBuffer, DXGI_FORMAT_R32_UINT, 0);
-		RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+	RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &vertexBuffer, &stride, &offset);
+	RHIDevice->GetDeviceContext()->IASetIndexBuffer(indexBuffer, DXGI_FORMAT_R32_UINT, 0);
+	RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+	if (bAlwaysOnTop)
+	{
+		// Disable depth test so lines render on top
+		RHIDevice->OMSetDepthStencilState(EComparisonFunc::Disable);
+		RHIDevice->OMSetBlendState(true);
+	}
+	else
+	{
 		// Overlay 스텐실(=1) 영역은 그리지 않도록 스텐실 테스트 설정
 		RHIDevice->OMSetDepthStencilState_StencilRejectOverlay();
+	}
+
+	// AddLine 계열은 항상 (2i, 2i+1) 정점 쌍으로 쌓으므로 선 단위로 잘라 GPU 버퍼 용량만큼씩 나눠 그린다
+	const uint32 totalLines = static_cast<uint32>(LineBatchData->Indices.size() / 2);
+	for (uint32 firstLine = 0; firstLine < totalLines; firstLine += MAX_LINES)
+	{
+		const uint32 lineCount = std::min(MAX_LINES, totalLines - firstLine);
+		if (!DynamicLineMesh->UpdateDataRange(LineBatchData, firstLine * 2, lineCount * 2, firstLine * 2, lineCount * 2, RHIDevice->GetDeviceContext()))
+		{
+			break;
+		}
 		RHIDevice->GetDeviceContext()->DrawIndexed(DynamicLineMesh->GetCurrentIndexCount(), 0, 0);
-		// 상태 복구
-		RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 	}
 
-	bLineBatchActive = false;
-}
+	// 상태 복구
+	if (bAlwaysOnTop)
+	{
+		RHIDevice->OMSetBlendState(false);
+	}
+	RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 
-void URenderer::EndLineBatchAlwaysOnTop(const FMatrix& ModelMatrix)
-{
-    if (!bLineBatchActive || !LineBatchData || !DynamicLineMesh || LineBatchData->Vertices.empty())
-    {
-        bLineBatchActive = false;
-        return;
-    }
-
-    const uint32 totalLines = static_cast<uint32>(LineBatchData->Indices.size() / 2);
-    if (totalLines > MAX_LINES)
-    {
-        const uint32 clampedLines = MAX_LINES;
-        const uint32 clampedVerts = clampedLines * 2;
-        const uint32 clampedIndices = clampedLines * 2;
-        LineBatchData->Vertices.resize(clampedVerts);
-        LineBatchData->Color.resize(clampedVerts);
-        LineBatchData->Indices.resize(clampedIndices);
-    }
-
-    if (!DynamicLineMesh->UpdateData(LineBatchData, RHIDevice->GetDeviceContext()))
-    {
-        bLineBatchActive = false;
-        return;
-    }
-
-    FMatrix ModelInvTranspose = ModelMatrix.InverseAffine().Transpose();
-    RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(ModelMatrix, ModelInvTranspose));
-    RHIDevice->PrepareShader(LineShader);
-
-    if (DynamicLineMesh->GetCurrentVertexCount() > 0 && DynamicLineMesh->GetCurrentIndexCount() > 0)
-    {
-        UINT stride = sizeof(FVertexSimple);
-        UINT offset = 0;
-        ID3D11Buffer* vertexBuffer = DynamicLineMesh->GetVertexBuffer();
-        ID3D11Buffer* indexBuffer = DynamicLineMesh->GetIndexBuffer();
-
-        RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &vertexBuffer, &stride, &offset);
-        RHIDevice->GetDeviceContext()->IASetIndexBuffer(indexBuffer, DXGI_FORMAT_R32_UINT, 0);
-        RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
-
-        // Disable depth test so lines render on top
-        RHIDevice->OMSetDepthStencilState(EComparisonFunc::Disable);
-        RHIDevice->OMSetBlendState(true);
-        RHIDevice->GetDeviceContext()->DrawIndexed(DynamicLineMesh->GetCurrentIndexCount(), 0, 0);
-        // Restore state
-        RHIDevice->OMSetBlendState(false);
-        RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
-    }
-
-    bLineBatchActive = false;
+	bLineBatchActive = false;
 }
 
 void URenderer::ClearLineBatch()
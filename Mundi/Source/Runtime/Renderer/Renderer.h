@@ -15,6 +15,7 @@ class FSceneView;
 class FGPUTimer;
 
 struct FMaterialSlot;
+class FDebugLineBuffer;
 
 class URenderer
 {
@@ -41,6 +42,7 @@ public:
 	void AddLines(const TArray<FVector>& Lines, const FVector4& Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f));
 	void AddLinesRange(const TArray<FVector>& Lines,int startIdx, int Count, const FVector4& Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f));
 	void AddLines(const TArray<FVector>& StartPoints, const TArray<FVector>& EndPoints, const TArray<FVector4>& Colors);
+	void AddLines(const FDebugLineBuffer& Lines);
 	void EndLineBatch(const FMatrix& ModelMatrix);
 	void EndLineBatchAlwaysOnTop(const FMatrix& ModelMatrix);
 	void ClearLineBatch();
@@ -65,9 +67,10 @@ private:
 	FMeshData* LineBatchData = nullptr;
 	UShader* LineShader = nullptr;
 	bool bLineBatchActive = false;
-	static const uint32 MAX_LINES = 200000;  // Maximum lines per batch (safety headroom)
+	static const uint32 MAX_LINES = 200000;  // GPU 버퍼 한 번에 올릴 수 있는 선 개수 (넘치면 여러 번 나눠 그린다)
 
 	void InitializeLineBatch();
+	void FlushLineBatch(const FMatrix& ModelMatrix, bool bAlwaysOnTop);
 
 	// 이전 drawCall에서 이미 썼던 RnderState면, 다시 Set 하지 않기 위해 만든 변수들
 	EViewMode PreViewModeIndex = EViewMode::VMI_Wireframe; // RSSetState, UpdateColorConstantBuffers
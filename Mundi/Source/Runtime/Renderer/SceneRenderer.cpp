@@ -37,6 +37,7 @@
 #include "SpotLightComponent.h"
 #include "SwapGuard.h"
 #include "MeshBatchElement.h"
+#include "MeshBatchSort.h"
 #include "SceneView.h"
 #include "Shader.h"
 #include "ResourceManager.h"
@@ -50,6 +51,7 @@
 #include "PostProcessing/VignettePass.h"
 #include "FbxLoader.h"
 #include "SkinnedMeshComponent.h"
+#include "DebugDrawManager.h"
 
 FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer)
 	: World(InWorld)
@@ -79,6 +81,8 @@ void FSceneRenderer::Render()
 {
     if (!IsValid()) return;
 
+	TIME_PROFILE(SceneRender)
+
 	/*static bool Loaded = false;
 	if (!Loaded)
 	{
@@ -471,18 +475,17 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	UShader* DepthVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_VS.hlsl");
 	if (!DepthVS || !DepthVS->GetVertexShader()) return;
 
-	FShaderVariant* ShaderVariant = DepthVS->GetOrCompileShaderVariant();
+	FShaderVariant* ShaderVariant = DepthVS->GetOrCompileShaderVariant(FShaderPermutationId(0));
 	if (!ShaderVariant) return;
 
-	TArray<FShaderMacro> ShaderMacros({{"GPU_SKINNING", "1"}});
-	FShaderVariant* SkinningShaderVariant = DepthVS->GetOrCompileShaderVariant(ShaderMacros);
+	FShaderVariant* SkinningShaderVariant = DepthVS->GetOrCompileShaderVariant(FShaderPermutation::WithGPUSkinning(0, true));
 	if (!SkinningShaderVariant) return;
 
 	// vsm용 픽셀 셰이더
 	UShader* DepthPs = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_PS.hlsl");
 	if (!DepthPs || !DepthPs->GetPixelShader()) return;
 
-	FShaderVariant* ShaderVarianVSM = DepthPs->GetOrCompileShaderVariant();
+	FShaderVariant* ShaderVarianVSM = DepthPs->GetOrCompileShaderVariant(FShaderPermutationId(0));
 	if (!ShaderVarianVSM) return;
 
 	// 2. 파이프라인 설정
@@ -929,8 +932,9 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 	}
 
 	// --- 2. 정렬 (Sort) ---
-	SkinnedMeshBatchElements.Sort();
-	MeshBatchElements.Sort();
+	// 상태 키(셰이더 > 머티리얼 > 메시) + 앞 -> 뒤 깊이로 64비트 키를 만들어 기수 정렬
+	SortMeshBatches(SkinnedMeshBatchElements, View->ViewLocation, EMeshSortMode::Opaque);
+	SortMeshBatches(MeshBatchElements, View->ViewLocation, EMeshSortMode::Opaque);
 
 	// --- 3. 그리기 (Draw) ---
 	{
@@ -966,8 +970,8 @@ void FSceneRenderer::RenderDecalPass()
 	FString ShaderPath = "Shaders/Effects/Decal.hlsl";
 
 	// ViewMode에 따른 Decal 셰이더 로드
-	UShader* DecalShader = UResourceManager::GetInstance().Load<UShader>(ShaderPath, View->ViewShaderMacros);
-	FShaderVariant* ShaderVariant = DecalShader->GetOrCompileShaderVariant(View->ViewShaderMacros);
+	UShader* DecalShader = UResourceManager::GetInstance().Load<UShader>(ShaderPath);
+	FShaderVariant* ShaderVariant = DecalShader ? DecalShader->GetOrCompileShaderVariant(View->ViewPermutationId) : nullptr;
 	if (!DecalShader || !ShaderVariant)
 	{
 		UE_LOG("RenderDecalPass: Failed to load Decal shader with ViewMode macros!");
@@ -979,24 +983,66 @@ void FSceneRenderer::RenderDecalPass()
 	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly); // 깊이 쓰기 OFF
 	RHIDevice->OMSetBlendState(true);
 
+	// 1. 텍스처/머티리얼이 같은 데칼끼리 연속해서 그리도록 정렬 (SRV, 머티리얼 바인딩 변경 최소화)
+	TArray<UDecalComponent*> SortedDecals;
+	SortedDecals.reserve(Proxies.Decals.Num());
 	for (UDecalComponent* Decal : Proxies.Decals)
 	{
-		if (!Decal || !Decal->GetDecalTexture())
+		if (Decal && Decal->GetDecalTexture())
+		{
+			SortedDecals.Add(Decal);
+		}
+	}
+	std::stable_sort(SortedDecals.begin(), SortedDecals.end(), [](UDecalComponent* A, UDecalComponent* B)
+	{
+		if (A->GetDecalTexture() != B->GetDecalTexture())
+			return A->GetDecalTexture() < B->GetDecalTexture();
+		return A->GetMaterial(0) < B->GetMaterial(0);
+	});
+
+	// 2. 리시버 캐시 검증: 데칼이 움직였거나 데칼 영역에 BVH 변경이 있으면 다시 쿼리
+	TArray<UDecalComponent*> StaleDecals;
+	TArray<FOBB> StaleDecalOBBs;
+	for (UDecalComponent* Decal : SortedDecals)
+	{
+		FDecalReceiverCache& Cache = Decal->GetReceiverCache();
+		const FMatrix DecalWorldMatrix = Decal->GetWorldMatrix();
+		if (Cache.bValid && Cache.BVH == BVH && Cache.DecalWorldMatrix == DecalWorldMatrix &&
+			!BVH->HasChangesInRegion(Cache.DecalBounds, Cache.Revision))
 		{
 			continue;
 		}
 
-		// Decal이 그려질 Primitives
-		TArray<UPrimitiveComponent*> TargetPrimitives;
+		Cache.BVH = BVH;
+		Cache.DecalWorldMatrix = DecalWorldMatrix;
+		Cache.DecalBounds = Decal->GetWorldAABB();
+		StaleDecals.Add(Decal);
+		StaleDecalOBBs.Add(Decal->GetWorldOBB());
+	}
 
-		// 1. Decal의 World AABB와 충돌한 모든 StaticMeshComponent 쿼리
-		const FOBB DecalOBB = Decal->GetWorldOBB();
-		TArray<UPrimitiveComponent*> IntersectedStaticMeshComponents = BVH->QueryIntersectedComponents(DecalOBB);
+	// 3. 캐시가 깨진 데칼은 한 번의 BVH 순회로 모아서 갱신
+	if (!StaleDecals.IsEmpty())
+	{
+		TArray<TArray<UPrimitiveComponent*>> QueryResults;
+		BVH->QueryIntersectedComponentsBatch(StaleDecalOBBs, QueryResults);
+		const uint64 Revision = BVH->GetChangeRevision();
+		for (int32 i = 0; i < StaleDecals.Num(); ++i)
+		{
+			FDecalReceiverCache& Cache = StaleDecals[i]->GetReceiverCache();
+			Cache.Receivers = std::move(QueryResults[i]);
+			Cache.Revision = Revision;
+			Cache.bValid = true;
+		}
+	}
 
-		// 2. 충돌한 모든 visible Actor의 PrimitiveComponent를 TargetPrimitives에 추가
+	TArray<UPrimitiveComponent*> TargetPrimitives;
+	for (UDecalComponent* Decal : SortedDecals)
+	{
+		// 4. 캐시된 리시버 중 이번 프레임에 보이는 것만 대상으로 (가시성은 BVH 변경을 일으키지 않으므로 매 프레임 확인)
 		// Actor에 기본으로 붙어있는 TextRenderComponent, BoundingBoxComponent는 decal 적용 안되게 하기 위해,
 		// 임시로 PrimitiveComponent가 아닌 UStaticMeshComponent를 받도록 함
-		for (UPrimitiveComponent* SMC : IntersectedStaticMeshComponents)
+		TargetPrimitives.Empty();
+		for (UPrimitiveComponent* SMC : Decal->GetReceiverCache().Receivers)
 		{
 			// 기즈모에 데칼 입히면 안되므로 에디팅이 안되는 Component는 데칼 그리지 않음
 			if (!SMC || !SMC->IsEditable())
@@ -1017,7 +1063,7 @@ void FSceneRenderer::RenderDecalPass()
 		const FMatrix DecalMatrix = Decal->GetDecalProjectionMatrix();
 		RHIDevice->SetAndUpdateConstantBuffer(DecalBufferType(DecalMatrix, Decal->GetOpacity()));
 
-		// 3. TargetPrimitive 순회하며 수집 후 렌더링
+		// 5. TargetPrimitive 순회하며 수집 후 렌더링
 		MeshBatchElements.Empty();
 		for (UPrimitiveComponent* Target : TargetPrimitives)
 		{
@@ -1259,6 +1305,7 @@ void FSceneRenderer::RenderDebugPass()
 
 		LineComponent->CollectLineBatches(OwnerRenderer);
 	}
+	FDebugDrawManager::GetInstance().CollectLines(World, OwnerRenderer, true);
 	OwnerRenderer->EndLineBatchAlwaysOnTop(FMatrix::Identity());
 
 	// Start a new batch for debug volumes (lights, shapes, etc.)
@@ -1284,8 +1331,55 @@ void FSceneRenderer::RenderDebugPass()
 		}
 	}
 
+	// 게임플레이/Lua에서 제출한 디버그 도형
+	FDebugDrawManager::GetInstance().CollectLines(World, OwnerRenderer, false);
+
 	// 수집된 라인을 출력하고 정리
 	OwnerRenderer->EndLineBatch(FMatrix::Identity());
+
+	RenderDebugTextAnchors();
+}
+
+void FSceneRenderer::RenderDebugTextAnchors()
+{
+	// ImGui 프레임 밖에서는 드로우 리스트가 다음 NewFrame에 버려지므로 그리지 않는다
+	ImGuiContext* Context = ImGui::GetCurrentContext();
+	if (!Context || !Context->WithinFrameScope)
+	{
+		return;
+	}
+
+	TArray<FDebugTextAnchor> Anchors;
+	FDebugDrawManager::GetInstance().CollectTextAnchors(World, Anchors);
+	if (Anchors.IsEmpty())
+	{
+		return;
+	}
+
+	const FMatrix ViewProj = View->ViewMatrix * View->ProjectionMatrix;
+	const float RectX = static_cast<float>(View->ViewRect.MinX);
+	const float RectY = static_cast<float>(View->ViewRect.MinY);
+	const float RectW = static_cast<float>(View->ViewRect.Width());
+	const float RectH = static_cast<float>(View->ViewRect.Height());
+
+	ImDrawList* DrawList = ImGui::GetForegroundDrawList();
+	DrawList->PushClipRect(ImVec2(RectX, RectY), ImVec2(RectX + RectW, RectY + RectH), true);
+	for (const FDebugTextAnchor& Anchor : Anchors)
+	{
+		// 행벡터 규약: clip = p * VP
+		const FVector4 Clip = FVector4(Anchor.Location.X, Anchor.Location.Y, Anchor.Location.Z, 1.0f) * ViewProj;
+		if (Clip.W <= KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		const float NdcX = Clip.X / Clip.W;
+		const float NdcY = Clip.Y / Clip.W;
+		const ImVec2 ScreenPos(RectX + (NdcX * 0.5f + 0.5f) * RectW, RectY + (0.5f - NdcY * 0.5f) * RectH);
+		const ImU32 TextColor = ImGui::ColorConvertFloat4ToU32(ImVec4(Anchor.Color.X, Anchor.Color.Y, Anchor.Color.Z, Anchor.Color.W));
+		DrawList->AddText(ScreenPos, TextColor, Anchor.Text.c_str());
+	}
+	DrawList->PopClipRect();
 }
 
 void FSceneRenderer::RenderOverayEditorPrimitivesPass()
@@ -3,6 +3,7 @@
 #include "CameraActor.h"
 #include "FViewport.h"
 #include "Frustum.h"
+#include "Shader.h"
 
 FSceneView::FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InRenderSettings)
 	: RenderSettings(InRenderSettings)
@@ -82,24 +83,24 @@ FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URende
 
 TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
 {
-	TArray<FShaderMacro> ShaderMacros;
+	FShaderPermutation Permutation;
 
 	switch (RenderSettings->GetViewMode())
 	{
 	case EViewMode::VMI_Lit_Phong:
-		ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_PHONG", "1" });
+		Permutation.Lighting = EShaderLightingDim::Phong;
 		break;
 	case EViewMode::VMI_Lit_Gouraud:
-		ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_GOURAUD", "1" });
+		Permutation.Lighting = EShaderLightingDim::Gouraud;
 		break;
 	case EViewMode::VMI_Lit_Lambert:
-		ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_LAMBERT", "1" });
+		Permutation.Lighting = EShaderLightingDim::Lambert;
 		break;
 	case EViewMode::VMI_Unlit:
 		// 매크로 없음 (Unlit)
 		break;
 	case EViewMode::VMI_WorldNormal:
-		ShaderMacros.push_back(FShaderMacro{ "VIEWMODE_WORLD_NORMAL", "1" });
+		Permutation.Lighting = EShaderLightingDim::WorldNormal;
 		break;
 	default:
 		// 셰이더를 강제하지 않는 모드는 여기서 처리 가능
@@ -112,17 +113,19 @@ TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
 		EShadowAATechnique Technique = RenderSettings->GetShadowAATechnique();
 		if (Technique == EShadowAATechnique::PCF)
 		{
-			ShaderMacros.Add(FShaderMacro("SHADOW_AA_TECHNIQUE", "1")); // 1 = PCF
+			Permutation.ShadowAA = EShaderShadowAADim::PCF;
 		}
 		else if (Technique == EShadowAATechnique::VSM)
 		{
-			ShaderMacros.Add(FShaderMacro("SHADOW_AA_TECHNIQUE", "2")); // 2 = VSM
+			Permutation.ShadowAA = EShaderShadowAADim::VSM;
 		}
 	}
 	else
 	{
-		ShaderMacros.Add(FShaderMacro("SHADOW_AA_TECHNIQUE", "0")); // 0 = Hard Shadow (AA 끔)
+		Permutation.ShadowAA = EShaderShadowAADim::Hard; // AA 끔
 	}
 
-	return ShaderMacros;
+	// 매크로 배열과 퍼뮤테이션 ID를 같은 차원 값에서 만들어 둘이 어긋나지 않게 한다
+	ViewPermutationId = Permutation.Encode();
+	return Permutation.ToMacros();
 }
@@ -71,6 +71,7 @@ public:
     // 렌더링 설정
     ECameraProjectionMode ProjectionMode = ECameraProjectionMode::Perspective;
     TArray<FShaderMacro> ViewShaderMacros;
+    FShaderPermutationId ViewPermutationId = 0; // ViewShaderMacros와 같은 조합의 퍼뮤테이션 ID (머티리얼 세트 없음)
     float NearClip = 0.0f;
     float FarClip = 0.0f;
     float FieldOfView = 0.0f;
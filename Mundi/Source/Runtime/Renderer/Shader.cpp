@@ -1,9 +1,108 @@
 ﻿#include "pch.h"
 #include "Shader.h"
 #include "Hash.h"
+#include "MeshDrawCommandCache.h"
+#include "PlatformTime.h"
+#include "NullRHI.h"
 
 IMPLEMENT_CLASS(UShader)
 
+namespace
+{
+	// 머티리얼 매크로 세트 레지스트리 (0번은 빈 세트)
+	TArray<TArray<FShaderMacro>> GShaderMacroSets = { TArray<FShaderMacro>() };
+	TMap<uint64, uint32> GShaderMacroSetByKey;
+}
+
+FShaderPermutation FShaderPermutation::Decode(FShaderPermutationId Id)
+{
+	FShaderPermutation Permutation;
+	Permutation.Lighting = static_cast<EShaderLightingDim>(Id & ((1u << LightingBits) - 1));
+	Permutation.ShadowAA = static_cast<EShaderShadowAADim>((Id >> LightingBits) & ((1u << ShadowAABits) - 1));
+	Permutation.bGPUSkinning = (Id & GPUSkinningBit) != 0;
+	Permutation.MacroSetId = Id >> MacroSetShift;
+	return Permutation;
+}
+
+TArray<FShaderMacro> FShaderPermutation::ToMacros() const
+{
+	TArray<FShaderMacro> Macros;
+
+	switch (Lighting)
+	{
+	case EShaderLightingDim::Phong:
+		Macros.Add(FShaderMacro{ "LIGHTING_MODEL_PHONG", "1" });
+		break;
+	case EShaderLightingDim::Gouraud:
+		Macros.Add(FShaderMacro{ "LIGHTING_MODEL_GOURAUD", "1" });
+		break;
+	case EShaderLightingDim::Lambert:
+		Macros.Add(FShaderMacro{ "LIGHTING_MODEL_LAMBERT", "1" });
+		break;
+	case EShaderLightingDim::WorldNormal:
+		Macros.Add(FShaderMacro{ "VIEWMODE_WORLD_NORMAL", "1" });
+		break;
+	default:
+		break;
+	}
+
+	switch (ShadowAA)
+	{
+	case EShaderShadowAADim::Hard:
+		Macros.Add(FShaderMacro{ "SHADOW_AA_TECHNIQUE", "0" });
+		break;
+	case EShaderShadowAADim::PCF:
+		Macros.Add(FShaderMacro{ "SHADOW_AA_TECHNIQUE", "1" });
+		break;
+	case EShaderShadowAADim::VSM:
+		Macros.Add(FShaderMacro{ "SHADOW_AA_TECHNIQUE", "2" });
+		break;
+	default:
+		break;
+	}
+
+	if (MacroSetId != 0)
+	{
+		Macros.Append(GetMacroSet(MacroSetId));
+	}
+
+	if (bGPUSkinning)
+	{
+		Macros.Add(FShaderMacro{ "GPU_SKINNING", "1" });
+	}
+
+	return Macros;
+}
+
+uint32 FShaderPermutation::RegisterMacroSet(const TArray<FShaderMacro>& InMacros)
+{
+	if (InMacros.IsEmpty())
+	{
+		return 0;
+	}
+
+	// 순서/중복과 무관하게 같은 조합이면 같은 세트로 취급 (Variant 키와 같은 규칙)
+	const uint64 Key = UShader::GenerateShaderKey(InMacros);
+	if (uint32* Found = GShaderMacroSetByKey.Find(Key))
+	{
+		return *Found;
+	}
+
+	const uint32 NewId = static_cast<uint32>(GShaderMacroSets.Num());
+	GShaderMacroSets.Add(InMacros);
+	GShaderMacroSetByKey.Add(Key, NewId);
+	return NewId;
+}
+
+const TArray<FShaderMacro>& FShaderPermutation::GetMacroSet(uint32 MacroSetId)
+{
+	if (MacroSetId >= static_cast<uint32>(GShaderMacroSets.Num()))
+	{
+		return GShaderMacroSets[0];
+	}
+	return GShaderMacroSets[MacroSetId];
+}
+
 // 컴파일 로직을 처리하는 비공개 헬퍼 함수
 static bool CompileShaderInternal(
 	const FWideString& InFilePath,
@@ -14,6 +113,12 @@ static bool CompileShaderInternal(
 	ID3DBlob** OutBlob
 )
 {
+	// Null RHI: HLSL 컴파일러 없이 빈 바이트코드로 대체 (셰이더/입력 레이아웃 생성과 바인딩 경로는 그대로 탄다)
+	if (GEngine.GetRHIDevice()->IsNullRHI())
+	{
+		return SUCCEEDED(NullRHI::CreateBlob(0, OutBlob));
+	}
+
 	ID3DBlob* ErrorBlob = nullptr;
 	HRESULT Hr = D3DCompileFromFile(
 		InFilePath.c_str(),
@@ -50,6 +155,7 @@ static bool CompileShaderInternal(
 UShader::~UShader()
 {
 	ReleaseResources();
+	FMeshDrawCommandCache::InvalidateAll();
 }
 
 uint64 UShader::GenerateShaderKey(const TArray<FShaderMacro>& InMacros)
@@ -175,6 +281,14 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
 		// 4. 맵에 추가하고, 새로 추가된 항목의 포인터(주소)를 반환
 		// TMap::Add()는 추가된 FShaderVariant의 레퍼런스를 포함하는 TPair를 반환합니다.
 		// .Value의 주소를 가져옵니다.
+		static uint32 NextVariantSortId = 1;
+		NewShaderVariant.SortId = NextVariantSortId++;
+		if (NewShaderVariant.SortId == 0x1000)
+		{
+			// 정렬 키의 Shader 필드는 12비트 (MeshBatchSort.h)
+			UE_LOG("[warning] Shader variant sort IDs exceed 12 bits; draw sorting may interleave shaders");
+		}
+
 		ShaderVariantMap.Add(Key, NewShaderVariant);
 		return &ShaderVariantMap[Key];
 	}
@@ -189,6 +303,53 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
 	return nullptr;
 }
 
+FShaderVariant* UShader::GetOrCompileShaderVariant(FShaderPermutationId PermutationId)
+{
+	constexpr uint32 NumLocal = FShaderPermutation::NumLocalPermutations;
+	const uint32 MacroSetId = PermutationId >> FShaderPermutation::MacroSetShift;
+	const uint32 LocalIndex = PermutationId & (NumLocal - 1);
+
+	// 1. 평탄 테이블 조회 (문자열/해시 없음)
+	if (MacroSetId < static_cast<uint32>(MacroSetToLocalSlot.Num()))
+	{
+		const int32 Slot = MacroSetToLocalSlot[MacroSetId];
+		if (Slot >= 0)
+		{
+			if (FShaderVariant* Found = PermutationTable[Slot * NumLocal + LocalIndex])
+			{
+				return Found;
+			}
+		}
+	}
+
+	// 2. 처음 보는 조합: 매크로 배열로 바꿔 기존 경로로 조회/컴파일
+	FShaderVariant* Variant = GetOrCompileShaderVariant(FShaderPermutation::Decode(PermutationId).ToMacros());
+	if (!Variant)
+	{
+		return nullptr;
+	}
+
+	// 3. 테이블에 기록 (ShaderVariantMap은 노드 기반이라 원소 주소가 유지됨)
+	if (MacroSetId >= static_cast<uint32>(MacroSetToLocalSlot.Num()))
+	{
+		MacroSetToLocalSlot.resize(MacroSetId + 1, -1);
+	}
+	int32& Slot = MacroSetToLocalSlot[MacroSetId];
+	if (Slot < 0)
+	{
+		Slot = PermutationTable.Num() / static_cast<int32>(NumLocal);
+		PermutationTable.resize(PermutationTable.Num() + NumLocal, nullptr);
+	}
+	PermutationTable[Slot * NumLocal + LocalIndex] = Variant;
+	return Variant;
+}
+
+void UShader::ResetPermutationTable()
+{
+	MacroSetToLocalSlot.Empty();
+	PermutationTable.Empty();
+}
+
 /**
  * @brief [신규] 실제 컴파일 로직을 수행하는 private 헬퍼 함수입니다.
  * @param InDevice D3D 디바이스
@@ -347,6 +508,7 @@ void UShader::ReleaseResources()
 		Pair.second.Release(); // FShaderVariant::Release() 호출
 	}
 	ShaderVariantMap.Empty();
+	ResetPermutationTable();
 }
 
 bool UShader::IsOutdated() const
@@ -425,6 +587,8 @@ bool UShader::Reload(ID3D11Device* InDevice)
 	// 2. [백업] 현재 맵을 Old 맵으로 이동시킵니다.
 	// (ShaderVariantMap은 이제 비어있습니다)
 	TMap<uint64, FShaderVariant> OldShaderVariantMap = std::move(ShaderVariantMap);
+	// 퍼뮤테이션 테이블은 Old 맵 원소를 가리키므로 비우고, 이후 조회 시 새 맵 기준으로 다시 채운다
+	ResetPermutationTable();
 
 	bool bAllReloadsSuccessful = true;
 
@@ -476,6 +640,9 @@ bool UShader::Reload(ID3D11Device* InDevice)
 		}
 		OldShaderVariantMap.Empty();
 
+		// 캐시된 드로우 커맨드가 해제된 셰이더 포인터를 들고 있지 않도록 전부 폐기
+		FMeshDrawCommandCache::InvalidateAll();
+
 		// 갱신된 타임스탬프를 설정합니다.
 		try
 		{
@@ -498,6 +665,7 @@ bool UShader::Reload(ID3D11Device* InDevice)
 
 		// Old 맵(정상 작동하던)을 현재 맵으로 복원합니다.
 		ShaderVariantMap = std::move(OldShaderVariantMap);
+		ResetPermutationTable();
 
 		return false;
 	}
@@ -628,3 +796,73 @@ void UShader::UpdateIncludeTimestamps()
 		}
 	}
 }
+
+FShaderVariantLookupBenchmarkResult RunShaderVariantLookupBenchmark(UShader* Shader, const TArray<FShaderMacro>& MaterialMacros, int32 NumLookups)
+{
+	FShaderVariantLookupBenchmarkResult Result;
+	if (!Shader || NumLookups <= 0)
+	{
+		return Result;
+	}
+
+	// 뷰포트가 흔히 오가는 조명 모델 4종 (그림자 AA는 PCF 고정)
+	constexpr int32 NumViews = 4;
+	const EShaderLightingDim Lightings[NumViews] = {
+		EShaderLightingDim::Phong, EShaderLightingDim::Gouraud, EShaderLightingDim::Lambert, EShaderLightingDim::None };
+
+	const uint32 MacroSetId = FShaderPermutation::RegisterMacroSet(MaterialMacros);
+	TArray<FShaderMacro> ViewMacros[NumViews];
+	FShaderPermutationId ViewIds[NumViews];
+	for (int32 i = 0; i < NumViews; ++i)
+	{
+		FShaderPermutation ViewPermutation;
+		ViewPermutation.Lighting = Lightings[i];
+		ViewPermutation.ShadowAA = EShaderShadowAADim::PCF;
+		ViewMacros[i] = ViewPermutation.ToMacros();
+		ViewIds[i] = ViewPermutation.Encode();
+	}
+
+	// 워밍업: 필요한 Variant를 미리 컴파일하고 두 경로의 결과가 같은지 확인
+	for (int32 i = 0; i < NumViews; ++i)
+	{
+		TArray<FShaderMacro> Macros = ViewMacros[i];
+		Macros.Append(MaterialMacros);
+		FShaderVariant* ByMacros = Shader->GetOrCompileShaderVariant(Macros);
+		FShaderVariant* ById = Shader->GetOrCompileShaderVariant(FShaderPermutation::WithMacroSet(ViewIds[i], MacroSetId));
+		if (ByMacros != ById)
+		{
+			Result.bSameVariants = false;
+		}
+	}
+
+	// 1. 기존 방식: 매 드로우마다 뷰 매크로 복사 + 머티리얼 매크로 Append + 해시 + 맵 조회
+	uintptr_t Sink = 0;
+	uint64 Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < NumLookups; ++i)
+	{
+		TArray<FShaderMacro> Macros = ViewMacros[i % NumViews];
+		if (0 < MaterialMacros.Num())
+		{
+			Macros.Append(MaterialMacros);
+		}
+		Sink ^= reinterpret_cast<uintptr_t>(Shader->GetOrCompileShaderVariant(Macros));
+	}
+	Result.MacroArrayMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 2. 퍼뮤테이션 ID: 정수 조합 + 배열 인덱싱
+	Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < NumLookups; ++i)
+	{
+		const FShaderPermutationId Id = FShaderPermutation::WithMacroSet(ViewIds[i % NumViews], MacroSetId);
+		Sink ^= reinterpret_cast<uintptr_t>(Shader->GetOrCompileShaderVariant(Id));
+	}
+	Result.PermutationIdMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	Result.NumLookups = NumLookups;
+	// 두 루프의 조회 결과가 같다면 XOR가 0으로 상쇄된다 (최적화로 루프가 사라지는 것도 방지)
+	if (Sink != 0)
+	{
+		Result.bSameVariants = false;
+	}
+	return Result;
+}
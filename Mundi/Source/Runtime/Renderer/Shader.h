@@ -14,6 +14,78 @@ struct FShaderMacro
 	}
 };
 
+// ─────────────────────────────
+// 셰이더 퍼뮤테이션 (타입이 있는 차원 -> 정수 ID)
+// ─────────────────────────────
+
+// 뷰 모드가 결정하는 조명 모델 매크로
+enum class EShaderLightingDim : uint8
+{
+	None,			// 매크로 없음 (Unlit 등)
+	Phong,			// LIGHTING_MODEL_PHONG
+	Gouraud,		// LIGHTING_MODEL_GOURAUD
+	Lambert,		// LIGHTING_MODEL_LAMBERT
+	WorldNormal,	// VIEWMODE_WORLD_NORMAL
+};
+
+// SHADOW_AA_TECHNIQUE 매크로
+enum class EShaderShadowAADim : uint8
+{
+	None,	// 매크로 없음
+	Hard,	// 0
+	PCF,	// 1
+	VSM,	// 2
+};
+
+// 퍼뮤테이션 ID 비트 배치: [0..2] 조명 모델 | [3..4] 그림자 AA | [5] GPU 스키닝 | [6..] 머티리얼 매크로 세트
+using FShaderPermutationId = uint32;
+
+/**
+ * @brief 셰이더 Variant를 고르는 차원들의 묶음
+ * 핫 패스에서는 Encode()한 정수 ID로 UShader의 평탄 배열을 바로 인덱싱하고,
+ * 문자열 매크로 배열은 해당 Variant를 처음 컴파일할 때만 ToMacros()로 만든다.
+ * 머티리얼마다 임의로 지정하는 매크로는 RegisterMacroSet()으로 한 번 등록해 세트 ID로 다룬다.
+ */
+struct FShaderPermutation
+{
+	EShaderLightingDim Lighting = EShaderLightingDim::None;
+	EShaderShadowAADim ShadowAA = EShaderShadowAADim::None;
+	bool bGPUSkinning = false;
+	uint32 MacroSetId = 0;	// 0 = 머티리얼 매크로 없음
+
+	static constexpr uint32 LightingBits = 3;
+	static constexpr uint32 ShadowAABits = 2;
+	static constexpr uint32 GPUSkinningBit = 1u << (LightingBits + ShadowAABits);
+	static constexpr uint32 MacroSetShift = LightingBits + ShadowAABits + 1;
+	static constexpr uint32 NumLocalPermutations = 1u << MacroSetShift;	// 매크로 세트 하나당 조합 수
+
+	FShaderPermutationId Encode() const
+	{
+		return static_cast<uint32>(Lighting)
+			| (static_cast<uint32>(ShadowAA) << LightingBits)
+			| (bGPUSkinning ? GPUSkinningBit : 0u)
+			| (MacroSetId << MacroSetShift);
+	}
+
+	static FShaderPermutation Decode(FShaderPermutationId Id);
+
+	// 기존 매크로 순서(뷰 -> 머티리얼 -> GPU 스키닝)를 그대로 따른다
+	TArray<FShaderMacro> ToMacros() const;
+
+	// 머티리얼 매크로 배열을 세트 ID로 등록 (같은 내용이면 같은 ID, 빈 배열은 0)
+	static uint32 RegisterMacroSet(const TArray<FShaderMacro>& InMacros);
+	static const TArray<FShaderMacro>& GetMacroSet(uint32 MacroSetId);
+
+	static FShaderPermutationId WithMacroSet(FShaderPermutationId Id, uint32 MacroSetId)
+	{
+		return (Id & (NumLocalPermutations - 1)) | (MacroSetId << MacroSetShift);
+	}
+	static FShaderPermutationId WithGPUSkinning(FShaderPermutationId Id, bool bEnable)
+	{
+		return bEnable ? (Id | GPUSkinningBit) : (Id & ~GPUSkinningBit);
+	}
+};
+
 // 단일 셰이더 파일의 여러 변형 중 하나
 struct FShaderVariant
 {
@@ -23,6 +95,9 @@ struct FShaderVariant
 	ID3D11VertexShader* VertexShader = nullptr;
 	ID3D11PixelShader* PixelShader = nullptr;
 
+	// 드로우 정렬 키용 작은 ID (컴파일 순서대로 1부터 발급, 포인터와 달리 실행마다 동일)
+	uint32 SortId = 0;
+
 	// Store macros for hot reload
 	TArray<FShaderMacro> SourceMacros;
 
@@ -48,6 +123,8 @@ public:
 	void Load(const FString& ShaderPath, ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 
 	FShaderVariant* GetOrCompileShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
+	// 핫 패스용: 퍼뮤테이션 ID로 평탄 배열을 인덱싱한다. 처음 보는 ID만 매크로 경로로 컴파일/조회 후 기록
+	FShaderVariant* GetOrCompileShaderVariant(FShaderPermutationId PermutationId);
 	bool CompileVariantInternal(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& OutVariant);
 	//FShaderVariant* GetShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11InputLayout* GetInputLayout(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
@@ -65,6 +142,12 @@ protected:
 private:
 	TMap<uint64, FShaderVariant> ShaderVariantMap;
 
+	// 퍼뮤테이션 ID -> Variant 평탄 테이블 (ShaderVariantMap 원소를 가리킴)
+	// 전역 매크로 세트 ID를 셰이더 로컬 슬롯으로 바꿔 실제 사용하는 세트 수만큼만 공간을 쓴다.
+	TArray<int32> MacroSetToLocalSlot;				// 전역 세트 ID -> 로컬 슬롯 (-1 = 미사용)
+	TArray<FShaderVariant*> PermutationTable;		// 로컬 슬롯 * NumLocalPermutations + 하위 비트
+	void ResetPermutationTable();
+
 	// Store included files (e.g., "Shaders/Common/LightingCommon.hlsl")
 	// Used for hot reload - if any included file changes, reload this shader
 	TArray<FString> IncludedFiles;
@@ -78,6 +161,17 @@ private:
 	void UpdateIncludeTimestamps();
 };
 
+// 디바이스의 실제 셰이더로 Variant 조회 비용을 측정한다 (매크로 배열 해시 vs 퍼뮤테이션 ID)
+struct FShaderVariantLookupBenchmarkResult
+{
+	double MacroArrayMs = 0.0;		// 뷰+머티리얼 매크로 배열 조립 + GenerateShaderKey + 맵 조회
+	double PermutationIdMs = 0.0;	// 퍼뮤테이션 ID 조합 + 평탄 배열 인덱싱
+	int32 NumLookups = 0;
+	bool bSameVariants = true;		// 두 경로가 같은 Variant를 돌려줬는지
+};
+
+FShaderVariantLookupBenchmarkResult RunShaderVariantLookupBenchmark(UShader* Shader, const TArray<FShaderMacro>& MaterialMacros, int32 NumLookups);
+
 struct FVertexPositionColor
 {
 	static const D3D11_INPUT_ELEMENT_DESC* GetLayout()
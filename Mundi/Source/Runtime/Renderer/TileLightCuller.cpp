@@ -278,6 +278,12 @@ bool FTileLightCuller::TestPointLightAgainstFrustum(
 	FVector LightPos = Light.Position;
 	float Radius = Light.AttenuationRadius;
 
+	// 빈 라이트 슬롯 (FLightManager의 반납된 슬롯)
+	if (Radius <= 0.0f)
+	{
+		return false;
+	}
+
 	return SphereIntersectsFrustum(LightPos, Radius, Frustum);
 }
 
@@ -289,6 +295,11 @@ bool FTileLightCuller::TestSpotLightAgainstFrustum(
 	FVector LightPos = Light.Position;
 	float Radius = Light.AttenuationRadius;
 
+	if (Radius <= 0.0f)
+	{
+		return false;
+	}
+
 	// Spot Light도 구체로 근사
 	return SphereIntersectsFrustum(LightPos, Radius, Frustum);
 }
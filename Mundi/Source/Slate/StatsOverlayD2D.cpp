@@ -13,6 +13,7 @@
 #include "TileCullingStats.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "ActorPool.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -169,7 +170,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowGPU && !bShowSkinning) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowGPU && !bShowSkinning && !bShowNotify && !bShowProfiler && !bShowPool) || !SwapChain)
 	{
 		return;
 	}
@@ -241,15 +242,37 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		const double ToMb = 1.0 / (1024.0 * 1024.0);
+		const FMemoryTagStats Total = FMemoryManager::GetTotalStats();
 
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		wchar_t Buf[1024];
+		int32 Len = swprintf_s(Buf, L"Memory: %.1f MB (Peak %.1f MB)\nAllocs: %llu (+%llu/frame)\n",
+			Total.LiveBytes * ToMb, Total.PeakBytes * ToMb, Total.LiveCount, Total.FrameAllocCount);
+		int32 LineCount = 2;
+
+		// 사용 중인 태그만 표시
+		for (int32 i = 0; i < static_cast<int32>(EMemoryTag::Count); ++i)
+		{
+			const FMemoryTagStats Stats = FMemoryManager::GetTagStats(static_cast<EMemoryTag>(i));
+			if (Stats.LiveCount == 0 && Stats.FrameAllocCount == 0)
+			{
+				continue;
+			}
+			const int32 Written = swprintf_s(Buf + Len, _countof(Buf) - Len, L"  %S: %.2f / %.2f MB  +%llu\n",
+				GetMemoryTagName(static_cast<EMemoryTag>(i)), Stats.LiveBytes * ToMb, Stats.PeakBytes * ToMb, Stats.FrameAllocCount);
+			if (Written < 0)
+			{
+				break;
+			}
+			Len += Written;
+			++LineCount;
+		}
 
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		const float MemoryPanelHeight = 18.0f * LineCount + 12.0f;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 50.0f, NextY + MemoryPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, Rc, BrushBlack, BrushLightGreen);
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowDecal)
@@ -349,8 +372,11 @@ void UStatsOverlayD2D::Draw()
 
 		NextY += shadowPanelHeight + Space;
 
+		const FProfileScopeStats& ShadowProfile = FCpuProfiler::GetFrameStats("ShadowMapPass");
+		swprintf_s(Buf, L"ShadowMapPass : %.3fms, Call : %u", ShadowProfile.InclusiveMs, ShadowProfile.CallCount);
+
 		rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + 40);
-		DrawTextBlock(D2DContext, TextFormat, FScopeCycleCounter::GetTimeProfile("ShadowMapPass").GetConstWChar_tWithKey("ShadowMapPass"), rc, BrushBlack, BrushDeepPink);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushDeepPink);
 
 		NextY += shadowPanelHeight + Space;
 	}
@@ -388,8 +414,8 @@ void UStatsOverlayD2D::Draw()
 	{
 		const ESkinningMode SkinningMode = GWorld->GetRenderSettings().GetSkinningMode();
 
-		const FTimeProfile& CpuProfile = FScopeCycleCounter::GetTimeProfile("SKINNING_CPU_TASK");
-		double CpuSkinningTime = CpuProfile.Milliseconds;
+		const FProfileScopeStats& CpuProfile = FCpuProfiler::GetFrameStats("SKINNING_CPU_TASK");
+		double CpuSkinningTime = CpuProfile.InclusiveMs;
 
 		double GpuSkinningTime = GPUTimer->GetTime("SKINNING_GPU_TASK");
 		GpuSkinningTime = std::max(GpuSkinningTime, 0.0);
@@ -418,11 +444,94 @@ void UStatsOverlayD2D::Draw()
 		NextY += SkinningPanelHeight + Space;
 	}
 
+	if (bShowNotify)
+	{
+		// 이번 프레임 AnimNotify Lua 디스패치 (Notify/NotifyBegin/Tick/End 합산)
+		const FProfileScopeStats& NotifyProfile = FCpuProfiler::GetFrameStats("AnimNotifyDispatch");
+
+		wchar_t Buf[256];
+		swprintf_s(Buf, L"[AnimNotify Stats]\nDispatches: %u\nDispatch Time: %.4f ms\nAvg / Dispatch: %.4f ms",
+			NotifyProfile.CallCount,
+			NotifyProfile.InclusiveMs,
+			NotifyProfile.CallCount > 0 ? NotifyProfile.InclusiveMs / NotifyProfile.CallCount : 0.0);
+
+		constexpr float NotifyPanelHeight = 90.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + NotifyPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushSkyBlue);
+
+		NextY += NotifyPanelHeight + Space;
+	}
+
+	if (bShowPool && GWorld && GWorld->GetActorPool())
+	{
+		// 풀별 나가 있는 수 / 대기 수 / 재사용률 (미스 = 대기 액터가 없어 새로 만든 횟수)
+		TArray<FActorPoolStats> PoolStats;
+		GWorld->GetActorPool()->GetStats(PoolStats);
+		const FActorPoolStats Total = GWorld->GetActorPool()->GetTotalStats();
+
+		wchar_t Buf[2048];
+		int32 Len = swprintf_s(Buf, L"[Actor Pool]\nActive: %d (Peak %d)  Free: %d\nAcquired: %llu  Reused: %llu  Discarded: %llu\n",
+			Total.NumActive, Total.PeakActive, Total.NumFree, Total.NumAcquired, Total.NumReused, Total.NumDiscarded);
+		int32 LineCount = 3;
+		for (const FActorPoolStats& Stats : PoolStats)
+		{
+			if (LineCount >= 12)
+			{
+				break;
+			}
+			const double HitRate = Stats.NumAcquired > 0 ? 100.0 * Stats.NumReused / Stats.NumAcquired : 0.0;
+			const int32 Written = swprintf_s(Buf + Len, _countof(Buf) - Len, L"%S  %d / %d  hit %.0f%%\n",
+				Stats.Name.c_str(), Stats.NumActive, Stats.NumFree, HitRate);
+			if (Written < 0)
+			{
+				break;
+			}
+			Len += Written;
+			++LineCount;
+		}
+
+		const float PoolPanelHeight = 18.0f * LineCount + 12.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 150.0f, NextY + PoolPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushSkyBlue);
+
+		NextY += PoolPanelHeight + Space;
+	}
+
+	if (bShowProfiler)
+	{
+		// 지난 프레임 CPU 스코프 트리 (자식은 들여쓰기, Incl = 자식 포함 / Excl = 자기 자신)
+		TArray<const FProfileScopeStats*> Scopes;
+		FCpuProfiler::GetFrameStatsHierarchy(Scopes);
+
+		wchar_t Buf[4096];
+		int32 Len = swprintf_s(Buf, L"[CPU Profiler]%s\n", FCpuProfiler::IsCapturing() ? L" (capturing)" : L"");
+		int32 LineCount = 1;
+		for (const FProfileScopeStats* Stats : Scopes)
+		{
+			if (LineCount >= 32)
+			{
+				break;
+			}
+			const int32 Written = swprintf_s(Buf + Len, _countof(Buf) - Len, L"%*s%S  %.3f / %.3f ms  x%u\n",
+				Stats->Depth * 2, L"", Stats->Name, Stats->InclusiveMs, Stats->ExclusiveMs, Stats->CallCount);
+			if (Written < 0)
+			{
+				break;
+			}
+			Len += Written;
+			++LineCount;
+		}
+
+		const float ProfilerPanelHeight = 18.0f * LineCount + 12.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 150.0f, NextY + ProfilerPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushLightGreen);
+
+		NextY += ProfilerPanelHeight + Space;
+	}
+
 	D2DContext->EndDraw();
 	D2DContext->SetTarget(nullptr);
 
-	FScopeCycleCounter::TimeProfileInit();
-
 	SafeRelease(TargetBmp);
 	SafeRelease(Surface);
 }
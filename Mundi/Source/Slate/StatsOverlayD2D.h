@@ -22,6 +22,9 @@ public:
     void SetShowShadow(bool b) { bShowShadow = b; }
     void SetShowGPU(bool b) { bShowGPU = b; }
     void SetShowSkinning(bool b) { bShowSkinning = b; }
+    void SetShowNotify(bool b) { bShowNotify = b; }
+    void SetShowProfiler(bool b) { bShowProfiler = b; }
+    void SetShowPool(bool b) { bShowPool = b; }
     void ToggleFPS() { bShowFPS = !bShowFPS; }
     void ToggleMemory() { bShowMemory = !bShowMemory; }
     void TogglePicking() { bShowPicking = !bShowPicking; }
@@ -31,6 +34,9 @@ public:
     void ToggleShadow() { bShowShadow = !bShowShadow; }
     void ToggleGPU() { bShowGPU = !bShowGPU; }
     void ToggleSkinning() { bShowSkinning = !bShowSkinning; }
+    void ToggleNotify() { bShowNotify = !bShowNotify; }
+    void ToggleProfiler() { bShowProfiler = !bShowProfiler; }
+    void TogglePool() { bShowPool = !bShowPool; }
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -40,6 +46,9 @@ public:
     bool IsShadowVisible() const { return bShowShadow; }
     bool IsGPUVisible() const { return bShowGPU; }
     bool IsSkinningVisible() const { return bShowSkinning; }
+    bool IsNotifyVisible() const { return bShowNotify; }
+    bool IsProfilerVisible() const { return bShowProfiler; }
+    bool IsPoolVisible() const { return bShowPool; }
 
     void SetGPUTimer(FGPUTimer* InGPUTimer) { GPUTimer = InGPUTimer; }
 
@@ -63,6 +72,9 @@ private:
     bool bShowLights = false;
     bool bShowGPU = false;
     bool bShowSkinning = true;
+    bool bShowNotify = false;
+    bool bShowProfiler = false;
+    bool bShowPool = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
@@ -1,83 +1,124 @@
 ﻿#include "pch.h"
 #include "ThumbnailManager.h"
-#include "Texture.h"
-#include "ResourceManager.h"
+#include "AssetRegistry.h"
+#include "WindowsBinReader.h"
+#include "WindowsBinWriter.h"
+#include <DirectXTex.h>
 #include <algorithm>
 
+namespace
+{
+	constexpr uint32_t ThumbnailCacheMagic = 0x424D4854; // 'THMB'
+	constexpr uint32_t ThumbnailCacheVersion = 1;
+
+	std::string GetLowerExtension(const std::string& FilePath)
+	{
+		size_t DotPos = FilePath.find_last_of('.');
+		if (DotPos == std::string::npos)
+		{
+			return std::string();
+		}
+
+		std::string Extension = FilePath.substr(DotPos);
+		std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+		return Extension;
+	}
+
+	bool IsImageExtension(const std::string& Extension)
+	{
+		return Extension == ".png" || Extension == ".jpg" || Extension == ".jpeg" ||
+		       Extension == ".dds" || Extension == ".tga" || Extension == ".bmp";
+	}
+}
+
 void FThumbnailManager::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext)
 {
 	Device = InDevice;
 	DeviceContext = InDeviceContext;
 
-	UE_LOG("ThumbnailManager: Initialized");
+	// editor.ini에서 예산 지정 가능 (MB 단위)
+	if (EditorINI.count("ThumbnailBudgetMB"))
+	{
+		try { SetMemoryBudget(std::stoull(EditorINI["ThumbnailBudgetMB"]) * 1024ull * 1024ull); }
+		catch (...) {}
+	}
+
+	std::error_code Ec;
+	fs::create_directories(UTF8ToWide(GCacheDir + "/Thumbnails"), Ec);
+
+	bStopWorkers = false;
+	for (int i = 0; i < NumWorkers; ++i)
+	{
+		Workers.emplace_back(&FThumbnailManager::WorkerLoop, this);
+	}
+
+	UE_LOG("ThumbnailManager: Initialized (Budget %.1f MB, %d workers)", BudgetBytes / (1024.0 * 1024.0), NumWorkers);
 }
 
 void FThumbnailManager::Shutdown()
 {
-	// 모든 썸네일 리소스 해제 (Manager가 소유한 것만)
+	StopWorkers();
+
+	// 모든 썸네일 리소스 해제
 	for (auto& Pair : ThumbnailCache)
 	{
-		if (Pair.second.bOwnedByManager)
-		{
-			if (Pair.second.SRV)
-			{
-				Pair.second.SRV->Release();
-			}
-			if (Pair.second.Texture)
-			{
-				Pair.second.Texture->Release();
-			}
-		}
+		ReleaseThumbnail(Pair.second.Data);
 	}
 	ThumbnailCache.clear();
+	LRUList.clear();
+	ResidentBytes = 0;
+	PathKeyCache.clear();
+	FailedKeys.clear();
+	InFlightKeys.clear();
 
 	// 기본 아이콘 해제 (항상 Manager가 소유)
 	for (auto& Pair : DefaultIconCache)
 	{
-		if (Pair.second.SRV)
-		{
-			Pair.second.SRV->Release();
-		}
-		if (Pair.second.Texture)
-		{
-			Pair.second.Texture->Release();
-		}
+		ReleaseThumbnail(Pair.second);
 	}
 	DefaultIconCache.clear();
 
 	UE_LOG("ThumbnailManager: Shutdown");
 }
 
-ID3D11ShaderResourceView* FThumbnailManager::GetThumbnail(const std::string& FilePath)
+void FThumbnailManager::StopWorkers()
 {
-	// 캐시에 있으면 반환
-	auto It = ThumbnailCache.find(FilePath);
-	if (It != ThumbnailCache.end())
 	{
-		return It->second.SRV;
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		bStopWorkers = true;
+		RequestQueue.clear();
+		CompletedResults.clear();
 	}
+	QueueCV.notify_all();
 
-	// 확장자 추출
-	size_t DotPos = FilePath.find_last_of('.');
-	if (DotPos == std::string::npos)
+	for (std::thread& Worker : Workers)
 	{
-		return nullptr;
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
 	}
+	Workers.clear();
+}
 
-	std::string Extension = FilePath.substr(DotPos);
-	std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+ID3D11ShaderResourceView* FThumbnailManager::GetThumbnail(const std::string& FilePath, uint64_t Key)
+{
+	std::string Extension = GetLowerExtension(FilePath);
+	if (Extension.empty())
+	{
+		return nullptr;
+	}
 
 	// 확장자별 썸네일 생성
 	FThumbnailData* ThumbnailData = nullptr;
 
-	if (Extension == ".fbx")
+	if (IsImageExtension(Extension))
 	{
-		ThumbnailData = CreateFBXThumbnail(FilePath);
+		return RequestImageThumbnail(FilePath, Key);
 	}
-	else if (Extension == ".png" || Extension == ".jpg" || Extension == ".jpeg" ||
-	         Extension == ".dds" || Extension == ".tga")
+	else if (Extension == ".fbx")
 	{
-		ThumbnailData = CreateImageThumbnail(FilePath);
+		ThumbnailData = CreateFBXThumbnail(FilePath);
 	}
 	else
 	{
@@ -93,61 +134,462 @@ ID3D11ShaderResourceView* FThumbnailManager::GetThumbnail(const std::string& Fil
 	return nullptr;
 }
 
-void FThumbnailManager::ClearCache()
+ID3D11ShaderResourceView* FThumbnailManager::RequestImageThumbnail(const std::string& FilePath, uint64_t Key)
 {
-	// 캐시된 썸네일 모두 해제 (Manager가 소유한 것만)
-	for (auto& Pair : ThumbnailCache)
+	if (Key == 0)
 	{
-		if (Pair.second.bOwnedByManager)
+		// 레지스트리가 갱신되면 파일이 바뀌었을 수 있으므로 경로 키를 다시 계산
+		const uint32_t Generation = FAssetRegistry::Get().GetGeneration();
+		if (Generation != PathKeyGeneration)
 		{
-			if (Pair.second.SRV)
-			{
-				Pair.second.SRV->Release();
-			}
-			if (Pair.second.Texture)
+			PathKeyCache.clear();
+			PathKeyGeneration = Generation;
+		}
+
+		auto PathIt = PathKeyCache.find(FilePath);
+		if (PathIt == PathKeyCache.end())
+		{
+			PathIt = PathKeyCache.emplace(FilePath, ComputeFileKey(FilePath)).first;
+		}
+		Key = PathIt->second;
+	}
+
+	// 상주 중이면 LRU 맨 앞으로 옮기고 반환
+	auto It = ThumbnailCache.find(Key);
+	if (It != ThumbnailCache.end())
+	{
+		FCachedThumbnail& Cached = It->second;
+		Cached.LastUsedFrame = FrameCounter;
+		LRUList.splice(LRUList.begin(), LRUList, Cached.LRUIt);
+		return Cached.Data.SRV;
+	}
+
+	if (FailedKeys.count(Key))
+	{
+		FThumbnailData* Fallback = CreateDefaultThumbnail(".img");
+		return Fallback ? Fallback->SRV : nullptr;
+	}
+
+	// 아직 없으면 워커에 요청하고 로딩 아이콘 반환
+	if (!Workers.empty() && InFlightKeys.insert(Key).second)
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		RequestQueue.push_back(FThumbnailRequest{ FilePath, Key });
+		if (RequestQueue.size() > MaxQueuedRequests)
+		{
+			InFlightKeys.erase(RequestQueue.front().Key);
+			RequestQueue.pop_front();
+		}
+		QueueCV.notify_one();
+	}
+
+	FThumbnailData* Placeholder = CreateDefaultThumbnail(".loading");
+	return Placeholder ? Placeholder->SRV : nullptr;
+}
+
+void FThumbnailManager::WorkerLoop()
+{
+	// WIC 디코더 사용을 위해 워커마다 COM 초기화
+	HRESULT ComHr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+	while (true)
+	{
+		FThumbnailRequest Request;
+		{
+			std::unique_lock<std::mutex> Lock(QueueMutex);
+			QueueCV.wait(Lock, [this]() { return bStopWorkers || !RequestQueue.empty(); });
+			if (bStopWorkers)
 			{
-				Pair.second.Texture->Release();
+				break;
 			}
+			Request = std::move(RequestQueue.back());
+			RequestQueue.pop_back();
+		}
+
+		FThumbnailResult Result;
+		Result.Key = Request.Key;
+
+		if (LoadFromDiskCache(Request.Key, Result))
+		{
+			++DiskCacheHits;
+		}
+		else if (DecodeImageThumbnail(Request.FilePath, Result))
+		{
+			++DecodeCount;
+			SaveToDiskCache(Result);
 		}
+		else
+		{
+			// 콘솔은 스레드 안전하지 않으므로 로그는 메인 스레드 Tick에서 남긴다
+			Result.FilePath = std::move(Request.FilePath);
+		}
+
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		if (bStopWorkers)
+		{
+			break;
+		}
+		CompletedResults.push_back(std::move(Result));
 	}
-	ThumbnailCache.clear();
 
-	UE_LOG("ThumbnailManager: Cache cleared");
+	if (SUCCEEDED(ComHr))
+	{
+		CoUninitialize();
+	}
 }
 
-FThumbnailData* FThumbnailManager::CreateFBXThumbnail(const std::string& FilePath)
+bool FThumbnailManager::DecodeImageThumbnail(const std::string& FilePath, FThumbnailResult& OutResult) const
 {
-	// TODO: 실제 FBX 메시를 렌더타겟에 렌더링하여 썸네일 생성
-	// 현재는 기본 아이콘 반환
-	UE_LOG("ThumbnailManager: FBX thumbnail generation not yet implemented for %s", FilePath.c_str());
-	return CreateDefaultThumbnail(".fbx");
+	using namespace DirectX;
+
+	std::wstring WPath = UTF8ToWide(FilePath);
+	std::string Extension = GetLowerExtension(FilePath);
+
+	TexMetadata Metadata;
+	ScratchImage SourceImage;
+	HRESULT Hr = E_FAIL;
+
+	if (Extension == ".dds")
+	{
+		Hr = LoadFromDDSFile(WPath.c_str(), DDS_FLAGS_NONE, &Metadata, SourceImage);
+	}
+	else if (Extension == ".tga")
+	{
+		Hr = LoadFromTGAFile(WPath.c_str(), &Metadata, SourceImage);
+	}
+	else
+	{
+		Hr = LoadFromWICFile(WPath.c_str(), WIC_FLAGS_IGNORE_SRGB, &Metadata, SourceImage);
+	}
+
+	if (FAILED(Hr))
+	{
+		return false;
+	}
+
+	// 첫 밉/첫 슬라이스만 사용
+	const Image* Src = SourceImage.GetImage(0, 0, 0);
+	if (!Src)
+	{
+		return false;
+	}
+
+	ScratchImage Decompressed;
+	if (IsCompressed(Src->format))
+	{
+		if (FAILED(Decompress(*Src, DXGI_FORMAT_R8G8B8A8_UNORM, Decompressed)))
+		{
+			return false;
+		}
+		Src = Decompressed.GetImage(0, 0, 0);
+	}
+
+	// 긴 변을 ThumbnailSize에 맞춰 비율 유지 축소
+	ScratchImage Resized;
+	size_t Width = Src->width;
+	size_t Height = Src->height;
+	if (Width > ThumbnailSize || Height > ThumbnailSize)
+	{
+		const float Scale = static_cast<float>(ThumbnailSize) / static_cast<float>(std::max(Width, Height));
+		Width = std::max<size_t>(1, static_cast<size_t>(Width * Scale));
+		Height = std::max<size_t>(1, static_cast<size_t>(Height * Scale));
+		if (FAILED(Resize(*Src, Width, Height, TEX_FILTER_DEFAULT, Resized)))
+		{
+			return false;
+		}
+		Src = Resized.GetImage(0, 0, 0);
+	}
+
+	ScratchImage Converted;
+	if (Src->format != DXGI_FORMAT_R8G8B8A8_UNORM && Src->format != DXGI_FORMAT_R8G8B8A8_UNORM_SRGB)
+	{
+		if (FAILED(Convert(*Src, DXGI_FORMAT_R8G8B8A8_UNORM, TEX_FILTER_DEFAULT, TEX_THRESHOLD_DEFAULT, Converted)))
+		{
+			return false;
+		}
+		Src = Converted.GetImage(0, 0, 0);
+	}
+
+	OutResult.Width = static_cast<int>(Src->width);
+	OutResult.Height = static_cast<int>(Src->height);
+	OutResult.Pixels.resize(Src->width * Src->height);
+	for (size_t Row = 0; Row < Src->height; ++Row)
+	{
+		memcpy(OutResult.Pixels.data() + Row * Src->width, Src->pixels + Row * Src->rowPitch, Src->width * sizeof(uint32_t));
+	}
+	OutResult.bSuccess = true;
+	return true;
+}
+
+std::string FThumbnailManager::GetDiskCachePath(uint64_t Key) const
+{
+	char Name[32];
+	sprintf_s(Name, "%016llx.thumb", static_cast<unsigned long long>(Key));
+	return GCacheDir + "/Thumbnails/" + Name;
+}
+
+bool FThumbnailManager::LoadFromDiskCache(uint64_t Key, FThumbnailResult& OutResult) const
+{
+	const std::string CachePath = GetDiskCachePath(Key);
+	std::error_code Ec;
+	const uint64_t FileSize = static_cast<uint64_t>(fs::file_size(UTF8ToWide(CachePath), Ec));
+	if (Ec)
+	{
+		return false;
+	}
+
+	FWindowsBinReader Reader(CachePath);
+	if (!Reader.IsOpen())
+	{
+		return false;
+	}
+
+	uint32_t Magic = 0, Version = 0;
+	int32_t Width = 0, Height = 0;
+	Reader << Magic << Version << Width << Height;
+	if (Magic != ThumbnailCacheMagic || Version != ThumbnailCacheVersion ||
+	    Width <= 0 || Height <= 0 || Width > ThumbnailSize || Height > ThumbnailSize)
+	{
+		return false;
+	}
+
+	// 헤더(16바이트) + 픽셀 크기와 일치하지 않으면 잘린 파일로 보고 다시 디코딩
+	const uint64_t PixelBytes = static_cast<uint64_t>(Width) * Height * sizeof(uint32_t);
+	if (FileSize != sizeof(uint32_t) * 4 + PixelBytes)
+	{
+		return false;
+	}
+
+	OutResult.Width = Width;
+	OutResult.Height = Height;
+	OutResult.Pixels.resize(static_cast<size_t>(Width) * Height);
+	Reader.Serialize(OutResult.Pixels.data(), PixelBytes);
+	OutResult.bSuccess = true;
+	return true;
+}
+
+void FThumbnailManager::SaveToDiskCache(const FThumbnailResult& Result) const
+{
+	// 임시 파일에 쓴 뒤 교체해 다른 워커가 반쯤 쓰인 파일을 읽지 않도록 한다
+	const std::string FinalPath = GetDiskCachePath(Result.Key);
+	const std::string TempPath = FinalPath + ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+	{
+		FWindowsBinWriter Writer(TempPath);
+		uint32_t Magic = ThumbnailCacheMagic;
+		uint32_t Version = ThumbnailCacheVersion;
+		int32_t Width = Result.Width;
+		int32_t Height = Result.Height;
+		Writer << Magic << Version << Width << Height;
+		Writer.Serialize(const_cast<uint32_t*>(Result.Pixels.data()), Result.Pixels.size() * sizeof(uint32_t));
+	}
+
+	std::error_code Ec;
+	fs::rename(UTF8ToWide(TempPath), UTF8ToWide(FinalPath), Ec);
+	if (Ec)
+	{
+		fs::remove(UTF8ToWide(TempPath), Ec);
+	}
+}
+
+void FThumbnailManager::Tick()
+{
+	++FrameCounter;
+
+	std::vector<FThumbnailResult> Ready;
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+
+		// 한 프레임에 업로드가 몰리지 않도록 일부만 꺼낸다
+		const size_t Count = std::min<size_t>(CompletedResults.size(), MaxUploadsPerTick);
+		Ready.assign(std::make_move_iterator(CompletedResults.begin()), std::make_move_iterator(CompletedResults.begin() + Count));
+		CompletedResults.erase(CompletedResults.begin(), CompletedResults.begin() + Count);
+	}
+
+	for (FThumbnailResult& Result : Ready)
+	{
+		InFlightKeys.erase(Result.Key);
+
+		// ClearCache 이전에 시작된 디코드가 뒤늦게 도착하면 같은 키 결과가 두 번 올 수 있다
+		if (ThumbnailCache.find(Result.Key) != ThumbnailCache.end())
+		{
+			continue;
+		}
+
+		if (!Result.bSuccess)
+		{
+			UE_LOG("ThumbnailManager: Failed to decode image thumbnail: %s", Result.FilePath.c_str());
+			FailedKeys.insert(Result.Key);
+			continue;
+		}
+
+		FThumbnailData Data;
+		if (!UploadThumbnail(Result, Data))
+		{
+			FailedKeys.insert(Result.Key);
+			continue;
+		}
+
+		LRUList.push_front(Result.Key);
+		FCachedThumbnail& Cached = ThumbnailCache[Result.Key];
+		Cached.Data = Data;
+		Cached.Bytes = static_cast<uint64_t>(Data.Width) * Data.Height * sizeof(uint32_t);
+		Cached.LastUsedFrame = FrameCounter;
+		Cached.LRUIt = LRUList.begin();
+		ResidentBytes += Cached.Bytes;
+	}
+
+	EvictToBudget();
 }
 
-FThumbnailData* FThumbnailManager::CreateImageThumbnail(const std::string& FilePath)
+bool FThumbnailManager::UploadThumbnail(const FThumbnailResult& Result, FThumbnailData& OutData)
 {
 	if (!Device)
 	{
-		return nullptr;
+		return false;
 	}
 
-	// 이미지 파일은 직접 로드하여 썸네일로 사용
-	UTexture* Texture = UResourceManager::GetInstance().Load<UTexture>(FString(FilePath.c_str()), true);
-	if (!Texture || !Texture->GetShaderResourceView())
+	D3D11_TEXTURE2D_DESC TexDesc = {};
+	TexDesc.Width = Result.Width;
+	TexDesc.Height = Result.Height;
+	TexDesc.MipLevels = 1;
+	TexDesc.ArraySize = 1;
+	TexDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+	TexDesc.SampleDesc.Count = 1;
+	TexDesc.Usage = D3D11_USAGE_IMMUTABLE;
+	TexDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	D3D11_SUBRESOURCE_DATA InitData = {};
+	InitData.pSysMem = Result.Pixels.data();
+	InitData.SysMemPitch = Result.Width * sizeof(uint32_t);
+
+	if (FAILED(Device->CreateTexture2D(&TexDesc, &InitData, &OutData.Texture)))
 	{
-		UE_LOG("ThumbnailManager: Failed to load image thumbnail: %s", FilePath.c_str());
-		return CreateDefaultThumbnail(".img");
+		return false;
 	}
 
-	// 캐시에 추가 (참조만 저장, ResourceManager가 관리하므로 Release하지 않음)
-	FThumbnailData Data;
-	Data.SRV = Texture->GetShaderResourceView();
-	Data.Texture = Texture->GetTexture2D();
-	Data.Width = Texture->GetWidth();
-	Data.Height = Texture->GetHeight();
-	Data.bOwnedByManager = false;  // ResourceManager가 소유, 우리는 Release 안 함
+	if (FAILED(Device->CreateShaderResourceView(OutData.Texture, nullptr, &OutData.SRV)))
+	{
+		OutData.Texture->Release();
+		OutData.Texture = nullptr;
+		return false;
+	}
+
+	OutData.Width = Result.Width;
+	OutData.Height = Result.Height;
+	OutData.bOwnedByManager = true;
+	return true;
+}
+
+void FThumbnailManager::ReleaseThumbnail(FThumbnailData& Data)
+{
+	if (!Data.bOwnedByManager)
+	{
+		return;
+	}
+	if (Data.SRV)
+	{
+		Data.SRV->Release();
+		Data.SRV = nullptr;
+	}
+	if (Data.Texture)
+	{
+		Data.Texture->Release();
+		Data.Texture = nullptr;
+	}
+}
+
+void FThumbnailManager::EvictToBudget()
+{
+	// LRU 꼬리부터 축출. 이번 프레임에 그려진 썸네일은 ImGui 드로우 리스트가 참조하므로 남겨둔다
+	while (ResidentBytes > BudgetBytes && !LRUList.empty())
+	{
+		const uint64_t Key = LRUList.back();
+		auto It = ThumbnailCache.find(Key);
+		if (It == ThumbnailCache.end())
+		{
+			// 캐시에 없는 키는 남은 LRU 항목일 뿐이므로 버린다
+			LRUList.pop_back();
+			continue;
+		}
+		if (It->second.LastUsedFrame + 1 >= FrameCounter)
+		{
+			break;
+		}
 
-	ThumbnailCache[FilePath] = Data;
-	return &ThumbnailCache[FilePath];
+		ResidentBytes -= It->second.Bytes;
+		ReleaseThumbnail(It->second.Data);
+		ThumbnailCache.erase(It);
+		LRUList.pop_back();
+		++EvictionCount;
+	}
+}
+
+void FThumbnailManager::SetMemoryBudget(uint64_t InBudgetBytes)
+{
+	BudgetBytes = std::max<uint64_t>(InBudgetBytes, ThumbnailSize * ThumbnailSize * sizeof(uint32_t));
+	EvictToBudget();
+}
+
+FThumbnailStats FThumbnailManager::GetStats() const
+{
+	FThumbnailStats Stats;
+	Stats.ResidentBytes = ResidentBytes;
+	Stats.BudgetBytes = BudgetBytes;
+	Stats.ResidentCount = static_cast<int>(ThumbnailCache.size());
+	Stats.PendingCount = static_cast<int>(InFlightKeys.size());
+	Stats.DiskCacheHits = DiskCacheHits.load();
+	Stats.Decodes = DecodeCount.load();
+	Stats.Evictions = EvictionCount;
+	return Stats;
+}
+
+uint64_t FThumbnailManager::ComputeFileKey(const std::string& FilePath)
+{
+	// 레지스트리에 있으면 콘텐츠 브라우저와 같은 키를 사용
+	if (const FAssetFileEntry* Entry = FAssetRegistry::Get().FindFile(FilePath))
+	{
+		return Entry->ThumbnailKey;
+	}
+
+	std::error_code Ec;
+	const fs::path Path(UTF8ToWide(FilePath));
+	const uint64_t FileSize = static_cast<uint64_t>(fs::file_size(Path, Ec));
+	const uint64_t WriteTime = static_cast<uint64_t>(fs::last_write_time(Path, Ec).time_since_epoch().count());
+
+	uint64_t Key = std::hash<std::string>{}(NormalizePath(FilePath));
+	Key ^= FileSize + 0x9e3779b97f4a7c15ull + (Key << 6) + (Key >> 2);
+	Key ^= WriteTime + 0x9e3779b97f4a7c15ull + (Key << 6) + (Key >> 2);
+	return Key;
+}
+
+void FThumbnailManager::ClearCache()
+{
+	// 대기 중인 요청은 버리고 상주 썸네일 모두 해제 (디스크 캐시는 유지)
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		RequestQueue.clear();
+		CompletedResults.clear();
+	}
+	InFlightKeys.clear();
+
+	for (auto& Pair : ThumbnailCache)
+	{
+		ReleaseThumbnail(Pair.second.Data);
+	}
+	ThumbnailCache.clear();
+	LRUList.clear();
+	ResidentBytes = 0;
+	PathKeyCache.clear();
+	FailedKeys.clear();
+
+	UE_LOG("ThumbnailManager: Cache cleared");
+}
+
+FThumbnailData* FThumbnailManager::CreateFBXThumbnail(const std::string& FilePath)
+{
+	// TODO: 실제 FBX 메시를 렌더타겟에 렌더링하여 썸네일 생성
+	// 현재는 기본 아이콘 반환
+	return CreateDefaultThumbnail(".fbx");
 }
 
 FThumbnailData* FThumbnailManager::CreateDefaultThumbnail(const std::string& Extension)
@@ -183,6 +625,10 @@ FThumbnailData* FThumbnailManager::CreateDefaultThumbnail(const std::string& Ext
 	{
 		Color = 0xFFFF8040; // 주황색 (머티리얼)
 	}
+	else if (Extension == ".loading")
+	{
+		Color = 0xFF303030; // 어두운 회색 (이미지 썸네일 로딩 중)
+	}
 
 	// 텍스처 데이터 생성 (단색)
 	std::vector<uint32_t> Pixels(ThumbnailSize * ThumbnailSize, Color);
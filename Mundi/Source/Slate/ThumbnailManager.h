@@ -1,6 +1,14 @@
 #pragma once
 #include <string>
 #include <unordered_map>
+#include <vector>
+#include <list>
+#include <deque>
+#include <unordered_set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 #include <d3d11.h>
 
 /**
@@ -15,10 +23,27 @@ struct FThumbnailData
 	bool bOwnedByManager = true;  // true면 Manager가 Release 책임, false면 외부(ResourceManager)가 관리
 };
 
+/**
+ * @brief 썸네일 캐시 통계
+ */
+struct FThumbnailStats
+{
+	uint64_t ResidentBytes = 0;    // GPU에 올라가 있는 썸네일 메모리
+	uint64_t BudgetBytes = 0;      // LRU 예산
+	int ResidentCount = 0;
+	int PendingCount = 0;          // 워커 대기/처리 중인 요청 수
+	uint64_t DiskCacheHits = 0;
+	uint64_t Decodes = 0;          // 원본 이미지 디코딩 횟수
+	uint64_t Evictions = 0;
+};
+
 /**
  * @brief 파일 썸네일 관리 클래스
  * - FBX, Prefab 등의 파일에 대한 미리보기 텍스처 생성 및 캐싱
  * - ImGui::Image()에서 사용 가능한 ShaderResourceView 제공
+ * - 이미지 썸네일은 워커 스레드에서 디코딩/축소하고, 완료 전까지는 로딩 아이콘을 반환
+ * - 축소된 결과는 DerivedDataCache/Thumbnails에 저장해 다음 방문 시 디코딩을 생략
+ * - 상주 썸네일은 LRU로 관리해 총 메모리를 예산 이하로 유지
  */
 class FThumbnailManager
 {
@@ -42,17 +67,27 @@ public:
 	void Shutdown();
 
 	/**
-	 * @brief 파일 경로에 대한 썸네일 가져오기 (없으면 생성)
+	 * @brief 파일 경로에 대한 썸네일 가져오기 (없으면 비동기 생성 요청)
 	 * @param FilePath 파일 경로
-	 * @return 썸네일 ShaderResourceView (ImGui::Image에 사용)
+	 * @param Key 파일 내용 식별 키 (FAssetFileEntry::ThumbnailKey, 0이면 경로+크기+수정 시각으로 계산)
+	 * @return 썸네일 ShaderResourceView (준비 전에는 로딩 아이콘)
 	 */
-	ID3D11ShaderResourceView* GetThumbnail(const std::string& FilePath);
+	ID3D11ShaderResourceView* GetThumbnail(const std::string& FilePath, uint64_t Key = 0);
+
+	/**
+	 * @brief 워커가 완료한 썸네일을 GPU에 업로드하고 예산 초과분을 축출 (메인 스레드, 매 프레임)
+	 */
+	void Tick();
 
 	/**
 	 * @brief 캐시 초기화
 	 */
 	void ClearCache();
 
+	void SetMemoryBudget(uint64_t InBudgetBytes);
+	uint64_t GetMemoryBudget() const { return BudgetBytes; }
+	FThumbnailStats GetStats() const;
+
 private:
 	FThumbnailManager() = default;
 	~FThumbnailManager() { Shutdown(); }
@@ -61,6 +96,33 @@ private:
 	FThumbnailManager(const FThumbnailManager&) = delete;
 	FThumbnailManager& operator=(const FThumbnailManager&) = delete;
 
+	// 워커에 넘기는 디코딩 요청
+	struct FThumbnailRequest
+	{
+		std::string FilePath;
+		uint64_t Key = 0;
+	};
+
+	// 워커가 만든 RGBA8 픽셀 (업로드 대기)
+	struct FThumbnailResult
+	{
+		uint64_t Key = 0;
+		int Width = 0;
+		int Height = 0;
+		std::vector<uint32_t> Pixels;
+		std::string FilePath;	// 실패 시 로그용 (워커 스레드에서는 로그를 남기지 않는다)
+		bool bSuccess = false;
+	};
+
+	// LRU에 들어있는 상주 썸네일
+	struct FCachedThumbnail
+	{
+		FThumbnailData Data;
+		uint64_t Bytes = 0;
+		uint64_t LastUsedFrame = 0;
+		std::list<uint64_t>::iterator LRUIt;
+	};
+
 	/**
 	 * @brief FBX 파일용 썸네일 생성
 	 */
@@ -72,20 +134,68 @@ private:
 	FThumbnailData* CreateDefaultThumbnail(const std::string& Extension);
 
 	/**
-	 * @brief 이미지 파일용 썸네일 생성
+	 * @brief 이미지 파일용 썸네일 요청 (캐시 적중 시 즉시 반환, 아니면 워커에 위임)
 	 */
-	FThumbnailData* CreateImageThumbnail(const std::string& FilePath);
+	ID3D11ShaderResourceView* RequestImageThumbnail(const std::string& FilePath, uint64_t Key);
+
+	// 워커 스레드
+	void WorkerLoop();
+	void StopWorkers();
+	bool DecodeImageThumbnail(const std::string& FilePath, FThumbnailResult& OutResult) const;
+
+	// 디스크 캐시
+	std::string GetDiskCachePath(uint64_t Key) const;
+	bool LoadFromDiskCache(uint64_t Key, FThumbnailResult& OutResult) const;
+	void SaveToDiskCache(const FThumbnailResult& Result) const;
+
+	bool UploadThumbnail(const FThumbnailResult& Result, FThumbnailData& OutData);
+	void ReleaseThumbnail(FThumbnailData& Data);
+	void EvictToBudget();
+
+	static uint64_t ComputeFileKey(const std::string& FilePath);
 
 private:
 	ID3D11Device* Device = nullptr;
 	ID3D11DeviceContext* DeviceContext = nullptr;
 
-	// 썸네일 캐시 (파일 경로 -> 썸네일 데이터)
-	std::unordered_map<std::string, FThumbnailData> ThumbnailCache;
+	// 썸네일 캐시 (파일 키 -> 썸네일), 앞쪽이 가장 최근에 사용된 항목
+	std::unordered_map<uint64_t, FCachedThumbnail> ThumbnailCache;
+	std::list<uint64_t> LRUList;
+	uint64_t ResidentBytes = 0;
+	uint64_t BudgetBytes = 32ull * 1024 * 1024;
+
+	// 경로 -> 키 (키를 모르는 호출자를 위해 stat 결과를 한 번만 계산)
+	std::unordered_map<std::string, uint64_t> PathKeyCache;
+	uint32_t PathKeyGeneration = 0;
+
+	// 디코딩에 실패한 키 (매 프레임 재요청 방지)
+	std::unordered_set<uint64_t> FailedKeys;
 
 	// 기본 아이콘 캐시 (확장자 -> 썸네일 데이터)
 	std::unordered_map<std::string, FThumbnailData> DefaultIconCache;
 
+	// 워커 큐. 가장 최근 요청(현재 보이는 폴더)부터 처리하도록 뒤에서 꺼낸다
+	std::vector<std::thread> Workers;
+	std::mutex QueueMutex;
+	std::condition_variable QueueCV;
+	std::deque<FThumbnailRequest> RequestQueue;
+	std::unordered_set<uint64_t> InFlightKeys;    // 메인 스레드 전용
+	std::vector<FThumbnailResult> CompletedResults;
+	bool bStopWorkers = false;
+
+	uint64_t FrameCounter = 0;
+	std::atomic<uint64_t> DiskCacheHits{ 0 };
+	std::atomic<uint64_t> DecodeCount{ 0 };
+	uint64_t EvictionCount = 0;
+
 	// 썸네일 크기
 	static constexpr int ThumbnailSize = 128;
+
+	// 프레임당 GPU 업로드 개수 상한 (한 프레임에 몰리지 않도록)
+	static constexpr int MaxUploadsPerTick = 16;
+
+	// 요청 큐 상한. 넘치면 가장 오래된 요청부터 버린다 (다시 보이면 재요청됨)
+	static constexpr size_t MaxQueuedRequests = 256;
+
+	static constexpr int NumWorkers = 2;
 };
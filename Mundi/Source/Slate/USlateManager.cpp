@@ -551,6 +551,9 @@ void USlateManager::Update(float DeltaSeconds)
     // MainToolbar 업데이트
     MainToolbar->Update();
 
+    // 워커가 완료한 썸네일 업로드 및 LRU 예산 유지
+    FThumbnailManager::GetInstance().Tick();
+
     if (TopPanel)
     {
         // 툴바 높이만큼 아래로 이동 (50px)
@@ -10,10 +10,45 @@
 #include <cstring>
 #include <algorithm>
 #include "MiniDump.h"
+#include "LightSlotBuffer.h"
+#include "MeshBatchSort.h"
+#include "MeshBVH.h"
+#include "Material.h"
+#include "Shader.h"
+#include "CpuProfiler.h"
+#include "MemoryManager.h"
+#include "StressSceneGenerator.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "PrefabRegistry.h"
+#include "JsonDocument.h"
+#include "CookedLevel.h"
+#include "ProjectileSimulation.h"
+#include "ActorPool.h"
+#include "WorldDuplication.h"
+#include "StaticMeshActor.h"
+#include "StaticMeshComponent.h"
 
 using std::max;
 using std::min;
 
+namespace
+{
+	// INPUT RECORD로 지정한 저장 경로 (INPUT STOP 시 사용)
+	FString InputCapturePath;
+
+	// INPUT RECORD/REPLAY 인자 -> Data/Profiling/<Name>.inrec (인자가 없으면 InputCapture)
+	FString MakeInputCapturePath(const char* Args)
+	{
+		while (*Args == ' ')
+		{
+			++Args;
+		}
+		const FString Name = (*Args != '\0') ? FString(Args) : FString("InputCapture");
+		return GDataDir + "/Profiling/" + Name + ".inrec";
+	}
+}
+
 IMPLEMENT_CLASS(UConsoleWidget)
 
 UConsoleWidget::UConsoleWidget()
@@ -54,6 +89,33 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
 	HelpCommandList.Add("STAT GPU");
+	HelpCommandList.Add("STAT NOTIFY");
+	HelpCommandList.Add("STAT PROFILER");
+	HelpCommandList.Add("STAT POOL");
+	HelpCommandList.Add("PROFILE");
+	HelpCommandList.Add("PROFILE ON");
+	HelpCommandList.Add("PROFILE OFF");
+	HelpCommandList.Add("PROFILE CAPTURE");
+	HelpCommandList.Add("MEM DUMP");
+	HelpCommandList.Add("MEM RESETPEAK");
+	HelpCommandList.Add("INPUT");
+	HelpCommandList.Add("INPUT RECORD");
+	HelpCommandList.Add("INPUT STOP");
+	HelpCommandList.Add("INPUT REPLAY");
+	HelpCommandList.Add("BENCH");
+	HelpCommandList.Add("BENCH LIGHTS");
+	HelpCommandList.Add("BENCH MESHSORT");
+	HelpCommandList.Add("BENCH SHADERVARIANT");
+	HelpCommandList.Add("BENCH BVH");
+	HelpCommandList.Add("BENCH TRACE");
+	HelpCommandList.Add("BENCH PROJECTILES");
+	HelpCommandList.Add("BENCH PREFAB");
+	HelpCommandList.Add("BENCH JSON");
+	HelpCommandList.Add("BENCH COOKEDLEVEL");
+	HelpCommandList.Add("BENCH POOL");
+	HelpCommandList.Add("BENCH WORLDDUP");
+	HelpCommandList.Add("STRESS ACTORS");
+	HelpCommandList.Add("STRESS CLEAR");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -555,6 +617,9 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT LIGHT");
 		AddLog("- STAT SHADOW");
 		AddLog("- STAT GPU");
+		AddLog("- STAT NOTIFY");
+		AddLog("- STAT PROFILER");
+		AddLog("- STAT POOL");
 		AddLog("- STAT ALL");
 		AddLog("- STAT NONE");
 	}
@@ -598,6 +663,21 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleSkinning();
 		AddLog("STAT SKINNING TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT NOTIFY") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleNotify();
+		AddLog("STAT NOTIFY TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT PROFILER") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleProfiler();
+		AddLog("STAT PROFILER TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT POOL") == 0)
+	{
+		UStatsOverlayD2D::Get().TogglePool();
+		AddLog("STAT POOL TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT ALL") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(true);
@@ -609,6 +689,9 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowShadow(true);
 		UStatsOverlayD2D::Get().SetShowGPU(true);
 		UStatsOverlayD2D::Get().SetShowSkinning(true);
+		UStatsOverlayD2D::Get().SetShowNotify(true);
+		UStatsOverlayD2D::Get().SetShowProfiler(true);
+		UStatsOverlayD2D::Get().SetShowPool(true);
 		AddLog("STAT: ON");
 	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
@@ -622,8 +705,314 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowShadow(false);
 		UStatsOverlayD2D::Get().SetShowGPU(false);
 		UStatsOverlayD2D::Get().SetShowSkinning(false);
+		UStatsOverlayD2D::Get().SetShowNotify(false);
+		UStatsOverlayD2D::Get().SetShowProfiler(false);
+		UStatsOverlayD2D::Get().SetShowPool(false);
 		AddLog("STAT: OFF");
 	}
+	else if (Stricmp(command_line, "PROFILE") == 0)
+	{
+		AddLog("PROFILE commands:");
+		AddLog("- PROFILE ON");
+		AddLog("- PROFILE OFF");
+		AddLog("- PROFILE CAPTURE [Frames]");
+	}
+	else if (Stricmp(command_line, "PROFILE ON") == 0)
+	{
+		FCpuProfiler::SetEnabled(true);
+		AddLog("CPU PROFILER: ON");
+	}
+	else if (Stricmp(command_line, "PROFILE OFF") == 0)
+	{
+		FCpuProfiler::SetEnabled(false);
+		AddLog("CPU PROFILER: OFF");
+	}
+	else if (Strnicmp(command_line, "PROFILE CAPTURE", 15) == 0)
+	{
+		// PROFILE CAPTURE [Frames] -> Chrome trace JSON (chrome://tracing 또는 Perfetto에서 열기)
+		const int32 NumFrames = std::max(1, atoi(command_line + 15));
+		const FString OutputPath = GDataDir + "/Profiling/CpuTrace.json";
+		FCpuProfiler::SetEnabled(true);
+		FCpuProfiler::RequestCapture(NumFrames, OutputPath);
+		AddLog("Capturing %d frame(s) to %s", NumFrames, OutputPath.c_str());
+	}
+	else if (Stricmp(command_line, "MEM DUMP") == 0)
+	{
+		// 태그별 Live/Peak/프레임 할당 표를 로그로 출력
+		FMemoryManager::DumpTagStats();
+	}
+	else if (Stricmp(command_line, "MEM RESETPEAK") == 0)
+	{
+		FMemoryManager::ResetPeaks();
+		AddLog("Memory peaks reset to current usage");
+	}
+	else if (Stricmp(command_line, "INPUT") == 0)
+	{
+		AddLog("INPUT commands:");
+		AddLog("- INPUT RECORD [Name]");
+		AddLog("- INPUT STOP");
+		AddLog("- INPUT REPLAY [Name]");
+	}
+	else if (Strnicmp(command_line, "INPUT RECORD", 12) == 0)
+	{
+		// INPUT RECORD [Name] -> INPUT STOP 시 Data/Profiling/<Name>.inrec 로 저장
+		InputCapturePath = MakeInputCapturePath(command_line + 12);
+		INPUT.StartRecording();
+	}
+	else if (Stricmp(command_line, "INPUT STOP") == 0)
+	{
+		if (INPUT.IsRecording())
+		{
+			INPUT.StopRecording(InputCapturePath);
+		}
+		else if (INPUT.IsReplaying())
+		{
+			INPUT.StopReplay();
+		}
+		else
+		{
+			AddLog("Input is not being recorded or replayed");
+		}
+	}
+	else if (Strnicmp(command_line, "INPUT REPLAY", 12) == 0)
+	{
+		// INPUT REPLAY [Name] -> 재생이 끝나면 프레임 시간 요약 + <Name>.inrec.timing.csv
+		INPUT.StartReplay(MakeInputCapturePath(command_line + 12));
+	}
+	else if (Stricmp(command_line, "BENCH") == 0)
+	{
+		AddLog("BENCH commands:");
+		AddLog("- BENCH LIGHTS");
+		AddLog("- BENCH MESHSORT");
+		AddLog("- BENCH SHADERVARIANT");
+		AddLog("- BENCH BVH");
+		AddLog("- BENCH TRACE");
+		AddLog("- BENCH PROJECTILES");
+		AddLog("- BENCH PREFAB");
+		AddLog("- BENCH JSON");
+		AddLog("- BENCH COOKEDLEVEL");
+		AddLog("- BENCH POOL");
+		AddLog("- BENCH WORLDDUP");
+	}
+	else if (Stricmp(command_line, "BENCH LIGHTS") == 0)
+	{
+		// 라이트 1024개 중 프레임당 4개만 변경, 1000프레임
+		const FLightSlotBenchmarkResult Result = RunLightSlotPackingBenchmark(1024, 4, 1000);
+		AddLog("Light packing (1024 lights, 4 dirty/frame, 1000 frames)");
+		AddLog("- Full rebuild : %.3f ms, %llu KB uploaded", Result.FullRebuildMs, Result.FullRebuildBytes / 1024);
+		AddLog("- Dirty ranges : %.3f ms, %llu KB uploaded, %d ranges", Result.DirtyRangeMs, Result.DirtyRangeBytes / 1024, Result.DirtyRangeCount);
+	}
+	else if (Stricmp(command_line, "BENCH MESHSORT") == 0)
+	{
+		// 배치 10000개, 100회 반복
+		const FMeshBatchSortBenchmarkResult Result = RunMeshBatchSortBenchmark(10000, 100);
+		AddLog("Mesh batch sort (10000 batches, 100 iterations)");
+		AddLog("- Legacy pointer sort : %.3f ms, %d state changes", Result.LegacySortMs, Result.LegacyStateChanges);
+		AddLog("- Key build only      : %.3f ms", Result.KeyBuildMs);
+		AddLog("- Key + std sort      : %.3f ms", Result.KeyComparisonSortMs);
+		AddLog("- Key + radix sort    : %.3f ms, %d state changes", Result.RadixSortMs, Result.RadixStateChanges);
+	}
+	else if (Stricmp(command_line, "BENCH SHADERVARIANT") == 0)
+	{
+		// 기본 머티리얼 셰이더로 조회 100000회 (조명 모델 4종을 번갈아 사용)
+		UMaterialInterface* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
+		UShader* Shader = DefaultMaterial ? DefaultMaterial->GetShader() : nullptr;
+		if (!Shader)
+		{
+			AddLog("[error] Default material shader is not loaded");
+		}
+		else
+		{
+			const FShaderVariantLookupBenchmarkResult Result = RunShaderVariantLookupBenchmark(Shader, DefaultMaterial->GetShaderMacros(), 100000);
+			AddLog("Shader variant lookup (%d lookups, %s)", Result.NumLookups, Shader->GetFilePath().c_str());
+			AddLog("- Macro array hash : %.3f ms", Result.MacroArrayMs);
+			AddLog("- Permutation ID   : %.3f ms", Result.PermutationIdMs);
+			AddLog("- Same variants    : %s", Result.bSameVariants ? "yes" : "NO");
+		}
+	}
+	else if (Stricmp(command_line, "BENCH BVH") == 0)
+	{
+		// 삼각형 약 100만 개 메시, 광선 100000개
+		const FMeshBVHBenchmarkResult Result = RunMeshBVHBenchmark(1000000, 100000);
+		AddLog("Mesh BVH (%d triangles, %d BVH4 nodes)", Result.NumTriangles, Result.NumNodes);
+		AddLog("- Build       : %.3f ms", Result.BuildMs);
+		AddLog("- BVH4 + SSE  : %.0f rays/s", Result.BVHRaysPerSec);
+		AddLog("- Brute force : %.0f rays/s, %d mismatches", Result.BruteForceRaysPerSec, Result.Mismatches);
+	}
+	else if (Stricmp(command_line, "BENCH TRACE") == 0)
+	{
+		UWorldPartitionManager* Partition = GWorld ? GWorld->GetPartitionManager() : nullptr;
+		if (!Partition || !Partition->GetBVH())
+		{
+			AddLog("[error] World partition is not available");
+		}
+		else
+		{
+			// 씬이 비어 있으면 편집 중인 레벨 대신 임시 월드에 메시 액터 10000개를 깔고 측정 (측정 후 월드째 삭제)
+			UWorld* TraceWorld = GWorld;
+			if (Partition->GetBVH()->TotalActorCount() < 1000)
+			{
+				TraceWorld = NewObject<UWorld>();
+				TraceWorld->InitializePartition();
+
+				const FString MeshPath = GDataDir + "/Model/Cube.obj";
+				for (int32 i = 0; i < 10000; ++i)
+				{
+					AStaticMeshActor* Actor = TraceWorld->SpawnActor<AStaticMeshActor>();
+					if (!Actor)
+					{
+						break;
+					}
+					Actor->GetStaticMeshComponent()->SetStaticMesh(MeshPath);
+					Actor->SetActorLocation(FVector((i % 100) * 2.0f, (i / 100) * 2.0f, 0.0f));
+				}
+				TraceWorld->GetPartitionManager()->BulkRegister(TraceWorld->GetActors());
+			}
+
+			const FWorldTraceBenchmarkResult Result = RunWorldTraceBenchmark(TraceWorld, 100000);
+			AddLog("World line trace (%d components, %d rays%s)", Result.NumComponents, Result.NumRays, TraceWorld != GWorld ? ", temporary stress world" : "");
+			AddLog("- RayQueryClosest : %.3f ms, %d hits", Result.LegacyMs, Result.LegacyHits);
+			AddLog("- LineTraceBatch  : %.3f ms, %d hits", Result.BatchMs, Result.BatchHits);
+
+			if (TraceWorld != GWorld)
+			{
+				ObjectFactory::DeleteObject(TraceWorld);
+			}
+		}
+	}
+	else if (Stricmp(command_line, "BENCH PROJECTILES") == 0)
+	{
+		// 발사체 10000개를 현재 월드 BVH에 대해 300프레임 (1/60초) 시뮬레이션. 액터/컴포넌트는 만들지 않음
+		const FProjectileStressResult Result = RunProjectileStressTest(GWorld, 10000, 300);
+		AddLog("Projectile simulation (%d projectiles, %d frames, %d colliders)", Result.NumProjectiles, Result.NumFrames, Result.NumColliders);
+		AddLog("- Total      : %.3f ms (avg %.3f ms, max %.3f ms per frame)", Result.TotalMs, Result.TotalMs / std::max(Result.NumFrames, 1), Result.MaxFrameMs);
+		AddLog("- Sweeps     : %lld, hits %lld, bounces %lld", Result.NumSweeps, Result.NumHits, Result.NumBounces);
+		AddLog("- Stopped    : %d", Result.NumStopped);
+	}
+	else if (Stricmp(command_line, "BENCH PREFAB") == 0)
+	{
+		// 파이어볼 프리팹 10000개 생성 (월드에는 등록하지 않음)
+		const FWideString PrefabPath = UTF8ToWide(GDataDir) + L"/Prefabs/Fireball.prefab";
+		const FPrefabSpawnBenchmarkResult Result = RunPrefabSpawnBenchmark(PrefabPath, 10000);
+		if (Result.NumSpawns == 0)
+		{
+			AddLog("[error] Failed to load %s", WideToUTF8(PrefabPath).c_str());
+		}
+		else
+		{
+			AddLog("Prefab spawn (%d instances of %s)", Result.NumSpawns, WideToUTF8(PrefabPath).c_str());
+			AddLog("- Load + parse per spawn : %.3f ms", Result.FileLoadMs);
+			AddLog("- Template compile       : %.3f ms", Result.CompileMs);
+			AddLog("- Template duplicate     : %.3f ms", Result.TemplateMs);
+			AddLog("- Same components        : %s", Result.bSameComponentCount ? "yes" : "NO");
+		}
+	}
+	else if (Stricmp(command_line, "BENCH JSON") == 0)
+	{
+		// Data/Scenes, Data/Prefabs 전체를 10회씩 파싱/출력
+		TArray<FWideString> Directories;
+		Directories.Add(UTF8ToWide(GDataDir) + L"/Scenes");
+		Directories.Add(UTF8ToWide(GDataDir) + L"/Prefabs");
+		const FJsonBenchmarkResult Result = RunJsonBenchmark(Directories, 10);
+		if (Result.NumFiles == 0)
+		{
+			AddLog("[error] No .scene/.prefab files found");
+		}
+		else
+		{
+			AddLog("JSON (%d files, %.1f KB, %d values, x%d)", Result.NumFiles, Result.TotalBytes / 1024.0, Result.NumValues, Result.Iterations);
+			AddLog("- JSON::Load            : %.3f ms", Result.LegacyParseMs);
+			AddLog("- FJsonDocument::Parse  : %.3f ms", Result.DocumentParseMs);
+			AddLog("- Parse + ToJSON        : %.3f ms", Result.DocumentToJSONMs);
+			AddLog("- JSON::dump            : %.3f ms", Result.LegacyDumpMs);
+			AddLog("- FJsonWriter           : %.3f ms", Result.WriterMs);
+			AddLog("- Parse failures        : %d", Result.NumParseFailures);
+			AddLog("- Output mismatches     : %d", Result.NumOutputMismatches);
+		}
+	}
+	else if (Stricmp(command_line, "BENCH COOKEDLEVEL") == 0)
+	{
+		// Data/Scenes의 모든 레벨을 쿠킹한 뒤 JSON 로드와 쿠킹 로드 결과를 비교
+		int32 NumScenes = 0;
+		int32 NumFailed = 0;
+		std::error_code Ec;
+		for (const auto& Entry : fs::directory_iterator(UTF8ToWide(GDataDir) + L"/Scenes", Ec))
+		{
+			if (!Entry.is_regular_file() || Entry.path().extension() != L".scene")
+			{
+				continue;
+			}
+
+			const FCookedLevelVerifyResult Result = VerifyCookedLevel(Entry.path().wstring());
+			const FString FileName = WideToUTF8(Entry.path().filename().wstring());
+			++NumScenes;
+			if (!Result.bCooked || !Result.bLoaded || Result.NumMismatchedActors != 0 || Result.NumFovYMismatches != 0)
+			{
+				++NumFailed;
+				AddLog("[error] %s: cooked=%d loaded=%d mismatched=%d fovy=%d", FileName.c_str(), Result.bCooked, Result.bLoaded,
+					Result.NumMismatchedActors, Result.NumFovYMismatches);
+				continue;
+			}
+			AddLog("%s (%d actors): %.1f KB -> %.1f KB, cook %.3f ms", FileName.c_str(), Result.NumActors,
+				Result.JsonBytes / 1024.0, Result.CookedBytes / 1024.0, Result.CookMs);
+			AddLog("- JSON load   : %.3f ms", Result.JsonLoadMs);
+			AddLog("- Cooked load : %.3f ms", Result.CookedLoadMs);
+		}
+		AddLog("Cooked level round-trip: %d scenes, %d failed", NumScenes, NumFailed);
+
+		const FCookedLevelVerifyResult DecalResult = VerifyCookedPerspectiveDecal();
+		const bool bDecalOk = DecalResult.bCooked && DecalResult.bLoaded && DecalResult.NumPerspectiveDecals > 0 &&
+			DecalResult.NumMismatchedActors == 0 && DecalResult.NumFovYMismatches == 0;
+		AddLog("%sPerspective decal FovY: %s (%d decals, %d mismatched)", bDecalOk ? "" : "[error] ",
+			bDecalOk ? "match" : "MISMATCH", DecalResult.NumPerspectiveDecals, DecalResult.NumFovYMismatches);
+	}
+	else if (Stricmp(command_line, "BENCH POOL") == 0)
+	{
+		// 매 프레임 사과 프리팹 500개 생성/파괴를 120프레임: 스폰/파괴 vs 풀 꺼내기/반납
+		const FWideString PrefabPath = UTF8ToWide(GDataDir) + L"/Prefabs/Apple.prefab";
+		const FActorPoolBenchmarkResult Result = RunActorPoolBenchmark(GWorld, PrefabPath, 500, 120);
+		if (Result.NumFrames == 0)
+		{
+			AddLog("[error] Failed to load %s", WideToUTF8(PrefabPath).c_str());
+		}
+		else
+		{
+			AddLog("Actor pool (%d actors x %d frames, %s)", Result.NumPerFrame, Result.NumFrames, WideToUTF8(PrefabPath).c_str());
+			AddLog("- Spawn / Destroy   : %.3f ms (max frame %.3f ms)", Result.SpawnDestroyMs, Result.SpawnDestroyMaxFrameMs);
+			AddLog("- Acquire / Release : %.3f ms (max frame %.3f ms)", Result.PoolMs, Result.PoolMaxFrameMs);
+			AddLog("- Reused            : %llu", Result.NumReused);
+			AddLog("- Reuse == Fresh    : %s", Result.bReuseMatchesFresh ? "match" : "MISMATCH");
+		}
+	}
+	else if (Stricmp(command_line, "BENCH WORLDDUP") == 0)
+	{
+		// 5만 액터 월드 복제: 액터별 Duplicate + AddActorToLevel vs 일괄 복제 (전역 리맵 + BulkRegister)
+		const FWorldDuplicationBenchmarkResult Result = RunWorldDuplicationBenchmark(50000);
+		AddLog("World duplication (%d actors, source built in %.2f ms)", Result.NumActors, Result.BuildSourceMs);
+		AddLog("- Per actor : %.2f ms", Result.PerActorMs);
+		AddLog("- Bulk      : %.2f ms (%d components)", Result.Bulk.TotalMs, Result.Bulk.NumComponents);
+		AddLog("  duplicate %.2f / attach %.2f / register %.2f / partition %.2f ms",
+			Result.Bulk.DuplicateMs, Result.Bulk.AttachMs, Result.Bulk.RegisterMs, Result.Bulk.PartitionMs);
+		AddLog("- Hierarchy : %s", Result.bHierarchyMatches ? "match" : "MISMATCH");
+	}
+	else if (Strnicmp(command_line, "STRESS ACTORS", 13) == 0)
+	{
+		// STRESS ACTORS <N> [MESH] -> 격자 배치로 N개 스폰 (MESH면 큐브 스태틱 메시, 아니면 빈 액터)
+		const int32 Count = std::max(1, atoi(command_line + 13));
+		FString Options = command_line + 13;
+		std::transform(Options.begin(), Options.end(), Options.begin(), ::toupper);
+		const bool bWithMesh = Options.find("MESH") != FString::npos;
+
+		double ElapsedMs = 0.0;
+		const int32 Spawned = FStressSceneGenerator::SpawnActors(GWorld, Count, bWithMesh, ElapsedMs);
+		AddLog("Spawned %d %s actors in %.2f ms (world total %d)", Spawned, bWithMesh ? "mesh" : "empty", ElapsedMs,
+			GWorld ? GWorld->GetActors().Num() : 0);
+	}
+	else if (Stricmp(command_line, "STRESS CLEAR") == 0)
+	{
+		const int32 Destroyed = FStressSceneGenerator::Clear(GWorld);
+		AddLog("Destroy requested for %d stress actors", Destroyed);
+	}
 	else if (Stricmp(command_line, "SKINNING") == 0)
 	{
 		AddLog("SKINNING CPU");
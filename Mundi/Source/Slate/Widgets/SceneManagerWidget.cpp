@@ -27,10 +27,20 @@ USceneManagerWidget::USceneManagerWidget()
 	, SelectionManager(nullptr)
 {
 	LoadIcons();
+
+	ActorAddedHandle = UWorld::OnActorAdded.AddDynamic(this, &USceneManagerWidget::OnWorldActorAdded);
+	ActorRemovedHandle = UWorld::OnActorRemoved.AddDynamic(this, &USceneManagerWidget::OnWorldActorRemoved);
+	LevelChangedHandle = UWorld::OnLevelChanged.AddDynamic(this, &USceneManagerWidget::OnWorldLevelChanged);
+	WorldDestroyedHandle = UWorld::OnWorldDestroyed.AddDynamic(this, &USceneManagerWidget::OnWorldDestroyed);
 }
 
 USceneManagerWidget::~USceneManagerWidget()
 {
+	UWorld::OnActorAdded.Remove(ActorAddedHandle);
+	UWorld::OnActorRemoved.Remove(ActorRemovedHandle);
+	UWorld::OnLevelChanged.Remove(LevelChangedHandle);
+	UWorld::OnWorldDestroyed.Remove(WorldDestroyedHandle);
+
 	ClearActorTree();
 }
 
@@ -46,76 +56,38 @@ void USceneManagerWidget::LoadIcons()
 
 void USceneManagerWidget::Update()
 {
-	// 지연된 새로고침 처리 (렌더링 중 iterator invalidation 방지)
-	if (bNeedRefreshNextFrame)
+	UWorld* World = GWorld;
+
+	// 월드가 바뀌었거나(PIE 시작/종료) 레벨이 통째로 교체됐으면 전체 재구성
+	if (World != BoundWorld || bNeedRefreshNextFrame)
 	{
 		RefreshActorTree();
 		bNeedRefreshNextFrame = false;
 		return; // 이번 프레임은 새로고침만 하고 끝
 	}
 
-	// 액터 수 변화 감지만 수행 (최소한의 검사)
-	static size_t LastActorCount = 0;
-
-	UWorld* World = GWorld;
-	static ULevel* LastLevel = nullptr; // 레벨이 새로 로드됐는지 감지하기 위함.
-
-	if (World)
+	if (!World)
 	{
-		size_t CurrentActorCount = World->GetActors().size();
-		ULevel* CurrentLevel = World->GetLevel();
-		if (CurrentActorCount != LastActorCount || CurrentLevel != LastLevel)
-		{
-			RefreshActorTree();
-			LastActorCount = CurrentActorCount;
-			LastLevel = CurrentLevel;
-			return; // 새로고침 후 이번 프레임은 더 이상 처리하지 않음
-		}
-
-		// 비용이 많이 드는 유효성 검사를 5초마다만 수행
-		static int32 ValidationCounter = 0;
-		ValidationCounter++;
-		if (ValidationCounter % 300 == 0) // 5초마다 (60FPS 기준)
-		{
-			// 느린 유효성 검사 - 몇 개만 샘플링
-			bool bNeedRefresh = false;
-			const TArray<AActor*>& WorldActors = World->GetActors();
-
-			// 전체 검사 대신 몇 개만 샘플링
-			int32 CheckCount = 0;
-			for (auto* RootNode : RootNodes)
-			{
-				if (++CheckCount > 10) break; // 최대 10개만 검사
-
-				if (RootNode && RootNode->IsActor())
-				{
-					if (!RootNode->Actor ||
-						std::find(WorldActors.begin(), WorldActors.end(), RootNode->Actor) == WorldActors.end())
-					{
-						bNeedRefresh = true;
-						break;
-					}
-				}
-			}
-
-			if (bNeedRefresh)
-			{
-				RequestDelayedRefresh();
-				return;
-			}
-		}
+		return;
 	}
-	else if (LastActorCount != 0)
+
+	// 이벤트를 거치지 않고 레벨에 직접 들어간 액터가 있으면 재구성 (개수 비교만, O(1))
+	if (NodeByActor.Num() != World->GetActors().Num())
 	{
 		RefreshActorTree();
-		LastActorCount = 0;
+		return;
+	}
+
+	// 선택 목록만 보기 필터는 선택이 바뀔 때마다 결과가 달라지므로 매 프레임 재구성
+	if (bRowsDirty || bShowOnlySelectedObjects)
+	{
+		RebuildVisibleRows();
 	}
 
 	// Sync selection from viewport
 	SyncSelectionFromViewport();
 
 	// 정기적으로 SelectionManager 정리 (매 프레임마다 하지 않고 가끔씩)
-	static int32 CleanupCounter = 0;
 	CleanupCounter++;
 	if (CleanupCounter % 60 == 0) // 약 1초마다
 	{
@@ -149,24 +121,42 @@ void USceneManagerWidget::RenderWidget()
 	}
 	else
 	{
-		// 빠른 렌더링 - 중복 검사 없이 바로 출력
-		for (auto* RootNode : RootNodes)
+		// 행 가상화: 스크롤 영역에 보이는 행만 위젯을 만든다 (모든 행은 같은 높이의 단일 행)
+		const float RowHeight = GetRowContentHeight() + ImGui::GetStyle().ItemSpacing.y;
+
+		if (PendingScrollRow >= 0)
 		{
-			if (RootNode)
+			const float RowTop = PendingScrollRow * RowHeight;
+			const float ViewTop = ImGui::GetScrollY();
+			const float ViewHeight = ImGui::GetWindowHeight();
+			if (RowTop < ViewTop || RowTop + RowHeight > ViewTop + ViewHeight)
 			{
-				// Categories are always shown, individual actors are filtered
-				if (RootNode->IsCategory() || ShouldShowActor(RootNode->Actor))
-				{
-					RenderActorNode(RootNode);
-				}
+				ImGui::SetScrollY(std::max(0.0f, RowTop - ViewHeight * 0.5f));
+			}
+			PendingScrollRow = -1;
+		}
+
+		ImGuiListClipper Clipper;
+		Clipper.Begin(VisibleRows.Num(), RowHeight);
+		while (Clipper.Step())
+		{
+			for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; ++Row)
+			{
+				RenderActorNode(VisibleRows[Row], World);
 			}
 		}
+		Clipper.End();
 	}
 
 	ImGui::EndChild();
 
 	ImGui::Dummy(ImVec2(0, 1.0f));
 	ImGui::Text("%zu개 액터", World->GetActors().size());
+	if (VisibleRows.Num() != NodeByActor.Num())
+	{
+		ImGui::SameLine();
+		ImGui::Text("(%d개 표시)", VisibleRows.Num());
+	}
 
 	// Status bar
 	ImGui::SameLine();
@@ -200,23 +190,139 @@ void USceneManagerWidget::RenderWidget()
 
 void USceneManagerWidget::RefreshActorTree()
 {
-	UWorld* World = GWorld;
-	if (!World)
-	{
-		ClearActorTree();
-		return;
-	}
+	BoundWorld = GWorld;
 
 	// Clear existing tree
 	ClearActorTree();
 
+	if (!BoundWorld)
+	{
+		return;
+	}
+
 	// Build new hierarchy
 	BuildActorHierarchy();
+	RebuildVisibleRows();
+}
+
+USceneManagerWidget::FActorTreeNode* USceneManagerWidget::AddActorNode(AActor* Actor)
+{
+	FActorTreeNode* ActorNode = new FActorTreeNode(Actor);
+	ActorNode->Parent = nullptr;
+	// Initialize node visibility from actor's actual visibility state
+	ActorNode->bIsVisible = Actor->IsActorVisible();
+	RootNodes.Add(ActorNode);
+	NodeByActor.Add(Actor, ActorNode);
+	return ActorNode;
+}
+
+void USceneManagerWidget::RebuildVisibleRows()
+{
+	// 월드에서 제거된(분리된) 노드를 순서를 유지하며 정리
+	int32 WriteIndex = 0;
+	for (int32 i = 0; i < RootNodes.Num(); ++i)
+	{
+		FActorTreeNode* Node = RootNodes[i];
+		if (Node->IsActor() && !Node->Actor)
+		{
+			delete Node;
+			continue;
+		}
+		RootNodes[WriteIndex++] = Node;
+	}
+	RootNodes.SetNum(WriteIndex);
+
+	VisibleRows.Empty();
+	VisibleRows.Reserve(RootNodes.Num());
+	for (FActorTreeNode* Node : RootNodes)
+	{
+		// Categories are always shown, individual actors are filtered
+		if (Node->IsCategory() || ShouldShowActor(Node->Actor))
+		{
+			Node->RowIndex = VisibleRows.Num();
+			VisibleRows.Add(Node);
+		}
+		else
+		{
+			Node->RowIndex = -1;
+		}
+	}
+
+	bRowsDirty = false;
+}
+
+void USceneManagerWidget::OnWorldActorAdded(UWorld* World, AActor* Actor)
+{
+	if (World != BoundWorld || !Actor || bNeedRefreshNextFrame || NodeByActor.Contains(Actor))
+		return;
+
+	FActorTreeNode* Node = AddActorNode(Actor);
+
+	// 보이는 행 목록이 최신이면 끝에 붙이기만 한다 (전체 재구성 없음)
+	if (!bRowsDirty && ShouldShowActor(Actor))
+	{
+		Node->RowIndex = VisibleRows.Num();
+		VisibleRows.Add(Node);
+	}
+}
+
+void USceneManagerWidget::OnWorldActorRemoved(UWorld* World, AActor* Actor)
+{
+	if (World != BoundWorld)
+		return;
+
+	FActorTreeNode** Found = NodeByActor.Find(Actor);
+	if (!Found)
+		return;
+
+	// 노드는 분리만 해두고 실제 삭제/행 압축은 다음 Update에서 한 번에 처리
+	(*Found)->Actor = nullptr;
+	NodeByActor.Remove(Actor);
+	bRowsDirty = true;
+
+	if (LastSyncedSelection == Actor)
+	{
+		LastSyncedSelection = nullptr;
+	}
+}
+
+void USceneManagerWidget::OnWorldLevelChanged(UWorld* World)
+{
+	if (World != BoundWorld)
+		return;
+
+	// 기존 액터가 곧 삭제되므로 포인터를 모두 끊고 다음 프레임에 재구성
+	DetachAllNodes();
+	bNeedRefreshNextFrame = true;
+}
+
+void USceneManagerWidget::OnWorldDestroyed(UWorld* World)
+{
+	if (World != BoundWorld)
+		return;
+
+	DetachAllNodes();
+	BoundWorld = nullptr;
+	bNeedRefreshNextFrame = true;
+}
+
+void USceneManagerWidget::DetachAllNodes()
+{
+	for (FActorTreeNode* Node : RootNodes)
+	{
+		if (Node->IsActor())
+		{
+			Node->Actor = nullptr;
+		}
+	}
+	NodeByActor.Empty();
+	bRowsDirty = true;
+	LastSyncedSelection = nullptr;
 }
 
 void USceneManagerWidget::BuildActorHierarchy()
 {
-	UWorld* World = GWorld;
+	UWorld* World = BoundWorld;
 	if (!World)
 		return;
 
@@ -224,7 +330,12 @@ void USceneManagerWidget::BuildActorHierarchy()
 	BuildCategorizedHierarchy();
 }
 
-void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
+float USceneManagerWidget::GetRowContentHeight() const
+{
+	return std::max(IconSize, ImGui::GetFontSize()) + ImGui::GetStyle().FramePadding.y * 2.0f;
+}
+
+void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, UWorld* World, int32 Depth)
 {
 	if (!Node)
 		return;
@@ -232,34 +343,26 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
 	// Handle category nodes
 	if (Node->IsCategory())
 	{
-		RenderCategoryNode(Node, Depth);
+		RenderCategoryNode(Node, World, Depth);
 		return;
 	}
 
-	// Handle actor nodes
-	if (!Node->Actor)
-		return; // 이미 사전 검사에서 걸러졌어야 하지만 방어 코드
-
+	// 클리퍼는 VisibleRows 한 칸 = 한 행으로 스크롤 범위를 잡으므로, 행 목록을 만든 뒤 분리/삭제 예약/필터 제외된
+	// 액터도 같은 높이의 빈 행을 차지해야 한다 (다음 RebuildVisibleRows 또는 OnActorRemoved에서 행이 정리됨)
 	AActor* Actor = Node->Actor;
-
-	// 중요: 액터가 이미 삭제되었는지 확인 (IsPendingDestroy 체크)
-	if (Actor->IsPendingDestroy())
+	if (!ShouldShowActor(Actor))
 	{
-		RequestDelayedRefresh(); // 다음 프레임에 트리 새로고침 요청
+		ImGui::Dummy(ImVec2(0.0f, GetRowContentHeight()));
 		return;
 	}
 
-	// Skip if doesn't pass filters
-	if (!ShouldShowActor(Actor))
-		return;
-
 	ImGuiTreeNodeFlags NodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth;
 
 	// Check if selected
 	bool bIsSelected = false;
-	if (UWorld* W = GWorld)
+	if (World)
 	{
-		bIsSelected = W->GetSelectionManager()->IsActorSelected(Actor);
+		bIsSelected = World->GetSelectionManager()->IsActorSelected(Actor);
 	}
 	if (bIsSelected)
 	{
@@ -366,7 +469,7 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
 	{
 		for (FActorTreeNode* Child : Node->Children)
 		{
-			RenderActorNode(Child, Depth + 1);
+			RenderActorNode(Child, World, Depth + 1);
 		}
 	}
 
@@ -380,12 +483,17 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
 
 bool USceneManagerWidget::ShouldShowActor(AActor* Actor) const
 {
-	if (!Actor)
+	// 삭제 예약된 액터는 행을 만들지 않는다 (실제 제거 시 OnActorRemoved 이벤트로 노드가 정리됨)
+	if (!Actor || Actor->IsPendingDestroy())
 		return false;
 
 	// Filter by selection
-	if (bShowOnlySelectedObjects && !SelectionManager->IsActorSelected(Actor))
-		return false;
+	if (bShowOnlySelectedObjects)
+	{
+		USelectionManager* Selection = BoundWorld ? BoundWorld->GetSelectionManager() : nullptr;
+		if (!Selection || !Selection->IsActorSelected(Actor))
+			return false;
+	}
 
 	return true;
 }
@@ -519,6 +627,11 @@ void USceneManagerWidget::ClearActorTree()
 		delete Node;
 	}
 	RootNodes.clear();
+	NodeByActor.Empty();
+	VisibleRows.Empty();
+	bRowsDirty = false;
+	LastSyncedSelection = nullptr;
+	PendingScrollRow = -1;
 }
 
 USceneManagerWidget::FActorTreeNode* USceneManagerWidget::FindNodeByActor(AActor* Actor)
@@ -526,28 +639,8 @@ USceneManagerWidget::FActorTreeNode* USceneManagerWidget::FindNodeByActor(AActor
 	if (!Actor)
 		return nullptr;
 
-	// Search through categories and their children
-	for (FActorTreeNode* RootNode : RootNodes)
-	{
-		if (!RootNode)
-			continue;
-
-		// Check if this root node is the actor (for backward compatibility)
-		if (RootNode->IsActor() && RootNode->Actor == Actor)
-			return RootNode;
-
-		// Search within category children
-		if (RootNode->IsCategory())
-		{
-			for (FActorTreeNode* Child : RootNode->Children)
-			{
-				if (Child && Child->IsActor() && Child->Actor == Actor)
-					return Child;
-			}
-		}
-	}
-
-	return nullptr;
+	FActorTreeNode** Found = NodeByActor.Find(Actor);
+	return Found ? *Found : nullptr;
 }
 
 void USceneManagerWidget::SyncSelectionFromViewport()
@@ -564,8 +657,14 @@ void USceneManagerWidget::SyncSelectionFromViewport()
 	{
 		SelectedActor = W->GetSelectionManager()->GetSelectedActor();
 	}
-	if (!SelectedActor)
+	// 뷰포트에서 선택이 바뀌었으면 해당 행이 보이도록 스크롤 예약
+	if (SelectedActor != LastSyncedSelection)
 	{
+		LastSyncedSelection = SelectedActor;
+		if (FActorTreeNode* Node = FindNodeByActor(SelectedActor))
+		{
+			PendingScrollRow = Node->RowIndex;
+		}
 	}
 }
 
@@ -611,24 +710,22 @@ USceneManagerWidget::FActorTreeNode* USceneManagerWidget::FindOrCreateCategoryNo
 
 void USceneManagerWidget::BuildCategorizedHierarchy()
 {
-	UWorld* World = GWorld;
+	UWorld* World = BoundWorld;
 	if (!World)
 		return;
 
 	const TArray<AActor*>& Actors = World->GetActors();
+	RootNodes.Reserve(Actors.Num());
+	NodeByActor.reserve(Actors.Num());
 
 	// Group actors by category
 	for (AActor* Actor : Actors)
 	{
-		if (!Actor)
+		if (!Actor || NodeByActor.Contains(Actor))
 			continue;
 
 		// Create actor node and add to category
-		FActorTreeNode* ActorNode = new FActorTreeNode(Actor);
-		ActorNode->Parent = nullptr;
-		// Initialize node visibility from actor's actual visibility state
-		ActorNode->bIsVisible = Actor->IsActorVisible();
-		RootNodes.Add(ActorNode);
+		AddActorNode(Actor);
 	}
 
 	// Initialize category visibility based on child actors
@@ -687,7 +784,7 @@ void USceneManagerWidget::HandleCategoryVisibilityToggle(FActorTreeNode* Categor
 		CategoryNode->bIsVisible ? "Visible" : "Hidden");
 }
 
-void USceneManagerWidget::RenderCategoryNode(FActorTreeNode* CategoryNode, int32 Depth)
+void USceneManagerWidget::RenderCategoryNode(FActorTreeNode* CategoryNode, UWorld* World, int32 Depth)
 {
 	if (!CategoryNode || !CategoryNode->IsCategory())
 		return;
@@ -758,7 +855,7 @@ void USceneManagerWidget::RenderCategoryNode(FActorTreeNode* CategoryNode, int32
 	{
 		for (FActorTreeNode* Child : CategoryNode->Children)
 		{
-			RenderActorNode(Child, Depth + 1);
+			RenderActorNode(Child, World, Depth + 1);
 		}
 		ImGui::TreePop();
 	}
@@ -2,6 +2,7 @@
 #include "Widget.h"
 #include "Vector.h"
 #include "UEContainer.h"
+#include "Delegates.h"
 
 class UUIManager;
 class UWorld;
@@ -15,6 +16,8 @@ class UTexture;
  * - Shows all actors in the world in a tree view
  * - Supports selection, visibility toggle, hierarchy management
  * - Syncs with 3D viewport selection
+ * - Incrementally updated from UWorld actor add/remove events
+ * - Only the rows inside the scroll view are built (ImGuiListClipper)
  */
 class USceneManagerWidget : public UWidget
 {
@@ -59,6 +62,7 @@ private:
         FActorTreeNode* Parent = nullptr;
         bool bIsExpanded = true;
         bool bIsVisible = true;
+        int32 RowIndex = -1;    // VisibleRows 내 위치 (필터에 걸리면 -1)
         
         // Constructor for Actor node
         FActorTreeNode(AActor* InActor) : NodeType(ETreeNodeType::Actor), Actor(InActor) {}
@@ -80,13 +84,38 @@ private:
         FString GetDisplayName() const;
     };
     
-    TArray<FActorTreeNode*> RootNodes;
+    TArray<FActorTreeNode*> RootNodes;          // 월드 액터 순서대로 (삭제된 노드는 Update에서 압축)
+    TMap<AActor*, FActorTreeNode*> NodeByActor;  // O(1) 액터 -> 노드 조회
+    TArray<FActorTreeNode*> VisibleRows;        // 필터를 통과한 행 (가상화 렌더링 대상)
+    bool bRowsDirty = false;                    // 노드 제거/필터 변경으로 VisibleRows 재구성 필요
+
+    // 이벤트를 구독 중인 월드 (GWorld가 바뀌면 전체 재구성)
+    UWorld* BoundWorld = nullptr;
+    FDelegateHandle ActorAddedHandle = 0;
+    FDelegateHandle ActorRemovedHandle = 0;
+    FDelegateHandle LevelChangedHandle = 0;
+    FDelegateHandle WorldDestroyedHandle = 0;
+
+    // 월드 이벤트 핸들러
+    void OnWorldActorAdded(UWorld* World, AActor* Actor);
+    void OnWorldActorRemoved(UWorld* World, AActor* Actor);
+    void OnWorldLevelChanged(UWorld* World);
+    void OnWorldDestroyed(UWorld* World);
+    void DetachAllNodes();
+    void RebuildVisibleRows();
+    FActorTreeNode* AddActorNode(AActor* Actor);
+
+    // 뷰포트에서 선택이 바뀌면 해당 행으로 스크롤
+    AActor* LastSyncedSelection = nullptr;
+    int32 PendingScrollRow = -1;
+    int32 CleanupCounter = 0;
     
     // Helper Methods
     void RefreshActorTree();
     void BuildActorHierarchy();
-    void RenderActorNode(FActorTreeNode* Node, int32 Depth = 0);
-    void RenderCategoryNode(FActorTreeNode* CategoryNode, int32 Depth = 0);
+    void RenderActorNode(FActorTreeNode* Node, UWorld* World, int32 Depth = 0);
+    void RenderCategoryNode(FActorTreeNode* CategoryNode, UWorld* World, int32 Depth = 0);
+    float GetRowContentHeight() const;   // 행 하나의 높이 (ItemSpacing 제외). 클리퍼와 빈 행이 같은 값을 쓴다
     bool ShouldShowActor(AActor* Actor) const;
     void HandleActorSelection(AActor* Actor);
     void HandleActorVisibilityToggle(AActor* Actor);
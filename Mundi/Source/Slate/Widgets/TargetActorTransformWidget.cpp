@@ -28,6 +28,7 @@
 #include "PointLightComponent.h"
 #include "SpotLightComponent.h"
 #include "SceneComponent.h"
+#include "PrefabRegistry.h"
 #include "Color.h"
 #include "PlatformProcess.h"
 #include "JsonSerializer.h"
@@ -342,6 +343,11 @@ void UTargetActorTransformWidget::RenderHeader(AActor* SelectedActor, UActorComp
 		ActorJson["Type"] = SelectedActor->GetClass()->Name;
 		SelectedActor->Serialize(false, ActorJson);
 		bool bSuccess = FJsonSerializer::SaveJsonToFile(ActorJson, PrefabPath);
+		if (bSuccess)
+		{
+			// 같은 경로의 캐시된 템플릿은 다음 스폰에서 새 내용으로 다시 컴파일
+			FPrefabRegistry::GetInstance().Invalidate(PrefabPath.wstring());
+		}
 	}
 
 	ImGui::SameLine();
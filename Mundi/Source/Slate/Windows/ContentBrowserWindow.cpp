@@ -12,7 +12,8 @@
 IMPLEMENT_CLASS(UContentBrowserWindow)
 
 UContentBrowserWindow::UContentBrowserWindow()
-	: SelectedFile(nullptr)
+	: DisplayedGeneration(0)
+	, SelectedFile(nullptr)
 	, SelectedIndex(-1)
 	, LastClickTime(0.0)
 	, LastClickedIndex(-1)
@@ -41,6 +42,7 @@ UContentBrowserWindow::UContentBrowserWindow()
 	// 루트 경로를 Data 폴더로 설정
 	RootPath = std::filesystem::current_path() / "Data";
 	CurrentPath = RootPath;
+	CurrentRegistryPath = GDataDir;
 }
 
 UContentBrowserWindow::~UContentBrowserWindow()
@@ -74,6 +76,12 @@ void UContentBrowserWindow::RenderWindow()
 
 	if (ImGui::Begin(GetConfig().WindowTitle.c_str(), &bIsOpen, GetConfig().WindowFlags))
 	{
+		// 레지스트리가 갱신됐으면 목록 재구성 (워커 폴링 결과는 엔진 Tick에서 채택됨)
+		if (FAssetRegistry::Get().GetGeneration() != DisplayedGeneration)
+		{
+			RefreshCurrentDirectory();
+		}
+
 		// 실제 UI 컨텐츠 렌더링
 		RenderPathBar();
 		RenderContentGrid();
@@ -95,9 +103,11 @@ void UContentBrowserWindow::Cleanup()
 
 void UContentBrowserWindow::NavigateToPath(const std::filesystem::path& NewPath)
 {
-	if (std::filesystem::exists(NewPath) && std::filesystem::is_directory(NewPath))
+	const FString RegistryPath = FAssetRegistry::ToRegistryPath(WideToUTF8(NewPath.wstring()));
+	if (FAssetRegistry::Get().FindDirectory(RegistryPath))
 	{
 		CurrentPath = NewPath;
+		CurrentRegistryPath = RegistryPath;
 		RefreshCurrentDirectory();
 		SelectedIndex = -1;
 		SelectedFile = nullptr;
@@ -106,40 +116,59 @@ void UContentBrowserWindow::NavigateToPath(const std::filesystem::path& NewPath)
 
 void UContentBrowserWindow::RefreshCurrentDirectory()
 {
+	// 선택 항목은 경로로 기억했다가 재구성 후 다시 찾는다
+	const FString SelectedPath = SelectedFile ? SelectedFile->RegistryPath : FString();
+	SelectedFile = nullptr;
+	SelectedIndex = -1;
+
 	DisplayedFiles.clear();
 
-	if (!std::filesystem::exists(CurrentPath))
+	FAssetRegistry& Registry = FAssetRegistry::Get();
+	DisplayedGeneration = Registry.GetGeneration();
+
+	const FAssetDirectoryEntry* Dir = Registry.FindDirectory(CurrentRegistryPath);
+	if (!Dir)
 	{
-		UE_LOG("ContentBrowserWindow: Path does not exist: %s", CurrentPath.string().c_str());
+		UE_LOG("ContentBrowserWindow: Path does not exist: %s", CurrentRegistryPath.c_str());
 		CurrentPath = RootPath;
+		CurrentRegistryPath = GDataDir;
 		return;
 	}
 
-	try
+	// 오른쪽 패널에는 파일만 표시 (폴더는 왼쪽 트리에 표시됨)
+	if (bShowFiles)
 	{
-		// 오른쪽 패널에는 파일만 표시 (폴더는 왼쪽 트리에 표시됨)
-		if (bShowFiles)
+		DisplayedFiles.reserve(Dir->Files.Num());
+		for (const FString& FilePath : Dir->Files)
 		{
-			for (const auto& entry : std::filesystem::directory_iterator(CurrentPath))
+			const FAssetFileEntry* File = Registry.FindFile(FilePath);
+			if (!File)
 			{
-				if (entry.is_regular_file())
-				{
-					FFileEntry FileEntry;
-					FileEntry.Path = entry.path();
-					FileEntry.FileName = FString(entry.path().filename().string().c_str());
-					FileEntry.Extension = FString(entry.path().extension().string().c_str());
-					FileEntry.bIsDirectory = false;
-					FileEntry.FileSize = std::filesystem::file_size(entry.path());
-					DisplayedFiles.push_back(FileEntry);
-				}
+				continue;
 			}
-		}
 
-		UE_LOG("ContentBrowserWindow: Loaded %d items from %s", DisplayedFiles.size(), CurrentPath.string().c_str());
+			FFileEntry FileEntry;
+			FileEntry.Path = CurrentPath / UTF8ToWide(File->FileName);
+			FileEntry.FileName = File->FileName;
+			FileEntry.Extension = File->Extension;
+			FileEntry.RegistryPath = File->Path;
+			FileEntry.bIsDirectory = false;
+			FileEntry.FileSize = File->FileSize;
+			FileEntry.LastWriteTime = File->LastWriteTime;
+			FileEntry.Type = File->Type;
+			FileEntry.ThumbnailKey = File->ThumbnailKey;
+			DisplayedFiles.push_back(FileEntry);
+		}
 	}
-	catch (const std::exception& e)
+
+	for (int32 i = 0; i < static_cast<int32>(DisplayedFiles.size()); ++i)
 	{
-		UE_LOG("ContentBrowserWindow: Error reading directory: %s", e.what());
+		if (!SelectedPath.empty() && DisplayedFiles[i].RegistryPath == SelectedPath)
+		{
+			SelectedIndex = i;
+			SelectedFile = &DisplayedFiles[i];
+			break;
+		}
 	}
 }
 
@@ -199,67 +228,49 @@ void UContentBrowserWindow::RenderFolderTree()
 	ImGui::Text("Folders");
 	ImGui::Separator();
 
-	// 루트 폴더부터 재귀적으로 렌더링
-	if (std::filesystem::exists(RootPath))
+	// 루트 폴더부터 재귀적으로 렌더링 (파일 시스템 호출 없이 레지스트리 스냅샷만 사용)
+	if (const FAssetDirectoryEntry* Root = FAssetRegistry::Get().FindDirectory(GDataDir))
 	{
-		RenderFolderTreeNode(RootPath);
+		RenderFolderTreeNode(*Root);
 	}
 }
 
-void UContentBrowserWindow::RenderFolderTreeNode(const std::filesystem::path& FolderPath)
+void UContentBrowserWindow::RenderFolderTreeNode(const FAssetDirectoryEntry& Folder)
 {
-	try
-	{
-		// 폴더 이름 가져오기
-		FString folderName = FolderPath == RootPath ? "Data" : FString(FolderPath.filename().string().c_str());
+	FAssetRegistry& Registry = FAssetRegistry::Get();
+	const bool hasSubFolders = !Folder.SubDirectories.IsEmpty();
 
-		// 하위 폴더 확인
-		bool hasSubFolders = false;
-		for (const auto& entry : std::filesystem::directory_iterator(FolderPath))
-		{
-			if (entry.is_directory())
-			{
-				hasSubFolders = true;
-				break;
-			}
-		}
-
-		// 트리 노드 플래그
-		ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
-		if (!hasSubFolders)
-		{
-			flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
-		}
-		if (FolderPath == CurrentPath)
-		{
-			flags |= ImGuiTreeNodeFlags_Selected;
-		}
+	// 트리 노드 플래그
+	ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
+	if (!hasSubFolders)
+	{
+		flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+	}
+	if (Folder.Path == CurrentRegistryPath)
+	{
+		flags |= ImGuiTreeNodeFlags_Selected;
+	}
 
-		// 트리 노드 렌더링
-		bool nodeOpen = ImGui::TreeNodeEx(folderName.c_str(), flags);
+	// 트리 노드 렌더링 (ID는 경로 기준이라 같은 이름의 폴더도 구분됨)
+	bool nodeOpen = ImGui::TreeNodeEx(Folder.Path.c_str(), flags, "%s", Folder.Name.c_str());
 
-		// 클릭 시 해당 폴더로 이동
-		if (ImGui::IsItemClicked())
-		{
-			NavigateToPath(FolderPath);
-		}
+	// 클릭 시 해당 폴더로 이동
+	if (ImGui::IsItemClicked())
+	{
+		NavigateToPath(std::filesystem::current_path() / UTF8ToWide(Folder.Path));
+	}
 
-		// 하위 폴더 렌더링
-		if (nodeOpen && hasSubFolders)
+	// 하위 폴더 렌더링
+	if (nodeOpen && hasSubFolders)
+	{
+		for (const FString& SubDirPath : Folder.SubDirectories)
 		{
-			for (const auto& entry : std::filesystem::directory_iterator(FolderPath))
+			if (const FAssetDirectoryEntry* SubDir = Registry.FindDirectory(SubDirPath))
 			{
-				if (entry.is_directory())
-				{
-					RenderFolderTreeNode(entry.path());
-				}
+				RenderFolderTreeNode(*SubDir);
 			}
-			ImGui::TreePop();
 		}
-	}
-	catch (const std::exception& e)
-	{
-		UE_LOG("Error rendering folder tree node: %s", e.what());
+		ImGui::TreePop();
 	}
 }
 
@@ -286,7 +297,15 @@ void UContentBrowserWindow::RenderPathBar()
 	ImGui::SameLine(ImGui::GetWindowWidth() - 100);
 	if (ImGui::Button("Refresh"))
 	{
-		RefreshCurrentDirectory();
+		// 워커에게 즉시 폴링 요청 (결과는 다음 Tick에 반영)
+		FAssetRegistry::Get().RequestRefresh();
+	}
+	if (ImGui::IsItemHovered())
+	{
+		const FThumbnailStats Stats = FThumbnailManager::GetInstance().GetStats();
+		ImGui::SetTooltip("Thumbnails: %d resident (%.1f / %.1f MB), %d pending\nDecoded %llu, disk cache hits %llu, evicted %llu",
+			Stats.ResidentCount, Stats.ResidentBytes / (1024.0 * 1024.0), Stats.BudgetBytes / (1024.0 * 1024.0), Stats.PendingCount,
+			Stats.Decodes, Stats.DiskCacheHits, Stats.Evictions);
 	}
 
 	ImGui::Separator();
@@ -351,7 +370,7 @@ void UContentBrowserWindow::RenderFileItem(FFileEntry& Entry, int Index, bool bU
 	{
 		// 썸네일 가져오기
 		std::string pathStr = Entry.Path.string();
-		ID3D11ShaderResourceView* thumbnailSRV = FThumbnailManager::GetInstance().GetThumbnail(pathStr);
+		ID3D11ShaderResourceView* thumbnailSRV = FThumbnailManager::GetInstance().GetThumbnail(pathStr, Entry.ThumbnailKey);
 
 		if (thumbnailSRV)
 		{
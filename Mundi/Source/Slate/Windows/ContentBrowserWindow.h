@@ -2,6 +2,7 @@
 
 #pragma once
 #include "UIWindow.h"
+#include "AssetRegistry.h"
 #include <filesystem>
 #include <vector>
 
@@ -17,11 +18,15 @@ struct FFileEntry
 	std::filesystem::path Path;        // 전체 경로
 	FString FileName;                  // 파일 이름
 	FString Extension;                 // 확장자
+	FString RegistryPath;              // 에셋 레지스트리 경로 (예: "Data/Textures/a.png")
 	bool bIsDirectory;                 // 디렉토리 여부
 	uintmax_t FileSize;               // 파일 크기 (바이트)
+	int64 LastWriteTime;               // 수정 시각 (레지스트리 값)
+	EAssetFileType Type;               // 확장자 분류
+	uint64 ThumbnailKey;               // 경로+크기+수정 시각 해시 (썸네일 캐시 키)
 
 	FFileEntry()
-		: bIsDirectory(false), FileSize(0)
+		: bIsDirectory(false), FileSize(0), LastWriteTime(0), Type(EAssetFileType::Other), ThumbnailKey(0)
 	{}
 };
 
@@ -52,7 +57,7 @@ public:
 	void NavigateToPath(const std::filesystem::path& NewPath);
 
 	/**
-	 * @brief 현재 디렉토리 새로고침
+	 * @brief 현재 디렉토리 목록을 에셋 레지스트리 스냅샷에서 다시 구성 (디스크 접근 없음)
 	 */
 	void RefreshCurrentDirectory();
 
@@ -108,12 +113,14 @@ private:
 	void RenderFolderTree();
 
 	/**
-	 * @brief 재귀적으로 폴더 트리 노드 렌더링
+	 * @brief 재귀적으로 폴더 트리 노드 렌더링 (레지스트리 메모리만 읽음)
 	 */
-	void RenderFolderTreeNode(const std::filesystem::path& FolderPath);
+	void RenderFolderTreeNode(const FAssetDirectoryEntry& Folder);
 
 private:
 	std::filesystem::path CurrentPath;        // 현재 탐색 중인 경로
+	FString CurrentRegistryPath;              // CurrentPath의 레지스트리 경로 (트리 선택 비교용)
+	uint32 DisplayedGeneration;               // DisplayedFiles를 만든 레지스트리 세대
 	std::filesystem::path RootPath;           // 루트 경로 (Data/)
 	TArray<FFileEntry> DisplayedFiles;        // 현재 표시 중인 파일 목록
 	TArray<std::filesystem::path> FolderList; // 왼쪽 패널의 폴더 목록
@@ -4,6 +4,8 @@
 // Uncomment to enable DDS texture caching (faster loading, uses Data/TextureCache/)
 #define USE_DDS_CACHE
 #define USE_OBJ_CACHE
+// Comment out to compile TIME_PROFILE scopes away entirely (CpuProfiler)
+#define USE_CPU_PROFILER
 
 #define IMGUI_DEFINE_MATH_OPERATORS	// Imgui에서 곡선 표시를 위한 전용 벡터 연산자 활성화
 